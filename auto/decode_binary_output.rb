@@ -0,0 +1,154 @@
+# =========================================================================
+#   Unity - A Test Framework for C
+#   ThrowTheSwitch.org
+#   Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+#   SPDX-License-Identifier: MIT
+# =========================================================================
+
+#============================================================
+#  Turns the records written by a test built with UNITY_OUTPUT_BINARY back
+#  into the text Unity prints normally, so the result can be handed to
+#  parse_output.rb, stylize_as_junit.rb or read by a person.
+#
+#    ruby decode_binary_output.rb [--tokens tokens.db] [input [output]]
+#
+#  Reads stdin and writes stdout when no files are given, so it can sit at
+#  the end of a pipe from the serial port or simulator. Tests built with
+#  UNITY_OUTPUT_TOKENIZED also need the database made by extract_tokens.rb.
+#============================================================
+
+require_relative 'extract_tokens'
+
+class UnityBinaryDecoder
+  HEADER   = 0
+  TEXT     = 1
+  STRING   = 2
+  LOCATION = 3
+  STATUS   = 4
+  INT      = 5
+  UINT     = 6
+  HEX      = 7
+  TOKEN    = 8
+
+  VERSION = 1
+  STATUS_WORDS = %w[OK PASS FAIL IGNORE].freeze
+  TOKEN_MARK = 1
+
+  def initialize(tokens = nil)
+    @strings = {}
+    @tokens = tokens ? tokens.strings : {}
+  end
+
+  # Decodes a whole binary string. A record cut short at the end is dropped.
+  def decode(data)
+    data = data.b
+    text = +''
+    pos = 0
+    while pos < data.bytesize
+      type = data.getbyte(pos)
+      length, pos = read_varint(data, pos + 1)
+      break if length.nil? || (pos + length > data.bytesize)
+
+      text << record(type, data.byteslice(pos, length))
+      pos += length
+    end
+    text
+  end
+
+  private
+
+  def read_varint(data, pos)
+    value = 0
+    shift = 0
+    while pos < data.bytesize
+      byte = data.getbyte(pos)
+      pos += 1
+      value |= (byte & 0x7F) << shift
+      return [value, pos] if (byte & 0x80).zero?
+
+      shift += 7
+    end
+    [nil, pos]
+  end
+
+  def read_varints(payload)
+    values = []
+    pos = 0
+    while pos < payload.bytesize
+      value, pos = read_varint(payload, pos)
+      values << value
+    end
+    values
+  end
+
+  def expand(token)
+    @tokens.fetch(token) { format('<token %08X>', token) }
+  end
+
+  # Names come as they are or, when tokenized, as the token mark and the token, seven bits
+  # to a byte
+  def name(str)
+    return str unless (str.bytesize == 6) && (str.getbyte(0) == TOKEN_MARK)
+
+    expand(str.bytes[1..].reverse.inject(0) { |token, b| (token << 7) | b })
+  end
+
+  # The same escaping UnityPrint applies to names
+  def printable(str)
+    str.each_byte.map do |c|
+      if c.between?(32, 126) then c.chr
+      elsif c == 13 then '\\r'
+      elsif c == 10 then '\\n'
+      else format('\\x%02X', c)
+      end
+    end.join
+  end
+
+  def record(type, payload)
+    case type
+    when HEADER
+      raise "Unsupported Unity binary protocol version #{payload.getbyte(5)}" unless payload.start_with?('UNITY') && payload.getbyte(5) == VERSION
+
+      @strings = {}
+      ''
+    when TEXT
+      payload
+    when STRING
+      id, pos = read_varint(payload, 0)
+      @strings[id] = payload.byteslice(pos..)
+      ''
+    when LOCATION
+      _index, file, line, test = read_varints(payload)
+      "#{printable(name(@strings.fetch(file, '')))}:#{line}:#{printable(name(@strings.fetch(test, '')))}:"
+    when STATUS
+      STATUS_WORDS[read_varints(payload).first] || ''
+    when INT
+      value = read_varints(payload).first
+      ((value >> 1) ^ -(value & 1)).to_s
+    when UINT
+      read_varints(payload).first.to_s
+    when HEX
+      value, = read_varint(payload, 1)
+      format("%0#{payload.getbyte(0)}X", value)
+    when TOKEN
+      expand(payload.unpack1('V'))
+    else
+      ''
+    end
+  end
+end
+
+if $0 == __FILE__
+  tokens = nil
+  if ARGV[0] == '--tokens'
+    ARGV.shift
+    tokens = UnityTokenDatabase.load(ARGV.shift)
+  end
+  input = ARGV[0] ? File.binread(ARGV[0]) : $stdin.binmode.read
+  text = UnityBinaryDecoder.new(tokens).decode(input)
+  if ARGV[1]
+    File.binwrite(ARGV[1], text)
+  else
+    $stdout.binmode.write(text)
+  end
+end
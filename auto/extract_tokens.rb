@@ -0,0 +1,176 @@
+# =========================================================================
+#   Unity - A Test Framework for C
+#   ThrowTheSwitch.org
+#   Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+#   SPDX-License-Identifier: MIT
+# =========================================================================
+
+#============================================================
+#  Builds the token database for tests built with UNITY_OUTPUT_TOKENIZED.
+#  Every string literal in the given C files (adjacent literals joined, as
+#  the compiler does) is hashed the same way UNITY_TOKEN does it, so pass
+#  it the test files, the generated runners and src/unity.c:
+#
+#    ruby extract_tokens.rb [-o tokens.db] [-s string ...] file.c [file.c ...]
+#
+#  Each line of the database is the token in hex and the string it stands
+#  for, quoted and escaped like a Ruby string. decode_binary_output.rb uses
+#  it to turn the tokens back into text. Test names that RUN_TEST makes
+#  with # are added too. Two strings with the same token can't be told
+#  apart, so the script reports them and fails.
+#============================================================
+
+class UnityTokenCollision < StandardError; end
+
+class UnityTokenDatabase
+  HASH_LENGTH = 32 # characters hashed from each end
+  HASH_K = 65599
+  MASK = 0xFFFFFFFF
+
+  attr_reader :strings
+
+  def self.token(str)
+    bytes = str.bytes
+    ends = (0...HASH_LENGTH).map { |i| bytes.fetch(i, 0) } +
+           (0...HASH_LENGTH).map { |i| i < bytes.size ? bytes[bytes.size - 1 - i] : 0 }
+    hash = bytes.size & MASK
+    coefficient = HASH_K
+    ends.each do |c|
+      hash = (hash + (coefficient * c)) & MASK
+      coefficient = (coefficient * HASH_K) & MASK
+    end
+    hash
+  end
+
+  def self.load(file_name)
+    db = new
+    File.foreach(file_name) do |line|
+      token, str = line.chomp.split(' ', 2)
+      db.strings[token.to_i(16)] = str.undump unless str.nil?
+    end
+    db
+  end
+
+  def initialize
+    @strings = {}
+  end
+
+  def add(str)
+    token = UnityTokenDatabase.token(str)
+    if @strings.key?(token) && @strings[token] != str
+      raise UnityTokenCollision, format('Token %08X stands for both %s and %s', token, @strings[token].dump, str.dump)
+    end
+
+    @strings[token] = str
+  end
+
+  def add_source(text)
+    c_string_literals(text).each { |str| add(str) }
+    text.scan(/\bRUN_TEST(?:_AT_LINE)?\s*\(\s*(\w+)/) { |name| add(name[0].b) }
+  end
+
+  def to_s
+    @strings.keys.sort.map { |token| format("%08X %s\n", token, @strings[token].dump) }.join
+  end
+
+  private
+
+  # A small C lexer: enough to skip comments and character constants and to
+  # join adjacent string literals
+  def c_string_literals(text)
+    literals = []
+    pos = 0
+    pending = nil
+    while pos < text.size
+      c = text[pos]
+      if text[pos, 2] == '/*'
+        pos = (text.index('*/', pos + 2) || text.size) + 2
+      elsif text[pos, 2] == '//'
+        pos = text.index("\n", pos) || text.size
+      elsif c == "'"
+        pos = skip_quoted(text, pos, "'")
+      elsif c == '"'
+        finish = skip_quoted(text, pos, '"')
+        pending = (pending || +'') << unescape(text[(pos + 1)...(finish - 1)])
+        pos = finish
+        next
+      elsif c =~ /\s/
+        pos += 1
+        next
+      else
+        pos += 1
+      end
+      literals << pending unless pending.nil?
+      pending = nil
+    end
+    literals << pending unless pending.nil?
+    literals
+  end
+
+  def skip_quoted(text, pos, quote)
+    pos += 1
+    while pos < text.size && text[pos] != quote && text[pos] != "\n"
+      pos += text[pos] == '\\' ? 2 : 1
+    end
+    pos + 1
+  end
+
+  ESCAPES = { 'n' => 10, 't' => 9, 'r' => 13, 'a' => 7, 'b' => 8, 'f' => 12, 'v' => 11, 'e' => 27 }.freeze
+
+  def unescape(body)
+    bytes = []
+    scanner = body.b
+    pos = 0
+    while pos < scanner.bytesize
+      c = scanner[pos]
+      if c != '\\'
+        bytes << c.ord
+        pos += 1
+      elsif (m = scanner[(pos + 1)..].match(/\A([0-7]{1,3})/))
+        bytes << (m[1].to_i(8) & 0xFF)
+        pos += 1 + m[1].size
+      elsif (m = scanner[(pos + 1)..].match(/\Ax([0-9A-Fa-f]+)/))
+        bytes << (m[1].to_i(16) & 0xFF)
+        pos += 2 + m[1].size
+      else
+        e = scanner[pos + 1]
+        bytes << (ESCAPES[e] || e.ord)
+        pos += 2
+      end
+    end
+    bytes.pack('C*')
+  end
+end
+
+if $0 == __FILE__
+  out_file = nil
+  db = UnityTokenDatabase.new
+  files = []
+  extra = []
+  until ARGV.empty?
+    arg = ARGV.shift
+    case arg
+    when '-o' then out_file = ARGV.shift
+    when '-s' then extra << ARGV.shift.b
+    else files << arg
+    end
+  end
+  if files.empty?
+    puts 'Usage: ruby extract_tokens.rb [-o tokens.db] [-s string ...] file.c [file.c ...]'
+    puts '  -s adds a string that is not a literal in any of the files, like a __FILE__ name'
+    exit 1
+  end
+
+  begin
+    extra.each { |str| db.add(str) }
+    files.each { |file_name| db.add_source(File.binread(file_name)) }
+  rescue UnityTokenCollision => e
+    warn "ERROR: #{e.message}. Change one of them."
+    exit 1
+  end
+  if out_file
+    File.binwrite(out_file, db.to_s)
+  else
+    print db.to_s
+  end
+end
@@ -49,7 +49,8 @@ class UnityTestRunnerGenerator
       include_extensions: '(?:hpp|hh|H|h)',
       source_extensions: '(?:cpp|cc|ino|C|c)',
       shuffle_tests: false,
-      rng_seed: 0
+      rng_seed: 0,
+      matrix_strength: 2
     }
   end
 
@@ -92,7 +93,9 @@ class UnityTestRunnerGenerator
   def generate(input_file, output_file, tests, used_mocks, testfile_includes)
     File.open(output_file, 'w') do |output|
       create_header(output, used_mocks, testfile_includes)
-      create_run_test_params_struct(output)
+      tests.each { |test| test[:args_table] = args_table(test) }
+      tests.each { |test| test[:value_source] = value_source(test) }
+      create_run_test_params_struct(output, tests)
       create_externs(output, tests, used_mocks)
       create_mock_management(output, used_mocks)
       create_setup(output)
@@ -102,6 +105,9 @@ class UnityTestRunnerGenerator
       create_reset(output)
       create_run_test(output)
       create_args_wrappers(output, tests)
+      create_value_sources(output, tests)
+      create_fuzz_tests(output, tests)
+      create_list_case_name(output, tests) if @options[:cmdline_args]
       create_shuffle_tests(output) if @options[:shuffle_tests]
       tests = create_warning_test(output, input_file, tests)
       create_main(output, input_file, tests, used_mocks)
@@ -133,28 +139,36 @@ class UnityTestRunnerGenerator
     source_scrubbed = source_scrubbed.gsub(/\/\/(?:.+\/\*|\*(?:$|[^\/])).*$/, '')  # remove line comments that comment out the start of blocks
     source_scrubbed = source_scrubbed.gsub(/\/\*.*?\*\//m, '')                     # remove block comments
     source_scrubbed = source_scrubbed.gsub(/\/\/.*$/, '')                          # remove line comments (all that remain)
+    source_scrubbed = source_scrubbed.gsub(/\bTEST_PROPERTY\s*\(\s*(\w+)\s*,[^)]*\)/, 'void \\1(void)') # property tests are plain tests to the runner
+    source_scrubbed = source_scrubbed.gsub(/\bTEST_ALLOC_SWEEP\s*\(\s*(\w+)\s*\)/, 'void \\1(void)') # and so are allocation sweeps
+    fuzz_tests = source_scrubbed.scan(/\bTEST_FUZZ\s*\(\s*(\w+)\s*,/).flatten
+    source_scrubbed = source_scrubbed.gsub(/\bTEST_FUZZ\s*\(\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*\)/, 'void \\1(const unsigned char* \\2, size_t \\3)')
     lines = source_scrubbed.split(/(^\s*\#.*$) | (;|\{|\}) /x)                     # Treat preprocessor directives as a logical line. Match ;, {, and } as end of lines
                            .map { |line| line.gsub(substring_unre, substring_unsubs) } # unhide the problematic characters previously removed
 
     lines.each_with_index do |line, _index|
       # find tests
-      next unless line =~ /^((?:\s*(?:TEST_(?:CASE|RANGE|MATRIX))\s*\(.*?\)\s*)*)\s*void\s+((?:#{@options[:test_prefix]}).*)\s*\(\s*(.*)\s*\)/m
-      next unless line =~ /^((?:\s*(?:TEST_(?:CASE|RANGE|MATRIX))\s*\(.*?\)\s*)*)\s*void\s+((?:#{@options[:test_prefix]})\w*)\s*\(\s*(.*)\s*\)/m
+      next unless line =~ /^((?:\s*(?:TEST_(?:CASE|RANGE|MATRIX(?:_PAIRWISE)?|VALUES_FROM))\s*\(.*?\)\s*)*)\s*void\s+((?:#{@options[:test_prefix]}).*)\s*\(\s*(.*)\s*\)/m
+      next unless line =~ /^((?:\s*(?:TEST_(?:CASE|RANGE|MATRIX(?:_PAIRWISE)?|VALUES_FROM))\s*\(.*?\)\s*)*)\s*void\s+((?:#{@options[:test_prefix]})\w*)\s*\(\s*(.*)\s*\)/m
 
       arguments = Regexp.last_match(1)
       name = Regexp.last_match(2)
       call = Regexp.last_match(3)
       params = Regexp.last_match(4)
       args = nil
+      values_from = nil
 
       if @options[:use_param_tests] && !arguments.empty?
         args = []
-        type_and_args = arguments.split(/TEST_(CASE|RANGE|MATRIX)/)
+        type_and_args = arguments.split(/TEST_(CASE|RANGE|MATRIX_PAIRWISE|MATRIX|VALUES_FROM)/)
         (1...type_and_args.length).step(2).each do |i|
           case type_and_args[i]
           when 'CASE'
             args << type_and_args[i + 1].sub(/^\s*\(\s*(.*?)\s*\)\s*$/m, '\1')
 
+          when 'VALUES_FROM'
+            values_from = type_and_args[i + 1].sub(/^\s*\(\s*(.*?)\s*\)\s*$/m, '\1')
+
           when 'RANGE'
             args += type_and_args[i + 1].scan(/(\[|<)\s*(-?\d+.?\d*)\s*,\s*(-?\d+.?\d*)\s*,\s*(-?\d+.?\d*)\s*(\]|>)/m).map do |arg_values_str|
               exclude_end = arg_values_str[0] == '<' && arg_values_str[-1] == '>'
@@ -169,23 +183,37 @@ class UnityTestRunnerGenerator
               arg_combinations.flatten.join(', ')
             end
 
-          when 'MATRIX'
+          when 'MATRIX', 'MATRIX_PAIRWISE'
             single_arg_regex_string = /(?:(?:"(?:\\"|[^\\])*?")+|(?:'\\?.')+|(?:[^\s\]\["',]|\[[\d\S_-]+\])+)/.source
             args_regex = /\[((?:\s*#{single_arg_regex_string}\s*,?)*(?:\s*#{single_arg_regex_string})?\s*)\]/m
             arg_elements_regex = /\s*(#{single_arg_regex_string})\s*,\s*/m
 
-            args += type_and_args[i + 1].scan(args_regex).flatten.map do |arg_values_str|
-              "#{arg_values_str},".scan(arg_elements_regex)
-            end.reduce do |result, arg_range_expanded|
-              result.product(arg_range_expanded)
-            end.map do |arg_combinations|
-              arg_combinations.flatten.join(', ')
+            arg_values = type_and_args[i + 1].scan(args_regex).flatten.map do |arg_values_str|
+              "#{arg_values_str},".scan(arg_elements_regex).flatten
+            end
+
+            if type_and_args[i] == 'MATRIX_PAIRWISE'
+              args += covering_array(arg_values, @options[:matrix_strength].to_i).map do |arg_combinations|
+                arg_combinations.join(', ')
+              end
+            else
+              args += arg_values.map { |values| values.map { |v| [v] } }.reduce do |result, arg_range_expanded|
+                result.product(arg_range_expanded)
+              end.map do |arg_combinations|
+                arg_combinations.flatten.join(', ')
+              end
             end
           end
         end
+
+        unless values_from.nil?
+          raise "#{name} takes its values from #{values_from} and can't also have TEST_CASE, TEST_RANGE or TEST_MATRIX cases" unless args.empty?
+
+          args = nil
+        end
       end
 
-      tests_and_line_numbers << { test: name, args: args, call: call, params: params, line_number: 0 }
+      tests_and_line_numbers << { test: name, args: args, values_from: values_from, fuzz: fuzz_tests.include?(name), call: call, params: params, line_number: 0 }
     end
 
     tests_and_line_numbers.uniq! { |v| v[:test] }
@@ -195,7 +223,7 @@ class UnityTestRunnerGenerator
     source_index = 0
     tests_and_line_numbers.size.times do |i|
       source_lines[source_index..].each_with_index do |line, index|
-        next unless line =~ /\s+#{tests_and_line_numbers[i][:test]}(?:\s|\()/
+        next unless line =~ /\s+#{tests_and_line_numbers[i][:test]}(?:\s|\()|TEST_(?:PROPERTY|FUZZ|ALLOC_SWEEP)\s*\(\s*#{tests_and_line_numbers[i][:test]}\s*[,)]/
 
         source_index += index
         tests_and_line_numbers[i][:line_number] = source_index + 1
@@ -206,6 +234,63 @@ class UnityTestRunnerGenerator
     tests_and_line_numbers
   end
 
+  # Build a covering array of the given strength with the IPOG strategy: the
+  # first `strength` parameters start as a full product, then each further
+  # parameter is added by picking, for every existing row, the value covering
+  # the most uncovered tuples (horizontal growth) and adding or completing rows
+  # for whatever tuples remain (vertical growth). Ties always go to the earlier
+  # value or row, so the same input always yields the same cases.
+  def covering_array(value_lists, strength)
+    return [] if value_lists.empty? || value_lists.any?(&:empty?)
+
+    strength = strength.clamp(1, value_lists.length)
+
+    sizes = value_lists.map(&:length)
+    rows = sizes.first(strength).map { |size| (0...size).to_a }.reduce do |result, indices|
+      result.product(indices).map(&:flatten)
+    end.map { |row| row.is_a?(Array) ? row : [row] }
+
+    (strength...sizes.length).each do |param|
+      combos = (0...param).to_a.combination(strength - 1).to_a
+      uncovered = {}
+      combos.each do |combo|
+        combo.map { |p| (0...sizes[p]).to_a }.reduce([[]]) { |result, values| result.product(values).map(&:flatten) }.each do |values|
+          sizes[param].times { |value| uncovered[[combo, values + [value]]] = true }
+        end
+      end
+
+      # horizontal growth
+      rows.each do |row|
+        best = (0...sizes[param]).max_by do |value|
+          count = combos.count do |combo|
+            values = row.values_at(*combo)
+            !values.include?(nil) && uncovered.key?([combo, values + [value]])
+          end
+          [count, -value]
+        end
+        row << best
+        combos.each { |combo| uncovered.delete([combo, row.values_at(*combo) + [best]]) }
+      end
+
+      # vertical growth
+      uncovered.each_key do |combo, values|
+        params = combo + [param]
+        row = rows.find do |candidate|
+          params.each_with_index.all? { |p, n| candidate[p].nil? || candidate[p] == values[n] }
+        end
+        unless row
+          row = Array.new(param + 1)
+          rows << row
+        end
+        params.each_with_index { |p, n| row[p] = values[n] }
+      end
+    end
+
+    rows.map do |row|
+      row.each_with_index.map { |value, p| value_lists[p][value || 0] }
+    end
+  end
+
   def find_includes(source)
     # remove comments (block and line, in three steps to ensure correct precedence)
     source.gsub!(/\/\/(?:.+\/\*|\*(?:$|[^\/])).*$/, '')  # remove line comments that comment out the start of blocks
@@ -297,13 +382,15 @@ class UnityTestRunnerGenerator
     output.puts('char* GlobalOrderError;')
   end
 
-  def create_run_test_params_struct(output)
+  def create_run_test_params_struct(output, tests)
     output.puts("\n/*=======Structure Used By Test Runner=====*/")
     output.puts('struct UnityRunTestParameters')
     output.puts('{')
     output.puts('  UnityTestFunction func;')
     output.puts('  const char* name;')
     output.puts('  UNITY_LINE_TYPE line_num;')
+    output.puts('  int args_row;') if args_tables?(tests)
+    output.puts('  int runs_cases;') if own_cases?(tests)
     output.puts('};')
   end
 
@@ -315,6 +402,11 @@ class UnityTestRunnerGenerator
     tests.each do |test|
       output.puts("extern void #{test[:test]}(#{test[:call] || 'void'});")
     end
+    tests.each do |test|
+      next unless test[:value_source]
+
+      output.puts("extern int #{test[:values_from]}(unsigned int index, #{test[:value_source][:type]}* value);")
+    end
     output.puts("#ifdef __cplusplus\n}\n#endif") if @options[:externc]
     output.puts('')
   end
@@ -417,8 +509,11 @@ class UnityTestRunnerGenerator
     output.puts("        return;")
     output.puts("#endif")
     output.puts("    Unity.NumberOfTests++;")
+    output.puts("    UnityReportTestBegin();")
     output.puts("    UNITY_CLR_DETAILS();")
+    output.puts("    UNITY_CAPTURE_OUTPUT_START();")
     output.puts("    UNITY_EXEC_TIME_START();")
+    output.puts("    UNITY_PERF_COUNTERS_START();")
     output.puts("    CMock_Init();")
     output.puts("    if (TEST_PROTECT())")
     output.puts("    {")
@@ -426,33 +521,90 @@ class UnityTestRunnerGenerator
       output.puts("        volatile CEXCEPTION_T e;")
       output.puts("        Try {")
       output.puts("            #{@options[:setup_name]}();")
+      output.puts("            UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);")
       output.puts("            func();")
       output.puts("        } Catch(e) {")
       output.puts("            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, \"Unhandled Exception!\");")
       output.puts("        }")
     else
       output.puts("        #{@options[:setup_name]}();")
+      output.puts("        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);")
       output.puts("        func();")
     end
     output.puts("    }")
+    output.puts("    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);")
     output.puts("    if (TEST_PROTECT())")
     output.puts("    {")
     output.puts("        #{@options[:teardown_name]}();")
     output.puts("        CMock_Verify();")
     output.puts("    }")
     output.puts("    CMock_Destroy();")
+    output.puts("    UNITY_PERF_COUNTERS_STOP();")
     output.puts("    UNITY_EXEC_TIME_STOP();")
+    output.puts("    UNITY_CAPTURE_OUTPUT_STOP();")
     output.puts("    UnityConcludeTest();")
     output.puts("}")
   end
 
+  # A parameterized test whose parameters are plain declarations ("type name") and whose
+  # arguments are all literals gets its cases as rows of a typed table, run by one function,
+  # rather than a wrapper function for each case. Returns the rows, or nil when that can't be
+  # done and the wrappers are needed.
+  def args_table(test)
+    return nil if !@options[:use_param_tests] || test[:args].nil? || test[:args].empty?
+
+    params = test[:call].to_s.split(',').map(&:strip)
+    types = params.map do |param|
+      match = param.match(/\A((?:const\s+|volatile\s+|unsigned\s+|signed\s+)*[A-Za-z_]\w*[\s*]+(?:const\s*)?)([A-Za-z_]\w*)\z/)
+      return nil if match.nil? || C_TYPE_WORDS.include?(match[2])
+
+      match[1].strip
+    end
+    rows = test[:args].map do |args|
+      values = split_literal_args(args.to_s)
+      return nil if values.nil? || values.length != types.length
+
+      values
+    end
+    { types: types, rows: rows }
+  end
+
+  C_TYPE_WORDS = %w[void char short int long float double signed unsigned const volatile _Bool bool].freeze
+  C_LITERAL = /[-+]?\s*(?:0[xX][0-9A-Fa-f]+|[0-9]+\.?[0-9]*(?:[eE][-+]?[0-9]+)?|\.[0-9]+(?:[eE][-+]?[0-9]+)?)[uUlLfF]*|
+               '(?:\\.|[^\\'])+'|
+               "(?:\\.|[^\\"])*"(?:\s*"(?:\\.|[^\\"])*")*|
+               NULL|true|false/x.freeze
+
+  def split_literal_args(args)
+    values = []
+    rest = args.strip
+    until rest.empty?
+      match = rest.match(/\A(#{C_LITERAL})\s*(?:,\s*|\z)/m)
+      return nil if match.nil?
+
+      values << match[1]
+      rest = match.post_match
+    end
+    values
+  end
+
+  def args_tables?(tests)
+    tests.any? { |test| test[:args_table] }
+  end
+
   def create_args_wrappers(output, tests)
     return unless @options[:use_param_tests]
 
     output.puts("\n/*=======Parameterized Test Wrappers=====*/")
+    output.puts('static int runner_args_row;') if args_tables?(tests)
     tests.each do |test|
       next if test[:args].nil? || test[:args].empty?
 
+      if test[:args_table]
+        create_args_table(output, test)
+        next
+      end
+
       test[:args].each.with_index(1) do |args, idx|
         output.puts("static void runner_args#{idx}_#{test[:test]}(void)")
         output.puts('{')
@@ -462,6 +614,239 @@ class UnityTestRunnerGenerator
     end
   end
 
+  def create_args_table(output, test)
+    table = "runner_args_table_#{test[:test]}"
+    types = test[:args_table][:types]
+    output.puts('static const struct')
+    output.puts('{')
+    output.puts('    UNITY_TOKENIZED_NAME_T name;')
+    types.each.with_index(1) { |type, idx| output.puts("    #{type} p#{idx};") }
+    output.puts("} #{table}[] =")
+    output.puts('{')
+    test[:args].zip(test[:args_table][:rows]).each do |args, values|
+      output.puts("    { UNITY_TOKENIZED_NAME(#{"#{test[:test]}(#{args})".dump}), #{values.join(', ')} },")
+    end
+    output.puts('};')
+    output.puts("static void runner_args_#{test[:test]}(void)")
+    output.puts('{')
+    output.puts("    #{test[:test]}(#{(1..types.length).map { |idx| "#{table}[runner_args_row].p#{idx}" }.join(', ')});")
+    output.puts("}\n")
+  end
+
+  # A TEST_VALUES_FROM test is run once for every value its source produces, while the runner
+  # is running, so the runner only holds one value and one name at a time however many there are.
+  def value_source(test)
+    return nil if !@options[:use_param_tests] || test[:values_from].nil?
+
+    match = test[:call].to_s.strip.match(/\A((?:const\s+|volatile\s+|unsigned\s+|signed\s+|struct\s+|union\s+|enum\s+)*[A-Za-z_]\w*[\s*]+(?:const\s*)?)([A-Za-z_]\w*)\z/)
+    raise "#{test[:test]} must take exactly one plain parameter to get its values from #{test[:values_from]}" if match.nil? || C_TYPE_WORDS.include?(match[2])
+
+    type = match[1].strip
+    # the runner writes the value itself, so it is stored without any top-level const
+    type = type.include?('*') ? type.sub(/\s*\bconst\s*\z/, '') : type.gsub(/\bconst\s+/, '')
+    { type: type, shown_as: value_shown_as(type) }
+  end
+
+  def value_shown_as(type)
+    return :string if type =~ /\bchar\s*\*\z/
+    return nil if type.include?('*')
+    return :uint if type =~ /\bunsigned\b|\A(?:volatile\s+)?(?:size_t|uint\w*_t|UNITY_UINT\w*|bool|_Bool)\z/
+    return :int if type =~ /\A(?:volatile\s+)?(?:signed\s+)?(?:char|short|int|long|signed|ptrdiff_t|int\w*_t|UNITY_INT\w*)(?:\s+(?:int|long))*\z/
+
+    nil
+  end
+
+  def values_sources?(tests)
+    tests.any? { |test| test[:value_source] }
+  end
+
+  def fuzz_tests?(tests)
+    tests.any? { |test| test[:fuzz] }
+  end
+
+  # Entries that run each of their cases through run_test themselves
+  def own_cases?(tests)
+    values_sources?(tests) || fuzz_tests?(tests)
+  end
+
+  def create_value_sources(output, tests)
+    return unless values_sources?(tests)
+
+    output.puts("\n/*=======Runtime Value Sources=====*/")
+    output.puts('static char runner_value_name[UNITY_VALUES_NAME_SIZE];')
+    output.puts('static unsigned int runner_value_name_len;')
+    output.puts('static void runner_value_name_add(const char* text)')
+    output.puts('{')
+    output.puts('    while ((*text != 0) && (runner_value_name_len < sizeof(runner_value_name) - 1))')
+    output.puts('    {')
+    output.puts('        runner_value_name[runner_value_name_len++] = *text++;')
+    output.puts('    }')
+    output.puts('    runner_value_name[runner_value_name_len] = 0;')
+    output.puts('}')
+    output.puts('static void runner_value_name_add_uint(UNITY_UINT number)')
+    output.puts('{')
+    output.puts('    char digits[24];')
+    output.puts('    int i = (int)sizeof(digits) - 1;')
+    output.puts('    digits[i] = 0;')
+    output.puts('    do')
+    output.puts('    {')
+    output.puts("        digits[--i] = (char)('0' + (int)(number % 10));")
+    output.puts('        number /= 10;')
+    output.puts('    } while (number != 0);')
+    output.puts('    runner_value_name_add(&digits[i]);')
+    output.puts('}')
+    if tests.any? { |test| test[:value_source] && test[:value_source][:shown_as] == :int }
+      output.puts('static void runner_value_name_add_int(UNITY_INT number)')
+      output.puts('{')
+      output.puts('    if (number < 0)')
+      output.puts('    {')
+      output.puts('        runner_value_name_add("-");')
+      output.puts('        runner_value_name_add_uint((UNITY_UINT)0 - (UNITY_UINT)number);')
+      output.puts('    }')
+      output.puts('    else')
+      output.puts('    {')
+      output.puts('        runner_value_name_add_uint((UNITY_UINT)number);')
+      output.puts('    }')
+      output.puts('}')
+    end
+    tests.each do |test|
+      next unless test[:value_source]
+
+      value = "runner_value_#{test[:test]}"
+      output.puts("static #{test[:value_source][:type]} #{value};")
+      output.puts("static void runner_value_case_#{test[:test]}(void)")
+      output.puts('{')
+      output.puts("    #{test[:test]}(#{value});")
+      output.puts('}')
+      output.puts("static void runner_values_#{test[:test]}(void)")
+      output.puts('{')
+      output.puts('    unsigned int index;')
+      output.puts("    for (index = 0; #{test[:values_from]}(index, &#{value}); index++)")
+      output.puts('    {')
+      output.puts('        runner_value_name_len = 0;')
+      output.puts("        runner_value_name_add(\"#{test[:test]}[\");")
+      output.puts('        runner_value_name_add_uint((UNITY_UINT)index);')
+      case test[:value_source][:shown_as]
+      when :string
+        output.puts("        runner_value_name_add(\"](\");")
+        output.puts("        if (#{value} == NULL)")
+        output.puts('        {')
+        output.puts('            runner_value_name_add("NULL)");')
+        output.puts('        }')
+        output.puts('        else')
+        output.puts('        {')
+        output.puts("            runner_value_name_add(\"\\\"\");")
+        output.puts("            runner_value_name_add(#{value});")
+        output.puts("            runner_value_name_add(\"\\\")\");")
+        output.puts('        }')
+      when :uint
+        output.puts("        runner_value_name_add(\"](\");")
+        output.puts("        runner_value_name_add_uint((UNITY_UINT)#{value});")
+        output.puts("        runner_value_name_add(\")\");")
+      when :int
+        output.puts("        runner_value_name_add(\"](\");")
+        output.puts("        runner_value_name_add_int((UNITY_INT)#{value});")
+        output.puts("        runner_value_name_add(\")\");")
+      else
+        output.puts("        runner_value_name_add(\"]\");")
+      end
+      output.puts("        run_test(runner_value_case_#{test[:test]}, runner_value_name, #{test[:line_number]});")
+      output.puts('    }')
+      output.puts('}')
+    end
+  end
+
+  # A TEST_FUZZ test is run once for every input in its corpus directory. The same runner
+  # built with UNITY_FUZZ_ENTRY is a libFuzzer target for one of them instead.
+  def create_fuzz_tests(output, tests)
+    return unless fuzz_tests?(tests)
+
+    output.puts("\n/*=======Fuzz Tests=====*/")
+    output.puts('#ifndef UNITY_INCLUDE_FUZZ')
+    output.puts('#error "TEST_FUZZ tests need Unity built with UNITY_INCLUDE_FUZZ"')
+    output.puts('#endif')
+    output.puts('#ifndef UNITY_FUZZ_ENTRY')
+    tests.each do |test|
+      next unless test[:fuzz]
+
+      output.puts("static void runner_fuzz_#{test[:test]}(void)")
+      output.puts('{')
+      output.puts("    UnityFuzzReplay(#{test[:test]}, \"#{test[:test]}\", #{test[:line_number]}, run_test);")
+      output.puts('}')
+    end
+    output.puts('#endif')
+  end
+
+  def create_fuzz_entry(output, filename, tests)
+    fuzz_tests = tests.select { |test| test[:fuzz] }
+
+    output.puts("\n/*=======libFuzzer Entry Point=====*/")
+    output.puts('#ifdef UNITY_FUZZ_ENTRY')
+    output.puts('#ifndef UNITY_FUZZ_TARGET')
+    output.puts("#define UNITY_FUZZ_TARGET #{fuzz_tests.first[:test]}")
+    output.puts('#endif')
+    output.puts('#ifdef __cplusplus')
+    output.puts('extern "C"')
+    output.puts('#endif')
+    output.puts('int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size);')
+    output.puts('int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size)')
+    output.puts('{')
+    output.puts('  static const struct')
+    output.puts('  {')
+    output.puts('    UnityFuzzFunction func;')
+    output.puts('    const char* name;')
+    output.puts('    UNITY_LINE_TYPE line_num;')
+    output.puts('  } targets[] =')
+    output.puts('  {')
+    fuzz_tests.each do |test|
+      output.puts("    { #{test[:test]}, \"#{test[:test]}\", #{test[:line_number]} },")
+    end
+    output.puts('  };')
+    output.puts('  static int began = 0;')
+    output.puts('  unsigned int t = 0;')
+    output.puts('  (void)run_test; /* only the corpus replay runs tests one by one */')
+    output.puts('  if (!began)')
+    output.puts('  {')
+    output.puts("    UnityBegin(UNITY_TOKENIZE(\"#{filename.gsub(/\\/, '\\\\\\')}\"));")
+    output.puts('    began = 1;')
+    output.puts('  }')
+    if fuzz_tests.length > 1
+      output.puts("  while ((t < #{fuzz_tests.length - 1}) && (targets[t].func != UNITY_FUZZ_TARGET))")
+      output.puts('  {')
+      output.puts('    t++;')
+      output.puts('  }')
+    end
+    output.puts('  UnityFuzzOneInput(UNITY_FUZZ_TARGET, targets[t].name, targets[t].line_num, data, size);')
+    output.puts('  return 0;')
+    output.puts('}')
+    output.puts('#else')
+  end
+
+  def create_list_case_name(output, tests)
+    return unless args_tables?(tests)
+
+    # Lists a tabled case the way the others are listed, without the quotes
+    output.puts("\n/*=======List Parameterized Test Names=====*/")
+    output.puts('#ifdef UNITY_USE_COMMAND_LINE_ARGS')
+    output.puts('static void runner_list_case_name(const char* name)')
+    output.puts('{')
+    output.puts('#ifdef UNITY_OUTPUT_TOKENIZED')
+    output.puts('  UnityPrint(name);')
+    output.puts('#else')
+    output.puts('  char ch[2] = { 0, 0 };')
+    output.puts('  for (; *name != 0; name++)')
+    output.puts('  {')
+    output.puts("    if ((*name != '\"') && (*name != '\\n'))")
+    output.puts('    {')
+    output.puts('      ch[0] = *name;')
+    output.puts('      UnityPrint(ch);')
+    output.puts('    }')
+    output.puts('  }')
+    output.puts('#endif')
+    output.puts('}')
+    output.puts('#endif')
+  end
+
   def create_warning_test(output, filename, tests)
     if count_tests(tests) == 0
       warning_test = {
@@ -495,6 +880,7 @@ class UnityTestRunnerGenerator
   end
 
   def create_main(output, filename, tests, used_mocks)
+    create_fuzz_entry(output, filename, tests) if fuzz_tests?(tests)
     output.puts("\n/*=======MAIN=====*/")
     main_name = @options[:main_name].to_sym == :auto ? "main_#{filename.gsub('.c', '')}" : @options[:main_name].to_s
     if @options[:cmdline_args]
@@ -512,9 +898,19 @@ class UnityTestRunnerGenerator
       output.puts("      UnityPrint(\"#{filename.gsub('.c', '').gsub(/\\/, '\\\\\\')}.\");")
       output.puts('      UNITY_PRINT_EOL();')
       tests.each do |test|
-        if !@options[:use_param_tests] || test[:args].nil? || test[:args].empty?
+        if test[:value_source] || test[:fuzz]
+          output.puts("      UnityPrint(\"  #{test[:test]}[...]\");")
+          output.puts('      UNITY_PRINT_EOL();')
+        elsif !@options[:use_param_tests] || test[:args].nil? || test[:args].empty?
           output.puts("      UnityPrint(\"  #{test[:test]}\");")
           output.puts('      UNITY_PRINT_EOL();')
+        elsif test[:args_table]
+          output.puts("      for (int r = 0; r < #{test[:args].length}; r++)")
+          output.puts('      {')
+          output.puts('        UnityPrint("  ");')
+          output.puts("        runner_list_case_name(runner_args_table_#{test[:test]}[r].name);")
+          output.puts('        UNITY_PRINT_EOL();')
+          output.puts('      }')
         else
           test[:args].each do |args|
             output.puts("      UnityPrint(\"  #{test[:test]}(#{args.gsub('"', '').gsub("\n", '').gsub(/\\/, '\\\\\\')})\");")
@@ -537,9 +933,9 @@ class UnityTestRunnerGenerator
     end
     output.puts('  suiteSetUp();') if @options[:has_suite_setup]
     if @options[:omit_begin_end]
-      output.puts("  UnitySetTestFile(\"#{filename.gsub(/\\/, '\\\\\\')}\");")
+      output.puts("  UnitySetTestFile(UNITY_TOKENIZE(\"#{filename.gsub(/\\/, '\\\\\\')}\"));")
     else
-      output.puts("  UnityBegin(\"#{filename.gsub(/\\/, '\\\\\\')}\");")
+      output.puts("  UnityBegin(UNITY_TOKENIZE(\"#{filename.gsub(/\\/, '\\\\\\')}\"));")
     end
     if @options[:shuffle_tests]
       output.puts
@@ -552,20 +948,44 @@ class UnityTestRunnerGenerator
     output.puts
     output.puts("  struct UnityRunTestParameters run_test_params_arr[#{count_tests(tests)}];")
     output.puts
+    # the optional fields are set for every entry so none is left uninitialized
+    optional_fields = lambda do |entry, args_row|
+      output.puts("  run_test_params_arr[#{entry}].args_row = #{args_row};") if args_tables?(tests)
+      output.puts("  run_test_params_arr[#{entry}].runs_cases = 0;") if own_cases?(tests)
+    end
     idx = 0
     tests.each do |test|
-      if !@options[:use_param_tests] || test[:args].nil? || test[:args].empty?
+      if test[:value_source] || test[:fuzz]
+        output.puts("  run_test_params_arr[#{idx}].func = runner_#{test[:fuzz] ? 'fuzz' : 'values'}_#{test[:test]};")
+        output.puts("  run_test_params_arr[#{idx}].name = UNITY_TOKENIZE(\"#{test[:test]}\");")
+        output.puts("  run_test_params_arr[#{idx}].line_num = #{test[:line_number]};")
+        output.puts("  run_test_params_arr[#{idx}].args_row = 0;") if args_tables?(tests)
+        output.puts("  run_test_params_arr[#{idx}].runs_cases = 1;")
+        idx += 1
+      elsif !@options[:use_param_tests] || test[:args].nil? || test[:args].empty?
         output.puts("  run_test_params_arr[#{idx}].func = #{test[:test]};")
-        output.puts("  run_test_params_arr[#{idx}].name = \"#{test[:test]}\";")
+        output.puts("  run_test_params_arr[#{idx}].name = UNITY_TOKENIZE(\"#{test[:test]}\");")
         output.puts("  run_test_params_arr[#{idx}].line_num = #{test[:line_number]};")
+        optional_fields.call(idx, 0)
         idx += 1
+      elsif test[:args_table]
+        output.puts("  for (int r = 0; r < #{test[:args].length}; r++)")
+        output.puts('  {')
+        output.puts("    run_test_params_arr[#{idx} + r].func = runner_args_#{test[:test]};")
+        output.puts("    run_test_params_arr[#{idx} + r].name = runner_args_table_#{test[:test]}[r].name;")
+        output.puts("    run_test_params_arr[#{idx} + r].line_num = #{test[:line_number]};")
+        output.puts("    run_test_params_arr[#{idx} + r].args_row = r;")
+        output.puts("    run_test_params_arr[#{idx} + r].runs_cases = 0;") if own_cases?(tests)
+        output.puts('  }')
+        idx += test[:args].length
       else
         test[:args].each.with_index(1) do |args, arg_idx|
           wrapper = "runner_args#{arg_idx}_#{test[:test]}"
           testname = "#{test[:test]}(#{args})".dump
           output.puts("  run_test_params_arr[#{idx}].func = #{wrapper};")
-          output.puts("  run_test_params_arr[#{idx}].name = #{testname};")
+          output.puts("  run_test_params_arr[#{idx}].name = UNITY_TOKENIZE(#{testname});")
           output.puts("  run_test_params_arr[#{idx}].line_num = #{test[:line_number]};")
+          optional_fields.call(idx, 0)
           idx += 1
         end
       end
@@ -577,6 +997,14 @@ class UnityTestRunnerGenerator
     end
     output.puts("  for (int i = 0; i < #{count_tests(tests)}; i++)")
     output.puts('  {')
+    output.puts('    runner_args_row = run_test_params_arr[i].args_row;') if args_tables?(tests)
+    if own_cases?(tests)
+      output.puts('    if (run_test_params_arr[i].runs_cases)')
+      output.puts('    {')
+      output.puts('      run_test_params_arr[i].func();')
+      output.puts('      continue;')
+      output.puts('    }')
+    end
     output.puts('    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);')
     output.puts('  }')
     output.puts
@@ -591,6 +1019,7 @@ class UnityTestRunnerGenerator
       output.puts('  return UNITY_END();') unless @options[:omit_begin_end]
     end
     output.puts('}')
+    output.puts('#endif /* UNITY_FUZZ_ENTRY */') if fuzz_tests?(tests)
   end
 
   def create_h_file(output, filename, tests, testfile_includes, used_mocks)
@@ -667,7 +1096,8 @@ if $0 == __FILE__
           '    --omit_begin_end=1    - omit calls to UnityBegin and UNITY_END (disabled by default)',
           '    --header_file=""      - path/name of test header file to generate too',
           '    --shuffle_tests=1     - enable shuffling of the test execution order (disabled by default)',
-          '    --rng_seed=1          - seed value for randomization of test execution order'].join("\n")
+          '    --rng_seed=1          - seed value for randomization of test execution order',
+          '    --matrix_strength=2   - combination strength covered by TEST_MATRIX_PAIRWISE (2 by default)'].join("\n")
     exit 1
   end
 
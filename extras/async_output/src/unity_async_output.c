@@ -0,0 +1,246 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+#if !defined(_POSIX_C_SOURCE) && !defined(_GNU_SOURCE)
+#define _POSIX_C_SOURCE 200809L /* pthreads, nanosleep and sigaction are hidden by a strict -std=c99 otherwise */
+#endif
+
+#include "unity_async_output.h"
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+
+#if (UNITY_ASYNC_OUTPUT_BUFFER_SIZE & (UNITY_ASYNC_OUTPUT_BUFFER_SIZE - 1)) != 0
+#error "UNITY_ASYNC_OUTPUT_BUFFER_SIZE must be a power of two"
+#endif
+
+/* The buffer has exactly one producer (the thread running the tests) and one consumer
+ * (the drain thread). Each index only ever grows and is only written by its owner, so
+ * publishing it with release/acquire ordering is all the synchronisation needed. */
+#define RING_LOAD(p)      __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define RING_STORE(p, v)  __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define RING_MASK         ((size_t)UNITY_ASYNC_OUTPUT_BUFFER_SIZE - 1)
+
+#define DRAIN_STOPPED  0
+#define DRAIN_RUNNING  1
+#define DRAIN_STOPPING 2
+
+static unsigned char ring[UNITY_ASYNC_OUTPUT_BUFFER_SIZE];
+static size_t ring_head; /* next byte the test thread writes */
+static size_t ring_tail; /* next byte the drain thread reads */
+static size_t dropped;
+static int drain_state = DRAIN_STOPPED;
+static pthread_t drain_thread;
+
+#ifndef UNITY_ASYNC_OUTPUT_NO_CRASH_HANDLER
+static const int crash_signals[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT };
+#define CRASH_SIGNAL_COUNT (sizeof(crash_signals) / sizeof(crash_signals[0]))
+static struct sigaction previous_actions[CRASH_SIGNAL_COUNT];
+#endif
+
+static void pause_briefly(void)
+{
+    struct timespec delay;
+    delay.tv_sec = 0;
+    delay.tv_nsec = UNITY_ASYNC_OUTPUT_POLL_NS;
+    (void)nanosleep(&delay, NULL);
+}
+
+static int is_drained(void)
+{
+    return RING_LOAD(&ring_tail) == RING_LOAD(&ring_head);
+}
+
+static void* drain(void* unused)
+{
+    size_t tail = ring_tail;
+    (void)unused;
+
+    for (;;)
+    {
+        /* Read the state before the head, so a stop request can never hide the last bytes */
+        const int state = RING_LOAD(&drain_state);
+        const size_t head = RING_LOAD(&ring_head);
+
+        if (tail == head)
+        {
+            if (state != DRAIN_RUNNING)
+            {
+                break;
+            }
+            pause_briefly();
+            continue;
+        }
+
+        while (tail != head)
+        {
+            UNITY_ASYNC_OUTPUT_SINK(ring[tail & RING_MASK]);
+            tail++;
+        }
+        if (RING_LOAD(&ring_head) == tail)
+        {
+            /* Caught up, so push it all out before telling a waiting flush we are done */
+            UNITY_ASYNC_OUTPUT_SINK_FLUSH();
+        }
+        RING_STORE(&ring_tail, tail);
+    }
+    return NULL;
+}
+
+#ifndef UNITY_ASYNC_OUTPUT_NO_CRASH_HANDLER
+static void restore_crash_handlers(void)
+{
+    size_t i;
+    for (i = 0; i < CRASH_SIGNAL_COUNT; i++)
+    {
+        (void)sigaction(crash_signals[i], &previous_actions[i], NULL);
+    }
+}
+
+static void crash_handler(int sig)
+{
+    /* Give the drain thread a chance to write out what the test said before it died.
+     * If the drain thread is the one crashing, there is nobody left to wait for. */
+    if (!pthread_equal(pthread_self(), drain_thread))
+    {
+        int polls = UNITY_ASYNC_OUTPUT_CRASH_POLLS;
+        while (!is_drained() && (polls-- > 0))
+        {
+            pause_briefly();
+        }
+    }
+
+    /* Hand the signal on to whoever handled it before us */
+    restore_crash_handlers();
+    (void)raise(sig);
+}
+
+static void install_crash_handlers(void)
+{
+    struct sigaction action;
+    size_t i;
+
+    action.sa_handler = crash_handler;
+    action.sa_flags = 0;
+    (void)sigemptyset(&action.sa_mask);
+    for (i = 0; i < CRASH_SIGNAL_COUNT; i++)
+    {
+        (void)sigaction(crash_signals[i], &action, &previous_actions[i]);
+    }
+}
+#endif
+
+void UnityAsyncOutput_Start(void)
+{
+    if (drain_state != DRAIN_STOPPED)
+    {
+        return;
+    }
+
+    dropped = 0;
+    ring_head = 0;
+    ring_tail = 0;
+    RING_STORE(&drain_state, DRAIN_RUNNING);
+    if (pthread_create(&drain_thread, NULL, drain, NULL) != 0)
+    {
+        /* No thread, no buffering: everything goes straight to the sink */
+        RING_STORE(&drain_state, DRAIN_STOPPED);
+        return;
+    }
+#ifndef UNITY_ASYNC_OUTPUT_NO_CRASH_HANDLER
+    install_crash_handlers();
+#endif
+}
+
+void UnityAsyncOutput_Char(int c)
+{
+    const size_t head = ring_head;
+
+    if (drain_state != DRAIN_RUNNING)
+    {
+        UNITY_ASYNC_OUTPUT_SINK(c);
+        return;
+    }
+
+    while ((head - RING_LOAD(&ring_tail)) > RING_MASK)
+    {
+#ifdef UNITY_ASYNC_OUTPUT_DROP
+        dropped++;
+        return;
+#else
+        pause_briefly();
+#endif
+    }
+
+    ring[head & RING_MASK] = (unsigned char)c;
+    RING_STORE(&ring_head, head + 1);
+}
+
+void UnityAsyncOutput_Flush(void)
+{
+    if (drain_state != DRAIN_RUNNING)
+    {
+        UNITY_ASYNC_OUTPUT_SINK_FLUSH();
+        return;
+    }
+
+    while (!is_drained())
+    {
+        pause_briefly();
+    }
+}
+
+static void print_number(size_t number)
+{
+    size_t divisor = 1;
+
+    while (number / divisor > 9)
+    {
+        divisor *= 10;
+    }
+    do
+    {
+        UNITY_ASYNC_OUTPUT_SINK((char)('0' + (number / divisor % 10)));
+        divisor /= 10;
+    } while (divisor > 0);
+}
+
+static void print_text(const char* text)
+{
+    while (*text)
+    {
+        UNITY_ASYNC_OUTPUT_SINK(*text++);
+    }
+}
+
+void UnityAsyncOutput_Complete(void)
+{
+    if (drain_state != DRAIN_RUNNING)
+    {
+        return;
+    }
+
+    RING_STORE(&drain_state, DRAIN_STOPPING);
+    (void)pthread_join(drain_thread, NULL);
+    RING_STORE(&drain_state, DRAIN_STOPPED);
+#ifndef UNITY_ASYNC_OUTPUT_NO_CRASH_HANDLER
+    restore_crash_handlers();
+#endif
+
+    if (dropped > 0)
+    {
+        print_text("Unity async output dropped ");
+        print_number(dropped);
+        print_text(" characters\n");
+    }
+    UNITY_ASYNC_OUTPUT_SINK_FLUSH();
+}
+
+size_t UnityAsyncOutput_DroppedCount(void)
+{
+    return dropped;
+}
@@ -0,0 +1,67 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+#ifndef UNITY_ASYNC_OUTPUT_H_
+#define UNITY_ASYNC_OUTPUT_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+/* Bytes waiting to be drained. Must be a power of two. */
+#ifndef UNITY_ASYNC_OUTPUT_BUFFER_SIZE
+#define UNITY_ASYNC_OUTPUT_BUFFER_SIZE 4096
+#endif
+
+/* How long the drain thread sleeps when there is nothing to do, and how long a
+ * test thread waits between checks while the buffer is full or being flushed */
+#ifndef UNITY_ASYNC_OUTPUT_POLL_NS
+#define UNITY_ASYNC_OUTPUT_POLL_NS 100000L
+#endif
+
+/* How many polls the crash handler waits for the drain thread before giving up */
+#ifndef UNITY_ASYNC_OUTPUT_CRASH_POLLS
+#define UNITY_ASYNC_OUTPUT_CRASH_POLLS 10000
+#endif
+
+/* The real sink the drain thread writes to. Defaults to stdout. */
+#ifndef UNITY_ASYNC_OUTPUT_SINK
+  #include <stdio.h>
+  #define UNITY_ASYNC_OUTPUT_SINK(a)     (void)putchar(a)
+  #define UNITY_ASYNC_OUTPUT_SINK_FLUSH() (void)fflush(stdout)
+#else
+  #ifdef UNITY_ASYNC_OUTPUT_SINK_HEADER_DECLARATION
+    extern void UNITY_ASYNC_OUTPUT_SINK_HEADER_DECLARATION;
+  #endif
+#endif
+
+#ifndef UNITY_ASYNC_OUTPUT_SINK_FLUSH
+#define UNITY_ASYNC_OUTPUT_SINK_FLUSH()
+#else
+  #ifdef UNITY_ASYNC_OUTPUT_SINK_FLUSH_HEADER_DECLARATION
+    extern void UNITY_ASYNC_OUTPUT_SINK_FLUSH_HEADER_DECLARATION;
+  #endif
+#endif
+
+/* Hook these up to UNITY_OUTPUT_CHAR, UNITY_OUTPUT_FLUSH, UNITY_OUTPUT_START and UNITY_OUTPUT_COMPLETE.
+ * Anything written while the drain thread is not running goes straight to the sink. */
+void UnityAsyncOutput_Start(void);
+void UnityAsyncOutput_Char(int c);
+void UnityAsyncOutput_Flush(void);
+void UnityAsyncOutput_Complete(void);
+
+/* Characters thrown away because the buffer was full (UNITY_ASYNC_OUTPUT_DROP only) */
+size_t UnityAsyncOutput_DroppedCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
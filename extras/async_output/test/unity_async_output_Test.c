@@ -0,0 +1,169 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+#if !defined(_POSIX_C_SOURCE) && !defined(_GNU_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "unity.h"
+#include "unity_async_output.h"
+#include "unity_async_sink_Spy.h"
+#include <signal.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* This test module includes the following tests: */
+
+void test_CharsGoStraightToSinkWhenNotStarted(void);
+void test_CharsReachSinkInOrderAfterFlush(void);
+void test_FlushWaitsForSlowSink(void);
+void test_BlockPolicyNeverLosesOutput(void);
+void test_DropPolicyCountsWhatDidNotFit(void);
+void test_CompleteReportsDroppedCharacters(void);
+void test_CrashHandlerDrainsBeforeDying(void);
+
+/* It makes use of the following features */
+void setUp(void);
+void tearDown(void);
+
+/* Let's Go! */
+void setUp(void)
+{
+    AsyncSinkSpy_Reset();
+}
+
+void tearDown(void)
+{
+    AsyncSinkSpy_Hold(0);
+    UnityAsyncOutput_Complete();
+}
+
+static void write_text(const char* text)
+{
+    while (*text)
+    {
+        UnityAsyncOutput_Char(*text++);
+    }
+}
+
+void test_CharsGoStraightToSinkWhenNotStarted(void)
+{
+    UnityAsyncOutput_Char('x');
+    TEST_ASSERT_EQUAL_STRING("x", AsyncSinkSpy_Get());
+}
+
+void test_CharsReachSinkInOrderAfterFlush(void)
+{
+    UnityAsyncOutput_Start();
+    write_text("hello world");
+    UnityAsyncOutput_Flush();
+    TEST_ASSERT_EQUAL_STRING("hello world", AsyncSinkSpy_Get());
+}
+
+void test_FlushWaitsForSlowSink(void)
+{
+    AsyncSinkSpy_DelayEachChar(500000L);
+    UnityAsyncOutput_Start();
+    write_text("0123456789");
+    UnityAsyncOutput_Flush();
+    TEST_ASSERT_EQUAL_STRING("0123456789", AsyncSinkSpy_Get());
+}
+
+void test_BlockPolicyNeverLosesOutput(void)
+{
+#ifndef UNITY_ASYNC_OUTPUT_DROP
+    int i;
+    AsyncSinkSpy_DelayEachChar(20000L);
+    UnityAsyncOutput_Start();
+    for (i = 0; i < 10 * UNITY_ASYNC_OUTPUT_BUFFER_SIZE; i++)
+    {
+        UnityAsyncOutput_Char('a' + (i % 26));
+    }
+    UnityAsyncOutput_Flush();
+    TEST_ASSERT_EQUAL_UINT(10 * UNITY_ASYNC_OUTPUT_BUFFER_SIZE, AsyncSinkSpy_Count());
+    TEST_ASSERT_EQUAL_CHAR('a' + ((10 * UNITY_ASYNC_OUTPUT_BUFFER_SIZE - 1) % 26), AsyncSinkSpy_Get()[AsyncSinkSpy_Count() - 1]);
+    TEST_ASSERT_EQUAL_UINT(0, UnityAsyncOutput_DroppedCount());
+#else
+    TEST_IGNORE_MESSAGE("Disable UNITY_ASYNC_OUTPUT_DROP to Run This Test");
+#endif
+}
+
+void test_DropPolicyCountsWhatDidNotFit(void)
+{
+#ifdef UNITY_ASYNC_OUTPUT_DROP
+    int i;
+    AsyncSinkSpy_Hold(1);
+    UnityAsyncOutput_Start();
+    for (i = 0; i < UNITY_ASYNC_OUTPUT_BUFFER_SIZE + 24; i++)
+    {
+        UnityAsyncOutput_Char('#');
+    }
+    AsyncSinkSpy_Hold(0);
+    UnityAsyncOutput_Flush();
+    TEST_ASSERT_EQUAL_UINT(UNITY_ASYNC_OUTPUT_BUFFER_SIZE, AsyncSinkSpy_Count());
+    TEST_ASSERT_EQUAL_UINT(24, UnityAsyncOutput_DroppedCount());
+#else
+    TEST_IGNORE_MESSAGE("Enable UNITY_ASYNC_OUTPUT_DROP to Run This Test");
+#endif
+}
+
+void test_CompleteReportsDroppedCharacters(void)
+{
+#ifdef UNITY_ASYNC_OUTPUT_DROP
+    int i;
+    AsyncSinkSpy_Hold(1);
+    UnityAsyncOutput_Start();
+    for (i = 0; i < UNITY_ASYNC_OUTPUT_BUFFER_SIZE + 3; i++)
+    {
+        UnityAsyncOutput_Char('#');
+    }
+    AsyncSinkSpy_Hold(0);
+    UnityAsyncOutput_Complete();
+    TEST_ASSERT_NOT_NULL(strstr(AsyncSinkSpy_Get(), "#Unity async output dropped 3 characters\n"));
+#else
+    TEST_IGNORE_MESSAGE("Enable UNITY_ASYNC_OUTPUT_DROP to Run This Test");
+#endif
+}
+
+void test_CrashHandlerDrainsBeforeDying(void)
+{
+    int fds[2];
+    int status = 0;
+    char received[32];
+    size_t length = 0;
+    ssize_t got;
+    pid_t child;
+
+    TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+    child = fork();
+    TEST_ASSERT_TRUE(child >= 0);
+    if (child == 0)
+    {
+        (void)close(fds[0]);
+        AsyncSinkSpy_ForwardTo(fds[1]);
+        AsyncSinkSpy_DelayEachChar(1000000L);
+        UnityAsyncOutput_Start();
+        write_text("last words");
+        (void)raise(SIGSEGV);
+        _exit(0); /* never reached when the handler passes the signal on */
+    }
+
+    (void)close(fds[1]);
+    while ((got = read(fds[0], &received[length], sizeof(received) - 1 - length)) > 0)
+    {
+        length += (size_t)got;
+    }
+    received[length] = '\0';
+    (void)close(fds[0]);
+    TEST_ASSERT_EQUAL_INT(child, waitpid(child, &status, 0));
+
+    TEST_ASSERT_TRUE(WIFSIGNALED(status));
+    TEST_ASSERT_EQUAL_INT(SIGSEGV, WTERMSIG(status));
+    TEST_ASSERT_EQUAL_STRING("last words", received);
+}
@@ -0,0 +1,29 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+#include "unity.h"
+
+extern void test_CharsGoStraightToSinkWhenNotStarted(void);
+extern void test_CharsReachSinkInOrderAfterFlush(void);
+extern void test_FlushWaitsForSlowSink(void);
+extern void test_BlockPolicyNeverLosesOutput(void);
+extern void test_DropPolicyCountsWhatDidNotFit(void);
+extern void test_CompleteReportsDroppedCharacters(void);
+extern void test_CrashHandlerDrainsBeforeDying(void);
+
+int main(void)
+{
+    UnityBegin("unity_async_output_Test.c");
+    RUN_TEST(test_CharsGoStraightToSinkWhenNotStarted);
+    RUN_TEST(test_CharsReachSinkInOrderAfterFlush);
+    RUN_TEST(test_FlushWaitsForSlowSink);
+    RUN_TEST(test_BlockPolicyNeverLosesOutput);
+    RUN_TEST(test_DropPolicyCountsWhatDidNotFit);
+    RUN_TEST(test_CompleteReportsDroppedCharacters);
+    RUN_TEST(test_CrashHandlerDrainsBeforeDying);
+    return UnityEnd();
+}
@@ -0,0 +1,86 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+#if !defined(_POSIX_C_SOURCE) && !defined(_GNU_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "unity_async_sink_Spy.h"
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Stands in for a slow link: it can be held shut, slowed down, or forwarded to a pipe */
+static char buffer[256];
+static size_t count;
+static int held;
+static long delay_ns;
+static int forward_fd = -1;
+
+void AsyncSinkSpy_Reset(void)
+{
+    memset(buffer, 0, sizeof(buffer));
+    count = 0;
+    held = 0;
+    delay_ns = 0;
+    forward_fd = -1;
+}
+
+void AsyncSinkSpy_Char(int c)
+{
+    struct timespec delay;
+    delay.tv_sec = 0;
+    delay.tv_nsec = (delay_ns > 0) ? delay_ns : 100000L;
+
+    while (__atomic_load_n(&held, __ATOMIC_ACQUIRE))
+    {
+        (void)nanosleep(&delay, NULL);
+    }
+    if (delay_ns > 0)
+    {
+        (void)nanosleep(&delay, NULL);
+    }
+
+    if (forward_fd >= 0)
+    {
+        char ch = (char)c;
+        (void)!write(forward_fd, &ch, 1);
+    }
+    else if (count < (sizeof(buffer) - 1))
+    {
+        buffer[count++] = (char)c;
+    }
+}
+
+void AsyncSinkSpy_Flush(void)
+{
+}
+
+const char* AsyncSinkSpy_Get(void)
+{
+    return buffer;
+}
+
+size_t AsyncSinkSpy_Count(void)
+{
+    return count;
+}
+
+void AsyncSinkSpy_Hold(int hold)
+{
+    __atomic_store_n(&held, hold, __ATOMIC_RELEASE);
+}
+
+void AsyncSinkSpy_DelayEachChar(long ns)
+{
+    delay_ns = ns;
+}
+
+void AsyncSinkSpy_ForwardTo(int fd)
+{
+    forward_fd = fd;
+}
@@ -0,0 +1,22 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+#ifndef UNITY_ASYNC_SINK_SPY_H
+#define UNITY_ASYNC_SINK_SPY_H
+
+#include <stddef.h>
+
+void AsyncSinkSpy_Reset(void);
+void AsyncSinkSpy_Char(int c);
+void AsyncSinkSpy_Flush(void);
+const char* AsyncSinkSpy_Get(void);
+size_t AsyncSinkSpy_Count(void);
+void AsyncSinkSpy_Hold(int hold);
+void AsyncSinkSpy_DelayEachChar(long ns);
+void AsyncSinkSpy_ForwardTo(int fd);
+
+#endif
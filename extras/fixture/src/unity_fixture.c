@@ -9,6 +9,13 @@
 #include "unity_internals.h"
 #include <string.h>
 
+#ifndef UNITY_EXCLUDE_STDLIB_MALLOC
+/* The patch journal is the fixture's own memory, so it stays out of unity_memory's books */
+#undef malloc
+#undef free
+#include <stdlib.h>
+#endif
+
 struct UNITY_FIXTURE_T UnityFixture;
 
 /* If you decide to use the function pointer approach.
@@ -62,7 +69,31 @@ static int testSelected(const char* test)
     return selected(UnityFixture.NameFilter, UnityFixture.Name, test);
 }
 
+/* Every test of a group passes the same TEST_GROUP string, so the group filters are
+ * only matched against it when the group or the filters change */
+static struct
+{
+    const char* group;
+    const char* filter;
+    const char* select;
+    int selected;
+} lastGroup;
+
 static int groupSelected(const char* group)
+{
+    if (group != lastGroup.group ||
+        UnityFixture.GroupFilter != lastGroup.filter ||
+        UnityFixture.Group != lastGroup.select)
+    {
+        lastGroup.group = group;
+        lastGroup.filter = UnityFixture.GroupFilter;
+        lastGroup.select = UnityFixture.Group;
+        lastGroup.selected = selected(UnityFixture.GroupFilter, UnityFixture.Group, group);
+    }
+    return lastGroup.selected;
+}
+
+int UnityGroupSelected(const char* group)
 {
     return selected(UnityFixture.GroupFilter, UnityFixture.Group, group);
 }
@@ -76,7 +107,7 @@ void UnityTestRunner(unityfunction* setup,
                      const char* file,
                      unsigned int line)
 {
-    if (testSelected(name) && groupSelected(group))
+    if (groupSelected(group) && testSelected(name))
     {
         Unity.TestFile = file;
         Unity.CurrentTestName = printableName;
@@ -87,6 +118,7 @@ void UnityTestRunner(unityfunction* setup,
         #ifndef UNITY_REPEAT_TEST_NAME
             Unity.CurrentTestName = NULL;
         #endif
+            UnitySetLineOpen(1);
         }
         else if (UnityFixture.Silent)
         {
@@ -95,23 +127,32 @@ void UnityTestRunner(unityfunction* setup,
         else
         {
             UNITY_OUTPUT_CHAR('.');
+            UnitySetLineOpen(1);
         }
 
         Unity.NumberOfTests++;
+        UnityReportTestBegin();
         UnityPointer_Init();
 
         if (!UnityFixture.DryRun) {
+            UNITY_CAPTURE_OUTPUT_START();
             UNITY_EXEC_TIME_START();
+            UNITY_PERF_COUNTERS_START();
 
             if (TEST_PROTECT())
             {
                 setup();
+                UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
                 testBody();
             }
+            UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
             if (TEST_PROTECT())
             {
                 teardown();
             }
+            UNITY_PERF_COUNTERS_STOP();
+            UNITY_EXEC_TIME_STOP();
+            UNITY_CAPTURE_OUTPUT_STOP();
         }
 
         if (TEST_PROTECT())
@@ -124,10 +165,16 @@ void UnityTestRunner(unityfunction* setup,
 
 void UnityIgnoreTest(const char* printableName, const char* group, const char* name)
 {
-    if (testSelected(name) && groupSelected(group))
+    if (groupSelected(group) && testSelected(name))
     {
         Unity.NumberOfTests++;
         Unity.TestIgnores++;
+        Unity.CurrentTestName = printableName;
+        Unity.CurrentTestLineNumber = 0;
+        UnityReportTestBegin();
+        Unity.CurrentTestIgnored = 1;
+        UnityReportTestEnd();
+        Unity.CurrentTestIgnored = 0;
         if (UnityFixture.Verbose)
         {
             UnityPrint(printableName);
@@ -148,44 +195,136 @@ void UnityIgnoreTest(const char* printableName, const char* group, const char* n
 }
 
 /*-------------------------------------------------------- */
-/*Automatic pointer restoration functions */
-struct PointerPair
+/*Automatic restoration of patched memory */
+
+/* Each patch is journaled as a header followed by the bytes it overwrote. The journal
+ * starts in a static block, big enough for UNITY_MAX_POINTERS pointer patches, and
+ * continues in heap blocks when a test patches more than that. */
+typedef struct UnityPatch
+{
+    struct UnityPatch* previous;
+    void* target;
+    size_t size;
+} UnityPatch;
+
+typedef union
+{
+    void* pointer;
+    size_t size;
+} UnityPatchUnit;
+
+#ifndef UNITY_EXCLUDE_STDLIB_MALLOC
+typedef struct UnityPatchBlock
 {
-    void** pointer;
-    void* old_value;
-};
+    struct UnityPatchBlock* next;
+    UnityPatchUnit units[1];
+} UnityPatchBlock;
 
-static struct PointerPair pointer_store[UNITY_MAX_POINTERS];
-static int pointer_index = 0;
+static UnityPatchBlock* patch_blocks = 0;
+#endif
+
+#define PATCH_UNITS(bytes) (((bytes) + sizeof(UnityPatchUnit) - 1) / sizeof(UnityPatchUnit))
+#define PATCH_FOOTPRINT(size) PATCH_UNITS(sizeof(UnityPatch) + (size))
+
+static UnityPatchUnit patch_arena[UNITY_MAX_POINTERS * PATCH_FOOTPRINT(sizeof(void*))];
+static UnityPatchUnit* patch_free = patch_arena;
+static UnityPatchUnit* patch_end = patch_arena + sizeof(patch_arena) / sizeof(UnityPatchUnit);
+static UnityPatch* patch_last = 0;
+static unsigned int patch_count = 0;
+
+static UnityPatch* newPatch(size_t size)
+{
+    const size_t needed = PATCH_FOOTPRINT(size);
+    UnityPatch* patch;
+
+    if ((size_t)(patch_end - patch_free) < needed)
+    {
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+        return 0;
+#else
+        size_t length = PATCH_UNITS(UNITY_PATCH_BLOCK_SIZE);
+        UnityPatchBlock* block;
+        if (length < needed)
+            length = needed;
+        block = (UnityPatchBlock*)malloc(sizeof(UnityPatchBlock) + (length - 1) * sizeof(UnityPatchUnit));
+        if (block == 0)
+            return 0;
+        block->next = patch_blocks;
+        patch_blocks = block;
+        patch_free = block->units;
+        patch_end = patch_free + length;
+#endif
+    }
+
+    patch = (UnityPatch*)patch_free;
+    patch_free += needed;
+    return patch;
+}
+
+static void releasePatches(void)
+{
+#ifndef UNITY_EXCLUDE_STDLIB_MALLOC
+    while (patch_blocks != 0)
+    {
+        UnityPatchBlock* next = patch_blocks->next;
+        free(patch_blocks);
+        patch_blocks = next;
+    }
+#endif
+    patch_free = patch_arena;
+    patch_end = patch_arena + sizeof(patch_arena) / sizeof(UnityPatchUnit);
+    patch_last = 0;
+}
 
 void UnityPointer_Init(void)
 {
-    pointer_index = 0;
+    releasePatches();
+    patch_count = 0;
 }
 
-void UnityPointer_Set(void** pointer, void* newValue, UNITY_LINE_TYPE line)
+void UnityPatch_Save(void* target, size_t size, UNITY_LINE_TYPE line)
 {
-    if (pointer_index >= UNITY_MAX_POINTERS)
+    UnityPatch* patch = newPatch(size);
+    if (patch == 0)
     {
-        UNITY_TEST_FAIL(line, "Too many pointers set");
+        UNITY_TEST_FAIL(line, "Too many patches set");
     }
     else
     {
-        pointer_store[pointer_index].pointer = pointer;
-        pointer_store[pointer_index].old_value = *pointer;
-        *pointer = newValue;
-        pointer_index++;
+        patch->previous = patch_last;
+        patch->target = target;
+        patch->size = size;
+        memcpy(patch + 1, target, size);
+        patch_last = patch;
+        patch_count++;
     }
 }
 
+void UnityPatch_Set(void* target, const void* value, size_t size, UNITY_LINE_TYPE line)
+{
+    UnityPatch_Save(target, size, line);
+    memmove(target, value, size);
+}
+
+void UnityPointer_Set(void** pointer, void* newValue, UNITY_LINE_TYPE line)
+{
+    UnityPatch_Set(pointer, &newValue, sizeof(newValue), line);
+}
+
+unsigned int UnityPatch_Count(void)
+{
+    return patch_count;
+}
+
 void UnityPointer_UndoAllSets(void)
 {
-    while (pointer_index > 0)
+    /* Newest first, so memory patched twice gets its original value back */
+    while (patch_last != 0)
     {
-        pointer_index--;
-        *(pointer_store[pointer_index].pointer) =
-            pointer_store[pointer_index].old_value;
+        memcpy(patch_last->target, patch_last + 1, patch_last->size);
+        patch_last = patch_last->previous;
     }
+    releasePatches();
 }
 
 int UnityGetCommandLineOptions(int argc, const char* argv[])
@@ -232,6 +371,16 @@ int UnityGetCommandLineOptions(int argc, const char* argv[])
             UNITY_PRINT_EOL();
             UnityPrint("  -r NUMBER   Repeatedly run all tests NUMBER times");
             UNITY_PRINT_EOL();
+            UnityPrint("  -t NUMBER   Report the NUMBER slowest tests when timing is enabled");
+            UNITY_PRINT_EOL();
+            UnityPrint("  --seed NUMBER  Seed the tests that draw random inputs, like properties");
+            UNITY_PRINT_EOL();
+#ifdef UNITY_INCLUDE_FILE_REPORTERS
+            UnityPrint("  --report-junit PATH  Write a JUnit XML report to PATH");
+            UNITY_PRINT_EOL();
+            UnityPrint("  --report-json PATH   Write JSON lines events to PATH");
+            UNITY_PRINT_EOL();
+#endif
             UnityPrint("  -h, --help  Display this help message");
             UNITY_PRINT_EOL();
             UNITY_PRINT_EOL();
@@ -312,6 +461,62 @@ int UnityGetCommandLineOptions(int argc, const char* argv[])
                 }
             }
         }
+        else if (strcmp(argv[i], "-t") == 0)
+        {
+            i++;
+            if (i >= argc)
+                return 1;
+#ifdef UNITY_EXEC_TIME_BUILTIN
+            {
+                unsigned int digit = 0;
+                UNITY_COUNTER_TYPE count = 0;
+                while (argv[i][digit] >= '0' && argv[i][digit] <= '9')
+                {
+                    count *= 10;
+                    count += (UNITY_COUNTER_TYPE)argv[i][digit++] - '0';
+                }
+                UnitySetSlowestTestCount(count);
+            }
+#endif
+            i++;
+        }
+        else if (strncmp(argv[i], "--seed", 6) == 0 && (argv[i][6] == '=' || argv[i][6] == '\0'))
+        {
+            /* --seed NUMBER or --seed=NUMBER, like the generated runners take it */
+            const char* seed = &argv[i][6];
+            if (*seed == '=')
+            {
+                seed++;
+            }
+            else
+            {
+                i++;
+                if (i >= argc)
+                    return 1;
+                seed = argv[i];
+            }
+            if (*seed < '0' || *seed > '9')
+                return 1;
+            UnitySeed = 0;
+            while (*seed >= '0' && *seed <= '9')
+            {
+                UnitySeed *= 10;
+                UnitySeed += (UNITY_UINT)(*seed++ - '0');
+            }
+            i++;
+        }
+#ifdef UNITY_INCLUDE_FILE_REPORTERS
+        else if (strcmp(argv[i], "--report-junit") == 0 || strcmp(argv[i], "--report-json") == 0)
+        {
+            const int junit = (strcmp(argv[i], "--report-junit") == 0);
+            i++;
+            if (i >= argc)
+                return 1;
+            if ((junit ? UnityReportJUnitTo(argv[i]) : UnityReportJsonTo(argv[i])) != 0)
+                return 1;
+            i++;
+        }
+#endif
         else
         {
             /* ignore unknown parameter */
@@ -323,10 +528,12 @@ int UnityGetCommandLineOptions(int argc, const char* argv[])
 
 void UnityConcludeFixtureTest(void)
 {
+    UnitySetLineOpen(0);
     if (Unity.CurrentTestIgnored)
     {
         Unity.TestIgnores++;
         UNITY_EXEC_TIME_STOP();
+        UNITY_PRINT_PERF_COUNTERS();
         UNITY_PRINT_EXEC_TIME();
         UNITY_PRINT_EOL();
     }
@@ -336,7 +543,14 @@ void UnityConcludeFixtureTest(void)
         {
             UnityPrint(" ");
             UnityPrint(UnityStrPass);
+            if (UnityPatch_Count() > 0)
+            {
+                UnityPrint(" (patches restored: ");
+                UnityPrintNumberUnsigned(UnityPatch_Count());
+                UnityPrint(")");
+            }
             UNITY_EXEC_TIME_STOP();
+            UNITY_PRINT_PERF_COUNTERS();
             UNITY_PRINT_EXEC_TIME();
             UNITY_PRINT_EOL();
         }
@@ -345,10 +559,13 @@ void UnityConcludeFixtureTest(void)
     {
         Unity.TestFailures++;
         UNITY_EXEC_TIME_STOP();
+        UNITY_PRINT_PERF_COUNTERS();
         UNITY_PRINT_EXEC_TIME();
         UNITY_PRINT_EOL();
+        UNITY_PRINT_CAPTURED_OUTPUT();
     }
 
+    UnityReportTestEnd();
     Unity.CurrentTestFailed = 0;
     Unity.CurrentTestIgnored = 0;
 }
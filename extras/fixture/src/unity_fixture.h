@@ -69,10 +69,15 @@ int UnityMain(int argc, const char* argv[], void (*runAllTests)(void));
     void TEST_##group##_GROUP_RUNNER(void);\
     void TEST_##group##_GROUP_RUNNER(void)
 
-/* Call this from main */
+/* Call this from main. The runner is skipped when -g or -G leave its group out. */
 #define RUN_TEST_GROUP(group)\
     { void TEST_##group##_GROUP_RUNNER(void);\
-      TEST_##group##_GROUP_RUNNER(); }
+      if (UnityGroupSelected(#group)) TEST_##group##_GROUP_RUNNER(); }
+
+/* Patch memory for the rest of the test. Like UT_PTR_SET, what they overwrite is put back
+ * after teardown, the newest patch first. */
+#define UT_MEM_SET(ptr, value, size)   UnityPatch_Set((ptr), (value), (size), __LINE__)
+#define UT_VALUE_SET(variable, value)  (UnityPatch_Save(&(variable), sizeof(variable), __LINE__), (void)((variable) = (value)))
 
 /* CppUTest Compatibility Macros */
 #ifndef UNITY_EXCLUDE_CPPUTEST_ASSERTS
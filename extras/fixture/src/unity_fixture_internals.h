@@ -36,16 +36,28 @@ void UnityTestRunner(unityfunction* setup,
                      const char* file, unsigned int line);
 
 void UnityIgnoreTest(const char* printableName, const char* group, const char* name);
+int UnityGroupSelected(const char* group);
 int UnityGetCommandLineOptions(int argc, const char* argv[]);
 void UnityConcludeFixtureTest(void);
 
 void UnityPointer_Set(void** pointer, void* newValue, UNITY_LINE_TYPE line);
 void UnityPointer_UndoAllSets(void);
 void UnityPointer_Init(void);
+void UnityPatch_Save(void* target, size_t size, UNITY_LINE_TYPE line);
+void UnityPatch_Set(void* target, const void* value, size_t size, UNITY_LINE_TYPE line);
+unsigned int UnityPatch_Count(void);
+
+/* Pointer patches that fit in the static part of the patch journal */
 #ifndef UNITY_MAX_POINTERS
 #define UNITY_MAX_POINTERS 5
 #endif
 
+/* Bytes in each heap block the patch journal grows by once its static part is full.
+ * With UNITY_EXCLUDE_STDLIB_MALLOC it doesn't grow, and patching more fails the test. */
+#ifndef UNITY_PATCH_BLOCK_SIZE
+#define UNITY_PATCH_BLOCK_SIZE 1024
+#endif
+
 #ifdef __cplusplus
 }
 #endif
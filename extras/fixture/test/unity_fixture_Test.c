@@ -65,6 +65,67 @@ TEST(UnityFixture, PointerSet)
     TEST_ASSERT_POINTERS_EQUAL(&c2, p2);
 }
 
+typedef struct
+{
+    int speed;
+    const char* name;
+    double gain;
+} PatchedConfig;
+
+static PatchedConfig config = { 10, "default", 1.5 };
+
+TEST(UnityFixture, MemoryAndValuePatchesAreRestoredNewestFirst)
+{
+    static const PatchedConfig testConfig = { 99, "test", 0.25 };
+    int counter = 7;
+
+    UnityPointer_Init();
+    UT_MEM_SET(&config, &testConfig, sizeof(config));
+    UT_VALUE_SET(config.speed, 42);
+    UT_VALUE_SET(config.gain, 3.0);
+    UT_VALUE_SET(counter, -1);
+    TEST_ASSERT_EQUAL_INT(42, config.speed);
+    STRCMP_EQUAL("test", config.name);
+    TEST_ASSERT_EQUAL_INT(-1, counter);
+    TEST_ASSERT_EQUAL_UINT(4, UnityPatch_Count());
+    UnityPointer_UndoAllSets();
+    TEST_ASSERT_EQUAL_INT(10, config.speed);
+    STRCMP_EQUAL("default", config.name);
+    TEST_ASSERT_TRUE(config.gain == 1.5);
+    TEST_ASSERT_EQUAL_INT(7, counter);
+}
+
+TEST(UnityFixture, PatchJournalGrowsPastMaxPointers)
+{
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    TEST_IGNORE_MESSAGE("The patch journal only grows on the heap");
+#else
+    static int* pointers[UNITY_MAX_POINTERS * 20];
+    char big[UNITY_PATCH_BLOCK_SIZE * 2];
+    char newBig[sizeof(big)];
+    int i;
+
+    memset(big, 'a', sizeof(big));
+    memset(newBig, 'b', sizeof(newBig));
+    UnityPointer_Init();
+    for (i = 0; i < (int)(sizeof(pointers) / sizeof(pointers[0])); i++)
+    {
+        UT_PTR_SET(pointers[i], &int1);
+    }
+    UT_MEM_SET(big, newBig, sizeof(big));
+    UT_PTR_SET(pointers[0], &int2);
+    TEST_ASSERT_EQUAL_PTR(&int2, pointers[0]);
+    TEST_ASSERT_EQUAL_PTR(&int1, pointers[sizeof(pointers) / sizeof(pointers[0]) - 1]);
+    TEST_ASSERT_EQUAL_CHAR('b', big[sizeof(big) - 1]);
+    UnityPointer_UndoAllSets();
+    for (i = 0; i < (int)(sizeof(pointers) / sizeof(pointers[0])); i++)
+    {
+        TEST_ASSERT_NULL(pointers[i]);
+    }
+    TEST_ASSERT_EACH_EQUAL_CHAR('a', big, sizeof(big));
+#endif
+}
+
 TEST(UnityFixture, FreeNULLSafety)
 {
     free(NULL);
@@ -269,6 +330,31 @@ TEST(UnityCommandOptions, UnknownCommandIsIgnored)
     TEST_ASSERT_EQUAL(98, UnityFixture.RepeatCount);
 }
 
+static const char* seed[] = {
+        "testrunner.exe",
+        "--seed", "1792433551",
+        "--seed=42",
+        "--seed", "-v"
+};
+
+TEST(UnityCommandOptions, OptionSeed)
+{
+    const UNITY_UINT savedSeed = UnitySeed;
+    TEST_ASSERT_EQUAL(0, UnityGetCommandLineOptions(3, seed));
+    TEST_ASSERT_EQUAL_UINT(1792433551u, UnitySeed);
+    TEST_ASSERT_EQUAL(0, UnityGetCommandLineOptions(4, seed));
+    TEST_ASSERT_EQUAL_UINT(42u, UnitySeed);
+    UnitySeed = savedSeed;
+}
+
+TEST(UnityCommandOptions, SeedWithoutNumberFails)
+{
+    const UNITY_UINT savedSeed = UnitySeed;
+    TEST_ASSERT_EQUAL(1, UnityGetCommandLineOptions(5, seed));
+    TEST_ASSERT_EQUAL(1, UnityGetCommandLineOptions(6, seed));
+    UnitySeed = savedSeed;
+}
+
 TEST(UnityCommandOptions, GroupOrNameFilterWithoutStringFails)
 {
     TEST_ASSERT_EQUAL(1, UnityGetCommandLineOptions(3, unknownCommand));
@@ -284,6 +370,40 @@ TEST(UnityCommandOptions, GroupFilterReallyFilters)
     TEST_ASSERT_EQUAL(saved, Unity.NumberOfTests);
 }
 
+static int excludedGroupRuns;
+
+TEST_GROUP_RUNNER(ExcludedGroup)
+{
+    excludedGroupRuns++;
+}
+
+TEST(UnityCommandOptions, ExcludedGroupRunnerIsSkipped)
+{
+    UnityFixture.Group = "groupname";
+    excludedGroupRuns = 0;
+    RUN_TEST_GROUP(ExcludedGroup);
+    TEST_ASSERT_EQUAL(0, excludedGroupRuns);
+    UnityFixture.Group = "ExcludedGroup";
+    RUN_TEST_GROUP(ExcludedGroup);
+    TEST_ASSERT_EQUAL(1, excludedGroupRuns);
+}
+
+TEST(UnityCommandOptions, GroupSelectionFollowsFilterChanges)
+{
+    static const char someGroup[] = "some-group";
+    UNITY_UINT saved = Unity.NumberOfTests;
+    UNITY_UINT savedIgnores = Unity.TestIgnores;
+    UnityFixture.NameFilter = 0;
+    UnityFixture.GroupFilter = "other";
+    UnityIgnoreTest("", someGroup, "name");
+    TEST_ASSERT_EQUAL(saved, Unity.NumberOfTests);
+    UnityFixture.GroupFilter = "some";
+    UnityIgnoreTest("", someGroup, "name");
+    TEST_ASSERT_EQUAL(saved + 1, Unity.NumberOfTests);
+    Unity.NumberOfTests = saved;
+    Unity.TestIgnores = savedIgnores;
+}
+
 IGNORE_TEST(UnityCommandOptions, TestShouldBeIgnored)
 {
     TEST_FAIL_MESSAGE("This test should not run!");
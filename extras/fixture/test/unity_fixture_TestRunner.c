@@ -11,6 +11,8 @@ TEST_GROUP_RUNNER(UnityFixture)
 {
     RUN_TEST_CASE(UnityFixture, PointerSetting);
     RUN_TEST_CASE(UnityFixture, PointerSet);
+    RUN_TEST_CASE(UnityFixture, MemoryAndValuePatchesAreRestoredNewestFirst);
+    RUN_TEST_CASE(UnityFixture, PatchJournalGrowsPastMaxPointers);
     RUN_TEST_CASE(UnityFixture, FreeNULLSafety);
     RUN_TEST_CASE(UnityFixture, ConcludeTestIncrementsFailCount);
 }
@@ -29,7 +31,11 @@ TEST_GROUP_RUNNER(UnityCommandOptions)
     RUN_TEST_CASE(UnityCommandOptions, MultipleOptions);
     RUN_TEST_CASE(UnityCommandOptions, MultipleOptionsDashRNotLastAndNoValueSpecified);
     RUN_TEST_CASE(UnityCommandOptions, UnknownCommandIsIgnored);
+    RUN_TEST_CASE(UnityCommandOptions, OptionSeed);
+    RUN_TEST_CASE(UnityCommandOptions, SeedWithoutNumberFails);
     RUN_TEST_CASE(UnityCommandOptions, GroupOrNameFilterWithoutStringFails);
     RUN_TEST_CASE(UnityCommandOptions, GroupFilterReallyFilters);
+    RUN_TEST_CASE(UnityCommandOptions, ExcludedGroupRunnerIsSkipped);
+    RUN_TEST_CASE(UnityCommandOptions, GroupSelectionFollowsFilterChanges);
     RUN_TEST_CASE(UnityCommandOptions, TestShouldBeIgnored);
 }
@@ -5,173 +5,1488 @@
     SPDX-License-Identifier: MIT
 ========================================================================= */
 
+#if defined(UNITY_MALLOC_GUARD_PAGES) && !defined(_DEFAULT_SOURCE) && !defined(_GNU_SOURCE)
+#define _DEFAULT_SOURCE /* MAP_ANONYMOUS is hidden by _POSIX_C_SOURCE alone */
+#endif
+#if !defined(_POSIX_C_SOURCE) && !defined(_GNU_SOURCE) && (defined(__unix__) || defined(__APPLE__))
+#define _POSIX_C_SOURCE 200809L /* fork and waitpid are hidden by a strict -std=c99 otherwise */
+#endif
+
 #include "unity.h"
 #include "unity_memory.h"
 #include <string.h>
 
+#if !defined(UNITY_EXCLUDE_SETJMP_H) && (defined(__unix__) || defined(__APPLE__))
+#define SWEEP_WORKERS_FORK
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#ifdef UNITY_MALLOC_GUARD_PAGES
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+#ifdef UNITY_MEMORY_THREAD_SAFE
+/* Everything below is only touched with this lock held. It is released again before a
+ * test is failed, as the failure doesn't come back. */
+#ifndef UNITY_MEMORY_LOCK
+static char memory_lock;
+#define UNITY_MEMORY_LOCK()   while (__atomic_test_and_set(&memory_lock, __ATOMIC_ACQUIRE)) { }
+#define UNITY_MEMORY_UNLOCK() __atomic_clear(&memory_lock, __ATOMIC_RELEASE)
+#endif
+#ifndef UNITY_MEMORY_THREAD_LOCAL
+#define UNITY_MEMORY_THREAD_LOCAL __thread
+#endif
+#else
+#define UNITY_MEMORY_LOCK()
+#define UNITY_MEMORY_UNLOCK()
+#define UNITY_MEMORY_THREAD_LOCAL
+#endif
+
 #define MALLOC_DONT_FAIL -1
 static int malloc_count;
+
+#ifdef UNITY_MALLOC_GUARD_PAGES
+static void catch_guard_page_faults(void);
+#endif
 static int malloc_fail_countdown = MALLOC_DONT_FAIL;
+static UnityMallocStats malloc_stats;
+
+/* The other faults that can be injected. Zero turns each of them off. */
+static size_t alloc_attempts;
+static size_t fail_only;
+static size_t fail_from_size;
+static unsigned int fail_percent;
+static UNITY_UINT32 fail_random;
+
+typedef struct AllocBudgetScope
+{
+    size_t max_allocs;
+    size_t max_bytes;
+    size_t start_allocs;
+    size_t start_bytes;
+    /* The tightest limits of this scope and all enclosing ones, as absolute counter values,
+     * so each allocation is checked against one scope however deeply budgets are nested */
+    size_t limit_allocs;
+    size_t limit_bytes;
+    int limit_allocs_scope;
+    int limit_bytes_scope;
+    unsigned int line;
+} AllocBudgetScope;
+
+static AllocBudgetScope alloc_budgets[UNITY_ALLOC_BUDGET_DEPTH];
+static int alloc_budget_depth;
+static char alloc_budget_message[256];
+
+/* Where the next allocation is made from, when the allocation macros could tell. Each thread
+ * notes its own before it takes the lock. */
+static UNITY_MEMORY_THREAD_LOCAL const char* call_site_file;
+static UNITY_MEMORY_THREAD_LOCAL unsigned int call_site_line;
+
+static void report_leaks(void);
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+static void heap_start_test(void);
+#else
+static void live_start_test(void);
+#endif
+#ifdef UNITY_MALLOC_ARENA
+static void arena_start_test(void);
+static void arena_reset(void);
+#endif
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+static const char* release_quarantine(void);
+#endif
+
+void UnityMalloc_StartTest(void)
+{
+    UNITY_MEMORY_LOCK();
+    malloc_count = 0;
+    malloc_fail_countdown = MALLOC_DONT_FAIL;
+    alloc_attempts = 0;
+    fail_only = 0;
+    fail_from_size = 0;
+    fail_percent = 0;
+    alloc_budget_depth = 0;
+    memset(&malloc_stats, 0, sizeof(malloc_stats));
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    heap_start_test();
+#else
+    live_start_test();
+#endif
+#ifdef UNITY_MALLOC_ARENA
+    arena_start_test();
+#endif
+#ifdef UNITY_MALLOC_GUARD_PAGES
+    catch_guard_page_faults();
+#endif
+    UNITY_MEMORY_UNLOCK();
+}
+
+void UnityMalloc_EndTest(void)
+{
+    int leaks;
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+    const char* spoiled;
+#endif
+
+    UNITY_MEMORY_LOCK();
+    malloc_fail_countdown = MALLOC_DONT_FAIL;
+    fail_only = 0;
+    fail_from_size = 0;
+    fail_percent = 0;
+    alloc_budget_depth = 0; /* a failure may have left budgets open */
+    UNITY_MEMORY_UNLOCK();
+#ifdef UNITY_MALLOC_REPORT_STATS
+    UnityMalloc_PrintStats();
+#endif
+    UNITY_MEMORY_LOCK();
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+    spoiled = release_quarantine();
+#endif
+    leaks = malloc_count;
+    if (leaks != 0)
+    {
+        report_leaks();
+    }
+#ifdef UNITY_MALLOC_ARENA
+    arena_reset();
+#endif
+    UNITY_MEMORY_UNLOCK();
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+    if (spoiled != NULL)
+    {
+        UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, spoiled);
+    }
+#endif
+    if (leaks != 0)
+    {
+        UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, "This test leaks!");
+    }
+}
+
+void UnityMalloc_CallSite(const char* file, unsigned int line)
+{
+    call_site_file = file;
+    call_site_line = line;
+}
+
+const UnityMallocStats* UnityMalloc_GetStats(void)
+{
+    return &malloc_stats;
+}
+
+void UnityMalloc_PrintStats(void)
+{
+    size_t bin;
+
+    UnityPrint(Unity.TestFile);
+    UNITY_OUTPUT_CHAR(':');
+    UnityPrintNumber((UNITY_INT)Unity.CurrentTestLineNumber);
+    UNITY_OUTPUT_CHAR(':');
+    UnityPrint(Unity.CurrentTestName);
+    UnityPrint(":INFO: Heap peak ");
+    UnityPrintNumberUnsigned((UNITY_UINT)malloc_stats.peak_bytes);
+    UnityPrint(" bytes, ");
+    UnityPrintNumberUnsigned((UNITY_UINT)malloc_stats.allocs);
+    UnityPrint(" allocs, ");
+    UnityPrintNumberUnsigned((UNITY_UINT)malloc_stats.frees);
+    UnityPrint(" frees, ");
+    UnityPrintNumberUnsigned((UNITY_UINT)malloc_stats.realloc_moves);
+    UnityPrint(" realloc moves copying ");
+    UnityPrintNumberUnsigned((UNITY_UINT)malloc_stats.realloc_copy_bytes);
+    UnityPrint(" bytes, log2 sizes");
+    for (bin = 0; bin < UNITY_MALLOC_HISTOGRAM_BINS; bin++)
+    {
+        if (malloc_stats.size_histogram[bin] != 0)
+        {
+            UNITY_OUTPUT_CHAR(' ');
+            UnityPrintNumberUnsigned((UNITY_UINT)bin);
+            UNITY_OUTPUT_CHAR('=');
+            UnityPrintNumberUnsigned((UNITY_UINT)malloc_stats.size_histogram[bin]);
+        }
+    }
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    {
+        UnityHeapStats heap;
+        UnityMalloc_GetHeapStats(&heap);
+        UnityPrint(", internal heap peak ");
+        UnityPrintNumberUnsigned((UNITY_UINT)heap.peak_bytes);
+        UnityPrint(" of ");
+        UnityPrintNumberUnsigned((UNITY_UINT)heap.size);
+        UnityPrint(" bytes, largest free block ");
+        UnityPrintNumberUnsigned((UNITY_UINT)heap.largest_free_block);
+        UnityPrint(" of ");
+        UnityPrintNumberUnsigned((UNITY_UINT)heap.free_bytes);
+        UnityPrint(" free bytes in ");
+        UnityPrintNumberUnsigned((UNITY_UINT)heap.free_blocks);
+        UnityPrint(" blocks");
+    }
+#endif
+    UNITY_PRINT_EOL();
+}
+
+static size_t add_saturated(size_t a, size_t b)
+{
+    return (b > UNITY_ALLOC_UNLIMITED - a) ? UNITY_ALLOC_UNLIMITED : (a + b);
+}
+
+void UnityMalloc_BudgetBegin(size_t max_allocs, size_t max_bytes, unsigned int line)
+{
+    AllocBudgetScope* scope;
+
+    UNITY_MEMORY_LOCK();
+    if (alloc_budget_depth >= UNITY_ALLOC_BUDGET_DEPTH)
+    {
+        UNITY_MEMORY_UNLOCK();
+        UNITY_TEST_FAIL((UNITY_LINE_TYPE)line, "Allocation budgets nested deeper than UNITY_ALLOC_BUDGET_DEPTH");
+    }
+
+    scope = &alloc_budgets[alloc_budget_depth];
+    scope->max_allocs = max_allocs;
+    scope->max_bytes = max_bytes;
+    scope->start_allocs = malloc_stats.allocs;
+    scope->start_bytes = malloc_stats.total_bytes;
+    scope->limit_allocs = add_saturated(scope->start_allocs, max_allocs);
+    scope->limit_bytes = add_saturated(scope->start_bytes, max_bytes);
+    scope->limit_allocs_scope = alloc_budget_depth;
+    scope->limit_bytes_scope = alloc_budget_depth;
+    scope->line = line;
+    if (alloc_budget_depth > 0)
+    {
+        const AllocBudgetScope* outer = &scope[-1];
+        if (outer->limit_allocs < scope->limit_allocs)
+        {
+            scope->limit_allocs = outer->limit_allocs;
+            scope->limit_allocs_scope = outer->limit_allocs_scope;
+        }
+        if (outer->limit_bytes < scope->limit_bytes)
+        {
+            scope->limit_bytes = outer->limit_bytes;
+            scope->limit_bytes_scope = outer->limit_bytes_scope;
+        }
+    }
+    alloc_budget_depth++;
+    UNITY_MEMORY_UNLOCK();
+}
+
+void UnityMalloc_BudgetEnd(unsigned int line)
+{
+    UNITY_MEMORY_LOCK();
+    if (alloc_budget_depth == 0)
+    {
+        UNITY_MEMORY_UNLOCK();
+        UNITY_TEST_FAIL((UNITY_LINE_TYPE)line, "UNITY_ALLOC_BUDGET_END without UNITY_ALLOC_BUDGET_BEGIN");
+    }
+    alloc_budget_depth--;
+    UNITY_MEMORY_UNLOCK();
+}
+
+static char* append_text(char* out, const char* text)
+{
+    while (*text)
+    {
+        *out++ = *text++;
+    }
+    return out;
+}
+
+static char* append_number(char* out, size_t number)
+{
+    size_t divisor = 1;
+
+    while (number / divisor > 9)
+    {
+        divisor *= 10;
+    }
+    do
+    {
+        *out++ = (char)('0' + (number / divisor % 10));
+        divisor /= 10;
+    } while (divisor > 0);
+    return out;
+}
+
+static char* append_limit(char* out, size_t limit)
+{
+    return (limit == UNITY_ALLOC_UNLIMITED) ? append_text(out, "unlimited") : append_number(out, limit);
+}
+
+static void check_budget(size_t size)
+{
+    const AllocBudgetScope* scope;
+    char* out = alloc_budget_message;
+
+    if (alloc_budget_depth == 0)
+    {
+        return;
+    }
+
+    scope = &alloc_budgets[alloc_budget_depth - 1];
+    if (malloc_stats.allocs >= scope->limit_allocs)
+    {
+        scope = &alloc_budgets[scope->limit_allocs_scope];
+    }
+    else if (size > scope->limit_bytes - malloc_stats.total_bytes)
+    {
+        scope = &alloc_budgets[scope->limit_bytes_scope];
+    }
+    else
+    {
+        return;
+    }
+
+    out = append_text(out, "Allocation budget from line ");
+    out = append_number(out, scope->line);
+    out = append_text(out, " exceeded by a request of ");
+    out = append_number(out, size);
+    out = append_text(out, " bytes. Used ");
+    out = append_number(out, malloc_stats.allocs - scope->start_allocs + 1);
+    out = append_text(out, " of ");
+    out = append_limit(out, scope->max_allocs);
+    out = append_text(out, " allocs and ");
+    out = append_number(out, add_saturated(malloc_stats.total_bytes - scope->start_bytes, size));
+    out = append_text(out, " of ");
+    out = append_limit(out, scope->max_bytes);
+    out = append_text(out, " bytes");
+    *out = '\0';
+    UNITY_MEMORY_UNLOCK(); /* only ever checked while allocating */
+    UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, alloc_budget_message);
+}
+
+static void track_alloc(size_t size)
+{
+    size_t bin = 0;
+    size_t rest = size;
+
+    while (rest > 1 && bin < UNITY_MALLOC_HISTOGRAM_BINS - 1) /* the last bin takes the rest */
+    {
+        rest >>= 1;
+        bin++;
+    }
+    malloc_stats.size_histogram[bin]++;
+    malloc_stats.allocs++;
+    malloc_stats.total_bytes += size;
+    malloc_stats.current_bytes += size;
+    if (malloc_stats.current_bytes > malloc_stats.peak_bytes)
+    {
+        malloc_stats.peak_bytes = malloc_stats.current_bytes;
+    }
+}
+
+static void track_free(size_t size)
+{
+    malloc_stats.frees++;
+    /* Memory allocated before the test started may be released during it */
+    malloc_stats.current_bytes = (malloc_stats.current_bytes > size) ? (malloc_stats.current_bytes - size) : 0;
+}
+
+void UnityMalloc_MakeMallocFailAfterCount(int countdown)
+{
+    UNITY_MEMORY_LOCK();
+    malloc_fail_countdown = countdown;
+    UNITY_MEMORY_UNLOCK();
+}
+
+void UnityMalloc_MakeMallocFailOnly(size_t allocation)
+{
+    UNITY_MEMORY_LOCK();
+    alloc_attempts = 0;
+    fail_only = allocation;
+    UNITY_MEMORY_UNLOCK();
+}
+
+void UnityMalloc_MakeMallocFailFromSize(size_t bytes)
+{
+    UNITY_MEMORY_LOCK();
+    fail_from_size = bytes;
+    UNITY_MEMORY_UNLOCK();
+}
+
+void UnityMalloc_MakeMallocFailRandomly(unsigned int percent, unsigned int seed)
+{
+    UNITY_MEMORY_LOCK();
+    fail_percent = percent;
+    fail_random = (UNITY_UINT32)seed ^ 0x9E3779B9u;
+    if (fail_random == 0)
+        fail_random = 1;
+    UNITY_MEMORY_UNLOCK();
+}
+
+/* xorshift32, which is plenty for picking which requests fail */
+static int random_failure(void)
+{
+    fail_random ^= (UNITY_UINT32)(fail_random << 13);
+    fail_random ^= fail_random >> 17;
+    fail_random ^= (UNITY_UINT32)(fail_random << 5);
+    return (fail_random % 100) < fail_percent;
+}
+
+/* These definitions are always included from unity_fixture_malloc_overrides.h */
+/* We undef to use them or avoid conflict with <stdlib.h> per the C standard */
+#undef malloc
+#undef free
+#undef calloc
+#undef realloc
+
+#ifndef UNITY_EXCLUDE_STDLIB_MALLOC
+#include <stdlib.h>
+#endif
+
+/* The internal heap is too small to spare room for tracking, so its blocks are found by
+ * walking it instead, and only their sizes are known. Everywhere else, live blocks are
+ * kept in a list, oldest first, with where and when they were allocated. */
+typedef struct GuardBytes
+{
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    size_t block;
+#else
+    struct GuardBytes* previous;
+    struct GuardBytes* next;
+    const char* file;
+    const void* caller;
+    size_t line;
+    size_t sequence;
+#endif
+    size_t size;
+    size_t guard_space;
+} Guard;
+
+#define UNITY_MALLOC_ALIGNMENT (UNITY_POINTER_WIDTH / 8)
+#ifndef UNITY_MALLOC_GUARD_ALIGNMENT
+#define UNITY_MALLOC_GUARD_ALIGNMENT UNITY_MALLOC_ALIGNMENT
+#endif
+#if !defined(UNITY_MALLOC_GUARD_PAGES) || defined(UNITY_MALLOC_GUARD_PAGES_UNDERRUN)
+static const char end[] = "END";
+#endif
+
+#ifndef UNITY_EXCLUDE_STDLIB_MALLOC
+static Guard* live_oldest;
+static Guard* live_newest;
+static Guard* test_oldest; /* the blocks from here on were allocated by the current test */
+
+/* Blocks that earlier tests leaked stay in the list, but are no longer this test's leaks */
+static void live_start_test(void)
+{
+    test_oldest = NULL;
+}
+#endif
+
+#ifdef __GNUC__
+#define CALLER() __builtin_return_address(0)
+#else
+#define CALLER() NULL
+#endif
+
+#if defined(UNITY_MALLOC_GUARD_PAGES) || defined(UNITY_MALLOC_QUARANTINE_BYTES)
+static size_t address_of(const void* p)
+{
+    return (size_t)(UNITY_PTR_TO_INT)p;
+}
+
+static char* append_hex(char* out, size_t number)
+{
+    int shift;
+
+    for (shift = UNITY_POINTER_WIDTH - 4; shift >= 0; shift -= 4)
+    {
+        *out++ = "0123456789ABCDEF"[(number >> shift) & 0xF];
+    }
+    return out;
+}
+
+#define BLOCK_FILE_LIMIT 64
+#define BLOCK_MESSAGE_SIZE (192 + BLOCK_FILE_LIMIT)
+
+/* Names a block by its size and where it was allocated, for failures found after the fact */
+static char* append_block(char* out, const Guard* guard)
+{
+    out = append_number(out, guard->size);
+    out = append_text(out, " byte block from allocation ");
+    out = append_number(out, guard->sequence);
+    if (guard->file != NULL)
+    {
+        /* Only the end of a long path, to keep the message in its buffer */
+        const size_t length = strlen(guard->file);
+        out = append_text(out, " at ");
+        if (length > BLOCK_FILE_LIMIT)
+            out = append_text(append_text(out, "..."), &guard->file[length - BLOCK_FILE_LIMIT]);
+        else
+            out = append_text(out, guard->file);
+        *out++ = ':';
+        out = append_number(out, guard->line);
+    }
+    else if (guard->caller != NULL)
+    {
+        out = append_text(out, " called from 0x");
+        out = append_hex(out, address_of(guard->caller));
+    }
+    return out;
+}
+#endif
+
+#ifdef UNITY_MALLOC_GUARD_PAGES
+/*-------------------------------------------------------- */
+/* In guard page mode, every block is mapped on its own, ending flush against a page that
+ * can't be touched, or starting right after one with UNITY_MALLOC_GUARD_PAGES_UNDERRUN.
+ * A stray access then faults at the instruction that made it, and the fault handler fails
+ * the test naming the block. Against an overrun guard page, the Guard sits just below the
+ * block at its own alignment, and the bytes left over either side are filled and checked
+ * when the block is freed, as the end marker is otherwise. Against an underrun guard page,
+ * the Guard ends the page before it. */
+#define GUARD_FILL ((char)0xFD)
+
+static size_t page_size;
+static struct sigaction previous_segv;
+static struct sigaction previous_bus;
+static char fault_message[BLOCK_MESSAGE_SIZE];
+
+static size_t round_to(size_t value, size_t unit)
+{
+    return ((value + unit - 1) / unit) * unit;
+}
+
+/* Pages for the Guard and the block together, before the guard page or after it */
+static size_t block_pages(size_t size)
+{
+#ifdef UNITY_MALLOC_GUARD_PAGES_UNDERRUN
+    return page_size + round_to(size + sizeof(end), page_size);
+#else
+    return round_to(sizeof(Guard) + UNITY_MALLOC_ALIGNMENT + round_to(size, UNITY_MALLOC_GUARD_ALIGNMENT), page_size);
+#endif
+}
+
+static char* guarded_allocate(size_t size)
+{
+    char* region;
+
+    if (page_size == 0)
+        page_size = (size_t)sysconf(_SC_PAGESIZE);
+    region = (char*)mmap(NULL, block_pages(size) + page_size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (region == (char*)MAP_FAILED)
+        return NULL;
+#ifdef UNITY_MALLOC_GUARD_PAGES_UNDERRUN
+    if (mprotect(region + page_size, page_size, PROT_NONE) == 0)
+        return region + 2 * page_size;
+#else
+    if (mprotect(region + block_pages(size), page_size, PROT_NONE) == 0)
+        return region + block_pages(size) - round_to(size, UNITY_MALLOC_GUARD_ALIGNMENT);
+#endif
+    (void)munmap(region, block_pages(size) + page_size);
+    return NULL;
+}
+
+static void guarded_release(char* mem, size_t size)
+{
+#ifdef UNITY_MALLOC_GUARD_PAGES_UNDERRUN
+    (void)munmap(mem - 2 * page_size, block_pages(size) + page_size);
+#else
+    (void)munmap(mem + round_to(size, UNITY_MALLOC_GUARD_ALIGNMENT) - block_pages(size), block_pages(size) + page_size);
+#endif
+}
+
+static size_t guard_page_of(const Guard* guard)
+{
+#ifdef UNITY_MALLOC_GUARD_PAGES_UNDERRUN
+    return address_of(&guard[1]);
+#else
+    return round_to(address_of(&guard[1]) + guard->size, page_size);
+#endif
+}
+
+static void guard_page_fault(int signal, siginfo_t* info, void* context)
+{
+    const size_t address = address_of(info->si_addr);
+    Guard* guard;
+    char* out = fault_message;
+
+    (void)context;
+    for (guard = live_oldest; guard != NULL; guard = guard->next)
+    {
+        if (address >= guard_page_of(guard) && address - guard_page_of(guard) < page_size)
+            break;
+    }
+    if (guard == NULL)
+    {
+        /* Not ours, so the access is retried with whatever handled it before */
+        (void)sigaction(signal, (signal == SIGBUS) ? &previous_bus : &previous_segv, NULL);
+        return;
+    }
+
+#ifdef UNITY_MALLOC_GUARD_PAGES_UNDERRUN
+    out = append_text(out, "Buffer underrun of the ");
+#else
+    out = append_text(out, "Buffer overrun of the ");
+#endif
+    out = append_block(out, guard);
+    *out = '\0';
+    UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, fault_message);
+#ifdef UNITY_EXCLUDE_SETJMP_H
+    (void)sigaction(signal, (signal == SIGBUS) ? &previous_bus : &previous_segv, NULL);
+#endif
+}
+
+/* Put back at the start of every test, in case a fault that wasn't ours took it away */
+static void catch_guard_page_faults(void)
+{
+    struct sigaction action;
+    struct sigaction previous;
+
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = guard_page_fault;
+    action.sa_flags = SA_SIGINFO | SA_NODEFER; /* failing the test jumps out of the handler */
+    (void)sigemptyset(&action.sa_mask);
+    if (sigaction(SIGSEGV, &action, &previous) == 0 && previous.sa_sigaction != guard_page_fault)
+        previous_segv = previous;
+    if (sigaction(SIGBUS, &action, &previous) == 0 && previous.sa_sigaction != guard_page_fault)
+        previous_bus = previous;
+}
+#endif
+
+/* Where the Guard of a block is */
+static Guard* guard_of(void* mem)
+{
+#if defined(UNITY_MALLOC_GUARD_PAGES) && defined(UNITY_MALLOC_GUARD_PAGES_UNDERRUN)
+    return (Guard*)((char*)mem - page_size) - 1;
+#elif defined(UNITY_MALLOC_GUARD_PAGES)
+    return (Guard*)((char*)mem - address_of(mem) % UNITY_MALLOC_ALIGNMENT) - 1;
+#else
+    return (Guard*)mem - 1;
+#endif
+}
+
+#ifndef UNITY_EXCLUDE_STDLIB_MALLOC
+/* And where the block of a Guard is */
+static char* block_of(Guard* guard)
+{
+#if defined(UNITY_MALLOC_GUARD_PAGES) && defined(UNITY_MALLOC_GUARD_PAGES_UNDERRUN)
+    return (char*)&guard[1] + page_size;
+#elif defined(UNITY_MALLOC_GUARD_PAGES)
+    return (char*)&guard[1] + (guard_page_of(guard) - address_of(&guard[1])) - round_to(guard->size, UNITY_MALLOC_GUARD_ALIGNMENT);
+#else
+    return (char*)&guard[1];
+#endif
+}
+#endif
+
+static void mark_end(char* mem)
+{
+    Guard* guard = guard_of(mem);
+#if defined(UNITY_MALLOC_GUARD_PAGES) && !defined(UNITY_MALLOC_GUARD_PAGES_UNDERRUN)
+    memset(&guard[1], GUARD_FILL, (size_t)(mem - (char*)&guard[1]));
+    memset(&mem[guard->size], GUARD_FILL, round_to(guard->size, UNITY_MALLOC_GUARD_ALIGNMENT) - guard->size);
+#else
+    memcpy(&mem[guard->size], end, sizeof(end));
+#endif
+}
+
+static int end_intact(char* mem)
+{
+    Guard* guard = guard_of(mem);
+#if defined(UNITY_MALLOC_GUARD_PAGES) && !defined(UNITY_MALLOC_GUARD_PAGES_UNDERRUN)
+    const char* filled;
+    for (filled = (char*)&guard[1]; filled < mem; filled++)
+    {
+        if (*filled != GUARD_FILL) return 0;
+    }
+    for (filled = &mem[guard->size]; filled < &mem[round_to(guard->size, UNITY_MALLOC_GUARD_ALIGNMENT)]; filled++)
+    {
+        if (*filled != GUARD_FILL) return 0;
+    }
+    return 1;
+#else
+    return strcmp(&mem[guard->size], end) == 0;
+#endif
+}
+
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+/*-------------------------------------------------------- */
+/* The internal heap is a two-level segregated fit allocator. Its blocks lie one after the
+ * other, each behind a Guard whose block field holds the size of the space after it, with
+ * the flags below in its low bits. Free blocks are kept in lists by size class: the first
+ * level is the highest power of two in their size, and the second splits the range up to
+ * the next one in HEAP_SL_COUNT parts. Bitmaps of the lists in use find a block that is
+ * big enough in a fixed number of steps. A free block keeps its list links in its own
+ * space, and repeats its size at the end, so the block after it can find and merge with it. */
+#define BLOCK_FREE      ((size_t)1)
+#define BLOCK_PREV_FREE ((size_t)2)
+#define BLOCK_FLAGS     (BLOCK_FREE | BLOCK_PREV_FREE)
+#define HEAP_GRANULE    ((UNITY_MALLOC_ALIGNMENT < 4) ? 4 : UNITY_MALLOC_ALIGNMENT)
+#define HEAP_ROUND_UP(size) ((((size) + HEAP_GRANULE - 1) / HEAP_GRANULE) * HEAP_GRANULE)
+#define HEAP_SL_LOG2    2
+#define HEAP_SL_COUNT   (1 << HEAP_SL_LOG2)
+#define HEAP_FL_COUNT   (sizeof(size_t) * 8)
+
+typedef struct FreeLinks
+{
+    Guard* next;
+    Guard* previous;
+} FreeLinks;
+
+#define HEAP_MIN_BLOCK HEAP_ROUND_UP(sizeof(FreeLinks) + sizeof(size_t))
+
+static union
+{
+    size_t align_size;
+    void* align_pointer;
+    unsigned char bytes[UNITY_INTERNAL_HEAP_SIZE_BYTES];
+} unity_heap;
+static unsigned char* heap_end; /* NULL until the heap is first used */
+static size_t heap_fl_bitmap;
+static unsigned char heap_sl_bitmap[HEAP_FL_COUNT];
+static Guard* heap_free_lists[HEAP_FL_COUNT][HEAP_SL_COUNT];
+static size_t heap_used;
+static size_t heap_peak;
+
+static size_t heap_block_for(size_t size)
+{
+    const size_t block = HEAP_ROUND_UP(size + sizeof(end));
+    return (block < HEAP_MIN_BLOCK) ? HEAP_MIN_BLOCK : block;
+}
+
+static size_t block_size(const Guard* guard)
+{
+    return guard->block & ~BLOCK_FLAGS;
+}
+
+static Guard* block_after(Guard* guard)
+{
+    unsigned char* next = (unsigned char*)(void*)(guard + 1) + block_size(guard);
+    return (next < heap_end) ? (Guard*)(void*)next : NULL;
+}
+
+static Guard* first_block(void)
+{
+    return (heap_end > unity_heap.bytes) ? (Guard*)(void*)unity_heap.bytes : NULL;
+}
+
+static Guard* block_before(Guard* guard)
+{
+    const size_t size = ((size_t*)(void*)guard)[-1];
+    return (Guard*)(void*)((unsigned char*)(void*)guard - size - sizeof(Guard));
+}
+
+static FreeLinks* links_of(Guard* guard)
+{
+    return (FreeLinks*)(void*)(guard + 1);
+}
+
+static void mark_free(Guard* guard)
+{
+    Guard* next = block_after(guard);
+    size_t* footer = (size_t*)(void*)((unsigned char*)(void*)(guard + 1) + block_size(guard)) - 1;
+    guard->block |= BLOCK_FREE;
+    *footer = block_size(guard);
+    if (next != NULL)
+        next->block |= BLOCK_PREV_FREE;
+}
+
+static void mark_used(Guard* guard)
+{
+    Guard* next = block_after(guard);
+    guard->block &= ~BLOCK_FREE;
+    if (next != NULL)
+        next->block &= ~BLOCK_PREV_FREE;
+}
+
+static unsigned int highest_bit(size_t value)
+{
+    unsigned int bit = 0;
+    while (value >>= 1)
+        bit++;
+    return bit;
+}
+
+static unsigned int lowest_bit(size_t value)
+{
+    unsigned int bit = 0;
+    while ((value & 1) == 0)
+    {
+        value >>= 1;
+        bit++;
+    }
+    return bit;
+}
+
+/* Blocks are never smaller than HEAP_MIN_BLOCK, so the first level is always above HEAP_SL_LOG2 */
+static void size_class(size_t size, unsigned int* fl, unsigned int* sl)
+{
+    *fl = highest_bit(size);
+    *sl = (unsigned int)(size >> (*fl - HEAP_SL_LOG2)) - HEAP_SL_COUNT;
+}
+
+static void heap_insert(Guard* guard)
+{
+    unsigned int fl;
+    unsigned int sl;
+    FreeLinks* links = links_of(guard);
+
+    size_class(block_size(guard), &fl, &sl);
+    links->previous = NULL;
+    links->next = heap_free_lists[fl][sl];
+    if (links->next != NULL)
+        links_of(links->next)->previous = guard;
+    heap_free_lists[fl][sl] = guard;
+    heap_fl_bitmap |= (size_t)1 << fl;
+    heap_sl_bitmap[fl] = (unsigned char)(heap_sl_bitmap[fl] | (1u << sl));
+}
+
+static void heap_remove(Guard* guard)
+{
+    unsigned int fl;
+    unsigned int sl;
+    FreeLinks* links = links_of(guard);
+
+    size_class(block_size(guard), &fl, &sl);
+    if (links->next != NULL)
+        links_of(links->next)->previous = links->previous;
+    if (links->previous != NULL)
+    {
+        links_of(links->previous)->next = links->next;
+    }
+    else
+    {
+        heap_free_lists[fl][sl] = links->next;
+        if (links->next == NULL)
+        {
+            heap_sl_bitmap[fl] = (unsigned char)(heap_sl_bitmap[fl] & ~(1u << sl));
+            if (heap_sl_bitmap[fl] == 0)
+                heap_fl_bitmap &= ~((size_t)1 << fl);
+        }
+    }
+}
+
+static Guard* heap_find(size_t block)
+{
+    unsigned int fl;
+    unsigned int sl;
+    size_t sl_map;
+    Guard* guard;
+
+    /* Look from the class above the one block falls in, where every block is big enough */
+    size_class(block + ((size_t)1 << (highest_bit(block) - HEAP_SL_LOG2)) - 1, &fl, &sl);
+    sl_map = heap_sl_bitmap[fl] & (~(size_t)0 << sl);
+    if (sl_map == 0)
+    {
+        const size_t fl_map = (fl + 1 < HEAP_FL_COUNT) ? (heap_fl_bitmap & (~(size_t)0 << (fl + 1))) : 0;
+        if (fl_map != 0)
+        {
+            fl = lowest_bit(fl_map);
+            sl_map = heap_sl_bitmap[fl];
+        }
+    }
+    if (sl_map != 0)
+        return heap_free_lists[fl][lowest_bit(sl_map)];
+
+    /* Nothing bigger is free, but block's own class may still hold one that fits */
+    size_class(block, &fl, &sl);
+    for (guard = heap_free_lists[fl][sl]; guard != NULL; guard = links_of(guard)->next)
+    {
+        if (block_size(guard) >= block)
+            return guard;
+    }
+    return NULL;
+}
+
+/* Gives what a used block doesn't need back to the heap, when it's enough for a block of its own */
+static void heap_trim(Guard* guard, size_t block)
+{
+    Guard* rest;
+
+    if (block_size(guard) < block + sizeof(Guard) + HEAP_MIN_BLOCK)
+        return;
+    rest = (Guard*)(void*)((unsigned char*)(void*)(guard + 1) + block);
+    rest->block = block_size(guard) - block - sizeof(Guard);
+    guard->block = block | (guard->block & BLOCK_FLAGS);
+    mark_free(rest);
+    heap_insert(rest);
+}
+
+static void heap_track_use(size_t before, size_t after)
+{
+    heap_used = heap_used - before + after;
+    if (heap_used > heap_peak)
+        heap_peak = heap_used;
+}
+
+/* The heap starts out as one free block */
+static void heap_init(void)
+{
+    Guard* first = (Guard*)(void*)unity_heap.bytes;
+
+    heap_end = unity_heap.bytes;
+    if (sizeof(unity_heap.bytes) >= sizeof(Guard) + HEAP_MIN_BLOCK)
+    {
+        first->block = ((sizeof(unity_heap.bytes) - sizeof(Guard)) / HEAP_GRANULE) * HEAP_GRANULE;
+        heap_end += sizeof(Guard) + first->block;
+        mark_free(first);
+        heap_insert(first);
+    }
+}
+
+static Guard* heap_allocate(size_t size)
+{
+    const size_t block = heap_block_for(size);
+    Guard* guard;
+
+    if (heap_end == NULL)
+        heap_init();
+    guard = heap_find(block);
+    if (guard == NULL)
+        return NULL;
+    heap_remove(guard);
+    mark_used(guard);
+    heap_trim(guard, block);
+    heap_track_use(0, sizeof(Guard) + block_size(guard));
+    return guard;
+}
+
+static void heap_release(Guard* guard)
+{
+    Guard* next = block_after(guard);
+
+    heap_track_use(sizeof(Guard) + block_size(guard), 0);
+    if (next != NULL && (next->block & BLOCK_FREE))
+    {
+        heap_remove(next);
+        guard->block += sizeof(Guard) + block_size(next);
+    }
+    if (guard->block & BLOCK_PREV_FREE)
+    {
+        Guard* previous = block_before(guard);
+        heap_remove(previous);
+        previous->block += sizeof(Guard) + block_size(guard);
+        guard = previous;
+    }
+    mark_free(guard);
+    heap_insert(guard);
+}
+
+/* Whether a used block can be made big enough for size bytes without moving it, because
+ * the block after it is free and big enough */
+static int heap_can_grow(Guard* guard, size_t size)
+{
+    Guard* next = block_after(guard);
+
+    return next != NULL && (next->block & BLOCK_FREE) &&
+           block_size(guard) + sizeof(Guard) + block_size(next) >= heap_block_for(size);
+}
+
+/* Makes a used block big enough for size bytes by taking in the block after it, which
+ * heap_can_grow has found to be free and big enough */
+static void heap_grow(Guard* guard, size_t size)
+{
+    const size_t block = heap_block_for(size);
+    const size_t before = block_size(guard);
+    Guard* next = block_after(guard);
+
+    heap_remove(next);
+    guard->block += sizeof(Guard) + block_size(next);
+    mark_used(guard);
+    heap_trim(guard, block);
+    heap_track_use(before, block_size(guard));
+}
+
+static void heap_start_test(void)
+{
+    heap_peak = heap_used;
+}
+
+void UnityMalloc_GetHeapStats(UnityHeapStats* stats)
+{
+    Guard* guard;
+
+    UNITY_MEMORY_LOCK();
+    if (heap_end == NULL)
+        heap_init();
+    memset(stats, 0, sizeof(*stats));
+    stats->size = sizeof(unity_heap.bytes);
+    stats->used_bytes = heap_used;
+    stats->peak_bytes = heap_peak;
+    for (guard = first_block(); guard != NULL; guard = block_after(guard))
+    {
+        if (guard->block & BLOCK_FREE)
+        {
+            stats->free_bytes += block_size(guard);
+            stats->free_blocks++;
+            if (block_size(guard) > stats->largest_free_block)
+                stats->largest_free_block = block_size(guard);
+        }
+    }
+    UNITY_MEMORY_UNLOCK();
+}
+#elif !defined(UNITY_MALLOC_GUARD_PAGES)
+static size_t unity_size_round_up(size_t size)
+{
+    size_t rounded_size;
+
+    rounded_size = ((size + UNITY_MALLOC_ALIGNMENT - 1) / UNITY_MALLOC_ALIGNMENT) * UNITY_MALLOC_ALIGNMENT;
+
+    return rounded_size;
+}
+#endif
+
+#ifdef UNITY_MALLOC_ARENA
+/*-------------------------------------------------------- */
+/* In arena mode, blocks are cut from the top of large chunks and never handed back one at
+ * a time: freeing only takes a block off the live list. The end of each test reclaims them
+ * all at once by starting again where the test started, so blocks allocated before it, in
+ * main or a suite's setup, are kept. Chunks are kept for the tests that follow, so the ones
+ * after the current chunk are left over from earlier tests, and are emptied as they are
+ * reached again. */
+typedef struct ArenaChunk
+{
+    struct ArenaChunk* next;
+    size_t size;
+    size_t used;
+} ArenaChunk;
+
+static ArenaChunk* arena_first;
+static ArenaChunk* arena_current;
+static ArenaChunk* arena_test_chunk; /* where the arena was when the test started */
+static size_t arena_test_used;
+
+static Guard* arena_allocate(size_t block)
+{
+    ArenaChunk* chunk = arena_current;
+    Guard* guard;
+
+    if (chunk == NULL || chunk->size - chunk->used < block)
+    {
+        for (chunk = (chunk != NULL) ? chunk->next : NULL; chunk != NULL; chunk = chunk->next)
+        {
+            if (chunk->size >= block)
+                break;
+        }
+        if (chunk == NULL)
+        {
+            size_t size = (block > UNITY_MALLOC_ARENA_CHUNK_BYTES) ? block : UNITY_MALLOC_ARENA_CHUNK_BYTES;
+            chunk = (ArenaChunk*)UNITY_MALLOC(sizeof(ArenaChunk) + size);
+            if (chunk == NULL) return NULL;
+            chunk->size = size;
+            if (arena_current != NULL)
+            {
+                chunk->next = arena_current->next;
+                arena_current->next = chunk;
+            }
+            else
+            {
+                chunk->next = NULL;
+                arena_first = chunk;
+            }
+        }
+        chunk->used = 0;
+        arena_current = chunk;
+    }
+    guard = (Guard*)((char*)&chunk[1] + chunk->used);
+    chunk->used += block;
+    return guard;
+}
 
-void UnityMalloc_StartTest(void)
+/* A reclaimed block points back at itself, so freeing it late does nothing */
+static int arena_reclaimed(const Guard* guard)
 {
-    malloc_count = 0;
-    malloc_fail_countdown = MALLOC_DONT_FAIL;
+    return guard->previous == guard;
 }
 
-void UnityMalloc_EndTest(void)
+static void arena_start_test(void)
 {
-    malloc_fail_countdown = MALLOC_DONT_FAIL;
-    if (malloc_count != 0)
+    arena_test_chunk = arena_current;
+    arena_test_used = (arena_current != NULL) ? arena_current->used : 0;
+}
+
+/* Takes a fixed number of steps, plus one for each block a failing test leaked */
+static void arena_reset(void)
+{
+    Guard* guard = test_oldest;
+
+    if (test_oldest != NULL)
     {
-        UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, "This test leaks!");
+        live_newest = test_oldest->previous;
+        if (live_newest != NULL)
+            live_newest->next = NULL;
+        else
+            live_oldest = NULL;
+    }
+    while (guard != NULL)
+    {
+        Guard* next = guard->next;
+        guard->previous = guard;
+        guard = next;
     }
+    test_oldest = NULL;
+    malloc_count = 0;
+    arena_current = (arena_test_chunk != NULL) ? arena_test_chunk : arena_first;
+    if (arena_current != NULL)
+        arena_current->used = arena_test_used;
 }
+#endif
 
-void UnityMalloc_MakeMallocFailAfterCount(int countdown)
+/* The checks every new allocation goes through, whether or not it needs a new block */
+static int allocation_allowed(size_t size)
 {
-    malloc_fail_countdown = countdown;
+    alloc_attempts++;
+    if (malloc_fail_countdown != MALLOC_DONT_FAIL)
+    {
+        if (malloc_fail_countdown == 0)
+            return 0;
+        malloc_fail_countdown--;
+    }
+    if (alloc_attempts == fail_only)
+        return 0;
+    if (fail_from_size != 0 && size >= fail_from_size)
+        return 0;
+    if (fail_percent != 0 && random_failure())
+        return 0;
+
+    if (size == 0) return 0;
+    check_budget(size);
+    return 1;
 }
 
-/* These definitions are always included from unity_fixture_malloc_overrides.h */
-/* We undef to use them or avoid conflict with <stdlib.h> per the C standard */
-#undef malloc
-#undef free
-#undef calloc
-#undef realloc
+static void* allocate(size_t size, const void* caller)
+{
+    char* mem;
+    Guard* guard;
+    const char* file = call_site_file;
 
+    call_site_file = NULL;
+    if (!allocation_allowed(size)) return NULL;
 #ifdef UNITY_EXCLUDE_STDLIB_MALLOC
-static unsigned char unity_heap[UNITY_INTERNAL_HEAP_SIZE_BYTES];
-static size_t heap_index;
+    guard = heap_allocate(size);
+#elif defined(UNITY_MALLOC_ARENA)
+    guard = arena_allocate(sizeof(Guard) + unity_size_round_up(size + sizeof(end)));
+#elif defined(UNITY_MALLOC_GUARD_PAGES)
+    mem = guarded_allocate(size);
+    guard = (mem != NULL) ? guard_of(mem) : NULL;
 #else
-#include <stdlib.h>
+    guard = (Guard*)UNITY_MALLOC(sizeof(Guard) + unity_size_round_up(size + sizeof(end)));
 #endif
+    if (guard == NULL) return NULL;
+    malloc_count++;
+    track_alloc(size);
+#ifndef UNITY_EXCLUDE_STDLIB_MALLOC
+    guard->previous = live_newest;
+    guard->next = NULL;
+    if (live_newest != NULL)
+        live_newest->next = guard;
+    else
+        live_oldest = guard;
+    live_newest = guard;
+    if (test_oldest == NULL)
+        test_oldest = guard;
+    guard->file = file;
+    guard->line = call_site_line;
+    guard->caller = caller;
+    guard->sequence = malloc_stats.allocs;
+#else
+    (void)caller;
+    (void)file;
+#endif
+    guard->size = size;
+    guard->guard_space = 0;
+#ifndef UNITY_MALLOC_GUARD_PAGES
+    mem = (char*)&(guard[1]);
+#endif
+    mark_end(mem);
 
-typedef struct GuardBytes
+    return (void*)mem;
+}
+
+void* unity_malloc(size_t size)
 {
-    size_t size;
-    size_t guard_space;
-} Guard;
+    void* mem;
 
-#define UNITY_MALLOC_ALIGNMENT (UNITY_POINTER_WIDTH / 8)
-static const char end[] = "END";
+    UNITY_MEMORY_LOCK();
+    mem = allocate(size, CALLER());
+    UNITY_MEMORY_UNLOCK();
+    return mem;
+}
 
-static size_t unity_size_round_up(size_t size)
+static int isOverrun(void* mem)
 {
-    size_t rounded_size;
-
-    rounded_size = ((size + UNITY_MALLOC_ALIGNMENT - 1) / UNITY_MALLOC_ALIGNMENT) * UNITY_MALLOC_ALIGNMENT;
+    return guard_of(mem)->guard_space != 0 || !end_intact((char*)mem);
+}
 
-    return rounded_size;
+#ifndef UNITY_EXCLUDE_STDLIB_MALLOC
+/* Gives a block back to where it came from, once nothing can use it */
+static void free_block(Guard* guard)
+{
+#if defined(UNITY_MALLOC_GUARD_PAGES)
+    guarded_release(block_of(guard), guard->size);
+#elif !defined(UNITY_MALLOC_ARENA)
+    UNITY_FREE(guard);
+#else
+    (void)guard; /* the arena takes it back at the end of the test */
+#endif
 }
+#endif
 
-void* unity_malloc(size_t size)
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+/*-------------------------------------------------------- */
+/* With a quarantine, freed blocks aren't given back straight away. They are filled with
+ * poison and queued, oldest first, until more than UNITY_MALLOC_QUARANTINE_BYTES of them
+ * are waiting. A block leaving the queue, or still in it at the end of a test, must hold
+ * nothing but poison, or something wrote to it through a pointer kept after it was freed.
+ * The queue reuses the Guard's links, and marks it so that passing the block to free() or
+ * realloc() again is caught as well, as long as it is still queued. */
+#define QUARANTINE_POISON ((char)0xDD)
+#define QUARANTINED ((size_t)0xDEADBEEFu)
+
+static Guard* quarantine_oldest;
+static Guard* quarantine_newest;
+static size_t quarantine_bytes;
+static int quarantine_spoiled; /* set until the use after free below is reported */
+static char quarantine_message[BLOCK_MESSAGE_SIZE];
+
+static int in_quarantine(const Guard* guard)
 {
-    char* mem;
-    Guard* guard;
-    size_t total_size;
+    return guard->guard_space == QUARANTINED;
+}
 
-    total_size = sizeof(Guard) + unity_size_round_up(size + sizeof(end));
+/* Notes the first byte that isn't poison any more, unless a use is already waiting */
+static void check_poison(Guard* guard)
+{
+    const char* mem = block_of(guard);
+    size_t offset = 0;
+    char* out;
 
-    if (malloc_fail_countdown != MALLOC_DONT_FAIL)
+    while (offset < guard->size && mem[offset] == QUARANTINE_POISON)
     {
-        if (malloc_fail_countdown == 0)
-            return NULL;
-        malloc_fail_countdown--;
+        offset++;
     }
+    if (offset == guard->size || quarantine_spoiled)
+        return;
+    out = append_text(quarantine_message, "Use after free: byte ");
+    out = append_number(out, offset);
+    out = append_text(out, " of the ");
+    out = append_block(out, guard);
+    out = append_text(out, " changed after it was freed");
+    *out = '\0';
+    quarantine_spoiled = 1;
+}
 
-    if (size == 0) return NULL;
-#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
-    if (heap_index + total_size > UNITY_INTERNAL_HEAP_SIZE_BYTES)
-    {
-        guard = NULL;
-    }
+static void release_quarantined(void)
+{
+    Guard* guard = quarantine_oldest;
+
+    quarantine_oldest = guard->next;
+    if (quarantine_oldest == NULL)
+        quarantine_newest = NULL;
+    quarantine_bytes -= guard->size;
+    check_poison(guard);
+    free_block(guard);
+}
+
+static void quarantine(Guard* guard)
+{
+    memset(block_of(guard), QUARANTINE_POISON, guard->size);
+    guard->guard_space = QUARANTINED;
+    guard->previous = NULL;
+    guard->next = NULL;
+    if (quarantine_newest != NULL)
+        quarantine_newest->next = guard;
     else
+        quarantine_oldest = guard;
+    quarantine_newest = guard;
+    quarantine_bytes += guard->size;
+    while (quarantine_bytes > (size_t)UNITY_MALLOC_QUARANTINE_BYTES)
     {
-        /* We know we can get away with this cast because we aligned memory already */
-        guard = (Guard*)(void*)(&unity_heap[heap_index]);
-        heap_index += total_size;
+        release_quarantined();
     }
-#else
-    guard = (Guard*)UNITY_MALLOC(total_size);
-#endif
-    if (guard == NULL) return NULL;
-    malloc_count++;
-    guard->size = size;
-    guard->guard_space = 0;
-    mem = (char*)&(guard[1]);
-    memcpy(&mem[size], end, sizeof(end));
-
-    return (void*)mem;
 }
 
-static int isOverrun(void* mem)
+/* The use after free found since this was last asked, if there was one */
+static const char* used_after_free(void)
 {
-    Guard* guard = (Guard*)mem;
-    char* memAsChar = (char*)mem;
-    guard--;
+    const int spoiled = quarantine_spoiled;
 
-    return guard->guard_space != 0 || strcmp(&memAsChar[guard->size], end) != 0;
+    quarantine_spoiled = 0;
+    return spoiled ? quarantine_message : NULL;
 }
 
+/* Checks and releases every block still queued, as at the end of a test */
+static const char* release_quarantine(void)
+{
+    while (quarantine_oldest != NULL)
+    {
+        release_quarantined();
+    }
+    return used_after_free();
+}
+#endif
+
 static void release_memory(void* mem)
 {
-    Guard* guard = (Guard*)mem;
-    guard--;
+    Guard* guard = guard_of(mem);
 
     malloc_count--;
+    track_free(guard->size);
 #ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    heap_release(guard);
+#else
+    if (guard == test_oldest)
+        test_oldest = guard->next;
+    if (guard->previous != NULL)
+        guard->previous->next = guard->next;
+    else
+        live_oldest = guard->next;
+    if (guard->next != NULL)
+        guard->next->previous = guard->previous;
+    else
+        live_newest = guard->previous;
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+    quarantine(guard);
+#else
+    free_block(guard);
+#endif
+#endif
+}
+
+static void report_leak(size_t size, const Guard* guard)
+{
+    UnityPrint("  Leaked ");
+    UnityPrintNumberUnsigned((UNITY_UINT)size);
+    UnityPrint(" bytes");
+#ifndef UNITY_EXCLUDE_STDLIB_MALLOC
+    UnityPrint(" in allocation ");
+    UnityPrintNumberUnsigned((UNITY_UINT)guard->sequence);
+    if (guard->file != NULL)
+    {
+        UnityPrint(" at ");
+        UnityPrint(guard->file);
+        UNITY_OUTPUT_CHAR(':');
+        UnityPrintNumberUnsigned((UNITY_UINT)guard->line);
+    }
+    else if (guard->caller != NULL)
     {
-        size_t block_size;
+        UnityPrint(" called from 0x");
+        UnityPrintNumberHex((UNITY_UINT)(UNITY_PTR_TO_INT)guard->caller, (char)(UNITY_POINTER_WIDTH / 4));
+    }
+#else
+    (void)guard;
+#endif
+    UNITY_PRINT_EOL();
+}
 
-        block_size = unity_size_round_up(guard->size + sizeof(end));
+/* Lists the blocks the test still has allocated, oldest first, up to UNITY_MALLOC_LEAK_REPORT_LIMIT.
+ * On the internal heap, blocks leaked by earlier tests can't be told apart and are listed too. */
+static void report_leaks(void)
+{
+    size_t reported = 0;
+    size_t leaked = 0;
+    Guard* guard;
 
-        if (mem == unity_heap + heap_index - block_size)
+    UnityEndOpenLine();
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    for (guard = first_block(); guard != NULL; guard = block_after(guard))
+    {
+        if (guard->block & BLOCK_FREE)
+            continue;
+#else
+    for (guard = test_oldest; guard != NULL; guard = guard->next)
+    {
+#endif
+        if (reported < UNITY_MALLOC_LEAK_REPORT_LIMIT)
         {
-            heap_index -= (sizeof(Guard) + block_size);
+            report_leak(guard->size, guard);
+            reported++;
         }
+        leaked++;
+    }
+    if (leaked > reported)
+    {
+        UnityPrint("  ...and ");
+        UnityPrintNumberUnsigned((UNITY_UINT)(leaked - reported));
+        UnityPrint(" more");
+        UNITY_PRINT_EOL();
     }
-#else
-    UNITY_FREE(guard);
-#endif
 }
 
 void unity_free(void* mem)
 {
     int overrun;
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+    const char* spoiled;
+#endif
 
     if (mem == NULL)
     {
         return;
     }
 
+    UNITY_MEMORY_LOCK();
+#ifdef UNITY_MALLOC_ARENA
+    if (arena_reclaimed(guard_of(mem)))
+    {
+        UNITY_MEMORY_UNLOCK();
+        return;
+    }
+#endif
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+    if (in_quarantine(guard_of(mem)))
+    {
+        UNITY_MEMORY_UNLOCK();
+        UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, "Freed memory passed to free()");
+    }
+#endif
     overrun = isOverrun(mem);
     release_memory(mem);
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+    spoiled = used_after_free();
+#endif
+    UNITY_MEMORY_UNLOCK();
     if (overrun)
     {
         UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, "Buffer overrun detected during free()");
     }
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+    if (spoiled != NULL)
+    {
+        UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, spoiled);
+    }
+#endif
 }
 
 void* unity_calloc(size_t num, size_t size)
 {
-    void* mem = unity_malloc(num * size);
+    void* mem;
+
+    UNITY_MEMORY_LOCK();
+    mem = allocate(num * size, CALLER());
+    UNITY_MEMORY_UNLOCK();
     if (mem == NULL) return NULL;
     memset(mem, 0, num * size);
     return mem;
 }
 
-void* unity_realloc(void* oldMem, size_t size)
+static void* reallocate(void* oldMem, size_t size, const void* caller)
 {
-    Guard* guard = (Guard*)oldMem;
+    Guard* guard;
     void* newMem;
 
-    if (oldMem == NULL) return unity_malloc(size);
+    if (oldMem == NULL) return allocate(size, caller);
 
-    guard--;
+    guard = guard_of(oldMem);
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+    if (in_quarantine(guard))
+    {
+        UNITY_MEMORY_UNLOCK();
+        UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, "Freed memory passed to realloc()");
+    }
+#endif
     if (isOverrun(oldMem))
     {
         release_memory(oldMem);
+        UNITY_MEMORY_UNLOCK();
         UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, "Buffer overrun detected during realloc()");
     }
 
@@ -184,20 +1499,319 @@ void* unity_realloc(void* oldMem, size_t size)
     if (guard->size >= size) return oldMem;
 
 #ifdef UNITY_EXCLUDE_STDLIB_MALLOC /* Optimization if memory is expandable */
+    if (heap_can_grow(guard, size))
     {
-        size_t old_total_size = unity_size_round_up(guard->size + sizeof(end));
-
-        if ((oldMem == unity_heap + heap_index - old_total_size) &&
-            ((heap_index - old_total_size + unity_size_round_up(size + sizeof(end))) <= UNITY_INTERNAL_HEAP_SIZE_BYTES))
-        {
-            release_memory(oldMem);    /* Not thread-safe, like unity_heap generally */
-            return unity_malloc(size); /* No memcpy since data is in place */
-        }
+        /* Counted as the free and the new allocation it saves. A refused one leaves the
+         * block as it was. */
+        if (!allocation_allowed(size))
+            return NULL;
+        heap_grow(guard, size);
+        track_free(guard->size);
+        track_alloc(size);
+        guard->size = size;
+        mark_end((char*)oldMem);
+        return oldMem;
     }
 #endif
-    newMem = unity_malloc(size);
+    newMem = allocate(size, caller);
     if (newMem == NULL) return NULL; /* Do not release old memory */
     memcpy(newMem, oldMem, guard->size);
+    malloc_stats.realloc_moves++;
+    malloc_stats.realloc_copy_bytes += guard->size;
     release_memory(oldMem);
     return newMem;
 }
+
+void* unity_realloc(void* oldMem, size_t size)
+{
+    void* mem;
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+    const char* spoiled;
+#endif
+
+    UNITY_MEMORY_LOCK();
+    mem = reallocate(oldMem, size, CALLER());
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+    spoiled = used_after_free();
+#endif
+    UNITY_MEMORY_UNLOCK();
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+    if (spoiled != NULL)
+    {
+        unity_free(mem);
+        UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, spoiled);
+    }
+#endif
+    return mem;
+}
+
+#ifndef UNITY_EXCLUDE_SETJMP_H
+/*-------------------------------------------------------- */
+/* An allocation sweep runs its body once as it is, to see which allocations it makes, then
+ * again with each of those failing in turn, with the requests from each size class upwards
+ * failing, and with failures picked at random. */
+#define SWEEP_MAX_WORKERS 64
+
+#define RUN_PASSED  0
+#define RUN_FAILED  1
+#define RUN_LEAKED  2
+#define RUN_CRASHED 3
+
+typedef struct SweepPlan
+{
+    size_t allocations;
+    size_t thresholds[UNITY_MALLOC_HISTOGRAM_BINS];
+    size_t size_runs;
+    size_t runs;
+} SweepPlan;
+
+static unsigned int sweep_workers = UNITY_ALLOC_SWEEP_WORKERS;
+static unsigned int sweep_random_runs = UNITY_ALLOC_SWEEP_RANDOM_RUNS;
+static unsigned int sweep_random_percent = UNITY_ALLOC_SWEEP_RANDOM_PERCENT;
+static char sweep_message[64];
+
+void UnityMalloc_SetSweepWorkers(unsigned int workers)
+{
+    sweep_workers = (workers > SWEEP_MAX_WORKERS) ? SWEEP_MAX_WORKERS : workers;
+}
+
+void UnityMalloc_SetSweepRandomRuns(unsigned int runs, unsigned int percent)
+{
+    sweep_random_runs = runs;
+    sweep_random_percent = percent;
+}
+
+static unsigned int sweep_seed(const SweepPlan* plan, size_t run)
+{
+    return (unsigned int)UnitySeed + (unsigned int)(run - plan->allocations - plan->size_runs);
+}
+
+static void clear_faults(void)
+{
+    UnityMalloc_MakeMallocFailAfterCount(MALLOC_DONT_FAIL);
+    UnityMalloc_MakeMallocFailOnly(0);
+    UnityMalloc_MakeMallocFailFromSize(0);
+    UnityMalloc_MakeMallocFailRandomly(0, 0);
+}
+
+static void set_faults(const SweepPlan* plan, size_t run)
+{
+    clear_faults();
+    if (run < plan->allocations)
+        UnityMalloc_MakeMallocFailOnly(run + 1);
+    else if (run < plan->allocations + plan->size_runs)
+        UnityMalloc_MakeMallocFailFromSize(plan->thresholds[run - plan->allocations]);
+    else
+        UnityMalloc_MakeMallocFailRandomly(sweep_random_percent, sweep_seed(plan, run));
+}
+
+/* Blocks a run leaks are released again, so the runs after it start from the same heap.
+ * They are the ones newer than both the newest block before the run and the allocation count
+ * then, which also keeps blocks left over from earlier tests out of it. The internal heap
+ * can't tell them from the test's own blocks, so there they stay. */
+static const void* newest_block(void)
+{
+#ifndef UNITY_EXCLUDE_STDLIB_MALLOC
+    return live_newest;
+#else
+    return NULL;
+#endif
+}
+
+static void release_leftovers(const void* newest_before, size_t allocs_before)
+{
+#ifndef UNITY_EXCLUDE_STDLIB_MALLOC
+    UNITY_MEMORY_LOCK();
+    while (live_newest != NULL && live_newest != newest_before && live_newest->sequence > allocs_before)
+    {
+        release_memory(block_of(live_newest));
+    }
+    UNITY_MEMORY_UNLOCK();
+#else
+    (void)newest_before;
+    (void)allocs_before;
+#endif
+}
+
+static int try_run(void (*body)(void), const SweepPlan* plan, size_t run)
+{
+    const int count_before = malloc_count;
+    const void* const newest_before = newest_block();
+    const size_t allocs_before = malloc_stats.allocs;
+    const int depth_before = alloc_budget_depth;
+    int result = RUN_PASSED;
+
+    set_faults(plan, run);
+    UNITY_CLR_DETAILS();
+    if (TEST_PROTECT())
+    {
+        body();
+    }
+    clear_faults();
+    alloc_budget_depth = depth_before;
+    if (Unity.CurrentTestFailed)
+    {
+        result = RUN_FAILED;
+    }
+    else if (malloc_count > count_before)
+    {
+        result = RUN_LEAKED;
+    }
+    release_leftovers(newest_before, allocs_before);
+    Unity.CurrentTestFailed = 0;
+    Unity.CurrentTestIgnored = 0;
+    return result;
+}
+
+static void report_run(const SweepPlan* plan, size_t run, int result)
+{
+    static const char* const outcomes[] = { "passed", "failed", "leaked", "crashed" };
+
+    if (run < plan->allocations)
+    {
+        UnityPrint("  Allocation ");
+        UnityPrintNumberUnsigned((UNITY_UINT)run + 1);
+        UnityPrint(" of ");
+        UnityPrintNumberUnsigned((UNITY_UINT)plan->allocations);
+    }
+    else if (run < plan->allocations + plan->size_runs)
+    {
+        UnityPrint("  Requests of ");
+        UnityPrintNumberUnsigned((UNITY_UINT)plan->thresholds[run - plan->allocations]);
+        UnityPrint(" bytes or more");
+    }
+    else
+    {
+        UnityPrint("  Random ");
+        UnityPrintNumberUnsigned((UNITY_UINT)sweep_random_percent);
+        UnityPrint("% from seed ");
+        UnityPrintNumberUnsigned((UNITY_UINT)sweep_seed(plan, run));
+    }
+    UnityPrint(" failing: ");
+    UnityPrint(outcomes[result]);
+    UNITY_PRINT_EOL();
+}
+
+/* What a failing run printed is ended before the run itself is reported */
+static int run_here(void (*body)(void), const SweepPlan* plan, size_t run)
+{
+    const int result = try_run(body, plan, run);
+
+    if (result == RUN_FAILED)
+    {
+        UNITY_PRINT_EOL();
+    }
+    if (result != RUN_PASSED)
+    {
+        report_run(plan, run, result);
+    }
+    return result != RUN_PASSED;
+}
+
+#ifdef SWEEP_WORKERS_FORK
+/* Every run gets a process of its own, with its output thrown away, so a run that crashes
+ * is reported like any other. Up to sweep_workers of them run at a time, and they are
+ * reported in order. */
+static size_t run_in_workers(void (*body)(void), const SweepPlan* plan)
+{
+    pid_t pids[SWEEP_MAX_WORKERS];
+    size_t first = 0;
+    size_t next = 0;
+    size_t wrong = 0;
+
+    UNITY_OUTPUT_FLUSH();
+    (void)fflush(stdout);
+    (void)fflush(stderr);
+    while (first < plan->runs)
+    {
+        while (next < plan->runs && next - first < sweep_workers)
+        {
+            const pid_t pid = fork();
+            if (pid == 0)
+            {
+                const int nowhere = open("/dev/null", O_WRONLY);
+                if (nowhere >= 0)
+                {
+                    (void)dup2(nowhere, 1);
+                    (void)dup2(nowhere, 2);
+                }
+                _exit(try_run(body, plan, next));
+            }
+            pids[next % sweep_workers] = pid;
+            next++;
+        }
+        if (pids[first % sweep_workers] < 0)
+        {
+            /* This run's process couldn't be started, so it is run here */
+            wrong += (size_t)run_here(body, plan, first);
+        }
+        else
+        {
+            int status = 0;
+            int result = RUN_CRASHED;
+            if (waitpid(pids[first % sweep_workers], &status, 0) > 0 && WIFEXITED(status) &&
+                WEXITSTATUS(status) < RUN_CRASHED)
+            {
+                result = WEXITSTATUS(status);
+            }
+            if (result != RUN_PASSED)
+            {
+                report_run(plan, first, result);
+                wrong++;
+            }
+        }
+        first++;
+    }
+    return wrong;
+}
+#endif
+
+void UnityMalloc_Sweep(void (*body)(void), unsigned int line)
+{
+    jmp_buf test_frame;
+    SweepPlan plan;
+    size_t histogram[UNITY_MALLOC_HISTOGRAM_BINS];
+    size_t wrong = 0;
+    size_t bin;
+    char* out;
+
+    memcpy(histogram, malloc_stats.size_histogram, sizeof(histogram));
+    clear_faults();
+    body(); /* failing without any failed allocation is the test's own failure */
+    plan.allocations = alloc_attempts;
+    plan.size_runs = 0;
+    for (bin = 0; bin < UNITY_MALLOC_HISTOGRAM_BINS; bin++)
+    {
+        if (malloc_stats.size_histogram[bin] != histogram[bin])
+            plan.thresholds[plan.size_runs++] = (size_t)1 << bin;
+    }
+    plan.runs = plan.allocations + plan.size_runs + sweep_random_runs;
+
+    memcpy(test_frame, Unity.AbortFrame, sizeof(jmp_buf));
+#ifdef SWEEP_WORKERS_FORK
+    if (sweep_workers > 1)
+    {
+        wrong = run_in_workers(body, &plan);
+    }
+    else
+#endif
+    {
+        size_t run;
+        for (run = 0; run < plan.runs; run++)
+        {
+            wrong += (size_t)run_here(body, &plan, run);
+        }
+    }
+    memcpy(Unity.AbortFrame, test_frame, sizeof(jmp_buf));
+
+    if (wrong != 0)
+    {
+        out = append_number(sweep_message, wrong);
+        out = append_text(out, " of ");
+        out = append_number(out, plan.runs);
+        out = append_text(out, " sweep runs went wrong");
+        *out = '\0';
+        UNITY_TEST_FAIL((UNITY_LINE_TYPE)line, sweep_message);
+    }
+}
+#endif
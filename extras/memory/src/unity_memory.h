@@ -18,14 +18,18 @@ extern "C"
 #ifdef UNITY_EXCLUDE_STDLIB_MALLOC
 /* Define this macro to remove the use of stdlib.h, malloc, and free.
  * Many embedded systems do not have a heap or malloc/free by default.
- * This internal unity_malloc() provides allocated memory deterministically from
- * the end of an array only, unity_free() only releases from end-of-array,
- * blocks are not coalesced, and memory not freed in LIFO order is stranded. */
+ * This internal unity_malloc() provides memory from an array instead, with a
+ * two-level segregated fit allocator: blocks can be freed in any order, free
+ * neighbours are coalesced, and every call takes a bounded number of steps. */
     #ifndef UNITY_INTERNAL_HEAP_SIZE_BYTES
     #define UNITY_INTERNAL_HEAP_SIZE_BYTES 256
     #endif
 #endif
 
+/* Define UNITY_MEMORY_THREAD_SAFE when the code under test allocates from several threads.
+ * The wrappers then serialize on UNITY_MEMORY_LOCK() / UNITY_MEMORY_UNLOCK(), a GCC
+ * __atomic spinlock unless you define your own. */
+
 /* These functions are used by Unity to allocate and release memory
  * on the heap and can be overridden with platform-specific implementations.
  * For example, when using FreeRTOS UNITY_MALLOC becomes pvPortMalloc()
@@ -39,9 +43,17 @@ extern "C"
     extern void UNITY_FREE(void* ptr);
 #endif
 
+#ifdef UNITY_MALLOC_CALL_SITES
+/* Leak reports then show the file and line of each allocation. These need <stdlib.h> to
+ * have been included already, as it can't declare malloc once they are defined. */
+#define malloc  (UnityMalloc_CallSite(__FILE__, __LINE__), unity_malloc)
+#define calloc  (UnityMalloc_CallSite(__FILE__, __LINE__), unity_calloc)
+#define realloc (UnityMalloc_CallSite(__FILE__, __LINE__), unity_realloc)
+#else
 #define malloc  unity_malloc
 #define calloc  unity_calloc
 #define realloc unity_realloc
+#endif
 #define free    unity_free
 
 void* unity_malloc(size_t size);
@@ -49,10 +61,139 @@ void* unity_calloc(size_t num, size_t size);
 void* unity_realloc(void * oldMem, size_t size);
 void unity_free(void * mem);
 
+/* One bin per power of two: bin n counts requests of 2^n up to 2^(n+1)-1 bytes, and the
+ * last bin every request bigger than that too */
+#ifndef UNITY_MALLOC_HISTOGRAM_BINS
+#define UNITY_MALLOC_HISTOGRAM_BINS (sizeof(size_t) * 8)
+#endif
+
+/* Allocation statistics for the current test, cleared by UnityMalloc_StartTest.
+ * They are left untouched by UnityMalloc_EndTest so a runner can still read them afterwards. */
+typedef struct UnityMallocStats
+{
+    size_t current_bytes;
+    size_t peak_bytes;
+    size_t allocs;
+    size_t total_bytes;
+    size_t frees;
+    size_t realloc_moves;
+    size_t realloc_copy_bytes;
+    size_t size_histogram[UNITY_MALLOC_HISTOGRAM_BINS];
+} UnityMallocStats;
+
 /* You must compile with malloc replacement, as defined in unity_fixture_malloc_overrides.h */
 void UnityMalloc_StartTest(void);
 void UnityMalloc_EndTest(void);
 void UnityMalloc_MakeMallocFailAfterCount(int countdown);
+const UnityMallocStats* UnityMalloc_GetStats(void);
+void UnityMalloc_PrintStats(void);
+void UnityMalloc_CallSite(const char* file, unsigned int line);
+
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+/* How the internal heap is used. Bytes in use count each block's bookkeeping as well, and
+ * the peak is the highest it has been since UnityMalloc_StartTest. */
+typedef struct UnityHeapStats
+{
+    size_t size;
+    size_t used_bytes;
+    size_t peak_bytes;
+    size_t free_bytes;
+    size_t free_blocks;
+    size_t largest_free_block;
+} UnityHeapStats;
+
+void UnityMalloc_GetHeapStats(UnityHeapStats* stats);
+#endif
+
+#ifdef UNITY_MALLOC_ARENA
+/* Define this to take blocks from per-test chunks of this many bytes instead of allocating
+ * each one from UNITY_MALLOC. Freeing is then only noted, and UnityMalloc_EndTest reclaims
+ * every block at once. */
+    #ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    #error "UNITY_MALLOC_ARENA takes its chunks from UNITY_MALLOC, so it can't be used with UNITY_EXCLUDE_STDLIB_MALLOC"
+    #endif
+    #ifndef UNITY_MALLOC_ARENA_CHUNK_BYTES
+    #define UNITY_MALLOC_ARENA_CHUNK_BYTES 65536
+    #endif
+#endif
+
+#ifdef UNITY_MALLOC_GUARD_PAGES
+/* Define this on POSIX hosts to map every block on its own, ending flush against a page that
+ * can't be touched, or starting right after one with UNITY_MALLOC_GUARD_PAGES_UNDERRUN. A stray
+ * access then faults as it happens, and fails the test naming the block. Blocks are rounded
+ * up to UNITY_MALLOC_GUARD_ALIGNMENT bytes, the size of a pointer unless you define it, so
+ * they stay aligned. Define it as 1 to have every block end exactly at the page. */
+    #if defined(UNITY_EXCLUDE_STDLIB_MALLOC) || defined(UNITY_MALLOC_ARENA)
+    #error "UNITY_MALLOC_GUARD_PAGES maps every block on its own, so it can't be used with UNITY_EXCLUDE_STDLIB_MALLOC or UNITY_MALLOC_ARENA"
+    #endif
+#endif
+
+#ifdef UNITY_MALLOC_QUARANTINE_BYTES
+/* Define this to hold freed blocks back, filled with poison, until more than this many bytes
+ * of them are waiting. A block that changed while it waited fails the test when it is given
+ * back, or at UnityMalloc_EndTest, naming the first changed byte and where it was allocated. */
+    #ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    #error "UNITY_MALLOC_QUARANTINE_BYTES keeps freed blocks in the list of the stdlib heap, so it can't be used with UNITY_EXCLUDE_STDLIB_MALLOC"
+    #endif
+#endif
+
+/* How many of the blocks still allocated at the end of a test its leak report lists */
+#ifndef UNITY_MALLOC_LEAK_REPORT_LIMIT
+#define UNITY_MALLOC_LEAK_REPORT_LIMIT 10
+#endif
+
+/* Allocation budgets limit how often, and how much, the code between BEGIN and END may allocate.
+ * The first allocation over the limit fails the test. Budgets nest: an allocation counts towards
+ * every budget it is made in. Allocations made to fail by UnityMalloc_MakeMallocFailAfterCount
+ * never reach the heap and so do not count. */
+#ifndef UNITY_ALLOC_BUDGET_DEPTH
+#define UNITY_ALLOC_BUDGET_DEPTH 8
+#endif
+
+#define UNITY_ALLOC_UNLIMITED ((size_t)-1)
+
+void UnityMalloc_BudgetBegin(size_t max_allocs, size_t max_bytes, unsigned int line);
+void UnityMalloc_BudgetEnd(unsigned int line);
+
+#define UNITY_ALLOC_BUDGET_BEGIN(max_allocs, max_bytes) UnityMalloc_BudgetBegin((max_allocs), (max_bytes), __LINE__)
+#define UNITY_ALLOC_BUDGET_END()                        UnityMalloc_BudgetEnd(__LINE__)
+#define TEST_ASSERT_NO_ALLOC(block)                     do { UNITY_ALLOC_BUDGET_BEGIN(0, 0); block; UNITY_ALLOC_BUDGET_END(); } while (0)
+
+/* More ways to make allocations fail, cleared by UnityMalloc_StartTest like the countdown.
+ * Zero turns each of them off. Only the allocation-th request from now on (counting from 1),
+ * every request of at least `bytes`, or each request with a chance of `percent` in 100, in
+ * an order that the same seed repeats. */
+void UnityMalloc_MakeMallocFailOnly(size_t allocation);
+void UnityMalloc_MakeMallocFailFromSize(size_t bytes);
+void UnityMalloc_MakeMallocFailRandomly(unsigned int percent, unsigned int seed);
+
+/* A test named `name` whose body runs once as it is, and then again for every allocation it
+ * made with that one failing, and for every size class it asked for with requests that big
+ * failing. Runs that fail, leak or crash are listed, and fail the test. setUp and tearDown
+ * run once around the whole sweep, so each run must clean up after itself. */
+#define TEST_ALLOC_SWEEP(name)                                                    \
+    static void name##_sweep(void);                                               \
+    void name(void);                                                              \
+    void name(void) { UnityMalloc_Sweep(name##_sweep, __LINE__); }                \
+    static void name##_sweep(void)
+
+/* Processes the runs of a sweep are spread over. Only POSIX hosts can fork, and only runs
+ * in their own process can be seen to crash. */
+#ifndef UNITY_ALLOC_SWEEP_WORKERS
+#define UNITY_ALLOC_SWEEP_WORKERS 1
+#endif
+
+/* Extra runs with failures picked at random, seeded from UnitySeed onwards */
+#ifndef UNITY_ALLOC_SWEEP_RANDOM_RUNS
+#define UNITY_ALLOC_SWEEP_RANDOM_RUNS 0
+#endif
+#ifndef UNITY_ALLOC_SWEEP_RANDOM_PERCENT
+#define UNITY_ALLOC_SWEEP_RANDOM_PERCENT 10
+#endif
+
+void UnityMalloc_Sweep(void (*body)(void), unsigned int line);
+void UnityMalloc_SetSweepWorkers(unsigned int workers);
+void UnityMalloc_SetSweepRandomRuns(unsigned int runs, unsigned int percent);
 
 #ifdef __cplusplus
 }
@@ -10,6 +10,9 @@
 #include "unity_output_Spy.h"
 #include <stdlib.h>
 #include <string.h>
+#ifdef UNITY_MEMORY_THREAD_SAFE
+#include <pthread.h>
+#endif
 
 /* This test module includes the following tests: */
 
@@ -22,14 +25,50 @@ void test_ReallocSizeZeroFreesMemAndReturnsNullPointer(void);
 void test_CallocFillsWithZero(void);
 void test_FreeNULLSafety(void);
 void test_DetectsLeak(void);
+void test_LeakReportListsEachBlock(void);
+void test_LeakReportIsCapped(void);
+void test_LeakReportLeavesOutEarlierTests(void);
+void test_LeakReportStartsOnALineOfItsOwn(void);
 void test_BufferOverrunFoundDuringFree(void);
 void test_BufferOverrunFoundDuringRealloc(void);
 void test_BufferGuardWriteFoundDuringFree(void);
 void test_BufferGuardWriteFoundDuringRealloc(void);
+void test_GuardPageTrapsOverrun(void);
+void test_GuardPageTrapsUnderrun(void);
+void test_GuardPageBlocksStayAligned(void);
+void test_QuarantineFindsWriteAfterFreeAtEndTest(void);
+void test_QuarantineChecksBlocksAsTheyLeave(void);
+void test_QuarantineCatchesDoubleFree(void);
 void test_MallocPastBufferFails(void);
 void test_CallocPastBufferFails(void);
 void test_MallocThenReallocGrowsMemoryInPlace(void);
 void test_ReallocFailDoesNotFreeMem(void);
+void test_RefusedReallocLeavesBlockUngrown(void);
+void test_FreeingOutOfOrderReclaimsMemory(void);
+void test_HeapStatsShowFragmentation(void);
+void test_StatsTrackCurrentAndPeakBytes(void);
+void test_StatsCountReallocMoves(void);
+void test_StatsHistogramUsesLog2OfRequestSize(void);
+void test_StatsAreClearedByStartTest(void);
+void test_StatsCanBePrinted(void);
+void test_NoAllocPassesWhenNothingIsAllocated(void);
+void test_NoAllocFailsOnFirstAllocation(void);
+void test_BudgetAllowsAllocationsWithinLimits(void);
+void test_BudgetFailsWhenBytesRunOut(void);
+void test_NestedBudgetsCountTowardsOuterBudget(void);
+void test_BudgetIgnoresForcedMallocFailures(void);
+void test_MallocFailsOnlyTheChosenAllocation(void);
+void test_MallocFailsFromSize(void);
+void test_MallocFailsRandomlyButRepeatably(void);
+void test_SweepFailsEachAllocationInTurn(void);
+void test_SweepReportsRunsThatGoWrong(void);
+void test_SweepAddsRandomRuns(void);
+void test_SweepWorkersReportCrashes(void);
+void test_ArenaIsReclaimedByEndTest(void);
+void test_BlocksFromBeforeTheTestOutliveIt(void);
+void test_ArenaTakesBlocksBiggerThanAChunk(void);
+void test_ThreadsShareTheCounters(void);
+void test_ThreadsShareTheFailCountdown(void);
 
 /* It makes use of the following features */
 void setUp(void);
@@ -179,9 +218,127 @@ void test_DetectsLeak(void)
 #endif
 }
 
-void test_BufferOverrunFoundDuringFree(void)
+void test_LeakReportListsEachBlock(void)
 {
 #ifdef USING_OUTPUT_SPY
+    void* m = malloc(10);
+    void* n;
+    void* o;
+    UnityMalloc_CallSite("leaky.c", 12);
+    n = malloc(20);
+    o = malloc(30);
+    free(o);
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    UnityMalloc_EndTest();
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "  Leaked 10 bytes\n  Leaked 20 bytes\n"));
+#else
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "  Leaked 10 bytes in allocation 1"));
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "  Leaked 20 bytes in allocation 2 at leaky.c:12\n"));
+#endif
+    TEST_ASSERT_NULL(strstr(UnityOutputCharSpy_Get(), "Leaked 30"));
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "This test leaks!"));
+    free(n);
+    free(m);
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY To Run This Test");
+#endif
+}
+
+void test_LeakReportIsCapped(void)
+{
+#if defined(USING_OUTPUT_SPY) && !defined(UNITY_EXCLUDE_STDLIB_MALLOC)
+    void* blocks[UNITY_MALLOC_LEAK_REPORT_LIMIT + 3];
+    size_t i;
+    for (i = 0; i < sizeof(blocks) / sizeof(blocks[0]); i++)
+    {
+        blocks[i] = malloc(1);
+    }
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    UnityMalloc_EndTest();
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "  ...and 3 more\n"));
+    while (i > 0)
+    {
+        free(blocks[--i]);
+    }
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY and the stdlib heap To Run This Test");
+#endif
+}
+
+void test_LeakReportLeavesOutEarlierTests(void)
+{
+#if defined(USING_OUTPUT_SPY) && !defined(UNITY_EXCLUDE_STDLIB_MALLOC)
+    void* m = malloc(11);
+    void* n;
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    UnityMalloc_EndTest();
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Destroy();
+    UnityOutputCharSpy_Create(1000);
+    UnityOutputCharSpy_Enable(1);
+    UnityMalloc_StartTest();
+    n = malloc(22);
+    EXPECT_ABORT_BEGIN
+    UnityMalloc_EndTest();
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "  Leaked 22 bytes in allocation 1"));
+    TEST_ASSERT_NULL(strstr(UnityOutputCharSpy_Get(), "Leaked 11"));
+    free(n);
+    free(m);
+    UnityMalloc_StartTest();
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY without UNITY_EXCLUDE_STDLIB_MALLOC To Run This Test");
+#endif
+}
+
+void test_LeakReportStartsOnALineOfItsOwn(void)
+{
+#if defined(USING_OUTPUT_SPY) && !defined(UNITY_EXCLUDE_STDLIB_MALLOC)
+    static const char report[] = "TEST(Memory, Leaks)\n"
+                                 "  Leaked 10 bytes in allocation 1 at leaky.c:7\n"
+                                 "  Leaked 20 bytes in allocation 2 at leaky.c:8\n";
+    void* m;
+    void* n;
+    UnityMalloc_CallSite("leaky.c", 7);
+    m = malloc(10);
+    UnityMalloc_CallSite("leaky.c", 8);
+    n = malloc(20);
+    UnityOutputCharSpy_Enable(1);
+    UnityPrint("TEST(Memory, Leaks)"); /* like the fixture runner's verbose output */
+    UnitySetLineOpen(1);
+    EXPECT_ABORT_BEGIN
+    UnityMalloc_EndTest();
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    UnitySetLineOpen(0);
+    Unity.CurrentTestFailed = 0;
+    TEST_ASSERT_EQUAL_STRING_LEN(report, UnityOutputCharSpy_Get(), sizeof(report) - 1);
+    TEST_ASSERT_EQUAL_STRING_LEN(Unity.TestFile, UnityOutputCharSpy_Get() + sizeof(report) - 1, strlen(Unity.TestFile));
+    free(n);
+    free(m);
+    UnityMalloc_StartTest();
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY without UNITY_EXCLUDE_STDLIB_MALLOC To Run This Test");
+#endif
+}
+
+void test_BufferOverrunFoundDuringFree(void)
+{
+#if defined(UNITY_MALLOC_GUARD_PAGES) && !defined(UNITY_MALLOC_GUARD_PAGES_UNDERRUN)
+    TEST_IGNORE_MESSAGE("Overruns trap as they happen with UNITY_MALLOC_GUARD_PAGES");
+#elif defined(USING_OUTPUT_SPY)
     void* m = malloc(10);
     char* s = (char*)m;
     TEST_ASSERT_NOT_NULL(m);
@@ -200,7 +357,9 @@ void test_BufferOverrunFoundDuringFree(void)
 
 void test_BufferOverrunFoundDuringRealloc(void)
 {
-#ifdef USING_OUTPUT_SPY
+#if defined(UNITY_MALLOC_GUARD_PAGES) && !defined(UNITY_MALLOC_GUARD_PAGES_UNDERRUN)
+    TEST_IGNORE_MESSAGE("Overruns trap as they happen with UNITY_MALLOC_GUARD_PAGES");
+#elif defined(USING_OUTPUT_SPY)
     void* m = malloc(10);
     char* s = (char*)m;
     TEST_ASSERT_NOT_NULL(m);
@@ -219,7 +378,9 @@ void test_BufferOverrunFoundDuringRealloc(void)
 
 void test_BufferGuardWriteFoundDuringFree(void)
 {
-#ifdef USING_OUTPUT_SPY
+#ifdef UNITY_MALLOC_GUARD_PAGES_UNDERRUN
+    TEST_IGNORE_MESSAGE("Underruns trap as they happen with UNITY_MALLOC_GUARD_PAGES_UNDERRUN");
+#elif defined(USING_OUTPUT_SPY)
     void* m = malloc(10);
     char* s = (char*)m;
     TEST_ASSERT_NOT_NULL(m);
@@ -239,7 +400,9 @@ void test_BufferGuardWriteFoundDuringFree(void)
 
 void test_BufferGuardWriteFoundDuringRealloc(void)
 {
-#ifdef USING_OUTPUT_SPY
+#ifdef UNITY_MALLOC_GUARD_PAGES_UNDERRUN
+    TEST_IGNORE_MESSAGE("Underruns trap as they happen with UNITY_MALLOC_GUARD_PAGES_UNDERRUN");
+#elif defined(USING_OUTPUT_SPY)
     void* m = malloc(10);
     char* s = (char*)m;
     TEST_ASSERT_NOT_NULL(m);
@@ -256,6 +419,117 @@ void test_BufferGuardWriteFoundDuringRealloc(void)
 #endif
 }
 
+void test_GuardPageTrapsOverrun(void)
+{
+#if defined(UNITY_MALLOC_GUARD_PAGES) && !defined(UNITY_MALLOC_GUARD_PAGES_UNDERRUN) && defined(USING_OUTPUT_SPY)
+    char* s = (char*)malloc(16);
+    TEST_ASSERT_NOT_NULL(s);
+    s[15] = 1;
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    ((volatile char*)s)[16] = 1;
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "Buffer overrun of the 16 byte block from allocation 1"));
+    free(s);
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY and UNITY_MALLOC_GUARD_PAGES To Run This Test");
+#endif
+}
+
+void test_GuardPageTrapsUnderrun(void)
+{
+#if defined(UNITY_MALLOC_GUARD_PAGES_UNDERRUN) && defined(USING_OUTPUT_SPY)
+    char* s = (char*)malloc(10);
+    TEST_ASSERT_NOT_NULL(s);
+    s[0] = 1;
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    ((volatile char*)s)[-1] = 1;
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "Buffer underrun of the 10 byte block from allocation 1"));
+    free(s);
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY and UNITY_MALLOC_GUARD_PAGES_UNDERRUN To Run This Test");
+#endif
+}
+
+void test_GuardPageBlocksStayAligned(void)
+{
+#if defined(UNITY_MALLOC_GUARD_PAGES) && !defined(UNITY_MALLOC_GUARD_ALIGNMENT)
+    char* s = (char*)malloc(6);
+    TEST_ASSERT_NOT_NULL(s);
+    TEST_ASSERT_EQUAL_UINT(0, (UNITY_UINT)(UNITY_PTR_TO_INT)s % sizeof(void*));
+    free(s);
+#else
+    TEST_IGNORE_MESSAGE("Enable UNITY_MALLOC_GUARD_PAGES with the default alignment To Run This Test");
+#endif
+}
+
+void test_QuarantineFindsWriteAfterFreeAtEndTest(void)
+{
+#if defined(UNITY_MALLOC_QUARANTINE_BYTES) && defined(USING_OUTPUT_SPY)
+    char* s = (char*)malloc(10);
+    TEST_ASSERT_NOT_NULL(s);
+    free(s);
+    ((volatile char*)s)[4] = 1;
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    UnityMalloc_EndTest();
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "Use after free: byte 4 of the 10 byte block from allocation 1"));
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY and UNITY_MALLOC_QUARANTINE_BYTES To Run This Test");
+#endif
+}
+
+void test_QuarantineChecksBlocksAsTheyLeave(void)
+{
+#if defined(UNITY_MALLOC_QUARANTINE_BYTES) && defined(USING_OUTPUT_SPY)
+    char* s;
+    char* big;
+    UnityMalloc_CallSite("stale.c", 7);
+    s = (char*)malloc(10);
+    big = (char*)malloc(UNITY_MALLOC_QUARANTINE_BYTES);
+    TEST_ASSERT_NOT_NULL(s);
+    TEST_ASSERT_NOT_NULL(big);
+    free(s);
+    ((volatile char*)s)[3] = 1;
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    free(big); /* pushes s out of the quarantine */
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "Use after free: byte 3 of the 10 byte block from allocation 1 at stale.c:7"));
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY and UNITY_MALLOC_QUARANTINE_BYTES To Run This Test");
+#endif
+}
+
+void test_QuarantineCatchesDoubleFree(void)
+{
+#if defined(UNITY_MALLOC_QUARANTINE_BYTES) && defined(USING_OUTPUT_SPY)
+    void* m = malloc(10);
+    TEST_ASSERT_NOT_NULL(m);
+    free(m);
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    free(m);
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "Freed memory passed to free()"));
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY and UNITY_MALLOC_QUARANTINE_BYTES To Run This Test");
+#endif
+}
+
 /*------------------------------------------------------------ */
 
 #define TEST_ASSERT_MEMORY_ALL_FREE_LIFO_ORDER(first_mem_ptr, ptr) \
@@ -324,3 +598,532 @@ void test_ReallocFailDoesNotFreeMem(void)
     TEST_IGNORE_MESSAGE("Enable UNITY_EXCLUDE_STDLIB_MALLOC to Run This Test");
 #endif
 }
+
+void test_RefusedReallocLeavesBlockUngrown(void)
+{
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    UnityHeapStats before;
+    UnityHeapStats after;
+    void* m = malloc(10);
+    void* n;
+    UnityMalloc_GetHeapStats(&before);
+    UnityMalloc_MakeMallocFailAfterCount(0);
+    n = realloc(m, 40);
+    UnityMalloc_GetHeapStats(&after);
+    free(m);
+    TEST_ASSERT_NULL(n);
+    TEST_ASSERT_EQUAL_UINT(before.used_bytes, after.used_bytes);
+    TEST_ASSERT_EQUAL_UINT(before.largest_free_block, after.largest_free_block);
+#else
+    TEST_IGNORE_MESSAGE("Enable UNITY_EXCLUDE_STDLIB_MALLOC to Run This Test");
+#endif
+}
+
+void test_FreeingOutOfOrderReclaimsMemory(void)
+{
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    void* m = malloc(UNITY_INTERNAL_HEAP_SIZE_BYTES/3);
+    void* n = malloc(UNITY_INTERNAL_HEAP_SIZE_BYTES/3);
+    void* o;
+    free(m);
+    o = malloc(UNITY_INTERNAL_HEAP_SIZE_BYTES/3);
+    free(n);
+    free(o);
+    TEST_ASSERT_NOT_NULL(n);
+    TEST_ASSERT_EQUAL_PTR(m, o);
+    TEST_ASSERT_MEMORY_ALL_FREE_LIFO_ORDER(m, n);
+#else
+    TEST_IGNORE_MESSAGE("Enable UNITY_EXCLUDE_STDLIB_MALLOC to Run This Test");
+#endif
+}
+
+void test_HeapStatsShowFragmentation(void)
+{
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    UnityHeapStats heap;
+    void* m = malloc(10);
+    void* n = malloc(10);
+    void* o = malloc(10);
+    UnityMalloc_GetHeapStats(&heap);
+    TEST_ASSERT_EQUAL_UINT(UNITY_INTERNAL_HEAP_SIZE_BYTES, heap.size);
+    TEST_ASSERT_EQUAL_UINT(1, heap.free_blocks);
+    TEST_ASSERT_EQUAL_UINT(heap.used_bytes, heap.peak_bytes);
+    free(n);
+    UnityMalloc_GetHeapStats(&heap);
+    TEST_ASSERT_EQUAL_UINT(2, heap.free_blocks);
+    TEST_ASSERT_LESS_THAN_UINT(heap.free_bytes, heap.largest_free_block);
+    TEST_ASSERT_LESS_THAN_UINT(heap.peak_bytes, heap.used_bytes);
+    free(o);
+    free(m);
+    UnityMalloc_GetHeapStats(&heap);
+    TEST_ASSERT_EQUAL_UINT(1, heap.free_blocks);
+    TEST_ASSERT_EQUAL_UINT(0, heap.used_bytes);
+#else
+    TEST_IGNORE_MESSAGE("Enable UNITY_EXCLUDE_STDLIB_MALLOC to Run This Test");
+#endif
+}
+
+/*------------------------------------------------------------ */
+
+void test_StatsTrackCurrentAndPeakBytes(void)
+{
+    const UnityMallocStats* stats = UnityMalloc_GetStats();
+    void* m = malloc(10);
+    void* n = malloc(20);
+    free(n);
+    TEST_ASSERT_EQUAL_UINT(10, stats->current_bytes);
+    TEST_ASSERT_EQUAL_UINT(30, stats->peak_bytes);
+    free(m);
+    TEST_ASSERT_EQUAL_UINT(0, stats->current_bytes);
+    TEST_ASSERT_EQUAL_UINT(30, stats->peak_bytes);
+    TEST_ASSERT_EQUAL_UINT(2, stats->allocs);
+    TEST_ASSERT_EQUAL_UINT(2, stats->frees);
+}
+
+void test_StatsCountReallocMoves(void)
+{
+    const UnityMallocStats* stats = UnityMalloc_GetStats();
+    void* m = malloc(10);
+    void* n = malloc(10); /* keeps m from growing in place */
+    void* moved = realloc(m, 20);
+    void* same = realloc(moved, 5);
+    TEST_ASSERT_EQUAL_PTR(moved, same);
+    free(n);
+    free(moved);
+    TEST_ASSERT_EQUAL_UINT(1, stats->realloc_moves);
+    TEST_ASSERT_EQUAL_UINT(10, stats->realloc_copy_bytes);
+    TEST_ASSERT_EQUAL_UINT(40, stats->peak_bytes);
+}
+
+void test_StatsHistogramUsesLog2OfRequestSize(void)
+{
+    const UnityMallocStats* stats = UnityMalloc_GetStats();
+    free(malloc(1));
+    free(malloc(7));
+    free(malloc(8));
+    free(malloc(15));
+    free(malloc(16));
+    TEST_ASSERT_EQUAL_UINT(1, stats->size_histogram[0]);
+    TEST_ASSERT_EQUAL_UINT(1, stats->size_histogram[2]);
+    TEST_ASSERT_EQUAL_UINT(2, stats->size_histogram[3]);
+    TEST_ASSERT_EQUAL_UINT(1, stats->size_histogram[4]);
+}
+
+void test_StatsAreClearedByStartTest(void)
+{
+    const UnityMallocStats* stats = UnityMalloc_GetStats();
+    free(malloc(10));
+    UnityMalloc_StartTest();
+    TEST_ASSERT_EQUAL_UINT(0, stats->peak_bytes);
+    TEST_ASSERT_EQUAL_UINT(0, stats->allocs);
+    TEST_ASSERT_EQUAL_UINT(0, stats->frees);
+    TEST_ASSERT_EQUAL_UINT(0, stats->size_histogram[3]);
+}
+
+void test_StatsCanBePrinted(void)
+{
+#ifdef USING_OUTPUT_SPY
+    void* m = malloc(10);
+    void* n = malloc(10);
+    m = realloc(m, 20);
+    free(n);
+    free(m);
+    UnityOutputCharSpy_Enable(1);
+    UnityMalloc_PrintStats();
+    UnityOutputCharSpy_Enable(0);
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(),
+        ":INFO: Heap peak 40 bytes, 3 allocs, 3 frees, 1 realloc moves copying 10 bytes, log2 sizes 3=2 4=1"));
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY To Run This Test");
+#endif
+}
+
+/*------------------------------------------------------------ */
+
+void test_NoAllocPassesWhenNothingIsAllocated(void)
+{
+    char buffer[8];
+    TEST_ASSERT_NO_ALLOC(memset(buffer, 0, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_HEX8(0, buffer[7]);
+}
+
+void test_NoAllocFailsOnFirstAllocation(void)
+{
+#ifdef USING_OUTPUT_SPY
+    void* m = NULL;
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_NO_ALLOC(m = malloc(10));
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+    TEST_ASSERT_NULL(m);
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(),
+        "exceeded by a request of 10 bytes. Used 1 of 0 allocs and 10 of 0 bytes"));
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY To Run This Test");
+#endif
+}
+
+void test_BudgetAllowsAllocationsWithinLimits(void)
+{
+    void* m;
+    void* n;
+    UNITY_ALLOC_BUDGET_BEGIN(2, 30);
+    m = malloc(10);
+    n = malloc(20);
+    UNITY_ALLOC_BUDGET_END();
+    free(n);
+    free(m);
+}
+
+void test_BudgetFailsWhenBytesRunOut(void)
+{
+#ifdef USING_OUTPUT_SPY
+    void* m;
+    void* n = NULL;
+    UNITY_ALLOC_BUDGET_BEGIN(UNITY_ALLOC_UNLIMITED, 16);
+    m = malloc(10);
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    n = malloc(7);
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+    free(m);
+    TEST_ASSERT_NULL(n);
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(),
+        "exceeded by a request of 7 bytes. Used 2 of unlimited allocs and 17 of 16 bytes"));
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY To Run This Test");
+#endif
+}
+
+void test_NestedBudgetsCountTowardsOuterBudget(void)
+{
+#ifdef USING_OUTPUT_SPY
+    void* m;
+    void* n = NULL;
+    int outer_line;
+    outer_line = __LINE__; UNITY_ALLOC_BUDGET_BEGIN(1, UNITY_ALLOC_UNLIMITED);
+    m = malloc(10);
+    UNITY_ALLOC_BUDGET_BEGIN(5, UNITY_ALLOC_UNLIMITED);
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    n = malloc(10);
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+    free(m);
+    TEST_ASSERT_NULL(n);
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "Used 2 of 1 allocs"));
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "Allocation budget from line "));
+    TEST_ASSERT_EQUAL_INT(outer_line, atoi(strstr(UnityOutputCharSpy_Get(), "from line ") + 10));
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY To Run This Test");
+#endif
+}
+
+void test_BudgetIgnoresForcedMallocFailures(void)
+{
+    void* m = NULL;
+    UnityMalloc_MakeMallocFailAfterCount(0);
+    TEST_ASSERT_NO_ALLOC(m = malloc(10));
+    TEST_ASSERT_NULL(m);
+}
+
+void test_MallocFailsOnlyTheChosenAllocation(void)
+{
+    void* m[3];
+    UnityMalloc_MakeMallocFailOnly(2);
+    m[0] = malloc(10);
+    m[1] = malloc(10);
+    m[2] = malloc(10);
+    TEST_ASSERT_NOT_NULL(m[0]);
+    TEST_ASSERT_NULL(m[1]);
+    TEST_ASSERT_NOT_NULL(m[2]);
+    free(m[0]);
+    free(m[2]);
+}
+
+void test_MallocFailsFromSize(void)
+{
+    void* m;
+    UnityMalloc_MakeMallocFailFromSize(16);
+    TEST_ASSERT_NULL(malloc(16));
+    m = malloc(15);
+    TEST_ASSERT_NOT_NULL(m);
+    free(m);
+}
+
+void test_MallocFailsRandomlyButRepeatably(void)
+{
+    char failed[2][100];
+    int round;
+    int i;
+    int failures = 0;
+
+    for (round = 0; round < 2; round++)
+    {
+        UnityMalloc_MakeMallocFailRandomly(50, 7);
+        for (i = 0; i < 100; i++)
+        {
+            void* m = malloc(8);
+            failed[round][i] = (char)(m == NULL);
+            failures += (m == NULL);
+            free(m);
+        }
+    }
+    TEST_ASSERT_EQUAL_MEMORY(failed[0], failed[1], sizeof(failed[0]));
+    TEST_ASSERT_INT_WITHIN(60, 100, failures);
+}
+
+/* Notes which of its three allocations each run got, oldest run first */
+static int sweep_runs;
+static int sweep_got[16];
+
+static void sweep_three_allocations(void)
+{
+    void* m[3];
+    int i;
+    m[0] = malloc(8);
+    m[1] = malloc(16);
+    m[2] = malloc(32);
+    sweep_got[sweep_runs] = 0;
+    for (i = 0; i < 3; i++)
+    {
+        if (m[i] != NULL)
+            sweep_got[sweep_runs] |= 1 << i;
+        free(m[i]);
+    }
+    sweep_runs++;
+}
+
+#if defined(USING_OUTPUT_SPY) && !defined(UNITY_EXCLUDE_STDLIB_MALLOC)
+static void sweep_with_bugs(void)
+{
+    char* first = (char*)malloc(8);
+    char* second;
+    TEST_ASSERT_NOT_NULL(first);
+    second = (char*)malloc(16);
+    if (second == NULL)
+        return;
+    free(second);
+    free(first);
+}
+#endif
+
+void test_SweepFailsEachAllocationInTurn(void)
+{
+    const int expected[] = { 7, 6, 5, 3, 0, 1, 3 };
+    sweep_runs = 0;
+    UnityMalloc_Sweep(sweep_three_allocations, __LINE__);
+    TEST_ASSERT_EQUAL_INT(7, sweep_runs);
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, sweep_got, 7);
+}
+
+void test_SweepReportsRunsThatGoWrong(void)
+{
+#if defined(USING_OUTPUT_SPY) && !defined(UNITY_EXCLUDE_STDLIB_MALLOC)
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    UnityMalloc_Sweep(sweep_with_bugs, __LINE__);
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "  Allocation 1 of 2 failing: failed\n"));
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "  Allocation 2 of 2 failing: leaked\n"));
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "  Requests of 8 bytes or more failing: failed\n"));
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "  Requests of 16 bytes or more failing: leaked\n"));
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "4 of 4 sweep runs went wrong"));
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY and the stdlib heap To Run This Test");
+#endif
+}
+
+void test_SweepAddsRandomRuns(void)
+{
+    sweep_runs = 0;
+    UnityMalloc_SetSweepRandomRuns(5, 50);
+    UnityMalloc_Sweep(sweep_three_allocations, __LINE__);
+    UnityMalloc_SetSweepRandomRuns(0, 50);
+    TEST_ASSERT_EQUAL_INT(12, sweep_runs);
+}
+
+#if defined(USING_OUTPUT_SPY) && (defined(__unix__) || defined(__APPLE__))
+static void sweep_that_crashes(void)
+{
+    char* m = (char*)malloc(8);
+    if (m == NULL)
+        abort();
+    free(m);
+}
+#endif
+
+void test_SweepWorkersReportCrashes(void)
+{
+#if defined(USING_OUTPUT_SPY) && (defined(__unix__) || defined(__APPLE__))
+    UnityMalloc_SetSweepWorkers(4);
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    UnityMalloc_Sweep(sweep_that_crashes, __LINE__);
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    UnityMalloc_SetSweepWorkers(1);
+    Unity.CurrentTestFailed = 0;
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "  Allocation 1 of 1 failing: crashed\n"));
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "2 of 2 sweep runs went wrong"));
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY on a POSIX host To Run This Test");
+#endif
+}
+
+void test_ArenaIsReclaimedByEndTest(void)
+{
+#ifdef UNITY_MALLOC_ARENA
+#ifdef USING_OUTPUT_SPY
+    void* first = malloc(10);
+    void* second = malloc(10);
+    void* m;
+    free(first);
+    UnityOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    UnityMalloc_EndTest();
+    EXPECT_ABORT_END
+    UnityOutputCharSpy_Enable(0);
+    Unity.CurrentTestFailed = 0;
+    TEST_ASSERT_NOT_NULL(strstr(UnityOutputCharSpy_Get(), "  Leaked 10 bytes in allocation 2"));
+    free(second); /* already reclaimed */
+    UnityMalloc_StartTest();
+    m = malloc(10);
+    TEST_ASSERT_EQUAL_PTR(first, m);
+    free(m);
+#else
+    TEST_IGNORE_MESSAGE("Enable USING_OUTPUT_SPY To Run This Test");
+#endif
+#else
+    TEST_IGNORE_MESSAGE("Enable UNITY_MALLOC_ARENA To Run This Test");
+#endif
+}
+
+void test_BlocksFromBeforeTheTestOutliveIt(void)
+{
+    unsigned char* kept;
+    unsigned char* inner;
+    unsigned char* again;
+    size_t i;
+
+    UnityMalloc_EndTest();
+    kept = (unsigned char*)malloc(16); /* like one from main or a suite's setup */
+    TEST_ASSERT_NOT_NULL(kept);
+    memset(kept, 0x5A, 16);
+    UnityMalloc_StartTest();
+    inner = (unsigned char*)malloc(16);
+    TEST_ASSERT_NOT_NULL(inner);
+    memset(inner, 0x11, 16);
+    free(inner);
+    UnityMalloc_EndTest();
+    UnityMalloc_StartTest();
+    again = (unsigned char*)malloc(16);
+    TEST_ASSERT_NOT_NULL(again);
+    memset(again, 0x22, 16);
+    TEST_ASSERT_TRUE(again != kept);
+    for (i = 0; i < 16; i++)
+    {
+        TEST_ASSERT_EQUAL_HEX8(0x5A, kept[i]);
+    }
+    free(again);
+    UnityMalloc_EndTest();
+    free(kept);
+    UnityMalloc_StartTest();
+}
+
+void test_ArenaTakesBlocksBiggerThanAChunk(void)
+{
+#ifdef UNITY_MALLOC_ARENA
+    char* small = (char*)malloc(10);
+    char* big = (char*)malloc(2 * UNITY_MALLOC_ARENA_CHUNK_BYTES);
+    char* after = (char*)malloc(10);
+    TEST_ASSERT_NOT_NULL(big);
+    TEST_ASSERT_NOT_NULL(after);
+    memset(big, 0xAA, 2 * UNITY_MALLOC_ARENA_CHUNK_BYTES);
+    free(small);
+    free(big);
+    free(after);
+#else
+    TEST_IGNORE_MESSAGE("Enable UNITY_MALLOC_ARENA To Run This Test");
+#endif
+}
+
+#ifdef UNITY_MEMORY_THREAD_SAFE
+#define THREADS 4
+#define ALLOCS_PER_THREAD 200
+
+static void* allocate_and_free(void* successes)
+{
+    int i;
+
+    for (i = 0; i < ALLOCS_PER_THREAD; i++)
+    {
+        char* m = (char*)malloc(8);
+        char* grown;
+        if (m == NULL) continue;
+        (*(int*)successes)++;
+        grown = (char*)realloc(m, 12);
+        if (grown != NULL)
+        {
+            (*(int*)successes)++;
+            m = grown;
+        }
+        free(m);
+    }
+    return NULL;
+}
+
+static int run_threads(int* successes)
+{
+    pthread_t threads[THREADS];
+    int total = 0;
+    int i;
+
+    for (i = 0; i < THREADS; i++)
+    {
+        successes[i] = 0;
+        TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, allocate_and_free, &successes[i]));
+    }
+    for (i = 0; i < THREADS; i++)
+    {
+        pthread_join(threads[i], NULL);
+        total += successes[i];
+    }
+    return total;
+}
+#endif
+
+void test_ThreadsShareTheCounters(void)
+{
+#ifdef UNITY_MEMORY_THREAD_SAFE
+    int successes[THREADS];
+    const UnityMallocStats* stats = UnityMalloc_GetStats();
+
+    TEST_ASSERT_EQUAL_INT(2 * THREADS * ALLOCS_PER_THREAD, run_threads(successes));
+    TEST_ASSERT_EQUAL_size_t(2 * THREADS * ALLOCS_PER_THREAD, stats->allocs);
+    TEST_ASSERT_EQUAL_size_t(2 * THREADS * ALLOCS_PER_THREAD, stats->frees);
+    TEST_ASSERT_EQUAL_size_t(0, stats->current_bytes);
+#else
+    TEST_IGNORE_MESSAGE("Enable UNITY_MEMORY_THREAD_SAFE To Run This Test");
+#endif
+}
+
+void test_ThreadsShareTheFailCountdown(void)
+{
+#ifdef UNITY_MEMORY_THREAD_SAFE
+    int successes[THREADS];
+
+    /* Exactly this many allocations get through, whichever threads make them */
+    UnityMalloc_MakeMallocFailAfterCount(61);
+    TEST_ASSERT_EQUAL_INT(61, run_threads(successes));
+#else
+    TEST_IGNORE_MESSAGE("Enable UNITY_MEMORY_THREAD_SAFE To Run This Test");
+#endif
+}
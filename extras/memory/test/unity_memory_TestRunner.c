@@ -17,14 +17,50 @@ extern void test_ReallocSizeZeroFreesMemAndReturnsNullPointer(void);
 extern void test_CallocFillsWithZero(void);
 extern void test_FreeNULLSafety(void);
 extern void test_DetectsLeak(void);
+extern void test_LeakReportListsEachBlock(void);
+extern void test_LeakReportIsCapped(void);
+extern void test_LeakReportLeavesOutEarlierTests(void);
+extern void test_LeakReportStartsOnALineOfItsOwn(void);
 extern void test_BufferOverrunFoundDuringFree(void);
 extern void test_BufferOverrunFoundDuringRealloc(void);
 extern void test_BufferGuardWriteFoundDuringFree(void);
 extern void test_BufferGuardWriteFoundDuringRealloc(void);
+extern void test_GuardPageTrapsOverrun(void);
+extern void test_GuardPageTrapsUnderrun(void);
+extern void test_GuardPageBlocksStayAligned(void);
+extern void test_QuarantineFindsWriteAfterFreeAtEndTest(void);
+extern void test_QuarantineChecksBlocksAsTheyLeave(void);
+extern void test_QuarantineCatchesDoubleFree(void);
 extern void test_MallocPastBufferFails(void);
 extern void test_CallocPastBufferFails(void);
 extern void test_MallocThenReallocGrowsMemoryInPlace(void);
 extern void test_ReallocFailDoesNotFreeMem(void);
+extern void test_RefusedReallocLeavesBlockUngrown(void);
+extern void test_FreeingOutOfOrderReclaimsMemory(void);
+extern void test_HeapStatsShowFragmentation(void);
+extern void test_StatsTrackCurrentAndPeakBytes(void);
+extern void test_StatsCountReallocMoves(void);
+extern void test_StatsHistogramUsesLog2OfRequestSize(void);
+extern void test_StatsAreClearedByStartTest(void);
+extern void test_StatsCanBePrinted(void);
+extern void test_NoAllocPassesWhenNothingIsAllocated(void);
+extern void test_NoAllocFailsOnFirstAllocation(void);
+extern void test_BudgetAllowsAllocationsWithinLimits(void);
+extern void test_BudgetFailsWhenBytesRunOut(void);
+extern void test_NestedBudgetsCountTowardsOuterBudget(void);
+extern void test_BudgetIgnoresForcedMallocFailures(void);
+extern void test_MallocFailsOnlyTheChosenAllocation(void);
+extern void test_MallocFailsFromSize(void);
+extern void test_MallocFailsRandomlyButRepeatably(void);
+extern void test_SweepFailsEachAllocationInTurn(void);
+extern void test_SweepReportsRunsThatGoWrong(void);
+extern void test_SweepAddsRandomRuns(void);
+extern void test_SweepWorkersReportCrashes(void);
+extern void test_ArenaIsReclaimedByEndTest(void);
+extern void test_BlocksFromBeforeTheTestOutliveIt(void);
+extern void test_ArenaTakesBlocksBiggerThanAChunk(void);
+extern void test_ThreadsShareTheCounters(void);
+extern void test_ThreadsShareTheFailCountdown(void);
 
 int main(void)
 {
@@ -38,13 +74,49 @@ int main(void)
     RUN_TEST(test_CallocFillsWithZero);
     RUN_TEST(test_FreeNULLSafety);
     RUN_TEST(test_DetectsLeak);
+    RUN_TEST(test_LeakReportListsEachBlock);
+    RUN_TEST(test_LeakReportIsCapped);
+    RUN_TEST(test_LeakReportLeavesOutEarlierTests);
+    RUN_TEST(test_LeakReportStartsOnALineOfItsOwn);
     RUN_TEST(test_BufferOverrunFoundDuringFree);
     RUN_TEST(test_BufferOverrunFoundDuringRealloc);
     RUN_TEST(test_BufferGuardWriteFoundDuringFree);
     RUN_TEST(test_BufferGuardWriteFoundDuringRealloc);
+    RUN_TEST(test_GuardPageTrapsOverrun);
+    RUN_TEST(test_GuardPageTrapsUnderrun);
+    RUN_TEST(test_GuardPageBlocksStayAligned);
+    RUN_TEST(test_QuarantineFindsWriteAfterFreeAtEndTest);
+    RUN_TEST(test_QuarantineChecksBlocksAsTheyLeave);
+    RUN_TEST(test_QuarantineCatchesDoubleFree);
     RUN_TEST(test_MallocPastBufferFails);
     RUN_TEST(test_CallocPastBufferFails);
     RUN_TEST(test_MallocThenReallocGrowsMemoryInPlace);
     RUN_TEST(test_ReallocFailDoesNotFreeMem);
+    RUN_TEST(test_RefusedReallocLeavesBlockUngrown);
+    RUN_TEST(test_FreeingOutOfOrderReclaimsMemory);
+    RUN_TEST(test_HeapStatsShowFragmentation);
+    RUN_TEST(test_StatsTrackCurrentAndPeakBytes);
+    RUN_TEST(test_StatsCountReallocMoves);
+    RUN_TEST(test_StatsHistogramUsesLog2OfRequestSize);
+    RUN_TEST(test_StatsAreClearedByStartTest);
+    RUN_TEST(test_StatsCanBePrinted);
+    RUN_TEST(test_NoAllocPassesWhenNothingIsAllocated);
+    RUN_TEST(test_NoAllocFailsOnFirstAllocation);
+    RUN_TEST(test_BudgetAllowsAllocationsWithinLimits);
+    RUN_TEST(test_BudgetFailsWhenBytesRunOut);
+    RUN_TEST(test_NestedBudgetsCountTowardsOuterBudget);
+    RUN_TEST(test_BudgetIgnoresForcedMallocFailures);
+    RUN_TEST(test_MallocFailsOnlyTheChosenAllocation);
+    RUN_TEST(test_MallocFailsFromSize);
+    RUN_TEST(test_MallocFailsRandomlyButRepeatably);
+    RUN_TEST(test_SweepFailsEachAllocationInTurn);
+    RUN_TEST(test_SweepReportsRunsThatGoWrong);
+    RUN_TEST(test_SweepAddsRandomRuns);
+    RUN_TEST(test_SweepWorkersReportCrashes);
+    RUN_TEST(test_ArenaIsReclaimedByEndTest);
+    RUN_TEST(test_BlocksFromBeforeTheTestOutliveIt);
+    RUN_TEST(test_ArenaTakesBlocksBiggerThanAChunk);
+    RUN_TEST(test_ThreadsShareTheCounters);
+    RUN_TEST(test_ThreadsShareTheFailCountdown);
     return UnityEnd();
 }
@@ -0,0 +1,817 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+#if !defined(_POSIX_C_SOURCE) && !defined(_GNU_SOURCE) && (defined(__unix__) || defined(__APPLE__))
+#define _POSIX_C_SOURCE 200809L /* fork, pipe and waitpid are hidden by a strict -std=c99 otherwise */
+#endif
+
+#include "unity_property.h"
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef UNITY_EXCLUDE_SETJMP_H
+#error "The property extra needs setjmp to try cases that fail without ending the test"
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define PROPERTY_WORKERS_FORK
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#define PROPERTY_MAX_WORKERS 64
+
+#define CASE_PASSED    0
+#define CASE_FAILED    1
+#define CASE_DISCARDED 2
+
+#define NO_FAILURE  ((UNITY_UINT32)0xFFFFFFFFu)
+#define WORKER_DIED ((UNITY_UINT32)0xFFFFFFFEu)
+
+/* A case is the sequence of random choices its generators made. Replaying the same choices
+ * gives the same inputs, and smaller choices give simpler inputs, so shrinking a failure is
+ * done on the choices alone without knowing anything about the types that were drawn.
+ * Choices past the end of what is replayed are zero, the simplest of all. */
+typedef uint64_t choice_t;
+
+static uint64_t stream[4];
+static int stream_seeded;
+static choice_t replay[UNITY_PROPERTY_MAX_DRAWS];
+static size_t replay_length;
+static int replaying;
+static choice_t drawn[UNITY_PROPERTY_MAX_DRAWS];
+static size_t draw_count;
+static choice_t best[UNITY_PROPERTY_MAX_DRAWS];
+static size_t best_length;
+static choice_t candidate[UNITY_PROPERTY_MAX_DRAWS];
+static UNITY_UINT32 shrinks;
+static int in_property;
+static int muted;
+static int reporting;
+static unsigned int reported;
+static int discarded;
+static unsigned int workers = UNITY_PROPERTY_WORKERS;
+
+/*-----------------------------------------------
+ * Random Choices
+ *-----------------------------------------------*/
+
+static uint64_t rotate(const uint64_t x, const int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+/* xoshiro256** */
+static uint64_t next_random(void)
+{
+    const uint64_t result = rotate(stream[1] * 5u, 7) * 9u;
+    const uint64_t t = stream[1] << 17;
+
+    stream[2] ^= stream[0];
+    stream[3] ^= stream[1];
+    stream[1] ^= stream[2];
+    stream[0] ^= stream[3];
+    stream[2] ^= t;
+    stream[3] = rotate(stream[3], 45);
+    return result;
+}
+
+/* splitmix64, which spreads any seed over the whole xoshiro state */
+static uint64_t split_mix(uint64_t* x)
+{
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static void seed_stream(uint64_t seed)
+{
+    int i;
+    for (i = 0; i < 4; i++)
+    {
+        stream[i] = split_mix(&seed);
+    }
+    stream_seeded = 1;
+}
+
+static uint64_t run_seed(void)
+{
+    if (UnitySeed == 0)
+    {
+#ifdef UNITY_PROPERTY_SEED
+        UnitySeed = (UNITY_UINT)(UNITY_PROPERTY_SEED);
+#else
+        const time_t now = time(NULL);
+        UnitySeed = (UNITY_UINT)now;
+#endif
+        if (UnitySeed == 0)
+        {
+            UnitySeed = 1;
+        }
+    }
+    return (uint64_t)UnitySeed;
+}
+
+/* Each property gets its own cases, and each case its own stream, so a case can be made
+ * again from its number alone, in any process and in any order */
+static uint64_t case_seed(const uint64_t property_hash, const UNITY_UINT32 index)
+{
+    uint64_t x = run_seed() ^ property_hash;
+    x += (uint64_t)index * 0xD1B54A32D192ED03ull;
+    return split_mix(&x);
+}
+
+static uint64_t name_hash(const char* name)
+{
+    uint64_t hash = 0xCBF29CE484222325ull; /* FNV-1a */
+    while ((name != NULL) && (*name != 0))
+    {
+        hash = (hash ^ (unsigned char)*name++) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/* A choice from 0 to span. What is remembered is the choice itself rather than the random
+ * number it came from, so making it smaller always makes the value it gives simpler. */
+static choice_t draw(const choice_t span)
+{
+    choice_t choice;
+
+    if (replaying)
+    {
+        choice = (draw_count < replay_length) ? replay[draw_count] : 0;
+    }
+    else
+    {
+        if (!stream_seeded)
+        {
+            seed_stream(run_seed());
+        }
+        choice = next_random();
+    }
+    if (span != (choice_t)-1)
+    {
+        choice %= span + 1u;
+    }
+    if (draw_count < UNITY_PROPERTY_MAX_DRAWS)
+    {
+        drawn[draw_count] = choice;
+    }
+    draw_count++;
+    return choice;
+}
+
+/*-----------------------------------------------
+ * Reporting The Values Of A Failing Case
+ *-----------------------------------------------*/
+
+static int report_start(void)
+{
+    if (!reporting)
+    {
+        return 0;
+    }
+    UnityPrint("    value ");
+    UnityPrintNumberUnsigned(++reported);
+    UnityPrint(": ");
+    return 1;
+}
+
+/*-----------------------------------------------
+ * Generators
+ *-----------------------------------------------*/
+
+UNITY_INT UnityProperty_Int(UNITY_INT min, UNITY_INT max)
+{
+    UNITY_UINT k;
+    UNITY_UINT value;
+
+    if (min > max)
+    {
+        const UNITY_INT swap = min;
+        min = max;
+        max = swap;
+    }
+    k = (UNITY_UINT)draw((choice_t)((UNITY_UINT)max - (UNITY_UINT)min));
+    if (min >= 0)
+    {
+        value = (UNITY_UINT)min + k;
+    }
+    else if (max <= 0)
+    {
+        value = (UNITY_UINT)max - k;
+    }
+    else
+    {
+        /* Count outwards from zero, alternating sides until the nearer end is reached */
+        const UNITY_UINT below = (UNITY_UINT)0 - (UNITY_UINT)min;
+        const UNITY_UINT above = (UNITY_UINT)max;
+        const UNITY_UINT nearer = (below < above) ? below : above;
+
+        if ((k / 2) < nearer || ((k / 2) == nearer && (k % 2) == 0))
+        {
+            value = (k % 2) ? ((k / 2) + 1) : ((UNITY_UINT)0 - (k / 2));
+        }
+        else
+        {
+            value = k - nearer;
+            if (below > above)
+            {
+                value = (UNITY_UINT)0 - value;
+            }
+        }
+    }
+    if (report_start())
+    {
+        UnityPrintNumber((UNITY_INT)value);
+        UNITY_PRINT_EOL();
+    }
+    return (UNITY_INT)value;
+}
+
+UNITY_UINT UnityProperty_Uint(UNITY_UINT min, UNITY_UINT max)
+{
+    UNITY_UINT value;
+
+    if (min > max)
+    {
+        const UNITY_UINT swap = min;
+        min = max;
+        max = swap;
+    }
+    value = min + (UNITY_UINT)draw((choice_t)(max - min));
+    if (report_start())
+    {
+        UnityPrintNumberUnsigned(value);
+        UNITY_PRINT_EOL();
+    }
+    return value;
+}
+
+UNITY_INT8 UnityProperty_Int8(void)
+{
+    return (UNITY_INT8)UnityProperty_Int(-128, 127);
+}
+
+UNITY_INT16 UnityProperty_Int16(void)
+{
+    return (UNITY_INT16)UnityProperty_Int(-32768, 32767);
+}
+
+UNITY_INT32 UnityProperty_Int32(void)
+{
+    return (UNITY_INT32)UnityProperty_Int(-2147483647 - 1, 2147483647);
+}
+
+UNITY_UINT8 UnityProperty_Uint8(void)
+{
+    return (UNITY_UINT8)UnityProperty_Uint(0, 0xFFu);
+}
+
+UNITY_UINT16 UnityProperty_Uint16(void)
+{
+    return (UNITY_UINT16)UnityProperty_Uint(0, 0xFFFFu);
+}
+
+UNITY_UINT32 UnityProperty_Uint32(void)
+{
+    return (UNITY_UINT32)UnityProperty_Uint(0, 0xFFFFFFFFu);
+}
+
+#ifdef UNITY_SUPPORT_64
+UNITY_INT64 UnityProperty_Int64(void)
+{
+    const UNITY_UINT64 lowest = (UNITY_UINT64)1 << 63;
+    return (UNITY_INT64)UnityProperty_Int((UNITY_INT)lowest, (UNITY_INT)(lowest - 1));
+}
+
+UNITY_UINT64 UnityProperty_Uint64(void)
+{
+    return (UNITY_UINT64)UnityProperty_Uint(0, (UNITY_UINT)-1);
+}
+#endif
+
+#if !defined(UNITY_EXCLUDE_FLOAT) || !defined(UNITY_EXCLUDE_DOUBLE)
+/* Shrinks towards zero when it is in the range, and towards min otherwise */
+static double draw_real(const double min, const double max)
+{
+    const choice_t choice = draw((choice_t)-1);
+    const double fraction = (double)(choice >> 11) * (1.0 / 9007199254740992.0); /* [0, 1) */
+
+    if ((min <= 0.0) && (max >= 0.0))
+    {
+        return (choice & 1u) ? (fraction * min) : (fraction * max);
+    }
+    return min + (fraction * (max - min));
+}
+
+static void report_real(const double value)
+{
+    if (report_start())
+    {
+#ifndef UNITY_EXCLUDE_FLOAT_PRINT
+        UnityPrintFloat((UNITY_DOUBLE)value);
+#else
+        (void)value;
+        UnityPrint("(float)");
+#endif
+        UNITY_PRINT_EOL();
+    }
+}
+#endif
+
+#ifndef UNITY_EXCLUDE_FLOAT
+float UnityProperty_Float(float min, float max)
+{
+    const float value = (float)draw_real((double)min, (double)max);
+    report_real((double)value);
+    return value;
+}
+#endif
+
+#ifndef UNITY_EXCLUDE_DOUBLE
+double UnityProperty_Double(double min, double max)
+{
+    const double value = draw_real(min, max);
+    report_real(value);
+    return value;
+}
+#endif
+
+size_t UnityProperty_Bytes(void* buffer, size_t min_length, size_t max_length)
+{
+    unsigned char* bytes = (unsigned char*)buffer;
+    const int was_reporting = reporting;
+    size_t length;
+    size_t i;
+
+    reporting = 0;
+    length = (size_t)UnityProperty_Uint((UNITY_UINT)min_length, (UNITY_UINT)max_length);
+    for (i = 0; i < length; i++)
+    {
+        bytes[i] = (unsigned char)draw(0xFFu);
+    }
+    reporting = was_reporting;
+    if (report_start())
+    {
+        UnityPrintNumberUnsigned((UNITY_UINT)length);
+        UnityPrint(" bytes");
+        for (i = 0; i < length; i++)
+        {
+            UNITY_OUTPUT_CHAR(' ');
+            UnityPrintNumberHex(bytes[i], 2);
+        }
+        UNITY_PRINT_EOL();
+    }
+    return length;
+}
+
+char* UnityProperty_String(char* buffer, size_t size)
+{
+    const int was_reporting = reporting;
+    size_t length;
+    size_t i;
+
+    if (size == 0)
+    {
+        return buffer;
+    }
+    reporting = 0;
+    length = (size_t)UnityProperty_Uint(0, (UNITY_UINT)(size - 1));
+    for (i = 0; i < length; i++)
+    {
+        /* The 95 printable characters, starting from 'a' so that is what they shrink to */
+        buffer[i] = (char)(' ' + (int)((draw(94u) + (choice_t)('a' - ' ')) % 95u));
+    }
+    buffer[length] = 0;
+    reporting = was_reporting;
+    if (report_start())
+    {
+        UNITY_OUTPUT_CHAR('"');
+        UnityPrint(buffer);
+        UNITY_OUTPUT_CHAR('"');
+        UNITY_PRINT_EOL();
+    }
+    return buffer;
+}
+
+/*-----------------------------------------------
+ * Running Cases
+ *-----------------------------------------------*/
+
+void UnityProperty_OutputChar(int c)
+{
+    if (!muted)
+    {
+        UNITY_PROPERTY_OUTPUT_SINK(c);
+    }
+}
+
+void UnityProperty_Discard(void)
+{
+    if (!in_property)
+    {
+        TEST_IGNORE_MESSAGE("Assumption not met outside of a property");
+    }
+    discarded = 1;
+    TEST_ABORT();
+}
+
+void UnityProperty_SetWorkers(unsigned int count)
+{
+    workers = (count > PROPERTY_MAX_WORKERS) ? PROPERTY_MAX_WORKERS : count;
+}
+
+static int try_case(void (*property)(void))
+{
+    int result;
+
+    draw_count = 0;
+    discarded = 0;
+    reported = 0;
+    UNITY_CLR_DETAILS();
+    if (TEST_PROTECT())
+    {
+        property();
+    }
+    if (Unity.CurrentTestFailed)
+    {
+        result = CASE_FAILED;
+    }
+    else if (discarded || Unity.CurrentTestIgnored)
+    {
+        result = CASE_DISCARDED;
+    }
+    else
+    {
+        result = CASE_PASSED;
+    }
+    Unity.CurrentTestFailed = 0;
+    Unity.CurrentTestIgnored = 0;
+    return result;
+}
+
+static void start_case(const uint64_t property_hash, const UNITY_UINT32 index)
+{
+    replaying = 0;
+    seed_stream(case_seed(property_hash, index));
+}
+
+/* Tries every step'th case from first on, and returns the first one that fails */
+static UNITY_UINT32 run_cases(void (*property)(void), const uint64_t property_hash,
+                              const UNITY_UINT32 first, const UNITY_UINT32 step,
+                              const UNITY_UINT32 iterations, UNITY_UINT32* ran)
+{
+    UNITY_UINT32 i = first;
+
+    while (i < iterations)
+    {
+        start_case(property_hash, i);
+        switch (try_case(property))
+        {
+            case CASE_FAILED:
+                return i;
+            case CASE_PASSED:
+                (*ran)++;
+                break;
+            default:
+                break;
+        }
+        if ((iterations - i) <= step)
+        {
+            break;
+        }
+        i += step;
+    }
+    return NO_FAILURE;
+}
+
+#ifdef PROPERTY_WORKERS_FORK
+/* Each worker tries its share of the cases with its output thrown away, and sends back the
+ * first one that failed. The earliest of those is the one a single process finds first. */
+static UNITY_UINT32 run_cases_in_workers(void (*property)(void), const uint64_t property_hash,
+                                         const UNITY_UINT32 iterations, UNITY_UINT32* ran)
+{
+    pid_t pids[PROPERTY_MAX_WORKERS];
+    int pipes[PROPERTY_MAX_WORKERS];
+    UNITY_UINT32 results[2];
+    UNITY_UINT32 failing = NO_FAILURE;
+    int died = 0;
+    unsigned int w;
+
+    UNITY_OUTPUT_FLUSH();
+    (void)fflush(stdout);
+    (void)fflush(stderr);
+    for (w = 0; w < workers; w++)
+    {
+        int ends[2];
+
+        pids[w] = -1;
+        if (pipe(ends) != 0)
+        {
+            continue;
+        }
+        pids[w] = fork();
+        if (pids[w] == 0)
+        {
+            const int nowhere = open("/dev/null", O_WRONLY);
+            (void)close(ends[0]);
+            if (nowhere >= 0)
+            {
+                (void)dup2(nowhere, 1);
+                (void)dup2(nowhere, 2);
+            }
+            results[1] = 0;
+            results[0] = run_cases(property, property_hash, (UNITY_UINT32)w, (UNITY_UINT32)workers,
+                                   iterations, &results[1]);
+            (void)write(ends[1], results, sizeof(results));
+            _exit(0);
+        }
+        (void)close(ends[1]);
+        if (pids[w] < 0)
+        {
+            (void)close(ends[0]);
+            continue;
+        }
+        pipes[w] = ends[0];
+    }
+
+    for (w = 0; w < workers; w++)
+    {
+        UNITY_UINT32 result;
+
+        if (pids[w] < 0)
+        {
+            /* This worker couldn't be started, so its share is tried here */
+            result = run_cases(property, property_hash, (UNITY_UINT32)w, (UNITY_UINT32)workers,
+                               iterations, ran);
+        }
+        else
+        {
+            int status = 0;
+            if (read(pipes[w], results, sizeof(results)) == (ssize_t)sizeof(results))
+            {
+                result = results[0];
+                *ran += results[1];
+            }
+            else
+            {
+                result = NO_FAILURE;
+                died = 1;
+            }
+            (void)close(pipes[w]);
+            (void)waitpid(pids[w], &status, 0);
+        }
+        if (result < failing)
+        {
+            failing = result;
+        }
+    }
+    return (died && (failing == NO_FAILURE)) ? WORKER_DIED : failing;
+}
+#endif
+
+/*-----------------------------------------------
+ * Shrinking
+ *-----------------------------------------------*/
+
+/* The choices of the last case, without the zeros at the end that replaying adds anyway */
+static size_t drawn_length(void)
+{
+    size_t length = (draw_count < UNITY_PROPERTY_MAX_DRAWS) ? draw_count : UNITY_PROPERTY_MAX_DRAWS;
+    while ((length > 0) && (drawn[length - 1] == 0))
+    {
+        length--;
+    }
+    return length;
+}
+
+/* Fewer choices are simpler, then smaller ones from the first on. Only ever accepting
+ * simpler cases is what makes shrinking come to an end. */
+static int simpler_than_best(const size_t length)
+{
+    size_t i;
+
+    if (length != best_length)
+    {
+        return length < best_length;
+    }
+    for (i = 0; i < length; i++)
+    {
+        if (drawn[i] != best[i])
+        {
+            return drawn[i] < best[i];
+        }
+    }
+    return 0;
+}
+
+static int try_candidate(void (*property)(void), const size_t length)
+{
+    size_t used;
+
+    if (shrinks >= UNITY_PROPERTY_MAX_SHRINKS)
+    {
+        return 0;
+    }
+    shrinks++;
+    memcpy(replay, candidate, length * sizeof(choice_t));
+    replay_length = length;
+    replaying = 1;
+    if (try_case(property) != CASE_FAILED)
+    {
+        return 0;
+    }
+    used = drawn_length();
+    if (!simpler_than_best(used))
+    {
+        return 0;
+    }
+    memcpy(best, drawn, used * sizeof(choice_t));
+    best_length = used;
+    return 1;
+}
+
+static void shrink(void (*property)(void))
+{
+    int improved = 1;
+
+    while (improved && (shrinks < UNITY_PROPERTY_MAX_SHRINKS))
+    {
+        size_t block;
+        size_t i;
+
+        improved = 0;
+
+        /* Leave out runs of choices, which drops whole values, elements and lengths */
+        for (block = 8; block > 0; block /= 2)
+        {
+            size_t start = 0;
+            while (start + block <= best_length)
+            {
+                memcpy(candidate, best, start * sizeof(choice_t));
+                memcpy(&candidate[start], &best[start + block], (best_length - start - block) * sizeof(choice_t));
+                if (try_candidate(property, best_length - block))
+                {
+                    improved = 1;
+                }
+                else
+                {
+                    start++;
+                }
+            }
+        }
+
+        /* Make each choice as small as it can be, first trying zero then bisecting */
+        for (i = 0; i < best_length; i++)
+        {
+            choice_t passes = 0;
+
+            if (best[i] == 0)
+            {
+                continue;
+            }
+            memcpy(candidate, best, best_length * sizeof(choice_t));
+            candidate[i] = 0;
+            if (try_candidate(property, best_length))
+            {
+                improved = 1;
+                continue;
+            }
+            while ((i < best_length) && (best[i] > passes + 1))
+            {
+                memcpy(candidate, best, best_length * sizeof(choice_t));
+                candidate[i] = passes + ((best[i] - passes) / 2);
+                if (try_candidate(property, best_length))
+                {
+                    improved = 1;
+                }
+                else
+                {
+                    passes = candidate[i];
+                }
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------
+ * Properties
+ *-----------------------------------------------*/
+
+void UnityProperty_Run(void (*property)(void), UNITY_UINT32 iterations, UNITY_LINE_TYPE line)
+{
+    jmp_buf test_frame;
+    const uint64_t property_hash = name_hash(Unity.CurrentTestName);
+    UNITY_UINT32 ran = 0;
+    UNITY_UINT32 failing;
+    int shrunk = 0;
+
+    if (iterations == 0)
+    {
+        iterations = UNITY_PROPERTY_ITERATIONS;
+    }
+    memcpy(test_frame, Unity.AbortFrame, sizeof(jmp_buf));
+    in_property = 1;
+    reporting = 0;
+    muted = 1;
+    UnitySetQuiet(1);
+    shrinks = 0;
+
+#ifdef PROPERTY_WORKERS_FORK
+    if ((workers > 1) && (iterations > 1))
+    {
+        failing = run_cases_in_workers(property, property_hash, iterations, &ran);
+    }
+    else
+#endif
+    {
+        failing = run_cases(property, property_hash, 0, 1, iterations, &ran);
+    }
+
+    if (failing < WORKER_DIED)
+    {
+        /* Make the failing case again here, and shrink it if replaying its choices repeats it */
+        start_case(property_hash, failing);
+        if (try_case(property) == CASE_FAILED)
+        {
+            const size_t length = drawn_length();
+            memcpy(candidate, drawn, length * sizeof(choice_t));
+            best_length = UNITY_PROPERTY_MAX_DRAWS + 1;
+            shrunk = try_candidate(property, length);
+            if (shrunk)
+            {
+                shrink(property);
+            }
+        }
+    }
+
+    muted = 0;
+    UnitySetQuiet(0);
+    memcpy(Unity.AbortFrame, test_frame, sizeof(jmp_buf));
+    if (failing == WORKER_DIED)
+    {
+        in_property = 0;
+        UNITY_TEST_FAIL(line, "A property worker died. Run without workers to see the failing case.");
+    }
+    if (failing == NO_FAILURE)
+    {
+        in_property = 0;
+        if (ran == 0)
+        {
+            UNITY_TEST_FAIL(line, "Every case was discarded by TEST_ASSUME");
+        }
+        return;
+    }
+
+    UnityPrint("  Falsified by case ");
+    UnityPrintNumberUnsigned((UNITY_UINT)failing + 1);
+    UnityPrint(" of ");
+    UnityPrintNumberUnsigned((UNITY_UINT)iterations);
+    if (shrunk)
+    {
+        UnityPrint(" after ");
+        UnityPrintNumberUnsigned((UNITY_UINT)shrinks);
+        UnityPrint(" shrinks");
+    }
+    UnityPrint(". Repeat with --seed ");
+    UnityPrintNumberUnsigned(UnitySeed);
+    UNITY_PRINT_EOL();
+
+    /* This time the failure is reported, and ends the test */
+    if (shrunk)
+    {
+        memcpy(replay, best, best_length * sizeof(choice_t));
+        replay_length = best_length;
+        replaying = 1;
+    }
+    else
+    {
+        start_case(property_hash, failing);
+    }
+    reporting = 1;
+    draw_count = 0;
+    reported = 0;
+    if (TEST_PROTECT())
+    {
+        property();
+    }
+    reporting = 0;
+    replaying = 0;
+    in_property = 0;
+    memcpy(Unity.AbortFrame, test_frame, sizeof(jmp_buf));
+    if (Unity.CurrentTestFailed)
+    {
+        TEST_ABORT();
+    }
+    UNITY_TEST_FAIL(line, "The failing case passed when it was repeated");
+}
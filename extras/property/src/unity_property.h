@@ -0,0 +1,102 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+#ifndef UNITY_PROPERTY_H_
+#define UNITY_PROPERTY_H_
+
+#include "unity.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Cases tried when TEST_PROPERTY is given 0 iterations */
+#ifndef UNITY_PROPERTY_ITERATIONS
+#define UNITY_PROPERTY_ITERATIONS 100
+#endif
+
+/* Random choices remembered for each case. A case that makes more than this many draws
+ * can still fail, but only its first draws can be shrunk. */
+#ifndef UNITY_PROPERTY_MAX_DRAWS
+#define UNITY_PROPERTY_MAX_DRAWS 256
+#endif
+
+/* How many times a failing case is rerun while looking for a smaller one */
+#ifndef UNITY_PROPERTY_MAX_SHRINKS
+#define UNITY_PROPERTY_MAX_SHRINKS 2000
+#endif
+
+/* Processes the cases of each property are spread over. Only POSIX hosts can fork, so
+ * everywhere else they always run in the test's own process. */
+#ifndef UNITY_PROPERTY_WORKERS
+#define UNITY_PROPERTY_WORKERS 1
+#endif
+
+/* Where UnityProperty_OutputChar sends what it doesn't hold back. Defaults to stdout. */
+#ifndef UNITY_PROPERTY_OUTPUT_SINK
+  #include <stdio.h>
+  #define UNITY_PROPERTY_OUTPUT_SINK(a) (void)putchar(a)
+#else
+  #ifdef UNITY_PROPERTY_OUTPUT_SINK_HEADER_DECLARATION
+    extern void UNITY_PROPERTY_OUTPUT_SINK_HEADER_DECLARATION;
+  #endif
+#endif
+
+/* A test named `name` that runs its body against `iterations` cases of random inputs.
+ * The body draws its inputs from the generators below and checks them with the usual
+ * TEST_ASSERT macros. */
+#define TEST_PROPERTY(name, iterations)                                      \
+    static void name##_property(void);                                       \
+    void name(void);                                                         \
+    void name(void) { UnityProperty_Run(name##_property, (iterations), __LINE__); } \
+    static void name##_property(void)
+
+/* Throws the current case away, for inputs the property doesn't apply to */
+#define TEST_ASSUME(condition) do { if (!(condition)) { UnityProperty_Discard(); } } while (0)
+
+/* Unity keeps its own output quiet while cases are tried and shrunk. Hook this up to
+ * UNITY_OUTPUT_CHAR to hold back what the tests print themselves in that time as well. */
+void UnityProperty_OutputChar(int c);
+
+void UnityProperty_Run(void (*property)(void), UNITY_UINT32 iterations, UNITY_LINE_TYPE line);
+void UnityProperty_Discard(void);
+void UnityProperty_SetWorkers(unsigned int workers);
+
+/* Generators. Each one shrinks towards the start of its range, or towards zero when zero
+ * is in it. Called outside of a property, they draw from a stream seeded by UnitySeed. */
+UNITY_INT   UnityProperty_Int(UNITY_INT min, UNITY_INT max);
+UNITY_UINT  UnityProperty_Uint(UNITY_UINT min, UNITY_UINT max);
+UNITY_INT8  UnityProperty_Int8(void);
+UNITY_INT16 UnityProperty_Int16(void);
+UNITY_INT32 UnityProperty_Int32(void);
+UNITY_UINT8  UnityProperty_Uint8(void);
+UNITY_UINT16 UnityProperty_Uint16(void);
+UNITY_UINT32 UnityProperty_Uint32(void);
+#ifdef UNITY_SUPPORT_64
+UNITY_INT64  UnityProperty_Int64(void);
+UNITY_UINT64 UnityProperty_Uint64(void);
+#endif
+#ifndef UNITY_EXCLUDE_FLOAT
+float UnityProperty_Float(float min, float max);
+#endif
+#ifndef UNITY_EXCLUDE_DOUBLE
+double UnityProperty_Double(double min, double max);
+#endif
+
+/* Fills buffer with between min_length and max_length random bytes, returning how many */
+size_t UnityProperty_Bytes(void* buffer, size_t min_length, size_t max_length);
+
+/* Fills buffer with a terminated string of up to size - 1 printable characters */
+char* UnityProperty_String(char* buffer, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
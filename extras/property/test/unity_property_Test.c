@@ -0,0 +1,255 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+#include "unity.h"
+#include "unity_property.h"
+#include "unity_property_sink_Spy.h"
+#include <string.h>
+
+/* This test module includes the following tests: */
+
+void test_PassingPropertyTriesEveryCase(void);
+void test_ZeroIterationsTriesTheDefaultNumberOfCases(void);
+void test_GeneratorsStayInTheirRanges(void);
+void test_FailingPropertyShrinksToTheSmallestCounterexample(void);
+void test_NegativeCounterexamplesShrinkTowardsZero(void);
+void test_StringsShrinkToTheShortestCounterexample(void);
+void test_FailureTellsWhichSeedRepeatsIt(void);
+void test_SameSeedGivesTheSameCases(void);
+void test_DifferentSeedsGiveDifferentCases(void);
+void test_AssumptionsDiscardCases(void);
+void test_PropertyFailsWhenEveryCaseIsDiscarded(void);
+void test_WorkersFindTheSameCounterexample(void);
+void test_OnlyTheShrunkFailureIsReported(void);
+
+/* It makes use of the following features */
+void setUp(void);
+void tearDown(void);
+
+/* These are run by the tests above rather than by the runner */
+void property_IsSmall(void);
+void property_IsNotVeryNegative(void);
+void property_HasNoZ(void);
+void property_Counts(void);
+void property_CountsDefault(void);
+void property_InRange(void);
+void property_Records(void);
+void property_OnlyEven(void);
+void property_NeverApplies(void);
+
+#define EXPECT_ABORT_BEGIN \
+  { \
+    jmp_buf TestAbortFrame;   \
+    memcpy(TestAbortFrame, Unity.AbortFrame, sizeof(jmp_buf)); \
+    PropertySinkSpy_Capture(1); \
+    if (TEST_PROTECT()) \
+    {
+
+#define EXPECT_ABORT_END \
+    } \
+    memcpy(Unity.AbortFrame, TestAbortFrame, sizeof(jmp_buf)); \
+    PropertySinkSpy_Capture(0); \
+  }
+
+#define EXPECT_FAILURE(property) \
+    EXPECT_ABORT_BEGIN           \
+    property();                  \
+    EXPECT_ABORT_END             \
+    TEST_ASSERT_TRUE_MESSAGE(Unity.CurrentTestFailed, "Property was expected to fail"); \
+    Unity.CurrentTestFailed = 0
+
+static unsigned int calls;
+static UNITY_UINT recorded[20];
+static unsigned int failures;
+
+static void CountFailure(const UNITY_FAILURE_T* failure)
+{
+    (void)failure;
+    failures++;
+}
+
+static const struct UNITY_REPORTER_T FailureCounter = { NULL, NULL, NULL, CountFailure, NULL, NULL };
+
+/* Let's Go! */
+void setUp(void)
+{
+    UnitySeed = 42;
+    calls = 0;
+}
+
+void tearDown(void)
+{
+    UnityProperty_SetWorkers(UNITY_PROPERTY_WORKERS);
+}
+
+TEST_PROPERTY(property_IsSmall, 200)
+{
+    TEST_ASSERT_TRUE(UnityProperty_Int(0, 1000) < 100);
+}
+
+TEST_PROPERTY(property_IsNotVeryNegative, 200)
+{
+    TEST_ASSERT_TRUE(UnityProperty_Int(-1000, 1000) > -50);
+}
+
+TEST_PROPERTY(property_HasNoZ, 500)
+{
+    char text[16];
+    TEST_ASSERT_NULL(strchr(UnityProperty_String(text, sizeof(text)), 'z'));
+}
+
+TEST_PROPERTY(property_Counts, 37)
+{
+    calls++;
+}
+
+TEST_PROPERTY(property_CountsDefault, 0)
+{
+    calls++;
+}
+
+TEST_PROPERTY(property_InRange, 500)
+{
+    unsigned char bytes[8];
+    const UNITY_INT i = UnityProperty_Int(-5, 7);
+    const UNITY_UINT u = UnityProperty_Uint(10, 12);
+    const size_t length = UnityProperty_Bytes(bytes, 2, 5);
+#ifndef UNITY_EXCLUDE_DOUBLE
+    const double d = UnityProperty_Double(1.5, 2.5);
+    TEST_ASSERT_TRUE((d >= 1.5) && (d <= 2.5));
+#endif
+    TEST_ASSERT_TRUE((i >= -5) && (i <= 7));
+    TEST_ASSERT_TRUE((u >= 10) && (u <= 12));
+    TEST_ASSERT_TRUE((length >= 2) && (length <= 5));
+}
+
+TEST_PROPERTY(property_Records, 20)
+{
+    recorded[calls++] = UnityProperty_Uint32();
+}
+
+TEST_PROPERTY(property_OnlyEven, 100)
+{
+    const UNITY_INT x = UnityProperty_Int(0, 1000);
+    TEST_ASSUME((x % 2) == 0);
+    calls++;
+    TEST_ASSERT_EQUAL_INT(0, x % 2);
+}
+
+TEST_PROPERTY(property_NeverApplies, 10)
+{
+    TEST_ASSUME(0);
+}
+
+void test_PassingPropertyTriesEveryCase(void)
+{
+    UnityProperty_SetWorkers(1);
+    property_Counts();
+    TEST_ASSERT_EQUAL_UINT(37, calls);
+}
+
+void test_ZeroIterationsTriesTheDefaultNumberOfCases(void)
+{
+    UnityProperty_SetWorkers(1);
+    property_CountsDefault();
+    TEST_ASSERT_EQUAL_UINT(UNITY_PROPERTY_ITERATIONS, calls);
+}
+
+void test_GeneratorsStayInTheirRanges(void)
+{
+    property_InRange();
+}
+
+void test_FailingPropertyShrinksToTheSmallestCounterexample(void)
+{
+    EXPECT_FAILURE(property_IsSmall);
+    TEST_ASSERT_NOT_NULL(strstr(PropertySinkSpy_Get(), "    value 1: 100\n"));
+}
+
+void test_NegativeCounterexamplesShrinkTowardsZero(void)
+{
+    EXPECT_FAILURE(property_IsNotVeryNegative);
+    TEST_ASSERT_NOT_NULL(strstr(PropertySinkSpy_Get(), "    value 1: -50\n"));
+}
+
+void test_StringsShrinkToTheShortestCounterexample(void)
+{
+    EXPECT_FAILURE(property_HasNoZ);
+    TEST_ASSERT_NOT_NULL(strstr(PropertySinkSpy_Get(), "    value 1: \"z\"\n"));
+}
+
+void test_FailureTellsWhichSeedRepeatsIt(void)
+{
+    UnitySeed = 12345;
+    EXPECT_FAILURE(property_IsSmall);
+    TEST_ASSERT_NOT_NULL(strstr(PropertySinkSpy_Get(), "  Falsified by case "));
+    TEST_ASSERT_NOT_NULL(strstr(PropertySinkSpy_Get(), ". Repeat with --seed 12345\n"));
+}
+
+void test_SameSeedGivesTheSameCases(void)
+{
+    UNITY_UINT first[20];
+
+    UnityProperty_SetWorkers(1);
+    property_Records();
+    memcpy(first, recorded, sizeof(first));
+    calls = 0;
+    property_Records();
+    TEST_ASSERT_EQUAL_MEMORY(first, recorded, sizeof(first));
+}
+
+void test_DifferentSeedsGiveDifferentCases(void)
+{
+    UNITY_UINT first[20];
+
+    UnityProperty_SetWorkers(1);
+    property_Records();
+    memcpy(first, recorded, sizeof(first));
+    calls = 0;
+    UnitySeed = 43;
+    property_Records();
+    TEST_ASSERT_TRUE(memcmp(first, recorded, sizeof(first)) != 0);
+}
+
+void test_AssumptionsDiscardCases(void)
+{
+    UnityProperty_SetWorkers(1);
+    property_OnlyEven();
+    TEST_ASSERT_TRUE(calls > 0);
+    TEST_ASSERT_TRUE(calls < 100);
+}
+
+void test_PropertyFailsWhenEveryCaseIsDiscarded(void)
+{
+    EXPECT_FAILURE(property_NeverApplies);
+    TEST_ASSERT_NOT_NULL(strstr(PropertySinkSpy_Get(), "Every case was discarded"));
+}
+
+void test_WorkersFindTheSameCounterexample(void)
+{
+    char alone[256];
+
+    UnityProperty_SetWorkers(1);
+    EXPECT_FAILURE(property_IsSmall);
+    strncpy(alone, PropertySinkSpy_Get(), sizeof(alone) - 1);
+    alone[sizeof(alone) - 1] = 0;
+
+    UnityProperty_SetWorkers(3);
+    EXPECT_FAILURE(property_IsSmall);
+    TEST_ASSERT_EQUAL_STRING(alone, PropertySinkSpy_Get());
+}
+
+void test_OnlyTheShrunkFailureIsReported(void)
+{
+    failures = 0;
+    TEST_ASSERT_EQUAL_INT(0, UnityAddReporter(&FailureCounter));
+    EXPECT_FAILURE(property_IsSmall);
+    UnityRemoveReporter(&FailureCounter);
+    TEST_ASSERT_EQUAL_UINT(1, failures);
+    TEST_ASSERT_NOT_NULL(strstr(PropertySinkSpy_Get(), ":FAIL"));
+    TEST_ASSERT_NULL(strstr(strstr(PropertySinkSpy_Get(), ":FAIL") + 1, ":FAIL"));
+}
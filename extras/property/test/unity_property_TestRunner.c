@@ -0,0 +1,41 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+#include "unity.h"
+
+extern void test_PassingPropertyTriesEveryCase(void);
+extern void test_ZeroIterationsTriesTheDefaultNumberOfCases(void);
+extern void test_GeneratorsStayInTheirRanges(void);
+extern void test_FailingPropertyShrinksToTheSmallestCounterexample(void);
+extern void test_NegativeCounterexamplesShrinkTowardsZero(void);
+extern void test_StringsShrinkToTheShortestCounterexample(void);
+extern void test_FailureTellsWhichSeedRepeatsIt(void);
+extern void test_SameSeedGivesTheSameCases(void);
+extern void test_DifferentSeedsGiveDifferentCases(void);
+extern void test_AssumptionsDiscardCases(void);
+extern void test_PropertyFailsWhenEveryCaseIsDiscarded(void);
+extern void test_WorkersFindTheSameCounterexample(void);
+extern void test_OnlyTheShrunkFailureIsReported(void);
+
+int main(void)
+{
+    UnityBegin("unity_property_Test.c");
+    RUN_TEST(test_PassingPropertyTriesEveryCase);
+    RUN_TEST(test_ZeroIterationsTriesTheDefaultNumberOfCases);
+    RUN_TEST(test_GeneratorsStayInTheirRanges);
+    RUN_TEST(test_FailingPropertyShrinksToTheSmallestCounterexample);
+    RUN_TEST(test_NegativeCounterexamplesShrinkTowardsZero);
+    RUN_TEST(test_StringsShrinkToTheShortestCounterexample);
+    RUN_TEST(test_FailureTellsWhichSeedRepeatsIt);
+    RUN_TEST(test_SameSeedGivesTheSameCases);
+    RUN_TEST(test_DifferentSeedsGiveDifferentCases);
+    RUN_TEST(test_AssumptionsDiscardCases);
+    RUN_TEST(test_PropertyFailsWhenEveryCaseIsDiscarded);
+    RUN_TEST(test_WorkersFindTheSameCounterexample);
+    RUN_TEST(test_OnlyTheShrunkFailureIsReported);
+    return UnityEnd();
+}
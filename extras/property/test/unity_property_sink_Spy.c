@@ -0,0 +1,42 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+#include "unity_property_sink_Spy.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Passes everything on to stdout, except while capturing what a property reports */
+static char buffer[2048];
+static size_t count;
+static int capturing;
+
+void PropertySinkSpy_Char(int c)
+{
+    if (!capturing)
+    {
+        (void)putchar(c);
+    }
+    else if (count < (sizeof(buffer) - 1))
+    {
+        buffer[count++] = (char)c;
+    }
+}
+
+void PropertySinkSpy_Capture(int capture)
+{
+    if (capture)
+    {
+        memset(buffer, 0, sizeof(buffer));
+        count = 0;
+    }
+    capturing = capture;
+}
+
+const char* PropertySinkSpy_Get(void)
+{
+    return buffer;
+}
@@ -0,0 +1,15 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+#ifndef UNITY_PROPERTY_SINK_SPY_H
+#define UNITY_PROPERTY_SINK_SPY_H
+
+void PropertySinkSpy_Char(int c);
+void PropertySinkSpy_Capture(int capture);
+const char* PropertySinkSpy_Get(void);
+
+#endif
@@ -5,8 +5,32 @@
     SPDX-License-Identifier: MIT
 ========================================================================= */
 
+#if defined(UNITY_INCLUDE_PERF_COUNTERS) && defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* syscall() is needed to reach perf_event_open */
+#endif
+#if defined(UNITY_CAPTURE_TEST_OUTPUT) && defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* for memfd_create() */
+#endif
+#if defined(UNITY_CAPTURE_TEST_OUTPUT) && defined(__unix__) && \
+    !defined(_GNU_SOURCE) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L /* dup2(), fileno() and ftruncate() */
+#endif
+#if defined(UNITY_INCLUDE_FUZZ) && (defined(__unix__) || defined(__APPLE__)) && \
+    !defined(_GNU_SOURCE) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L /* fork(), fileno() and the directory functions */
+#endif
+#if defined(UNITY_INCLUDE_EXEC_TIME) && (defined(__unix__) || defined(__APPLE__)) && \
+    !defined(_GNU_SOURCE) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L /* clock_gettime() is hidden by a strict -std=c99 otherwise */
+#endif
+
+#define UNITY_OUTPUT_INTERCEPT_OWNER /* see UnityOutputChar */
 #include "unity.h"
 
+#ifdef UNITY_INCLUDE_FILE_REPORTERS
+#include <stdio.h>
+#endif
+
 #ifndef UNITY_PROGMEM
 #define UNITY_PROGMEM
 #endif
@@ -16,12 +40,48 @@
 void UNITY_OUTPUT_CHAR(int);
 #endif
 
+/* Set while Unity is to print nothing and report no failures, see UnitySetQuiet */
+static int UnityQuiet = 0;
+
+#ifdef UNITY_OUTPUT_INTERCEPT
+/* The only place that still writes to the configured output. Everything else in this
+ * file goes through UnityOutputChar like the rest of the test build does. */
+static void UnityOutputSinkChar(int c)
+{
+    UNITY_OUTPUT_CHAR(c);
+}
+#undef UNITY_OUTPUT_CHAR
+#define UNITY_OUTPUT_CHAR(a) UnityOutputChar(a)
+#else
+/* Everything this file prints passes here, so that it can be kept quiet */
+static void UnityOutputQuietChar(int c)
+{
+    if (!UnityQuiet)
+    {
+        UNITY_OUTPUT_CHAR(c);
+    }
+}
+#undef UNITY_OUTPUT_CHAR
+#define UNITY_OUTPUT_CHAR(a) UnityOutputQuietChar(a)
+#endif
+
 /* Helpful macros for us to use here in Assert functions */
-#define UNITY_FAIL_AND_BAIL         do { Unity.CurrentTestFailed  = 1; UNITY_OUTPUT_FLUSH(); TEST_ABORT(); } while (0)
+#define UNITY_FAIL_AND_BAIL         do { Unity.CurrentTestFailed  = 1; UnityReportFailure(); UNITY_OUTPUT_FLUSH(); TEST_ABORT(); } while (0)
 #define UNITY_IGNORE_AND_BAIL       do { Unity.CurrentTestIgnored = 1; UNITY_OUTPUT_FLUSH(); TEST_ABORT(); } while (0)
 #define RETURN_IF_FAIL_OR_IGNORE    do { if (Unity.CurrentTestFailed || Unity.CurrentTestIgnored) { TEST_ABORT(); } } while (0)
 
 struct UNITY_STORAGE_T Unity;
+int UnityVerbosity = UNITY_DEFAULT_VERBOSITY;
+UNITY_UINT UnitySeed = 0;
+static int UnityDotsPending = 0; /* progress dots have been printed without an end of line */
+static int UnityLineOpen = 0;    /* a test's result line is waiting for its end, see UnitySetLineOpen */
+
+/* In tokenized mode Unity's own messages are sent as tokens like everyone else's */
+#ifdef UNITY_OUTPUT_TOKENIZED
+#define UNITY_STR(s) UNITY_TOKEN_BYTES(s)
+#else
+#define UNITY_STR(s) s
+#endif
 
 #ifdef UNITY_OUTPUT_COLOR
 const char UNITY_PROGMEM UnityStrOk[]                            = "\033[42mOK\033[0m";
@@ -34,52 +94,420 @@ const char UNITY_PROGMEM UnityStrPass[]                          = "PASS";
 const char UNITY_PROGMEM UnityStrFail[]                          = "FAIL";
 const char UNITY_PROGMEM UnityStrIgnore[]                        = "IGNORE";
 #endif
-static const char UNITY_PROGMEM UnityStrNull[]                   = "NULL";
+static const char UNITY_PROGMEM UnityStrNull[]                   = UNITY_STR("NULL");
 static const char UNITY_PROGMEM UnityStrSpacer[]                 = UNITY_FAILURE_DETAIL_SEPARATOR;
-static const char UNITY_PROGMEM UnityStrExpected[]               = " Expected ";
-static const char UNITY_PROGMEM UnityStrWas[]                    = " Was ";
-static const char UNITY_PROGMEM UnityStrGt[]                     = " to be greater than ";
-static const char UNITY_PROGMEM UnityStrLt[]                     = " to be less than ";
-static const char UNITY_PROGMEM UnityStrOrEqual[]                = "or equal to ";
-static const char UNITY_PROGMEM UnityStrNotEqual[]               = " to be not equal to ";
-static const char UNITY_PROGMEM UnityStrElement[]                = " Element ";
-static const char UNITY_PROGMEM UnityStrByte[]                   = " Byte ";
-static const char UNITY_PROGMEM UnityStrCharacter[]              = " Character ";
-static const char UNITY_PROGMEM UnityStrMemory[]                 = " Memory Mismatch.";
-static const char UNITY_PROGMEM UnityStrDelta[]                  = " Values Not Within Delta ";
-static const char UNITY_PROGMEM UnityStrPointless[]              = " You Asked Me To Compare Nothing, Which Was Pointless.";
-static const char UNITY_PROGMEM UnityStrNullPointerForExpected[] = " Expected pointer to be NULL";
-static const char UNITY_PROGMEM UnityStrNullPointerForActual[]   = " Actual pointer was NULL";
+static const char UNITY_PROGMEM UnityStrExpected[]               = UNITY_STR(" Expected ");
+static const char UNITY_PROGMEM UnityStrWas[]                    = UNITY_STR(" Was ");
+static const char UNITY_PROGMEM UnityStrGt[]                     = UNITY_STR(" to be greater than ");
+static const char UNITY_PROGMEM UnityStrLt[]                     = UNITY_STR(" to be less than ");
+static const char UNITY_PROGMEM UnityStrOrEqual[]                = UNITY_STR("or equal to ");
+static const char UNITY_PROGMEM UnityStrNotEqual[]               = UNITY_STR(" to be not equal to ");
+static const char UNITY_PROGMEM UnityStrElement[]                = UNITY_STR(" Element ");
+static const char UNITY_PROGMEM UnityStrByte[]                   = UNITY_STR(" Byte ");
+static const char UNITY_PROGMEM UnityStrCharacter[]              = UNITY_STR(" Character ");
+static const char UNITY_PROGMEM UnityStrMemory[]                 = UNITY_STR(" Memory Mismatch.");
+static const char UNITY_PROGMEM UnityStrDelta[]                  = UNITY_STR(" Values Not Within Delta ");
+static const char UNITY_PROGMEM UnityStrPointless[]              = UNITY_STR(" You Asked Me To Compare Nothing, Which Was Pointless.");
+static const char UNITY_PROGMEM UnityStrNullPointerForExpected[] = UNITY_STR(" Expected pointer to be NULL");
+static const char UNITY_PROGMEM UnityStrNullPointerForActual[]   = UNITY_STR(" Actual pointer was NULL");
 #ifndef UNITY_EXCLUDE_FLOAT
-static const char UNITY_PROGMEM UnityStrNot[]                    = "Not ";
-static const char UNITY_PROGMEM UnityStrInf[]                    = "Infinity";
-static const char UNITY_PROGMEM UnityStrNegInf[]                 = "Negative Infinity";
-static const char UNITY_PROGMEM UnityStrNaN[]                    = "NaN";
-static const char UNITY_PROGMEM UnityStrDet[]                    = "Determinate";
-static const char UNITY_PROGMEM UnityStrInvalidFloatTrait[]      = "Invalid Float Trait";
-#endif
-const char UNITY_PROGMEM UnityStrErrShorthand[]                  = "Unity Shorthand Support Disabled";
-const char UNITY_PROGMEM UnityStrErrFloat[]                      = "Unity Floating Point Disabled";
-const char UNITY_PROGMEM UnityStrErrDouble[]                     = "Unity Double Precision Disabled";
-const char UNITY_PROGMEM UnityStrErr64[]                         = "Unity 64-bit Support Disabled";
-const char UNITY_PROGMEM UnityStrErrDetailStack[]                = "Unity Detail Stack Support Disabled";
-static const char UNITY_PROGMEM UnityStrBreaker[]                = "-----------------------";
-static const char UNITY_PROGMEM UnityStrResultsTests[]           = " Tests ";
-static const char UNITY_PROGMEM UnityStrResultsFailures[]        = " Failures ";
-static const char UNITY_PROGMEM UnityStrResultsIgnored[]         = " Ignored ";
+static const char UNITY_PROGMEM UnityStrNot[]                    = UNITY_STR("Not ");
+static const char UNITY_PROGMEM UnityStrInf[]                    = UNITY_STR("Infinity");
+static const char UNITY_PROGMEM UnityStrNegInf[]                 = UNITY_STR("Negative Infinity");
+static const char UNITY_PROGMEM UnityStrNaN[]                    = UNITY_STR("NaN");
+static const char UNITY_PROGMEM UnityStrDet[]                    = UNITY_STR("Determinate");
+static const char UNITY_PROGMEM UnityStrInvalidFloatTrait[]      = UNITY_STR("Invalid Float Trait");
+#endif
+const char UNITY_PROGMEM UnityStrErrShorthand[]                  = UNITY_STR("Unity Shorthand Support Disabled");
+const char UNITY_PROGMEM UnityStrErrFloat[]                      = UNITY_STR("Unity Floating Point Disabled");
+const char UNITY_PROGMEM UnityStrErrDouble[]                     = UNITY_STR("Unity Double Precision Disabled");
+const char UNITY_PROGMEM UnityStrErr64[]                         = UNITY_STR("Unity 64-bit Support Disabled");
+const char UNITY_PROGMEM UnityStrErrDetailStack[]                = UNITY_STR("Unity Detail Stack Support Disabled");
+static const char UNITY_PROGMEM UnityStrBreaker[]                = UNITY_STR("-----------------------");
+static const char UNITY_PROGMEM UnityStrResultsTests[]           = UNITY_STR(" Tests ");
+static const char UNITY_PROGMEM UnityStrResultsFailures[]        = UNITY_STR(" Failures ");
+static const char UNITY_PROGMEM UnityStrResultsIgnored[]         = UNITY_STR(" Ignored ");
 #ifndef UNITY_EXCLUDE_DETAILS
 #ifdef UNITY_DETAIL_STACK_SIZE
 static const char* UNITY_PROGMEM UnityStrDetailLabels[] = UNITY_DETAIL_LABEL_NAMES;
 static const UNITY_COUNTER_TYPE UNITY_PROGMEM UnityStrDetailLabelsCount = sizeof(UnityStrDetailLabels) / sizeof(const char*);
-static const char UNITY_PROGMEM UnityStrErrDetailStackEmpty[]           = " Detail Stack Empty";
-static const char UNITY_PROGMEM UnityStrErrDetailStackFull[]            = " Detail Stack Full";
-static const char UNITY_PROGMEM UnityStrErrDetailStackLabel[]           = " Detail Label Outside Of UNITY_DETAIL_LABEL_NAMES: ";
-static const char UNITY_PROGMEM UnityStrErrDetailStackPop[]             = " Detail Pop With Unexpected Arguments";
+static const char UNITY_PROGMEM UnityStrErrDetailStackEmpty[]           = UNITY_STR(" Detail Stack Empty");
+static const char UNITY_PROGMEM UnityStrErrDetailStackFull[]            = UNITY_STR(" Detail Stack Full");
+static const char UNITY_PROGMEM UnityStrErrDetailStackLabel[]           = UNITY_STR(" Detail Label Outside Of UNITY_DETAIL_LABEL_NAMES: ");
+static const char UNITY_PROGMEM UnityStrErrDetailStackPop[]             = UNITY_STR(" Detail Pop With Unexpected Arguments");
 #else
 static const char UNITY_PROGMEM UnityStrDetail1Name[]            = UNITY_DETAIL1_NAME " ";
 static const char UNITY_PROGMEM UnityStrDetail2Name[]            = " " UNITY_DETAIL2_NAME " ";
 #endif
 #endif
+/*-----------------------------------------------
+ * Binary Output
+ *-----------------------------------------------*/
+#ifdef UNITY_OUTPUT_BINARY
+#if UNITY_OUTPUT_BINARY_STRINGS < 2
+#error "UNITY_OUTPUT_BINARY_STRINGS must hold at least a file name and a test name"
+#endif
+
+/* Each record is a type byte, the payload length as a varint, then the payload, so a
+ * decoder can step over types it does not know. auto/decode_binary_output.rb turns a
+ * stream of them back into the text Unity would otherwise have printed. */
+#define UNITY_BINARY_HEADER   0 /* "UNITY" and the protocol version, starts each run */
+#define UNITY_BINARY_TEXT     1 /* characters, as written */
+#define UNITY_BINARY_STRING   2 /* id, characters: a file or test name later records refer to */
+#define UNITY_BINARY_LOCATION 3 /* test index, file id, line, test name id: "file:line:test:" */
+#define UNITY_BINARY_STATUS   4 /* 0 OK, 1 PASS, 2 FAIL, 3 IGNORE */
+#define UNITY_BINARY_INT      5 /* zigzag encoded, so small negative numbers stay small */
+#define UNITY_BINARY_UINT     6
+#define UNITY_BINARY_HEX      7 /* digits to print, then the value */
+#define UNITY_BINARY_TOKEN    8 /* 32-bit token of a string, low byte first */
+#define UNITY_BINARY_VERSION  1
+
+static char UnityBinaryText[UNITY_OUTPUT_BINARY_TEXT_SIZE];
+static UNITY_UINT UnityBinaryTextLength;
+static const char* UnityBinaryStrings[UNITY_OUTPUT_BINARY_STRINGS];
+static UNITY_UINT32 UnityBinaryStringHashes[UNITY_OUTPUT_BINARY_STRINGS];
+static UNITY_UINT UnityBinaryNextString;
+
+static UNITY_UINT UnityBinaryVarintSize(UNITY_UINT value)
+{
+    UNITY_UINT size = 1;
+
+    while (value > 0x7F)
+    {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+static void UnityBinaryVarint(UNITY_UINT value)
+{
+    while (value > 0x7F)
+    {
+        UnityOutputSinkChar((int)((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    UnityOutputSinkChar((int)value);
+}
+
+static void UnityBinaryFlushText(void)
+{
+    UNITY_UINT i;
+
+    if (UnityBinaryTextLength == 0)
+    {
+        return;
+    }
+    UnityOutputSinkChar(UNITY_BINARY_TEXT);
+    UnityBinaryVarint(UnityBinaryTextLength);
+    for (i = 0; i < UnityBinaryTextLength; i++)
+    {
+        UnityOutputSinkChar(UnityBinaryText[i]);
+    }
+    UnityBinaryTextLength = 0;
+}
+
+/* Any other record first sends the text written before it, to keep everything in order */
+static void UnityBinaryRecord(const int type, const UNITY_UINT length)
+{
+    UnityBinaryFlushText();
+    UnityOutputSinkChar(type);
+    UnityBinaryVarint(length);
+}
+
+static void UnityBinaryValue(const int type, const UNITY_UINT value)
+{
+    UnityBinaryRecord(type, UnityBinaryVarintSize(value));
+    UnityBinaryVarint(value);
+}
+
+static void UnityBinaryOutputChar(int c)
+{
+    UnityBinaryText[UnityBinaryTextLength++] = (char)c;
+    if ((c == '\n') || (UnityBinaryTextLength == UNITY_OUTPUT_BINARY_TEXT_SIZE))
+    {
+        UnityBinaryFlushText();
+    }
+}
+
+static void UnityBinaryBegin(void)
+{
+    UNITY_UINT i;
+
+    for (i = 0; i < UNITY_OUTPUT_BINARY_STRINGS; i++)
+    {
+        UnityBinaryStrings[i] = NULL;
+    }
+    UnityBinaryNextString = 0;
+
+    UnityBinaryRecord(UNITY_BINARY_HEADER, 6);
+    UnityOutputSinkChar('U');
+    UnityOutputSinkChar('N');
+    UnityOutputSinkChar('I');
+    UnityOutputSinkChar('T');
+    UnityOutputSinkChar('Y');
+    UnityOutputSinkChar(UNITY_BINARY_VERSION);
+}
+
+static UNITY_UINT UnityBinaryStringLength(const char* string)
+{
+    UNITY_UINT length = 0;
+
+#ifdef UNITY_OUTPUT_TOKENIZED
+    if (string[0] == UNITY_TOKEN_MARK)
+    {
+        return UNITY_TOKEN_SIZE; /* the token may well contain zero bytes */
+    }
+#endif
+    while (string[length])
+    {
+        length++;
+    }
+    return length;
+}
+
+static UNITY_UINT32 UnityBinaryStringHash(const char* string, const UNITY_UINT length)
+{
+    UNITY_UINT32 hash = 2166136261u; /* FNV-1a */
+    UNITY_UINT i;
+
+    for (i = 0; i < length; i++)
+    {
+        hash = (hash ^ (unsigned char)string[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/* File and test names are sent once and then referred to by id. The ids are slots in a
+ * small round robin cache keyed on the pointer and a hash of the characters, so a buffer
+ * that is reused for another name (or a tokenized name on the stack) is sent again rather
+ * than taken for the old one. A name that has dropped out is simply sent again too.
+ * Id 0 is NULL. The slot holding id keep is never reused for the new name. */
+static UNITY_UINT UnityBinaryStringId(const char* string, const UNITY_UINT keep)
+{
+    UNITY_UINT slot;
+    UNITY_UINT length;
+    UNITY_UINT32 hash;
+    UNITY_UINT i;
+
+    if (string == NULL)
+    {
+        return 0;
+    }
+    length = UnityBinaryStringLength(string);
+    hash = UnityBinaryStringHash(string, length);
+    for (slot = 0; slot < UNITY_OUTPUT_BINARY_STRINGS; slot++)
+    {
+        if ((UnityBinaryStrings[slot] == string) && (UnityBinaryStringHashes[slot] == hash))
+        {
+            return slot + 1;
+        }
+    }
+
+    slot = UnityBinaryNextString;
+    if ((slot + 1) == keep)
+    {
+        slot = (slot + 1) % UNITY_OUTPUT_BINARY_STRINGS;
+    }
+    UnityBinaryNextString = (slot + 1) % UNITY_OUTPUT_BINARY_STRINGS;
+    UnityBinaryStrings[slot] = string;
+    UnityBinaryStringHashes[slot] = hash;
+
+    UnityBinaryRecord(UNITY_BINARY_STRING, UnityBinaryVarintSize(slot + 1) + length);
+    UnityBinaryVarint(slot + 1);
+    for (i = 0; i < length; i++)
+    {
+        UnityOutputSinkChar((unsigned char)string[i]);
+    }
+    return slot + 1;
+}
+
+static void UnityBinaryTestResultsBegin(const char* file, const UNITY_LINE_TYPE line)
+{
+    const UNITY_UINT file_id = UnityBinaryStringId(file, 0);
+    const UNITY_UINT name_id = UnityBinaryStringId(Unity.CurrentTestName, file_id);
+    const UNITY_UINT index = (UNITY_UINT)Unity.NumberOfTests;
+
+    UnityBinaryRecord(UNITY_BINARY_LOCATION,
+                      UnityBinaryVarintSize(index) + UnityBinaryVarintSize(file_id) +
+                      UnityBinaryVarintSize((UNITY_UINT)line) + UnityBinaryVarintSize(name_id));
+    UnityBinaryVarint(index);
+    UnityBinaryVarint(file_id);
+    UnityBinaryVarint((UNITY_UINT)line);
+    UnityBinaryVarint(name_id);
+}
+
+/* The result words are sent as a code rather than spelled out */
+static int UnityBinaryStatus(const char* string)
+{
+    UNITY_UINT status;
+
+    if (string == UnityStrOk)
+    {
+        status = 0;
+    }
+    else if (string == UnityStrPass)
+    {
+        status = 1;
+    }
+    else if (string == UnityStrFail)
+    {
+        status = 2;
+    }
+    else if (string == UnityStrIgnore)
+    {
+        status = 3;
+    }
+    else
+    {
+        return 0;
+    }
+    UnityBinaryValue(UNITY_BINARY_STATUS, status);
+    return 1;
+}
+
+#ifdef UNITY_OUTPUT_TOKENIZED
+static int UnityBinaryToken(const char* string)
+{
+    UNITY_UINT32 token = 0;
+    int i;
+
+    if ((string == NULL) || (string[0] != UNITY_TOKEN_MARK))
+    {
+        return 0;
+    }
+    for (i = UNITY_TOKEN_SIZE - 1; i > 0; i--)
+    {
+        token = (token << 7) | (UNITY_UINT32)(unsigned char)string[i];
+    }
+    UnityBinaryRecord(UNITY_BINARY_TOKEN, 4);
+    for (i = 0; i < 4; i++)
+    {
+        UnityOutputSinkChar((int)((token >> (i * 8)) & 0xFF));
+    }
+    return 1;
+}
+#endif
+
+static void UnityBinaryHex(const UNITY_UINT number, const char nibbles)
+{
+    UNITY_UINT value = number;
+
+    if (nibbles <= 0)
+    {
+        return;
+    }
+    if (nibbles < UNITY_MAX_NIBBLES)
+    {
+        value &= ((UNITY_UINT)1 << (nibbles * 4)) - 1;
+    }
+    UnityBinaryRecord(UNITY_BINARY_HEX, 1 + UnityBinaryVarintSize(value));
+    UnityOutputSinkChar(nibbles);
+    UnityBinaryVarint(value);
+}
+#endif /* UNITY_OUTPUT_BINARY */
+
+/*-----------------------------------------------
+ * Output Interception
+ *-----------------------------------------------*/
+#ifdef UNITY_OUTPUT_INTERCEPT
+#ifdef UNITY_CAPTURE_FAILURE_TEXT
+static char UnityFailureText[UNITY_FAILURE_TEXT_SIZE];
+static UNITY_UINT UnityFailureTextLength;
+static int UnityFailureTextCapturing;
+#endif
+
+/*-----------------------------------------------*/
+static void UnityOutputSend(int c)
+{
+#ifdef UNITY_OUTPUT_BINARY
+    UnityBinaryOutputChar(c);
+#else
+    UnityOutputSinkChar(c);
+#endif
+}
+
+#ifdef UNITY_CAPTURING_TEST_OUTPUT
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#define UNITY_CAPTURE_HELD_SIZE 128
+
+static int UnityCaptureFd = -1;                   /* what the running test has written */
+static int UnityCaptureSavedFds[2] = { -1, -1 };  /* the real stdout and stderr */
+static int UnityCaptureActive = 0;
+static char UnityCaptureHeld[UNITY_CAPTURE_HELD_SIZE]; /* Unity's own output during the test */
+static UNITY_UINT UnityCaptureHeldLength;
+static char UnityCapturedOutput[UNITY_CAPTURE_TEST_OUTPUT_SIZE + 1];
+static UNITY_UINT UnityCapturedLength;
+static UNITY_UINT UnityCapturedDropped;
+
+/*-----------------------------------------------*/
+static void UnityCaptureRedirect(const int capture)
+{
+    /* Anything still buffered belongs where the descriptors pointed until now */
+    (void)fflush(stdout);
+    (void)fflush(stderr);
+    (void)dup2(capture ? UnityCaptureFd : UnityCaptureSavedFds[0], 1);
+    (void)dup2(capture ? UnityCaptureFd : UnityCaptureSavedFds[1], 2);
+}
+
+/*-----------------------------------------------*/
+static void UnityCaptureSendHeld(void)
+{
+    UNITY_UINT i;
+
+    for (i = 0; i < UnityCaptureHeldLength; i++)
+    {
+        UnityOutputSend(UnityCaptureHeld[i]);
+    }
+    UnityCaptureHeldLength = 0;
+}
+
+/*-----------------------------------------------*/
+static void UnityCaptureHoldChar(int c)
+{
+    if (UnityCaptureHeldLength == UNITY_CAPTURE_HELD_SIZE)
+    {
+        /* Step out of the capture for long enough to pass on what has been held */
+        UnityCaptureRedirect(0);
+        UnityCaptureSendHeld();
+        UnityCaptureRedirect(1);
+    }
+    UnityCaptureHeld[UnityCaptureHeldLength++] = (char)c;
+}
+#endif
+
+/*-----------------------------------------------*/
+void UnityOutputChar(int c)
+{
+    if (UnityQuiet)
+    {
+        return;
+    }
+#ifdef UNITY_CAPTURE_FAILURE_TEXT
+    if (UnityFailureTextCapturing && (UnityFailureTextLength < (UNITY_FAILURE_TEXT_SIZE - 1)))
+    {
+        /* The separators in front of the text belong to the line, not to the failure */
+        if ((UnityFailureTextLength > 0) || ((c != ' ') && (c != ':') && (c != '.')))
+        {
+            UnityFailureText[UnityFailureTextLength++] = (char)c;
+        }
+    }
+#endif
+#ifdef UNITY_CAPTURING_TEST_OUTPUT
+    if (UnityCaptureActive)
+    {
+        UnityCaptureHoldChar(c);
+        return;
+    }
+#endif
+    UnityOutputSend(c);
+}
+#endif /* UNITY_OUTPUT_INTERCEPT */
+
 /*-----------------------------------------------
  * Pretty Printers & Test Result Output Handlers
  *-----------------------------------------------*/
@@ -140,6 +568,19 @@ void UnityPrint(const char* string)
 {
     const char* pch = string;
 
+#ifdef UNITY_OUTPUT_BINARY
+    if (UnityBinaryStatus(string))
+    {
+        return;
+    }
+#endif
+#ifdef UNITY_OUTPUT_TOKENIZED
+    if (UnityBinaryToken(string))
+    {
+        return;
+    }
+#endif
+
     if (pch != NULL)
     {
         while (*pch)
@@ -262,6 +703,9 @@ void UnityPrintNumber(const UNITY_INT number_to_print)
 {
     UNITY_UINT number = (UNITY_UINT)number_to_print;
 
+#ifdef UNITY_OUTPUT_BINARY
+    UnityBinaryValue(UNITY_BINARY_INT, (number_to_print < 0) ? (((~number) << 1) | 1) : (number << 1));
+#else
     if (number_to_print < 0)
     {
         /* A negative number, including MIN negative */
@@ -269,12 +713,16 @@ void UnityPrintNumber(const UNITY_INT number_to_print)
         number = (~number) + 1;
     }
     UnityPrintNumberUnsigned(number);
+#endif
 }
 
 /*-----------------------------------------------
  * basically do an itoa using as little ram as possible */
 void UnityPrintNumberUnsigned(const UNITY_UINT number)
 {
+#ifdef UNITY_OUTPUT_BINARY
+    UnityBinaryValue(UNITY_BINARY_UINT, number);
+#else
     UNITY_UINT divisor = 1;
 
     /* figure out initial divisor */
@@ -289,12 +737,15 @@ void UnityPrintNumberUnsigned(const UNITY_UINT number)
         UNITY_OUTPUT_CHAR((char)('0' + (number / divisor % 10)));
         divisor /= 10;
     } while (divisor > 0);
+#endif
 }
 
 /*-----------------------------------------------*/
 void UnityPrintNumberHex(const UNITY_UINT number, const char nibbles_to_print)
 {
+#ifndef UNITY_OUTPUT_BINARY
     int nibble;
+#endif
     char nibbles = nibbles_to_print;
 
     if ((unsigned)nibbles > UNITY_MAX_NIBBLES)
@@ -302,6 +753,9 @@ void UnityPrintNumberHex(const UNITY_UINT number, const char nibbles_to_print)
         nibbles = UNITY_MAX_NIBBLES;
     }
 
+#ifdef UNITY_OUTPUT_BINARY
+    UnityBinaryHex(number, nibbles);
+#else
     while (nibbles > 0)
     {
         nibbles--;
@@ -315,6 +769,7 @@ void UnityPrintNumberHex(const UNITY_UINT number, const char nibbles_to_print)
             UNITY_OUTPUT_CHAR((char)('A' - 10 + nibble));
         }
     }
+#endif
 }
 
 /*-----------------------------------------------*/
@@ -524,10 +979,24 @@ void UnityPrintFloat(const UNITY_DOUBLE input_number)
 }
 #endif /* ! UNITY_EXCLUDE_FLOAT_PRINT */
 
+/*-----------------------------------------------
+ * Reporters
+ *-----------------------------------------------*/
+
 /*-----------------------------------------------*/
-static void UnityTestResultsBegin(const char* file, const UNITY_LINE_TYPE line)
+static void UnityTextResultsBegin(const char* file, const UNITY_LINE_TYPE line)
+{
+    UnityPrint(file);
+    UNITY_OUTPUT_CHAR(':');
+    UnityPrintNumber((UNITY_INT)line);
+    UNITY_OUTPUT_CHAR(':');
+    UnityPrint(Unity.CurrentTestName);
+    UNITY_OUTPUT_CHAR(':');
+}
+
+/*-----------------------------------------------*/
+static void UnityEclipseResultsBegin(const char* file, const UNITY_LINE_TYPE line)
 {
-#ifdef UNITY_OUTPUT_FOR_ECLIPSE
     UNITY_OUTPUT_CHAR('(');
     UnityPrint(file);
     UNITY_OUTPUT_CHAR(':');
@@ -536,8 +1005,11 @@ static void UnityTestResultsBegin(const char* file, const UNITY_LINE_TYPE line)
     UNITY_OUTPUT_CHAR(' ');
     UnityPrint(Unity.CurrentTestName);
     UNITY_OUTPUT_CHAR(':');
-#else
-#ifdef UNITY_OUTPUT_FOR_IAR_WORKBENCH
+}
+
+/*-----------------------------------------------*/
+static void UnityIarWorkbenchResultsBegin(const char* file, const UNITY_LINE_TYPE line)
+{
     UnityPrint("<SRCREF line=");
     UnityPrintNumber((UNITY_INT)line);
     UnityPrint(" file=\"");
@@ -546,8 +1018,11 @@ static void UnityTestResultsBegin(const char* file, const UNITY_LINE_TYPE line)
     UNITY_OUTPUT_CHAR('>');
     UnityPrint(Unity.CurrentTestName);
     UnityPrint("</SRCREF> ");
-#else
-#ifdef UNITY_OUTPUT_FOR_QT_CREATOR
+}
+
+/*-----------------------------------------------*/
+static void UnityQtCreatorResultsBegin(const char* file, const UNITY_LINE_TYPE line)
+{
     UnityPrint("file://");
     UnityPrint(file);
     UNITY_OUTPUT_CHAR(':');
@@ -555,57 +1030,216 @@ static void UnityTestResultsBegin(const char* file, const UNITY_LINE_TYPE line)
     UNITY_OUTPUT_CHAR(' ');
     UnityPrint(Unity.CurrentTestName);
     UNITY_OUTPUT_CHAR(':');
-#else
-    UnityPrint(file);
-    UNITY_OUTPUT_CHAR(':');
-    UnityPrintNumber((UNITY_INT)line);
-    UNITY_OUTPUT_CHAR(':');
-    UnityPrint(Unity.CurrentTestName);
-    UNITY_OUTPUT_CHAR(':');
-#endif
+}
+
+const struct UNITY_REPORTER_T UnityReporterText         = { NULL, NULL, UnityTextResultsBegin,         NULL, NULL, NULL };
+const struct UNITY_REPORTER_T UnityReporterEclipse      = { NULL, NULL, UnityEclipseResultsBegin,      NULL, NULL, NULL };
+const struct UNITY_REPORTER_T UnityReporterIarWorkbench = { NULL, NULL, UnityIarWorkbenchResultsBegin, NULL, NULL, NULL };
+const struct UNITY_REPORTER_T UnityReporterQtCreator    = { NULL, NULL, UnityQtCreatorResultsBegin,    NULL, NULL, NULL };
+#ifdef UNITY_OUTPUT_BINARY
+const struct UNITY_REPORTER_T UnityReporterBinary       = { NULL, NULL, UnityBinaryTestResultsBegin,   NULL, NULL, NULL };
 #endif
+
+/* The output format options only choose which reporter is installed at start up */
+#if defined(UNITY_OUTPUT_BINARY)
+#define UNITY_DEFAULT_REPORTER UnityReporterBinary
+#elif defined(UNITY_OUTPUT_FOR_ECLIPSE)
+#define UNITY_DEFAULT_REPORTER UnityReporterEclipse
+#elif defined(UNITY_OUTPUT_FOR_IAR_WORKBENCH)
+#define UNITY_DEFAULT_REPORTER UnityReporterIarWorkbench
+#elif defined(UNITY_OUTPUT_FOR_QT_CREATOR)
+#define UNITY_DEFAULT_REPORTER UnityReporterQtCreator
+#else
+#define UNITY_DEFAULT_REPORTER UnityReporterText
 #endif
+
+static const struct UNITY_REPORTER_T* UnityReporters[UNITY_MAX_REPORTERS] = { &UNITY_DEFAULT_REPORTER };
+static UNITY_COUNTER_TYPE UnityReporterCount = 1;
+static UNITY_FAILURE_T UnityFailure;
+static const char* UnityIgnoreMessage;
+
+#define UNITY_REPORT(event, args) do {                                  \
+        UNITY_COUNTER_TYPE r_;                                          \
+        for (r_ = 0; r_ < UnityReporterCount; r_++) {                   \
+            if (UnityReporters[r_]->event != NULL) {                    \
+                UnityReporters[r_]->event args; } }                     \
+    } while (0)
+
+/*-----------------------------------------------*/
+void UnitySetQuiet(const int quiet)
+{
+    UnityQuiet = quiet;
 }
 
 /*-----------------------------------------------*/
-static void UnityTestResultsFailBegin(const UNITY_LINE_TYPE line)
+void UnitySetLineOpen(const int open)
 {
-    UnityTestResultsBegin(Unity.TestFile, line);
-    UnityPrint(UnityStrFail);
-    UNITY_OUTPUT_CHAR(':');
+    UnityLineOpen = open;
 }
 
 /*-----------------------------------------------*/
-void UnityConcludeTest(void)
+void UnityEndOpenLine(void)
 {
-    if (Unity.CurrentTestIgnored)
+    if (!UnityQuiet && (UnityDotsPending || UnityLineOpen))
     {
-        Unity.TestIgnores++;
-    }
-    else if (!Unity.CurrentTestFailed)
-    {
-        UnityTestResultsBegin(Unity.TestFile, Unity.CurrentTestLineNumber);
-        UnityPrint(UnityStrPass);
+        UnityDotsPending = 0;
+        UnityLineOpen = 0;
+        UNITY_PRINT_EOL();
     }
-    else
+}
+
+/*-----------------------------------------------*/
+int UnityAddReporter(const struct UNITY_REPORTER_T* reporter)
+{
+    if ((reporter == NULL) || (UnityReporterCount >= UNITY_MAX_REPORTERS))
     {
-        Unity.TestFailures++;
+        return 1;
     }
+    UnityReporters[UnityReporterCount++] = reporter;
+    return 0;
+}
 
-    Unity.CurrentTestFailed = 0;
-    Unity.CurrentTestIgnored = 0;
-    UNITY_PRINT_EXEC_TIME();
-    UNITY_PRINT_EOL();
-    UNITY_FLUSH_CALL();
+/*-----------------------------------------------*/
+void UnityRemoveReporter(const struct UNITY_REPORTER_T* reporter)
+{
+    UNITY_COUNTER_TYPE i;
+    UNITY_COUNTER_TYPE kept = 0;
+
+    for (i = 0; i < UnityReporterCount; i++)
+    {
+        if (UnityReporters[i] != reporter)
+        {
+            UnityReporters[kept++] = UnityReporters[i];
+        }
+    }
+    UnityReporterCount = kept;
 }
 
 /*-----------------------------------------------*/
-static void UnityAddMsgIfSpecified(const char* msg)
+void UnityReportTestBegin(void)
 {
-#ifdef UNITY_PRINT_TEST_CONTEXT
-    UnityPrint(UnityStrSpacer);
-    UNITY_PRINT_TEST_CONTEXT();
+    UnityIgnoreMessage = NULL;
+    UnityFailure.Message = NULL;
+    UNITY_REPORT(TestBegin, (Unity.TestFile, Unity.CurrentTestName, Unity.CurrentTestLineNumber));
+}
+
+/*-----------------------------------------------*/
+void UnityReportTestEnd(void)
+{
+    UNITY_TEST_RESULT_T result;
+
+    result.File = Unity.TestFile;
+    result.TestName = Unity.CurrentTestName;
+    result.Line = Unity.CurrentTestLineNumber;
+    if (Unity.CurrentTestIgnored)
+    {
+        result.Result = UNITY_RESULT_IGNORE;
+        result.Message = UnityIgnoreMessage;
+    }
+    else if (Unity.CurrentTestFailed)
+    {
+        result.Result = UNITY_RESULT_FAIL;
+        result.Message = UnityFailure.Message;
+    }
+    else
+    {
+        result.Result = UNITY_RESULT_PASS;
+        result.Message = NULL;
+    }
+#ifdef UNITY_CAPTURING_TEST_OUTPUT
+    result.Output = (Unity.CurrentTestFailed && (UnityCapturedLength > 0)) ? UnityCapturedOutput : NULL;
+#else
+    result.Output = NULL;
+#endif
+#ifdef UNITY_INCLUDE_EXEC_TIME
+    result.Duration = Unity.CurrentTestStopTime - Unity.CurrentTestStartTime;
+#else
+    result.Duration = 0;
+#endif
+    UNITY_REPORT(TestEnd, (&result));
+}
+
+/*-----------------------------------------------*/
+static void UnityTestResultsBegin(const char* file, const UNITY_LINE_TYPE line)
+{
+    if (UnityQuiet)
+    {
+        return;
+    }
+    if (UnityDotsPending)
+    {
+        UnityDotsPending = 0;
+        UNITY_PRINT_EOL();
+    }
+    UNITY_REPORT(ResultsBegin, (file, line));
+}
+
+/*-----------------------------------------------*/
+static void UnityFailureBegin(const UNITY_LINE_TYPE line)
+{
+    UnityFailure.File = Unity.TestFile;
+    UnityFailure.TestName = Unity.CurrentTestName;
+    UnityFailure.Message = NULL;
+    UnityFailure.Text = NULL;
+    UnityFailure.Line = line;
+    UnityFailure.Flags = 0;
+}
+
+/*-----------------------------------------------*/
+static void UnityFailureTextStart(void)
+{
+#ifdef UNITY_CAPTURE_FAILURE_TEXT
+    UnityFailureTextLength = 0;
+    UnityFailureTextCapturing = 1;
+#endif
+}
+
+/*-----------------------------------------------*/
+static void UnityFailureValues(const UNITY_INT expected, const UNITY_INT actual, const UNITY_DISPLAY_STYLE_T style)
+{
+    UnityFailure.Expected = expected;
+    UnityFailure.Actual = actual;
+    UnityFailure.Style = style;
+    UnityFailure.Flags |= UNITY_FAILURE_HAS_VALUES;
+}
+
+/*-----------------------------------------------*/
+static void UnityPrintElement(const UNITY_UINT32 index)
+{
+    UnityFailure.Index = index;
+    UnityFailure.Flags |= UNITY_FAILURE_HAS_INDEX;
+    UnityPrint(UnityStrElement);
+    UnityPrintNumberUnsigned(index);
+}
+
+/*-----------------------------------------------*/
+static void UnityReportFailure(void)
+{
+#ifdef UNITY_CAPTURE_FAILURE_TEXT
+    UnityFailureTextCapturing = 0;
+    UnityFailureText[UnityFailureTextLength] = 0;
+    UnityFailure.Text = UnityFailureText;
 #endif
+    if (!UnityQuiet)
+    {
+        UNITY_REPORT(AssertFail, (&UnityFailure));
+    }
+}
+
+/*-----------------------------------------------*/
+static void UnityTestResultsFailBegin(const UNITY_LINE_TYPE line)
+{
+    UnityFailureBegin(line);
+    UnityTestResultsBegin(Unity.TestFile, line);
+    UnityPrint(UnityStrFail);
+    UNITY_OUTPUT_CHAR(':');
+    UnityFailureTextStart();
+    UnityLineOpen = 1; /* UnityConcludeTest ends it */
+}
+
+/*-----------------------------------------------*/
+static void UnityPrintDetails(void)
+{
 #ifndef UNITY_EXCLUDE_DETAILS
 #ifdef UNITY_DETAIL_STACK_SIZE
     {
@@ -646,8 +1280,64 @@ static void UnityAddMsgIfSpecified(const char* msg)
     }
 #endif
 #endif
+}
+
+/*-----------------------------------------------*/
+void UnityConcludeTest(void)
+{
+    UnityLineOpen = 0;
+    if (Unity.CurrentTestIgnored)
+    {
+        Unity.TestIgnores++;
+    }
+    else if (Unity.CurrentTestFailed)
+    {
+        Unity.TestFailures++;
+    }
+    else if (UnityVerbosity < UNITY_VERBOSITY_NORMAL)
+    {
+        /* Nothing of the PASS line is formatted, the pass is only counted or marked */
+        if (UnityVerbosity == UNITY_VERBOSITY_DOTS)
+        {
+            UNITY_OUTPUT_CHAR('.');
+            UnityDotsPending = 1;
+        }
+        UnityReportTestEnd();
+        Unity.CurrentTestFailed = 0;
+        Unity.CurrentTestIgnored = 0;
+        return;
+    }
+    else
+    {
+        UnityTestResultsBegin(Unity.TestFile, Unity.CurrentTestLineNumber);
+        UnityPrint(UnityStrPass);
+    }
+
+    UnityReportTestEnd();
+    Unity.CurrentTestFailed = 0;
+    Unity.CurrentTestIgnored = 0;
+    UNITY_PRINT_PERF_COUNTERS();
+    UNITY_PRINT_EXEC_TIME();
+    if (UnityVerbosity >= UNITY_VERBOSITY_VERBOSE)
+    {
+        UnityPrintDetails();
+    }
+    UNITY_PRINT_EOL();
+    UNITY_PRINT_CAPTURED_OUTPUT();
+    UNITY_FLUSH_CALL();
+}
+
+/*-----------------------------------------------*/
+static void UnityAddMsgIfSpecified(const char* msg)
+{
+#ifdef UNITY_PRINT_TEST_CONTEXT
+    UnityPrint(UnityStrSpacer);
+    UNITY_PRINT_TEST_CONTEXT();
+#endif
+    UnityPrintDetails();
     if (msg)
     {
+        UnityFailure.Message = msg;
         UnityPrint(UnityStrSpacer);
         UnityPrint(msg);
     }
@@ -797,6 +1487,7 @@ void UnityAssertEqualIntNumber(const UNITY_INT expected,
     if (expected != actual)
     {
         UnityTestResultsFailBegin(lineNumber);
+        UnityFailureValues(expected, actual, style);
         UnityPrint(UnityStrExpected);
         UnityPrintIntNumberByStyle(expected, style);
         UnityPrint(UnityStrWas);
@@ -817,6 +1508,7 @@ void UnityAssertEqualUintNumber(const UNITY_UINT expected,
     if (expected != actual)
     {
         UnityTestResultsFailBegin(lineNumber);
+        UnityFailureValues((UNITY_INT)expected, (UNITY_INT)actual, style);
         UnityPrint(UnityStrExpected);
         UnityPrintUintNumberByStyle(expected, style);
         UnityPrint(UnityStrWas);
@@ -844,6 +1536,7 @@ void UnityAssertIntGreaterOrLessOrEqualNumber(const UNITY_INT threshold,
     if (failed)
     {
         UnityTestResultsFailBegin(lineNumber);
+        UnityFailureValues(threshold, actual, style);
         UnityPrint(UnityStrExpected);
         UnityPrintIntNumberByStyle(actual, style);
         if (compare & UNITY_GREATER_THAN) { UnityPrint(UnityStrGt);       }
@@ -875,6 +1568,7 @@ void UnityAssertUintGreaterOrLessOrEqualNumber(const UNITY_UINT threshold,
     if (failed)
     {
         UnityTestResultsFailBegin(lineNumber);
+        UnityFailureValues((UNITY_INT)threshold, (UNITY_INT)actual, style);
         UnityPrint(UnityStrExpected);
         UnityPrintUintNumberByStyle(actual, style);
         if (compare & UNITY_GREATER_THAN) { UnityPrint(UnityStrGt);       }
@@ -991,8 +1685,8 @@ void UnityAssertEqualIntArray(UNITY_INTERNAL_PTR expected,
                 actual_val &= mask;
             }
             UnityTestResultsFailBegin(lineNumber);
-            UnityPrint(UnityStrElement);
-            UnityPrintNumberUnsigned(num_elements - elements - 1);
+            UnityFailureValues(expect_val, actual_val, style);
+            UnityPrintElement(num_elements - elements - 1);
             UnityPrint(UnityStrExpected);
             UnityPrintIntNumberByStyle(expect_val, style);
             UnityPrint(UnityStrWas);
@@ -1112,8 +1806,7 @@ void UnityAssertWithinFloatArray(const UNITY_FLOAT delta,
         if (!UnityFloatsWithin(in_delta + current_element_delta, *ptr_expected, *ptr_actual))
         {
             UnityTestResultsFailBegin(lineNumber);
-            UnityPrint(UnityStrElement);
-            UnityPrintNumberUnsigned(num_elements - elements - 1);
+            UnityPrintElement(num_elements - elements - 1);
             UNITY_PRINT_EXPECTED_AND_ACTUAL_FLOAT((UNITY_DOUBLE)*ptr_expected, (UNITY_DOUBLE)*ptr_actual);
             UnityAddMsgIfSpecified(msg);
             UNITY_FAIL_AND_BAIL;
@@ -1342,8 +2035,7 @@ void UnityAssertWithinDoubleArray(const UNITY_DOUBLE delta,
         if (!UnityDoublesWithin(in_delta + current_element_delta, *ptr_expected, *ptr_actual))
         {
             UnityTestResultsFailBegin(lineNumber);
-            UnityPrint(UnityStrElement);
-            UnityPrintNumberUnsigned(num_elements - elements - 1);
+            UnityPrintElement(num_elements - elements - 1);
             UNITY_PRINT_EXPECTED_AND_ACTUAL_FLOAT(*ptr_expected, *ptr_actual);
             UnityAddMsgIfSpecified(msg);
             UNITY_FAIL_AND_BAIL;
@@ -1519,6 +2211,7 @@ void UnityAssertIntNumbersWithin(const UNITY_UINT delta,
     if (Unity.CurrentTestFailed)
     {
         UnityTestResultsFailBegin(lineNumber);
+        UnityFailureValues(expected, actual, style);
         UnityPrint(UnityStrDelta);
         UnityPrintIntNumberByStyle((UNITY_INT)delta, style);
         UnityPrint(UnityStrExpected);
@@ -1551,6 +2244,7 @@ void UnityAssertUintNumbersWithin(const UNITY_UINT delta,
     if (Unity.CurrentTestFailed)
     {
         UnityTestResultsFailBegin(lineNumber);
+        UnityFailureValues((UNITY_INT)expected, (UNITY_INT)actual, style);
         UnityPrint(UnityStrDelta);
         UnityPrintUintNumberByStyle(delta, style);
         UnityPrint(UnityStrExpected);
@@ -1706,10 +2400,10 @@ void UnityAssertNumbersArrayWithin(const UNITY_UINT delta,
                 actual_val &= mask;
             }
             UnityTestResultsFailBegin(lineNumber);
+            UnityFailureValues(expect_val, actual_val, style);
             UnityPrint(UnityStrDelta);
             UnityPrintIntNumberByStyle((UNITY_INT)delta, style);
-            UnityPrint(UnityStrElement);
-            UnityPrintNumberUnsigned(num_elements - elements - 1);
+            UnityPrintElement(num_elements - elements - 1);
             UnityPrint(UnityStrExpected);
             UnityPrintIntNumberByStyle(expect_val, style);
             UnityPrint(UnityStrWas);
@@ -1884,8 +2578,7 @@ void UnityAssertEqualStringArray(UNITY_INTERNAL_PTR expected,
             UnityTestResultsFailBegin(lineNumber);
             if (num_elements > 1)
             {
-                UnityPrint(UnityStrElement);
-                UnityPrintNumberUnsigned(j);
+                UnityPrintElement(j);
             }
             UnityPrintExpectedAndActualStrings(expd, act, i_diff);
             UnityAddMsgIfSpecified(msg);
@@ -1939,7 +2632,7 @@ void UnityAssertNotEqualString(const char* expected,
         }
         else
         {
-            UnityPrint(" Expected strings to be different");
+            UnityPrint(UNITY_TOKENIZE(" Expected strings to be different"));
         }
 
         UNITY_FAIL_AND_BAIL;
@@ -1997,7 +2690,7 @@ void UnityAssertNotEqualStringLen(const char* expected,
         }
         else
         {
-            UnityPrint(" Expected strings to be different");
+            UnityPrint(UNITY_TOKENIZE(" Expected strings to be different"));
         }
         
         UNITY_FAIL_AND_BAIL;
@@ -2060,7 +2753,7 @@ void UnityAssertNotEqualMemory(UNITY_INTERNAL_PTR expected,
         }
         else
         {
-            UnityPrint(" Expected memory to be different");
+            UnityPrint(UNITY_TOKENIZE(" Expected memory to be different"));
         }
 
         UNITY_FAIL_AND_BAIL;
@@ -2117,8 +2810,7 @@ void UnityAssertEqualMemory(UNITY_INTERNAL_PTR expected,
                 UnityPrint(UnityStrMemory);
                 if (num_elements > 1)
                 {
-                    UnityPrint(UnityStrElement);
-                    UnityPrintNumberUnsigned(num_elements - elements - 1);
+                    UnityPrintElement(num_elements - elements - 1);
                 }
                 UnityPrint(UnityStrByte);
                 UnityPrintNumberUnsigned(length - bytes - 1);
@@ -2443,8 +3135,10 @@ void UnityFail(const char* msg, const UNITY_LINE_TYPE line)
 {
     RETURN_IF_FAIL_OR_IGNORE;
 
+    UnityFailureBegin(line);
     UnityTestResultsBegin(Unity.TestFile, line);
     UnityPrint(UnityStrFail);
+    UnityFailureTextStart();
     UnityAddMsgIfSpecified(msg);
 
     UNITY_FAIL_AND_BAIL;
@@ -2457,6 +3151,7 @@ void UnityIgnore(const char* msg, const UNITY_LINE_TYPE line)
 
     UnityTestResultsBegin(Unity.TestFile, line);
     UnityPrint(UnityStrIgnore);
+    UnityIgnoreMessage = msg;
     if (msg != NULL)
     {
         UNITY_OUTPUT_CHAR(':');
@@ -2480,142 +3175,2133 @@ void UnityMessage(const char* msg, const UNITY_LINE_TYPE line)
     UNITY_PRINT_EOL();
 }
 
+/*-----------------------------------------------
+ * Execution Time
+ *-----------------------------------------------*/
+#ifdef UNITY_EXEC_TIME_BUILTIN
+#if !defined(UNITY_CLOCK_NS) && !defined(UNITY_CLOCK_MS)
+#include <time.h>
+#endif
+
+typedef struct
+{
+    const char* file;
+    char name[UNITY_EXEC_TIME_NAME_SIZE]; /* copied, as the names of cases are built in a buffer they share */
+    UNITY_LINE_TYPE line;
+    UNITY_TIME_TYPE total;
+    UNITY_TIME_TYPE phase[UNITY_EXEC_PHASE_COUNT];
+} UNITY_SLOW_TEST_T;
+
+/* Kept sorted with the slowest test first */
+static UNITY_SLOW_TEST_T UnitySlowestTests[UNITY_EXEC_TIME_SLOWEST_MAX];
+static UNITY_COUNTER_TYPE UnitySlowestTestsKept = 0;
+static UNITY_COUNTER_TYPE UnitySlowestTestsWanted = UNITY_EXEC_TIME_SLOWEST;
+static const char* const UnityStrExecPhases[UNITY_EXEC_PHASE_COUNT] = { "setUp ", "body ", "tearDown " };
+
 /*-----------------------------------------------*/
-/* If we have not defined our own test runner, then include our default test runner to make life easier */
-#ifndef UNITY_SKIP_DEFAULT_RUNNER
-void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum)
+#define UNITY_TIME_UNITS_PER_S (UNITY_TIME_UNITS_PER_MS * 1000u)
+
+/* Now, in units of UNITY_TIME_UNITS_PER_MS. Only differences are used, so the clock may wrap around. */
+static UNITY_TIME_TYPE UnityClockNow(void)
 {
-    Unity.CurrentTestName = FuncName;
-    Unity.CurrentTestLineNumber = (UNITY_LINE_TYPE)FuncLineNum;
-    Unity.NumberOfTests++;
-    #ifndef UNITY_EXCLUDE_DETAILS
-    #ifdef UNITY_DETAIL_STACK_SIZE
-    Unity.CurrentDetailStackSize = 0;
-    #else
-    UNITY_CLR_DETAILS();
-    #endif
-    #endif
-    UNITY_EXEC_TIME_START();
-    if (TEST_PROTECT())
-    {
-        setUp();
-        Func();
-    }
-    if (TEST_PROTECT())
+#if defined(UNITY_CLOCK_NS)
+    return (UNITY_TIME_TYPE)(UNITY_CLOCK_NS() / (1000000u / UNITY_TIME_UNITS_PER_MS));
+#elif defined(UNITY_CLOCK_MS)
+    return (UNITY_TIME_TYPE)UNITY_CLOCK_MS() * (UNITY_TIME_TYPE)UNITY_TIME_UNITS_PER_MS;
+#elif defined(_WIN32)
+    const clock_t now = clock();
+    return ((UNITY_TIME_TYPE)(now / CLOCKS_PER_SEC) * UNITY_TIME_UNITS_PER_S) +
+           (((UNITY_TIME_TYPE)(now % CLOCKS_PER_SEC) * UNITY_TIME_UNITS_PER_S) / (UNITY_TIME_TYPE)CLOCKS_PER_SEC);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((UNITY_TIME_TYPE)now.tv_sec * UNITY_TIME_UNITS_PER_S) +
+           (UNITY_TIME_TYPE)(now.tv_nsec / (long)(1000000000u / UNITY_TIME_UNITS_PER_S));
+#endif
+}
+
+/*-----------------------------------------------*/
+/* In milliseconds, to the last unit kept */
+static void UnityPrintTime(const UNITY_TIME_TYPE time)
+{
+    const UNITY_TIME_TYPE fraction = time % UNITY_TIME_UNITS_PER_MS;
+    UNITY_TIME_TYPE divisor = UNITY_TIME_UNITS_PER_MS / 10u;
+
+    UnityPrintNumberUnsigned((UNITY_UINT)(time / UNITY_TIME_UNITS_PER_MS));
+    UNITY_OUTPUT_CHAR('.');
+    while (divisor > 0)
     {
-        tearDown();
+        UNITY_OUTPUT_CHAR((char)('0' + (fraction / divisor % 10)));
+        divisor /= 10;
     }
-    UNITY_EXEC_TIME_STOP();
-    UnityConcludeTest();
+    UnityPrint(" ms");
 }
-#endif
 
 /*-----------------------------------------------*/
-void UnitySetTestFile(const char* filename)
+static void UnityPrintExecPhases(const UNITY_TIME_TYPE* phases)
 {
-    Unity.TestFile = filename;
+    UNITY_COUNTER_TYPE phase;
+
+    for (phase = 0; phase < UNITY_EXEC_PHASE_COUNT; phase++)
+    {
+        UnityPrint((phase == 0) ? " (" : ", ");
+        UnityPrint(UnityStrExecPhases[phase]);
+        UnityPrintTime(phases[phase]);
+    }
+    UNITY_OUTPUT_CHAR(')');
 }
 
 /*-----------------------------------------------*/
-void UnityBegin(const char* filename)
+static void UnityExecTimeAccumulate(const UNITY_TIME_TYPE now)
 {
-    Unity.TestFile = filename;
-    Unity.CurrentTestName = NULL;
-    Unity.CurrentTestLineNumber = 0;
-    Unity.NumberOfTests = 0;
-    Unity.TestFailures = 0;
-    Unity.TestIgnores = 0;
-    Unity.CurrentTestFailed = 0;
-    Unity.CurrentTestIgnored = 0;
-
-    UNITY_CLR_DETAILS();
-    UNITY_OUTPUT_START();
+    Unity.CurrentTestPhaseTime[Unity.CurrentTestPhase] += now - Unity.CurrentPhaseStartTime;
+    Unity.CurrentPhaseStartTime = now;
 }
 
 /*-----------------------------------------------*/
-int UnityEnd(void)
+static void UnityExecTimeKeepIfSlow(void)
 {
-    UNITY_PRINT_EOL();
-    UnityPrint(UnityStrBreaker);
-    UNITY_PRINT_EOL();
-    UnityPrintNumber((UNITY_INT)(Unity.NumberOfTests));
-    UnityPrint(UnityStrResultsTests);
-    UnityPrintNumber((UNITY_INT)(Unity.TestFailures));
-    UnityPrint(UnityStrResultsFailures);
-    UnityPrintNumber((UNITY_INT)(Unity.TestIgnores));
-    UnityPrint(UnityStrResultsIgnored);
-    UNITY_PRINT_EOL();
-    if (Unity.TestFailures == 0U)
+    const UNITY_TIME_TYPE total = Unity.CurrentTestStopTime - Unity.CurrentTestStartTime;
+    UNITY_COUNTER_TYPE i;
+    UNITY_COUNTER_TYPE phase;
+    UNITY_COUNTER_TYPE c;
+
+    if (Unity.CurrentTestIgnored)
     {
-        UnityPrint(UnityStrOk);
+        return;
+    }
+    else if (UnitySlowestTestsKept < UnitySlowestTestsWanted)
+    {
+        i = UnitySlowestTestsKept++;
+    }
+    else if ((UnitySlowestTestsWanted > 0) && (total > UnitySlowestTests[UnitySlowestTestsWanted - 1].total))
+    {
+        i = UnitySlowestTestsWanted - 1;
     }
     else
     {
-        UnityPrint(UnityStrFail);
-#ifdef UNITY_DIFFERENTIATE_FINAL_FAIL
-        UNITY_OUTPUT_CHAR('E'); UNITY_OUTPUT_CHAR('D');
-#endif
+        return;
     }
-    UNITY_PRINT_EOL();
-    UNITY_FLUSH_CALL();
-    UNITY_OUTPUT_COMPLETE();
-    return (int)(Unity.TestFailures);
-}
 
-/*-----------------------------------------------
- * Details Stack
- *-----------------------------------------------*/
-#ifndef UNITY_EXCLUDE_DETAILS
-#ifdef UNITY_DETAIL_STACK_SIZE
-void UnityPushDetail(UNITY_DETAIL_LABEL_TYPE label, UNITY_DETAIL_VALUE_TYPE value, const UNITY_LINE_TYPE line) {
-    if (Unity.CurrentDetailStackSize >= UNITY_DETAIL_STACK_SIZE) {
-        UnityTestResultsFailBegin(line);
-        UnityPrint(UnityStrErrDetailStackFull);
-        UnityAddMsgIfSpecified(NULL);
-        UNITY_FAIL_AND_BAIL;
+    /* slide the faster tests down until the new one is in order */
+    while ((i > 0) && (UnitySlowestTests[i - 1].total < total))
+    {
+        UnitySlowestTests[i] = UnitySlowestTests[i - 1];
+        i--;
     }
-    if (label >= UnityStrDetailLabelsCount) {
-        UnityTestResultsFailBegin(line);
-        UnityPrint(UnityStrErrDetailStackLabel);
-        UnityPrintNumberUnsigned(label);
-        UnityAddMsgIfSpecified(NULL);
-        UNITY_FAIL_AND_BAIL;
+    UnitySlowestTests[i].file = Unity.TestFile;
+    for (c = 0; (Unity.CurrentTestName != NULL) && (c < UNITY_EXEC_TIME_NAME_SIZE - 1) && (Unity.CurrentTestName[c] != 0); c++)
+    {
+        UnitySlowestTests[i].name[c] = Unity.CurrentTestName[c];
     }
-    Unity.CurrentDetailStackLabels[Unity.CurrentDetailStackSize] = label;
-    Unity.CurrentDetailStackValues[Unity.CurrentDetailStackSize++] = value;
-}
-void UnityPopDetail(UNITY_DETAIL_LABEL_TYPE label, UNITY_DETAIL_VALUE_TYPE value, const UNITY_LINE_TYPE line) {
-    if (Unity.CurrentDetailStackSize == 0) {
-        UnityTestResultsFailBegin(line);
-        UnityPrint(UnityStrErrDetailStackEmpty);
-        UnityAddMsgIfSpecified(NULL);
-        UNITY_FAIL_AND_BAIL;
+    UnitySlowestTests[i].name[c] = 0;
+    UnitySlowestTests[i].line = Unity.CurrentTestLineNumber;
+    UnitySlowestTests[i].total = total;
+    for (phase = 0; phase < UNITY_EXEC_PHASE_COUNT; phase++)
+    {
+        UnitySlowestTests[i].phase[phase] = Unity.CurrentTestPhaseTime[phase];
     }
-    if ((Unity.CurrentDetailStackLabels[Unity.CurrentDetailStackSize-1] != label) || (Unity.CurrentDetailStackValues[Unity.CurrentDetailStackSize-1] != value)) {
-        UnityTestResultsFailBegin(line);
-        UnityPrint(UnityStrErrDetailStackPop);
-        UnityAddMsgIfSpecified(NULL);
-        UNITY_FAIL_AND_BAIL;
-    }   
-    Unity.CurrentDetailStackSize--;
 }
-#endif
-#endif
 
-/*-----------------------------------------------
- * Command Line Argument Support
- *-----------------------------------------------*/
-#ifdef UNITY_USE_COMMAND_LINE_ARGS
+/*-----------------------------------------------*/
+void UnityExecTimeStart(void)
+{
+    UNITY_COUNTER_TYPE phase;
 
-char* UnityOptionIncludeNamed = NULL;
-char* UnityOptionExcludeNamed = NULL;
-int UnityVerbosity            = 1;
-int UnityStrictMatch          = 0;
+    Unity.CurrentTestStartTime = UnityClockNow();
+    Unity.CurrentTestStopTime = Unity.CurrentTestStartTime;
+    Unity.CurrentPhaseStartTime = Unity.CurrentTestStartTime;
+    Unity.CurrentTestPhase = UNITY_EXEC_PHASE_SETUP;
+    for (phase = 0; phase < UNITY_EXEC_PHASE_COUNT; phase++)
+    {
+        Unity.CurrentTestPhaseTime[phase] = 0;
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityExecTimePhase(UNITY_EXEC_PHASE_T phase)
+{
+    /* CurrentTestPhase is UNITY_EXEC_PHASE_COUNT whenever no test is being timed */
+    if (Unity.CurrentTestPhase < UNITY_EXEC_PHASE_COUNT)
+    {
+        UnityExecTimeAccumulate(UnityClockNow());
+        Unity.CurrentTestPhase = (UNITY_COUNTER_TYPE)phase;
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityExecTimeStop(void)
+{
+    UNITY_COUNTER_TYPE phase;
+
+    if (Unity.CurrentTestPhase >= UNITY_EXEC_PHASE_COUNT)
+    {
+        /* Already stopped, or never started (a dry run, for instance) */
+        return;
+    }
+
+    Unity.CurrentTestStopTime = UnityClockNow();
+    UnityExecTimeAccumulate(Unity.CurrentTestStopTime);
+    Unity.CurrentTestPhase = UNITY_EXEC_PHASE_COUNT;
+    for (phase = 0; phase < UNITY_EXEC_PHASE_COUNT; phase++)
+    {
+        Unity.TotalPhaseTime[phase] += Unity.CurrentTestPhaseTime[phase];
+    }
+    UnityExecTimeKeepIfSlow();
+}
+
+/*-----------------------------------------------*/
+void UnityPrintExecTime(void)
+{
+    UnityPrint(" (");
+    UnityPrintTime(Unity.CurrentTestStopTime - Unity.CurrentTestStartTime);
+    UNITY_OUTPUT_CHAR(')');
+    if (UnityVerbosity >= UNITY_VERBOSITY_VERBOSE)
+    {
+        UnityPrintExecPhases(Unity.CurrentTestPhaseTime);
+    }
+}
+
+/*-----------------------------------------------*/
+void UnitySetSlowestTestCount(UNITY_COUNTER_TYPE count)
+{
+    UnitySlowestTestsWanted = (count > UNITY_EXEC_TIME_SLOWEST_MAX) ? UNITY_EXEC_TIME_SLOWEST_MAX : count;
+}
+
+/*-----------------------------------------------*/
+static void UnityExecTimeReset(void)
+{
+    UNITY_COUNTER_TYPE phase;
+
+    Unity.CurrentTestPhase = UNITY_EXEC_PHASE_COUNT;
+    for (phase = 0; phase < UNITY_EXEC_PHASE_COUNT; phase++)
+    {
+        Unity.TotalPhaseTime[phase] = 0;
+    }
+    UnitySlowestTestsKept = 0;
+}
+
+/*-----------------------------------------------*/
+static void UnityPrintExecTimeReport(void)
+{
+    UNITY_TIME_TYPE total = 0;
+    UNITY_TIME_TYPE overhead;
+    UNITY_TIME_TYPE permille = 0;
+    UNITY_COUNTER_TYPE phase;
+    UNITY_COUNTER_TYPE i;
+
+    for (phase = 0; phase < UNITY_EXEC_PHASE_COUNT; phase++)
+    {
+        total += Unity.TotalPhaseTime[phase];
+    }
+    overhead = Unity.TotalPhaseTime[UNITY_EXEC_PHASE_SETUP] + Unity.TotalPhaseTime[UNITY_EXEC_PHASE_TEARDOWN];
+    if (overhead > ((UNITY_TIME_TYPE)-1 / 1000u))
+    {
+        permille = overhead / (total / 1000u);
+    }
+    else if (total > 0)
+    {
+        permille = (overhead * 1000u) / total;
+    }
+
+    UnityPrint("Total time ");
+    UnityPrintTime(total);
+    UnityPrintExecPhases(Unity.TotalPhaseTime);
+    UnityPrint(", fixture overhead ");
+    UnityPrintNumberUnsigned(permille / 10);
+    UNITY_OUTPUT_CHAR('.');
+    UnityPrintNumberUnsigned(permille % 10);
+    UNITY_OUTPUT_CHAR('%');
+    UNITY_PRINT_EOL();
+
+    if (UnitySlowestTestsKept > 0)
+    {
+        UnityPrint("Slowest tests");
+        UNITY_PRINT_EOL();
+    }
+    for (i = 0; i < UnitySlowestTestsKept; i++)
+    {
+        UnityPrint("  ");
+        UnityPrint(UnitySlowestTests[i].file);
+        UnityPrint(" line ");
+        UnityPrintNumberUnsigned((UNITY_UINT)UnitySlowestTests[i].line);
+        if (UnitySlowestTests[i].name[0] != 0)
+        {
+            UNITY_OUTPUT_CHAR(' ');
+            UnityPrint(UnitySlowestTests[i].name);
+        }
+        UNITY_OUTPUT_CHAR(' ');
+        UnityPrintTime(UnitySlowestTests[i].total);
+        UnityPrintExecPhases(UnitySlowestTests[i].phase);
+        UNITY_PRINT_EOL();
+    }
+}
+#endif /* UNITY_EXEC_TIME_BUILTIN */
+
+/*-----------------------------------------------
+ * Performance Counters
+ *-----------------------------------------------*/
+#if defined(UNITY_INCLUDE_PERF_COUNTERS) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <string.h>
+
+typedef struct
+{
+    const char* name;
+    __u32 type;
+    __u64 config;
+} UnityPerfCounterDef;
+
+/* Each perf type forms its own group, led by its first entry. Hardware counters are frequently
+ * unavailable (virtual machines, containers, perf_event_paranoid), in which case only the
+ * software group is reported. */
+static const UnityPerfCounterDef UnityPerfCounterDefs[] = {
+    { "instructions",     PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS     },
+    { "cycles",           PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES       },
+    { "cache-misses",     PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES     },
+    { "branch-misses",    PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES    },
+    { "task-clock",       PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK       },
+    { "page-faults",      PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS      },
+    { "context-switches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES },
+};
+#define UNITY_PERF_COUNTER_COUNT (sizeof(UnityPerfCounterDefs) / sizeof(UnityPerfCounterDefs[0]))
+
+static int UnityPerfCounterFds[UNITY_PERF_COUNTER_COUNT];
+static __u64 UnityPerfCounterValues[UNITY_PERF_COUNTER_COUNT];
+static int UnityPerfCountersOpened = 0;
+
+/*-----------------------------------------------*/
+static void UnityPerfCountersOpen(void)
+{
+    struct perf_event_attr attr;
+    int leader = -1;
+    __u32 leader_type = (__u32)-1;
+    unsigned int i;
+
+    for (i = 0; i < UNITY_PERF_COUNTER_COUNT; i++)
+    {
+        if (UnityPerfCounterDefs[i].type != leader_type)
+        {
+            leader_type = UnityPerfCounterDefs[i].type;
+            leader = -1;
+        }
+        else if (leader < 0)
+        {
+            /* The group leader could not be opened, so neither can its members */
+            UnityPerfCounterFds[i] = -1;
+            continue;
+        }
+
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = UnityPerfCounterDefs[i].type;
+        attr.config = UnityPerfCounterDefs[i].config;
+        if (leader < 0)
+        {
+            attr.disabled = 1; /* members follow their leader when it is enabled */
+        }
+        if (attr.type == PERF_TYPE_HARDWARE)
+        {
+            /* Software events such as context switches only ever happen in the kernel */
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+        }
+        UnityPerfCounterFds[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+        if (leader < 0)
+        {
+            leader = UnityPerfCounterFds[i];
+        }
+    }
+    UnityPerfCountersOpened = 1;
+}
+
+/*-----------------------------------------------*/
+static void UnityPerfCountersClose(void)
+{
+    unsigned int i;
+
+    if (!UnityPerfCountersOpened)
+    {
+        return;
+    }
+    for (i = 0; i < UNITY_PERF_COUNTER_COUNT; i++)
+    {
+        if (UnityPerfCounterFds[i] >= 0)
+        {
+            (void)close(UnityPerfCounterFds[i]);
+        }
+    }
+    UnityPerfCountersOpened = 0;
+}
+
+/*-----------------------------------------------*/
+static void UnityPerfCountersControl(unsigned long request)
+{
+    unsigned int i;
+    __u32 leader_type = (__u32)-1;
+
+    for (i = 0; i < UNITY_PERF_COUNTER_COUNT; i++)
+    {
+        if (UnityPerfCounterDefs[i].type == leader_type)
+        {
+            continue;
+        }
+        leader_type = UnityPerfCounterDefs[i].type;
+        if (UnityPerfCounterFds[i] >= 0)
+        {
+            (void)ioctl(UnityPerfCounterFds[i], request, PERF_IOC_FLAG_GROUP);
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityPerfCountersStart(void)
+{
+    if (!UnityPerfCountersOpened)
+    {
+        UnityPerfCountersOpen();
+    }
+    memset(UnityPerfCounterValues, 0, sizeof(UnityPerfCounterValues));
+    UnityPerfCountersControl(PERF_EVENT_IOC_RESET);
+    UnityPerfCountersControl(PERF_EVENT_IOC_ENABLE);
+}
+
+/*-----------------------------------------------*/
+void UnityPerfCountersStop(void)
+{
+    unsigned int i;
+
+    UnityPerfCountersControl(PERF_EVENT_IOC_DISABLE);
+    for (i = 0; i < UNITY_PERF_COUNTER_COUNT; i++)
+    {
+        if ((UnityPerfCounterFds[i] < 0) ||
+            (read(UnityPerfCounterFds[i], &UnityPerfCounterValues[i], sizeof(__u64)) != (ssize_t)sizeof(__u64)))
+        {
+            UnityPerfCounterValues[i] = 0;
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityPrintPerfCounters(void)
+{
+    unsigned int i;
+    int printed = 0;
+
+    if (!UnityPerfCountersOpened)
+    {
+        return;
+    }
+    for (i = 0; i < UNITY_PERF_COUNTER_COUNT; i++)
+    {
+        if (UnityPerfCounterFds[i] < 0)
+        {
+            continue;
+        }
+        UnityPrint(printed ? " " : " [");
+        UnityPrint(UnityPerfCounterDefs[i].name);
+        UNITY_OUTPUT_CHAR('=');
+        UnityPrintNumberUnsigned((UNITY_UINT)UnityPerfCounterValues[i]);
+        printed = 1;
+    }
+    UnityPrint(printed ? "]" : " [perf counters unavailable]");
+}
+#endif /* UNITY_INCLUDE_PERF_COUNTERS */
+
+/*-----------------------------------------------
+ * Test Output Capture
+ *-----------------------------------------------*/
+#ifdef UNITY_CAPTURING_TEST_OUTPUT
+/*-----------------------------------------------*/
+static void UnityCaptureOpen(void)
+{
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+    UnityCaptureFd = memfd_create("unity_test_output", MFD_CLOEXEC);
+#endif
+    if (UnityCaptureFd < 0)
+    {
+        FILE* const file = tmpfile();
+        UnityCaptureFd = (file != NULL) ? dup(fileno(file)) : -1;
+        if (file != NULL)
+        {
+            (void)fclose(file);
+        }
+    }
+    if (UnityCaptureFd >= 0)
+    {
+        UnityCaptureSavedFds[0] = dup(1);
+        UnityCaptureSavedFds[1] = dup(2);
+    }
+}
+
+/*-----------------------------------------------*/
+static void UnityCaptureClose(void)
+{
+    if (UnityCaptureFd >= 0)
+    {
+        (void)close(UnityCaptureFd);
+        (void)close(UnityCaptureSavedFds[0]);
+        (void)close(UnityCaptureSavedFds[1]);
+        UnityCaptureFd = -1;
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityCaptureOutputStart(void)
+{
+    UnityCapturedLength = 0;
+    UnityCapturedDropped = 0;
+    if (UnityCaptureFd < 0)
+    {
+        UnityCaptureOpen();
+    }
+    if ((UnityCaptureFd < 0) || (UnityCaptureSavedFds[0] < 0) || (UnityCaptureSavedFds[1] < 0) ||
+        (ftruncate(UnityCaptureFd, 0) != 0) || (lseek(UnityCaptureFd, 0, SEEK_SET) != 0))
+    {
+        /* Without somewhere to put it, the output goes where it always did */
+        return;
+    }
+    UnityCaptureRedirect(1);
+    UnityCaptureActive = 1;
+}
+
+/*-----------------------------------------------*/
+void UnityCaptureOutputStop(void)
+{
+    off_t start;
+    ssize_t got;
+
+    if (!UnityCaptureActive)
+    {
+        return;
+    }
+    UnityCaptureRedirect(0);
+    UnityCaptureActive = 0;
+    UnityCaptureSendHeld();
+
+    /* A test that passed keeps its output to itself. A failing one shows the end of it. */
+    if (!Unity.CurrentTestFailed)
+    {
+        return;
+    }
+    start = lseek(UnityCaptureFd, 0, SEEK_END);
+    start = (start > (off_t)UNITY_CAPTURE_TEST_OUTPUT_SIZE) ? (start - (off_t)UNITY_CAPTURE_TEST_OUTPUT_SIZE) : 0;
+    if (lseek(UnityCaptureFd, start, SEEK_SET) != start)
+    {
+        return;
+    }
+    UnityCapturedDropped = (UNITY_UINT)start;
+    while (UnityCapturedLength < UNITY_CAPTURE_TEST_OUTPUT_SIZE)
+    {
+        got = read(UnityCaptureFd, &UnityCapturedOutput[UnityCapturedLength],
+                   (size_t)(UNITY_CAPTURE_TEST_OUTPUT_SIZE - UnityCapturedLength));
+        if (got <= 0)
+        {
+            break;
+        }
+        UnityCapturedLength += (UNITY_UINT)got;
+    }
+    UnityCapturedOutput[UnityCapturedLength] = 0;
+
+    /* Start on a whole line when the beginning had to go */
+    if (UnityCapturedDropped > 0)
+    {
+        UNITY_UINT skip = 0;
+        UNITY_UINT i;
+        while ((skip < UnityCapturedLength) && (UnityCapturedOutput[skip++] != '\n')) {}
+        if (skip < UnityCapturedLength)
+        {
+            for (i = skip; i <= UnityCapturedLength; i++)
+            {
+                UnityCapturedOutput[i - skip] = UnityCapturedOutput[i];
+            }
+            UnityCapturedLength -= skip;
+            UnityCapturedDropped += skip;
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityPrintCapturedOutput(void)
+{
+    UNITY_UINT i;
+    int line_start = 1;
+
+    if (UnityCapturedLength == 0)
+    {
+        return;
+    }
+    if (UnityCapturedDropped > 0)
+    {
+        UnityPrint("  | (");
+        UnityPrintNumberUnsigned(UnityCapturedDropped);
+        UnityPrint(" bytes of output before this were dropped)");
+        UNITY_PRINT_EOL();
+    }
+    for (i = 0; i < UnityCapturedLength; i++)
+    {
+        if (line_start)
+        {
+            UnityPrint("  | ");
+            line_start = 0;
+        }
+        if (UnityCapturedOutput[i] == '\n')
+        {
+            UNITY_PRINT_EOL();
+            line_start = 1;
+        }
+        else
+        {
+            UnityPrintChar(&UnityCapturedOutput[i]);
+        }
+    }
+    if (!line_start)
+    {
+        UNITY_PRINT_EOL();
+    }
+    UNITY_FLUSH_CALL();
+}
+#endif /* UNITY_CAPTURING_TEST_OUTPUT */
+
+/*-----------------------------------------------*/
+/* If we have not defined our own test runner, then include our default test runner to make life easier */
+#ifndef UNITY_SKIP_DEFAULT_RUNNER
+void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum)
+{
+    Unity.CurrentTestName = FuncName;
+    Unity.CurrentTestLineNumber = (UNITY_LINE_TYPE)FuncLineNum;
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    #ifndef UNITY_EXCLUDE_DETAILS
+    #ifdef UNITY_DETAIL_STACK_SIZE
+    Unity.CurrentDetailStackSize = 0;
+    #else
+    UNITY_CLR_DETAILS();
+    #endif
+    #endif
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        Func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+    }
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+#endif
+
+/*-----------------------------------------------
+ * Fuzz Tests
+ *-----------------------------------------------*/
+#ifdef UNITY_INCLUDE_FUZZ
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const char* UnityFuzzCorpus = UNITY_FUZZ_CORPUS;
+int UnityFuzzJobs = UNITY_FUZZ_JOBS;
+
+static UnityFuzzFunction UnityFuzzTest;
+static const unsigned char* UnityFuzzInput;
+static size_t UnityFuzzInputSize;
+static char UnityFuzzMessage[UNITY_FUZZ_PATH_SIZE + 40];
+
+/*-----------------------------------------------*/
+static void UnityFuzzCase(void)
+{
+    UnityFuzzTest(UnityFuzzInput, UnityFuzzInputSize);
+}
+
+/*-----------------------------------------------*/
+static void UnityFuzzFailCase(void)
+{
+    UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, UnityFuzzMessage);
+}
+
+/*-----------------------------------------------*/
+static void UnityFuzzIgnoreCase(void)
+{
+    UNITY_TEST_IGNORE(Unity.CurrentTestLineNumber, UnityFuzzMessage);
+}
+
+/*-----------------------------------------------*/
+static size_t UnityFuzzAppend(char* buffer, size_t size, size_t length, const char* text)
+{
+    while ((*text != 0) && (length < (size - 1)))
+    {
+        buffer[length++] = *text++;
+    }
+    buffer[length] = 0;
+    return length;
+}
+
+/*-----------------------------------------------*/
+#ifndef UNITY_SKIP_DEFAULT_RUNNER
+static void UnityFuzzDefaultRun(UnityTestFunction Func, const char* FuncName, UNITY_LINE_TYPE FuncLineNum)
+{
+    UnityDefaultTestRun(Func, FuncName, (int)FuncLineNum);
+}
+#endif
+
+/*-----------------------------------------------*/
+void UnityFuzzOneInput(UnityFuzzFunction Func, const char* FuncName, UNITY_LINE_TYPE FuncLineNum, const unsigned char* data, size_t size)
+{
+    Unity.CurrentTestName = FuncName;
+    Unity.CurrentTestLineNumber = FuncLineNum;
+    Unity.CurrentTestFailed = 0;
+    Unity.CurrentTestIgnored = 0;
+    UNITY_CLR_DETAILS();
+    UnityFuzzTest = Func;
+    UnityFuzzInput = data;
+    UnityFuzzInputSize = size;
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UnityFuzzCase();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+    }
+    if (Unity.CurrentTestFailed)
+    {
+        /* The failure has been printed already. Aborting is how a fuzzer learns that this
+         * input found something, and makes it keep the input. */
+        UNITY_PRINT_EOL();
+        UNITY_OUTPUT_FLUSH();
+        (void)fflush(stdout);
+        abort();
+    }
+    Unity.CurrentTestIgnored = 0;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <dirent.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define UNITY_FUZZ_MAX_JOBS 64
+
+/* What a replaying job tells the runner about each of its inputs */
+#define UNITY_FUZZ_STARTED 0u
+#define UNITY_FUZZ_PASSED  1u
+#define UNITY_FUZZ_FAILED  2u
+#define UNITY_FUZZ_IGNORED 3u
+#define UNITY_FUZZ_ASSERT  4u
+
+/* Each record is followed by its strings: a message, the failure text and the test's output */
+#define UNITY_FUZZ_STRINGS   3
+#define UNITY_FUZZ_NO_STRING 0xFFFFFFFFu
+
+typedef struct
+{
+    UNITY_UINT32 index;
+    UNITY_UINT32 state;
+    UNITY_UINT32 length[UNITY_FUZZ_STRINGS];
+    UNITY_LINE_TYPE line;
+    UNITY_INT expected;
+    UNITY_INT actual;
+    UNITY_DISPLAY_STYLE_T style;
+    UNITY_UINT32 element;
+    UNITY_UINT8 flags;
+    UNITY_TIME_TYPE duration;
+#ifdef UNITY_EXEC_TIME_BUILTIN
+    UNITY_TIME_TYPE phase[UNITY_EXEC_PHASE_COUNT];
+#endif
+} UNITY_FUZZ_RECORD_T;
+
+static char** UnityFuzzInputs;
+static size_t UnityFuzzInputCount;
+static char UnityFuzzDir[UNITY_FUZZ_PATH_SIZE];
+static char UnityFuzzName[UNITY_FUZZ_PATH_SIZE];
+static char UnityFuzzRelayMessage[UNITY_FUZZ_PATH_SIZE];
+static char UnityFuzzRelayText[UNITY_FUZZ_PATH_SIZE];
+static int UnityFuzzJobReport = -1;
+static UNITY_UINT32 UnityFuzzJobIndex;
+static UNITY_TEST_RESULT_T UnityFuzzJobResult;
+
+/*-----------------------------------------------*/
+static int UnityFuzzCompareNames(const void* a, const void* b)
+{
+    return strcmp(*(const char* const*)a, *(const char* const*)b);
+}
+
+/*-----------------------------------------------*/
+/* Lists the inputs in the corpus directory by name, so they are always replayed and
+ * reported in the same order */
+static void UnityFuzzListInputs(void)
+{
+    DIR* dir = opendir(UnityFuzzDir);
+    struct dirent* entry;
+    size_t room = 0;
+
+    UnityFuzzInputs = NULL;
+    UnityFuzzInputCount = 0;
+    if (dir == NULL)
+    {
+        return;
+    }
+    while ((entry = readdir(dir)) != NULL)
+    {
+        const size_t length = strlen(entry->d_name);
+        char* name;
+
+        if (entry->d_name[0] == '.')
+        {
+            continue; /* the directory itself, its parent and hidden files */
+        }
+        if (UnityFuzzInputCount == room)
+        {
+            const size_t more = (room == 0) ? 16 : (room * 2);
+            char** inputs = (char**)realloc(UnityFuzzInputs, more * sizeof(char*));
+            if (inputs == NULL)
+            {
+                break;
+            }
+            UnityFuzzInputs = inputs;
+            room = more;
+        }
+        name = (char*)malloc(length + 1);
+        if (name == NULL)
+        {
+            break;
+        }
+        memcpy(name, entry->d_name, length + 1);
+        UnityFuzzInputs[UnityFuzzInputCount++] = name;
+    }
+    (void)closedir(dir);
+    if (UnityFuzzInputCount > 1)
+    {
+        qsort(UnityFuzzInputs, UnityFuzzInputCount, sizeof(char*), UnityFuzzCompareNames);
+    }
+}
+
+/*-----------------------------------------------*/
+static void UnityFuzzFreeInputs(void)
+{
+    size_t i;
+
+    for (i = 0; i < UnityFuzzInputCount; i++)
+    {
+        free(UnityFuzzInputs[i]);
+    }
+    free(UnityFuzzInputs);
+    UnityFuzzInputs = NULL;
+    UnityFuzzInputCount = 0;
+}
+
+/*-----------------------------------------------*/
+static unsigned char* UnityFuzzReadInput(const char* path, size_t* size)
+{
+    FILE* file = fopen(path, "rb");
+    unsigned char* data = NULL;
+    size_t length = 0;
+    size_t room = 0;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    for (;;)
+    {
+        size_t got;
+
+        if (length == room)
+        {
+            const size_t more = (room == 0) ? 4096 : (room * 2);
+            unsigned char* grown = (unsigned char*)realloc(data, more);
+            if (grown == NULL)
+            {
+                free(data);
+                (void)fclose(file);
+                return NULL;
+            }
+            data = grown;
+            room = more;
+        }
+        got = fread(&data[length], 1, room - length, file);
+        length += got;
+        if (got == 0)
+        {
+            break;
+        }
+    }
+    if (ferror(file))
+    {
+        free(data);
+        data = NULL;
+    }
+    (void)fclose(file);
+    *size = length;
+    return data;
+}
+
+/*-----------------------------------------------*/
+static void UnityFuzzNameInput(const char* FuncName, size_t index)
+{
+    size_t length = UnityFuzzAppend(UnityFuzzName, sizeof(UnityFuzzName), 0, FuncName);
+    length = UnityFuzzAppend(UnityFuzzName, sizeof(UnityFuzzName), length, "[");
+    length = UnityFuzzAppend(UnityFuzzName, sizeof(UnityFuzzName), length, UnityFuzzInputs[index]);
+    (void)UnityFuzzAppend(UnityFuzzName, sizeof(UnityFuzzName), length, "]");
+}
+
+/*-----------------------------------------------*/
+static void UnityFuzzRunInput(const char* FuncName, size_t index, UNITY_LINE_TYPE FuncLineNum, UnityTestRunFunction Run)
+{
+    char path[UNITY_FUZZ_PATH_SIZE];
+    size_t length = UnityFuzzAppend(path, sizeof(path), 0, UnityFuzzDir);
+    unsigned char* data = NULL;
+    size_t size = 0;
+
+    length = UnityFuzzAppend(path, sizeof(path), length, "/");
+    length = UnityFuzzAppend(path, sizeof(path), length, UnityFuzzInputs[index]);
+    UnityFuzzNameInput(FuncName, index);
+    if (length < (sizeof(path) - 1))
+    {
+        data = UnityFuzzReadInput(path, &size);
+    }
+    if (data == NULL)
+    {
+        length = UnityFuzzAppend(UnityFuzzMessage, sizeof(UnityFuzzMessage), 0, "Cannot read ");
+        (void)UnityFuzzAppend(UnityFuzzMessage, sizeof(UnityFuzzMessage), length, path);
+        Run(UnityFuzzFailCase, UnityFuzzName, FuncLineNum);
+        return;
+    }
+    UnityFuzzInput = data;
+    UnityFuzzInputSize = size;
+    Run(UnityFuzzCase, UnityFuzzName, FuncLineNum);
+    free(data);
+}
+
+/*-----------------------------------------------*/
+static void UnityFuzzSendRecord(int report, UNITY_FUZZ_RECORD_T* record, const char* const* strings)
+{
+    size_t room[UNITY_FUZZ_STRINGS];
+    int i;
+
+    room[0] = sizeof(UnityFuzzRelayMessage) - 1;
+    room[1] = sizeof(UnityFuzzRelayText) - 1;
+#ifdef UNITY_CAPTURING_TEST_OUTPUT
+    room[2] = UNITY_CAPTURE_TEST_OUTPUT_SIZE;
+#else
+    room[2] = 0;
+#endif
+    for (i = 0; i < UNITY_FUZZ_STRINGS; i++)
+    {
+        size_t length = 0;
+
+        if ((strings == NULL) || (strings[i] == NULL))
+        {
+            record->length[i] = UNITY_FUZZ_NO_STRING;
+            continue;
+        }
+        while ((length < room[i]) && (strings[i][length] != 0))
+        {
+            length++;
+        }
+        record->length[i] = (UNITY_UINT32)length;
+    }
+    if (write(report, record, sizeof(*record)) != (ssize_t)sizeof(*record))
+    {
+        _exit(1);
+    }
+    for (i = 0; i < UNITY_FUZZ_STRINGS; i++)
+    {
+        if ((record->length[i] != UNITY_FUZZ_NO_STRING) &&
+            (write(report, strings[i], record->length[i]) != (ssize_t)record->length[i]))
+        {
+            _exit(1);
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+static void UnityFuzzSendState(int report, size_t index, UNITY_UINT32 state)
+{
+    UNITY_FUZZ_RECORD_T record;
+
+    memset(&record, 0, sizeof(record));
+    record.index = (UNITY_UINT32)index;
+    record.state = state;
+    if (state != UNITY_FUZZ_STARTED)
+    {
+        const char* strings[UNITY_FUZZ_STRINGS];
+
+        strings[0] = UnityFuzzJobResult.Message;
+        strings[1] = NULL;
+        strings[2] = UnityFuzzJobResult.Output;
+        record.duration = UnityFuzzJobResult.Duration;
+#ifdef UNITY_EXEC_TIME_BUILTIN
+        memcpy(record.phase, Unity.CurrentTestPhaseTime, sizeof(record.phase));
+#endif
+        UnityFuzzSendRecord(report, &record, strings);
+        return;
+    }
+    UnityFuzzSendRecord(report, &record, NULL);
+}
+
+/*-----------------------------------------------*/
+/* The reporter of a job, which passes failures on to the runner as they happen and keeps
+ * how each input ended for UnityFuzzRunJob to send */
+static void UnityFuzzJobAssertFail(const UNITY_FAILURE_T* failure)
+{
+    UNITY_FUZZ_RECORD_T record;
+    const char* strings[UNITY_FUZZ_STRINGS];
+
+    memset(&record, 0, sizeof(record));
+    record.index = UnityFuzzJobIndex;
+    record.state = UNITY_FUZZ_ASSERT;
+    record.line = failure->Line;
+    record.expected = failure->Expected;
+    record.actual = failure->Actual;
+    record.style = failure->Style;
+    record.element = failure->Index;
+    record.flags = failure->Flags;
+    strings[0] = failure->Message;
+    strings[1] = failure->Text;
+    strings[2] = NULL;
+    UnityFuzzSendRecord(UnityFuzzJobReport, &record, strings);
+}
+
+static void UnityFuzzJobTestEnd(const UNITY_TEST_RESULT_T* result)
+{
+    UnityFuzzJobResult = *result;
+}
+
+static const struct UNITY_REPORTER_T UnityReporterFuzzJob =
+{
+    NULL, NULL, NULL, UnityFuzzJobAssertFail, UnityFuzzJobTestEnd, NULL
+};
+
+/*-----------------------------------------------*/
+/* Runs in a forked job with its output going to a file of its own. It tells the runner
+ * when each input starts and how it ended, so an input that crashes the job is known.
+ * Only the default reporter is kept, as the runner passes the rest what the job sends. */
+static void UnityFuzzRunJob(const char* FuncName, UNITY_LINE_TYPE FuncLineNum, UnityTestRunFunction Run,
+                            size_t first, size_t jobs, int report)
+{
+    UNITY_COUNTER_TYPE kept = 0;
+    UNITY_COUNTER_TYPE r;
+    size_t i;
+
+    for (r = 0; r < UnityReporterCount; r++)
+    {
+        if (UnityReporters[r] == &UNITY_DEFAULT_REPORTER)
+        {
+            UnityReporters[kept++] = UnityReporters[r];
+        }
+    }
+    UnityReporterCount = kept;
+    (void)UnityAddReporter(&UnityReporterFuzzJob);
+    UnityFuzzJobReport = report;
+
+    for (i = first; i < UnityFuzzInputCount; i += jobs)
+    {
+        const UNITY_COUNTER_TYPE failures = Unity.TestFailures;
+        const UNITY_COUNTER_TYPE ignores = Unity.TestIgnores;
+
+        UnityFuzzSendState(report, i, UNITY_FUZZ_STARTED);
+        UnityFuzzJobIndex = (UNITY_UINT32)i;
+        memset(&UnityFuzzJobResult, 0, sizeof(UnityFuzzJobResult));
+        UnityFuzzRunInput(FuncName, i, FuncLineNum, Run);
+        UNITY_OUTPUT_FLUSH();
+        (void)fflush(stdout);
+        if (Unity.TestFailures != failures)
+        {
+            UnityFuzzSendState(report, i, UNITY_FUZZ_FAILED);
+        }
+        else if (Unity.TestIgnores != ignores)
+        {
+            UnityFuzzSendState(report, i, UNITY_FUZZ_IGNORED);
+        }
+        else
+        {
+            UnityFuzzSendState(report, i, UNITY_FUZZ_PASSED);
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+/* Reads all of a record, or tells that the job has gone */
+static int UnityFuzzReceive(int report, void* buffer, size_t size)
+{
+    char* at = (char*)buffer;
+
+    while (size > 0)
+    {
+        const ssize_t got = read(report, at, size);
+        if (got <= 0)
+        {
+            return 0;
+        }
+        at += got;
+        size -= (size_t)got;
+    }
+    return 1;
+}
+
+/*-----------------------------------------------*/
+static int UnityFuzzReceiveString(int report, UNITY_UINT32 length, char* buffer, size_t size, const char** string)
+{
+    *string = NULL;
+    if (length == UNITY_FUZZ_NO_STRING)
+    {
+        return 1;
+    }
+    if ((size == 0) || (length >= size) || !UnityFuzzReceive(report, buffer, length))
+    {
+        return 0;
+    }
+    buffer[length] = 0;
+    *string = buffer;
+    return 1;
+}
+
+/*-----------------------------------------------*/
+static int UnityFuzzReceiveRecord(int report, UNITY_FUZZ_RECORD_T* record, const char** strings)
+{
+    if (!UnityFuzzReceive(report, record, sizeof(*record)))
+    {
+        return 0;
+    }
+    if (!UnityFuzzReceiveString(report, record->length[0], UnityFuzzRelayMessage, sizeof(UnityFuzzRelayMessage), &strings[0]) ||
+        !UnityFuzzReceiveString(report, record->length[1], UnityFuzzRelayText, sizeof(UnityFuzzRelayText), &strings[1]))
+    {
+        return 0;
+    }
+#ifdef UNITY_CAPTURING_TEST_OUTPUT
+    return UnityFuzzReceiveString(report, record->length[2], UnityCapturedOutput, sizeof(UnityCapturedOutput), &strings[2]);
+#else
+    return UnityFuzzReceiveString(report, record->length[2], NULL, 0, &strings[2]);
+#endif
+}
+
+/* Passes what a job sent on to the reporters it dropped: all but the default one, whose
+ * output the job printed itself */
+#define UNITY_FUZZ_RELAY(event, args) do {                                      \
+        UNITY_COUNTER_TYPE r_;                                                  \
+        for (r_ = 0; r_ < UnityReporterCount; r_++) {                           \
+            if ((UnityReporters[r_] != &UNITY_DEFAULT_REPORTER) &&              \
+                (UnityReporters[r_]->event != NULL)) {                          \
+                UnityReporters[r_]->event args; } }                             \
+    } while (0)
+
+/*-----------------------------------------------*/
+static void UnityFuzzRelay(const UNITY_FUZZ_RECORD_T* record, const char* const* strings, int* begun)
+{
+    if (!*begun)
+    {
+        UNITY_FUZZ_RELAY(TestBegin, (Unity.TestFile, Unity.CurrentTestName, Unity.CurrentTestLineNumber));
+        *begun = 1;
+    }
+    if (record->state == UNITY_FUZZ_ASSERT)
+    {
+        UNITY_FAILURE_T failure;
+
+        failure.File = Unity.TestFile;
+        failure.TestName = Unity.CurrentTestName;
+        failure.Message = strings[0];
+        failure.Text = strings[1];
+        failure.Line = record->line;
+        failure.Expected = record->expected;
+        failure.Actual = record->actual;
+        failure.Style = record->style;
+        failure.Index = record->element;
+        failure.Flags = record->flags;
+        UNITY_FUZZ_RELAY(AssertFail, (&failure));
+    }
+    else
+    {
+        UNITY_TEST_RESULT_T result;
+
+        result.File = Unity.TestFile;
+        result.TestName = Unity.CurrentTestName;
+        result.Message = strings[0];
+        result.Output = strings[2];
+        result.Line = Unity.CurrentTestLineNumber;
+        result.Result = (record->state == UNITY_FUZZ_FAILED) ? UNITY_RESULT_FAIL :
+                        (record->state == UNITY_FUZZ_IGNORED) ? UNITY_RESULT_IGNORE : UNITY_RESULT_PASS;
+        result.Duration = record->duration;
+        UNITY_FUZZ_RELAY(TestEnd, (&result));
+    }
+}
+
+/*-----------------------------------------------*/
+#ifdef UNITY_EXEC_TIME_BUILTIN
+/* Counts the time a job took for an input, as if it had been replayed here */
+static void UnityFuzzAddExecTime(const UNITY_FUZZ_RECORD_T* record)
+{
+    UNITY_COUNTER_TYPE phase;
+
+    Unity.CurrentTestStartTime = 0;
+    Unity.CurrentTestStopTime = 0;
+    for (phase = 0; phase < UNITY_EXEC_PHASE_COUNT; phase++)
+    {
+        Unity.CurrentTestPhaseTime[phase] = record->phase[phase];
+        Unity.TotalPhaseTime[phase] += record->phase[phase];
+        Unity.CurrentTestStopTime += record->phase[phase];
+    }
+    Unity.CurrentTestIgnored = (record->state == UNITY_FUZZ_IGNORED) ? 1u : 0u;
+    UnityExecTimeKeepIfSlow();
+    Unity.CurrentTestIgnored = 0;
+}
+#endif
+
+/*-----------------------------------------------*/
+/* Passes on what a job sent and printed. Returns the next input it would have replayed if
+ * it crashed, or the number of inputs when it got through all of its own. */
+static size_t UnityFuzzCollectJob(const char* FuncName, UNITY_LINE_TYPE FuncLineNum, UnityTestRunFunction Run,
+                                  size_t jobs, FILE* output, int report, pid_t pid)
+{
+    UNITY_FUZZ_RECORD_T record;
+    const char* strings[UNITY_FUZZ_STRINGS];
+    int running = 0;
+    int begun = 0;
+    size_t last = 0;
+    int status = 0;
+    int c;
+
+    while (UnityFuzzReceiveRecord(report, &record, strings))
+    {
+        if ((size_t)record.index >= UnityFuzzInputCount)
+        {
+            break;
+        }
+        if (record.state == UNITY_FUZZ_STARTED)
+        {
+            running = 1;
+            begun = 0;
+            last = (size_t)record.index;
+            continue;
+        }
+        UnityFuzzNameInput(FuncName, (size_t)record.index);
+        Unity.CurrentTestName = UnityFuzzName;
+        Unity.CurrentTestLineNumber = FuncLineNum;
+        UnityFuzzRelay(&record, strings, &begun);
+        if (record.state == UNITY_FUZZ_ASSERT)
+        {
+            continue;
+        }
+        running = 0;
+        Unity.NumberOfTests++;
+        if (record.state == UNITY_FUZZ_FAILED)
+        {
+            Unity.TestFailures++;
+        }
+        else if (record.state == UNITY_FUZZ_IGNORED)
+        {
+            Unity.TestIgnores++;
+        }
+#ifdef UNITY_EXEC_TIME_BUILTIN
+        UnityFuzzAddExecTime(&record);
+#endif
+    }
+
+    (void)close(report);
+    (void)waitpid(pid, &status, 0);
+
+    rewind(output);
+    while ((c = fgetc(output)) != EOF)
+    {
+        UNITY_OUTPUT_CHAR(c);
+    }
+    if (running)
+    {
+        (void)UnityFuzzAppend(UnityFuzzMessage, sizeof(UnityFuzzMessage), 0, "Crashed while replaying this input");
+        UnityFuzzNameInput(FuncName, last);
+        Run(UnityFuzzFailCase, UnityFuzzName, FuncLineNum);
+        return last + jobs;
+    }
+    return UnityFuzzInputCount;
+}
+
+/*-----------------------------------------------*/
+/* Forks a job that replays every jobs'th input from first on. Returns its pid, or -1 when
+ * it couldn't be started. */
+static pid_t UnityFuzzStartJob(const char* FuncName, UNITY_LINE_TYPE FuncLineNum, UnityTestRunFunction Run,
+                               size_t first, size_t jobs, FILE** output, int* report)
+{
+    int ends[2];
+    pid_t pid;
+
+    /* Nothing may be left buffered for the job to print again */
+    UNITY_OUTPUT_FLUSH();
+    (void)fflush(stdout);
+    *output = tmpfile();
+    if ((*output == NULL) || (pipe(ends) != 0))
+    {
+        return -1;
+    }
+    pid = fork();
+    if (pid == 0)
+    {
+        (void)close(ends[0]);
+        (void)dup2(fileno(*output), 1);
+        UnityFuzzRunJob(FuncName, FuncLineNum, Run, first, jobs, ends[1]);
+        _exit(0);
+    }
+    (void)close(ends[1]);
+    if (pid < 0)
+    {
+        (void)close(ends[0]);
+        return -1;
+    }
+    *report = ends[0];
+    return pid;
+}
+
+/*-----------------------------------------------*/
+/* Each job replays every jobs'th input in a forked process. What they print is passed on
+ * job by job once they are all done, so lines of different inputs never interleave. When a
+ * job crashes, another one goes on from its next input, so every input gets its result. */
+static void UnityFuzzReplayInJobs(const char* FuncName, UNITY_LINE_TYPE FuncLineNum, UnityTestRunFunction Run, size_t jobs)
+{
+    FILE* outputs[UNITY_FUZZ_MAX_JOBS];
+    int reports[UNITY_FUZZ_MAX_JOBS];
+    pid_t pids[UNITY_FUZZ_MAX_JOBS];
+    size_t job;
+
+    for (job = 0; job < jobs; job++)
+    {
+        pids[job] = UnityFuzzStartJob(FuncName, FuncLineNum, Run, job, jobs, &outputs[job], &reports[job]);
+    }
+
+    for (job = 0; job < jobs; job++)
+    {
+        size_t next = job;
+
+        while (next < UnityFuzzInputCount)
+        {
+            if (pids[job] < 0)
+            {
+                /* This job couldn't be started, so its inputs are replayed here */
+                for (; next < UnityFuzzInputCount; next += jobs)
+                {
+                    UnityFuzzRunInput(FuncName, next, FuncLineNum, Run);
+                }
+            }
+            else
+            {
+                next = UnityFuzzCollectJob(FuncName, FuncLineNum, Run, jobs, outputs[job], reports[job], pids[job]);
+            }
+            if (outputs[job] != NULL)
+            {
+                (void)fclose(outputs[job]);
+            }
+            if (next < UnityFuzzInputCount)
+            {
+                pids[job] = UnityFuzzStartJob(FuncName, FuncLineNum, Run, next, jobs, &outputs[job], &reports[job]);
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityFuzzReplay(UnityFuzzFunction Func, const char* FuncName, UNITY_LINE_TYPE FuncLineNum, UnityTestRunFunction Run)
+{
+    size_t jobs = (UnityFuzzJobs > 1) ? (size_t)UnityFuzzJobs : 1;
+    size_t length;
+    size_t i;
+
+#ifndef UNITY_SKIP_DEFAULT_RUNNER
+    if (Run == NULL)
+    {
+        Run = UnityFuzzDefaultRun;
+    }
+#endif
+    UnityFuzzTest = Func;
+    length = UnityFuzzAppend(UnityFuzzDir, sizeof(UnityFuzzDir), 0, UnityFuzzCorpus);
+    length = UnityFuzzAppend(UnityFuzzDir, sizeof(UnityFuzzDir), length, "/");
+    (void)UnityFuzzAppend(UnityFuzzDir, sizeof(UnityFuzzDir), length, FuncName);
+    UnityFuzzListInputs();
+
+    if (UnityFuzzInputCount == 0)
+    {
+        length = UnityFuzzAppend(UnityFuzzMessage, sizeof(UnityFuzzMessage), 0, "No inputs in ");
+        (void)UnityFuzzAppend(UnityFuzzMessage, sizeof(UnityFuzzMessage), length, UnityFuzzDir);
+        Run(UnityFuzzIgnoreCase, FuncName, FuncLineNum);
+        return;
+    }
+    if (jobs > UnityFuzzInputCount)
+    {
+        jobs = UnityFuzzInputCount;
+    }
+    if (jobs > UNITY_FUZZ_MAX_JOBS)
+    {
+        jobs = UNITY_FUZZ_MAX_JOBS;
+    }
+    if (jobs > 1)
+    {
+        UnityFuzzReplayInJobs(FuncName, FuncLineNum, Run, jobs);
+    }
+    else
+    {
+        for (i = 0; i < UnityFuzzInputCount; i++)
+        {
+            UnityFuzzRunInput(FuncName, i, FuncLineNum, Run);
+        }
+    }
+    UnityFuzzFreeInputs();
+}
+
+#else
+/*-----------------------------------------------*/
+void UnityFuzzReplay(UnityFuzzFunction Func, const char* FuncName, UNITY_LINE_TYPE FuncLineNum, UnityTestRunFunction Run)
+{
+#ifndef UNITY_SKIP_DEFAULT_RUNNER
+    if (Run == NULL)
+    {
+        Run = UnityFuzzDefaultRun;
+    }
+#endif
+    UnityFuzzTest = Func;
+    (void)UnityFuzzAppend(UnityFuzzMessage, sizeof(UnityFuzzMessage), 0, "Replaying a corpus needs a POSIX host");
+    Run(UnityFuzzIgnoreCase, FuncName, FuncLineNum);
+}
+#endif
+#endif /* UNITY_INCLUDE_FUZZ */
+
+/*-----------------------------------------------*/
+void UnitySetTestFile(const char* filename)
+{
+    Unity.TestFile = filename;
+}
+
+/*-----------------------------------------------*/
+void UnityBegin(const char* filename)
+{
+    Unity.TestFile = filename;
+    Unity.CurrentTestName = NULL;
+    Unity.CurrentTestLineNumber = 0;
+    Unity.NumberOfTests = 0;
+    Unity.TestFailures = 0;
+    Unity.TestIgnores = 0;
+    Unity.CurrentTestFailed = 0;
+    Unity.CurrentTestIgnored = 0;
+
+    UNITY_CLR_DETAILS();
+#ifdef UNITY_EXEC_TIME_BUILTIN
+    UnityExecTimeReset();
+#endif
+    UNITY_OUTPUT_START();
+#ifdef UNITY_OUTPUT_BINARY
+    UnityBinaryBegin();
+#endif
+    UNITY_REPORT(SuiteBegin, (filename));
+}
+
+/*-----------------------------------------------*/
+int UnityEnd(void)
+{
+    UnityDotsPending = 0;
+    UnityLineOpen = 0;
+    UNITY_PRINT_EOL();
+#ifdef UNITY_EXEC_TIME_BUILTIN
+    UnityPrintExecTimeReport();
+#endif
+    UnityPrint(UnityStrBreaker);
+    UNITY_PRINT_EOL();
+    UnityPrintNumber((UNITY_INT)(Unity.NumberOfTests));
+    UnityPrint(UnityStrResultsTests);
+    UnityPrintNumber((UNITY_INT)(Unity.TestFailures));
+    UnityPrint(UnityStrResultsFailures);
+    UnityPrintNumber((UNITY_INT)(Unity.TestIgnores));
+    UnityPrint(UnityStrResultsIgnored);
+    UNITY_PRINT_EOL();
+    if (Unity.TestFailures == 0U)
+    {
+        UnityPrint(UnityStrOk);
+    }
+    else
+    {
+        UnityPrint(UnityStrFail);
+#ifdef UNITY_DIFFERENTIATE_FINAL_FAIL
+        UNITY_OUTPUT_CHAR('E'); UNITY_OUTPUT_CHAR('D');
+#endif
+    }
+    UNITY_PRINT_EOL();
+    UNITY_REPORT(SuiteEnd, (Unity.NumberOfTests, Unity.TestFailures, Unity.TestIgnores));
+#ifdef UNITY_OUTPUT_BINARY
+    UnityBinaryFlushText();
+#endif
+    UNITY_FLUSH_CALL();
+#if defined(UNITY_INCLUDE_PERF_COUNTERS) && defined(__linux__)
+    UnityPerfCountersClose();
+#endif
+#ifdef UNITY_CAPTURING_TEST_OUTPUT
+    UnityCaptureClose();
+#endif
+    UNITY_OUTPUT_COMPLETE();
+    return (int)(Unity.TestFailures);
+}
+
+/*-----------------------------------------------
+ * Details Stack
+ *-----------------------------------------------*/
+#ifndef UNITY_EXCLUDE_DETAILS
+#ifdef UNITY_DETAIL_STACK_SIZE
+void UnityPushDetail(UNITY_DETAIL_LABEL_TYPE label, UNITY_DETAIL_VALUE_TYPE value, const UNITY_LINE_TYPE line) {
+    if (Unity.CurrentDetailStackSize >= UNITY_DETAIL_STACK_SIZE) {
+        UnityTestResultsFailBegin(line);
+        UnityPrint(UnityStrErrDetailStackFull);
+        UnityAddMsgIfSpecified(NULL);
+        UNITY_FAIL_AND_BAIL;
+    }
+    if (label >= UnityStrDetailLabelsCount) {
+        UnityTestResultsFailBegin(line);
+        UnityPrint(UnityStrErrDetailStackLabel);
+        UnityPrintNumberUnsigned(label);
+        UnityAddMsgIfSpecified(NULL);
+        UNITY_FAIL_AND_BAIL;
+    }
+    Unity.CurrentDetailStackLabels[Unity.CurrentDetailStackSize] = label;
+    Unity.CurrentDetailStackValues[Unity.CurrentDetailStackSize++] = value;
+}
+void UnityPopDetail(UNITY_DETAIL_LABEL_TYPE label, UNITY_DETAIL_VALUE_TYPE value, const UNITY_LINE_TYPE line) {
+    if (Unity.CurrentDetailStackSize == 0) {
+        UnityTestResultsFailBegin(line);
+        UnityPrint(UnityStrErrDetailStackEmpty);
+        UnityAddMsgIfSpecified(NULL);
+        UNITY_FAIL_AND_BAIL;
+    }
+    if ((Unity.CurrentDetailStackLabels[Unity.CurrentDetailStackSize-1] != label) || (Unity.CurrentDetailStackValues[Unity.CurrentDetailStackSize-1] != value)) {
+        UnityTestResultsFailBegin(line);
+        UnityPrint(UnityStrErrDetailStackPop);
+        UnityAddMsgIfSpecified(NULL);
+        UNITY_FAIL_AND_BAIL;
+    }   
+    Unity.CurrentDetailStackSize--;
+}
+#endif
+#endif
+
+/*-----------------------------------------------
+ * File Reporters
+ *-----------------------------------------------*/
+#ifdef UNITY_INCLUDE_FILE_REPORTERS
+
+/* Room kept in each <testsuite> tag for the counts, which are only known at the end */
+#define UNITY_JUNIT_COUNTS_WIDTH 80
+
+static FILE* UnityJUnitFile = NULL;
+static const char* UnityJUnitPath = NULL;
+static long UnityJUnitCountsAt = -1;
+static long UnityJUnitEndAt = -1;
+static UNITY_FAILURE_T UnityJUnitFailure;
+static int UnityJUnitFailed;
+static FILE* UnityJsonFile = NULL;
+static const char* UnityJsonPath = NULL;
+
+/*-----------------------------------------------*/
+static void UnityFilePutNumber(FILE* file, const UNITY_UINT number)
+{
+    UNITY_UINT divisor = 1;
+
+    while (number / divisor > 9)
+    {
+        divisor *= 10;
+    }
+    do
+    {
+        (void)fputc((int)('0' + (number / divisor % 10)), file);
+        divisor /= 10;
+    } while (divisor > 0);
+}
+
+/*-----------------------------------------------*/
+static void UnityFilePutValue(FILE* file, const UNITY_INT value, const UNITY_DISPLAY_STYLE_T style)
+{
+    if ((style & UNITY_DISPLAY_RANGE_INT) && (value < 0))
+    {
+        (void)fputc('-', file);
+        UnityFilePutNumber(file, (UNITY_UINT)0 - (UNITY_UINT)value);
+    }
+    else
+    {
+        UnityFilePutNumber(file, (UNITY_UINT)value);
+    }
+}
+
+/*-----------------------------------------------*/
+static void UnityFilePutHexByte(FILE* file, const unsigned char c)
+{
+    static const char digits[] = "0123456789ABCDEF";
+
+    (void)fputc(digits[c >> 4], file);
+    (void)fputc(digits[c & 0xF], file);
+}
+
+/*-----------------------------------------------*/
+/* Seconds, to the last unit kept */
+static void UnityFilePutSeconds(FILE* file, const UNITY_TIME_TYPE time)
+{
+    const UNITY_UINT fraction = (UNITY_UINT)(time % (UNITY_TIME_UNITS_PER_MS * 1000u));
+    UNITY_UINT divisor = UNITY_TIME_UNITS_PER_MS * 100u;
+
+    UnityFilePutNumber(file, (UNITY_UINT)(time / (UNITY_TIME_UNITS_PER_MS * 1000u)));
+    (void)fputc('.', file);
+    while (divisor > 0)
+    {
+        (void)fputc((int)('0' + (fraction / divisor % 10)), file);
+        divisor /= 10;
+    }
+}
+
+/*-----------------------------------------------*/
+static void UnityFilePutXml(FILE* file, const char* string)
+{
+    const char* pch = string;
+
+    while ((pch != NULL) && (*pch != 0))
+    {
+        const unsigned char c = (unsigned char)*pch++;
+        switch (c)
+        {
+            case '&':  (void)fputs("&amp;", file);  break;
+            case '<':  (void)fputs("&lt;", file);   break;
+            case '>':  (void)fputs("&gt;", file);   break;
+            case '"':  (void)fputs("&quot;", file); break;
+            case '\'': (void)fputs("&apos;", file); break;
+            case '\n': (void)fputs("&#10;", file);  break;
+            case '\r': (void)fputs("&#13;", file);  break;
+            case '\t': (void)fputs("&#9;", file);   break;
+            default:
+                if (c < 0x20)
+                {
+                    /* not allowed in XML 1.0 at all, so spell it out the way Unity prints it */
+                    (void)fputs("\\x", file);
+                    UnityFilePutHexByte(file, c);
+                }
+                else
+                {
+                    (void)fputc(c, file);
+                }
+                break;
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+static void UnityFilePutJson(FILE* file, const char* string)
+{
+    const char* pch = string;
+
+    if (string == NULL)
+    {
+        (void)fputs("null", file);
+        return;
+    }
+    (void)fputc('"', file);
+    while (*pch != 0)
+    {
+        const unsigned char c = (unsigned char)*pch++;
+        switch (c)
+        {
+            case '"':  (void)fputs("\\\"", file); break;
+            case '\\': (void)fputs("\\\\", file); break;
+            case '\n': (void)fputs("\\n", file);  break;
+            case '\r': (void)fputs("\\r", file);  break;
+            case '\t': (void)fputs("\\t", file);  break;
+            default:
+                if (c < 0x20)
+                {
+                    (void)fputs("\\u00", file);
+                    UnityFilePutHexByte(file, c);
+                }
+                else
+                {
+                    (void)fputc(c, file);
+                }
+                break;
+        }
+    }
+    (void)fputc('"', file);
+}
+
+/*-----------------------------------------------*/
+static void UnityJUnitSuiteBegin(const char* file)
+{
+    int i;
+
+    if (UnityJUnitEndAt >= 0)
+    {
+        /* Another suite in the same run: it goes where the closing tag was */
+        UnityJUnitFile = fopen(UnityJUnitPath, "r+");
+        if (UnityJUnitFile == NULL)
+        {
+            return;
+        }
+        (void)fseek(UnityJUnitFile, UnityJUnitEndAt, SEEK_SET);
+    }
+    else
+    {
+        (void)fputs("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuites>\n", UnityJUnitFile);
+    }
+    (void)fputs("  <testsuite name=\"", UnityJUnitFile);
+    UnityFilePutXml(UnityJUnitFile, file);
+    (void)fputc('"', UnityJUnitFile);
+    UnityJUnitCountsAt = ftell(UnityJUnitFile);
+    if (UnityJUnitCountsAt >= 0)
+    {
+        for (i = 0; i < UNITY_JUNIT_COUNTS_WIDTH; i++)
+        {
+            (void)fputc(' ', UnityJUnitFile);
+        }
+    }
+    (void)fputs(">\n", UnityJUnitFile);
+}
+
+/*-----------------------------------------------*/
+static void UnityJUnitTestBegin(const char* file, const char* name, const UNITY_LINE_TYPE line)
+{
+    (void)file;
+    (void)name;
+    (void)line;
+    UnityJUnitFailed = 0;
+}
+
+/*-----------------------------------------------*/
+static void UnityJUnitAssertFail(const UNITY_FAILURE_T* failure)
+{
+    if (!UnityJUnitFailed)
+    {
+        UnityJUnitFailure = *failure;
+        UnityJUnitFailed = 1;
+    }
+}
+
+/*-----------------------------------------------*/
+static void UnityJUnitTestEnd(const UNITY_TEST_RESULT_T* result)
+{
+    FILE* const out = UnityJUnitFile;
+
+    if (out == NULL)
+    {
+        return;
+    }
+
+    (void)fputs("    <testcase classname=\"", out);
+    UnityFilePutXml(out, result->File);
+    (void)fputs("\" name=\"", out);
+    UnityFilePutXml(out, result->TestName);
+    (void)fputs("\" file=\"", out);
+    UnityFilePutXml(out, result->File);
+    (void)fputs("\" line=\"", out);
+    UnityFilePutNumber(out, (UNITY_UINT)result->Line);
+    (void)fputs("\" time=\"", out);
+    UnityFilePutSeconds(out, result->Duration);
+    if (result->Result == UNITY_RESULT_PASS)
+    {
+        (void)fputs("\"/>\n", out);
+        return;
+    }
+
+    (void)fputs("\">\n", out);
+    if (result->Result == UNITY_RESULT_IGNORE)
+    {
+        (void)fputs("      <skipped message=\"", out);
+        UnityFilePutXml(out, result->Message);
+        (void)fputs("\"/>\n", out);
+    }
+    else
+    {
+        (void)fputs("      <failure message=\"", out);
+        if (UnityJUnitFailed && (UnityJUnitFailure.Text != NULL))
+        {
+            UnityFilePutXml(out, UnityJUnitFailure.Text);
+        }
+        else
+        {
+            UnityFilePutXml(out, result->Message);
+        }
+        (void)fputs("\" type=\"ASSERT\">", out);
+        UnityFilePutXml(out, result->File);
+        (void)fputc(':', out);
+        UnityFilePutNumber(out, (UNITY_UINT)(UnityJUnitFailed ? UnityJUnitFailure.Line : result->Line));
+        (void)fputs("</failure>\n", out);
+    }
+    if (result->Output != NULL)
+    {
+        (void)fputs("      <system-out>", out);
+        UnityFilePutXml(out, result->Output);
+        (void)fputs("</system-out>\n", out);
+    }
+    (void)fputs("    </testcase>\n", out);
+}
+
+/*-----------------------------------------------*/
+static void UnityJUnitSuiteEnd(const UNITY_COUNTER_TYPE tests, const UNITY_COUNTER_TYPE failures, const UNITY_COUNTER_TYPE ignores)
+{
+    FILE* const out = UnityJUnitFile;
+
+    if (out == NULL)
+    {
+        return;
+    }
+
+    (void)fputs("  </testsuite>\n", out);
+    UnityJUnitEndAt = ftell(out);
+    (void)fputs("</testsuites>\n", out);
+
+    if (UnityJUnitCountsAt >= 0)
+    {
+        (void)fseek(out, UnityJUnitCountsAt, SEEK_SET);
+        (void)fputs(" tests=\"", out);
+        UnityFilePutNumber(out, (UNITY_UINT)tests);
+        (void)fputs("\" failures=\"", out);
+        UnityFilePutNumber(out, (UNITY_UINT)failures);
+        (void)fputs("\" skipped=\"", out);
+        UnityFilePutNumber(out, (UNITY_UINT)ignores);
+        (void)fputs("\" errors=\"0\"", out);
+    }
+    (void)fclose(out);
+    UnityJUnitFile = NULL;
+}
+
+static const struct UNITY_REPORTER_T UnityReporterJUnit =
+{
+    UnityJUnitSuiteBegin, UnityJUnitTestBegin, NULL, UnityJUnitAssertFail, UnityJUnitTestEnd, UnityJUnitSuiteEnd
+};
+
+/*-----------------------------------------------*/
+static void UnityJsonEvent(const char* event)
+{
+    (void)fputs("{\"event\":\"", UnityJsonFile);
+    (void)fputs(event, UnityJsonFile);
+    (void)fputc('"', UnityJsonFile);
+}
+
+/*-----------------------------------------------*/
+static void UnityJsonTest(const char* file, const char* name, const UNITY_LINE_TYPE line)
+{
+    (void)fputs(",\"file\":", UnityJsonFile);
+    UnityFilePutJson(UnityJsonFile, file);
+    (void)fputs(",\"test\":", UnityJsonFile);
+    UnityFilePutJson(UnityJsonFile, name);
+    (void)fputs(",\"line\":", UnityJsonFile);
+    UnityFilePutNumber(UnityJsonFile, (UNITY_UINT)line);
+}
+
+/*-----------------------------------------------*/
+static void UnityJsonSuiteBegin(const char* file)
+{
+    if (UnityJsonFile == NULL)
+    {
+        /* Another suite in the same run: its events follow the last one's */
+        UnityJsonFile = fopen(UnityJsonPath, "a");
+        if (UnityJsonFile == NULL)
+        {
+            return;
+        }
+    }
+    UnityJsonEvent("suite_begin");
+    (void)fputs(",\"file\":", UnityJsonFile);
+    UnityFilePutJson(UnityJsonFile, file);
+    (void)fputs("}\n", UnityJsonFile);
+}
+
+/*-----------------------------------------------*/
+static void UnityJsonTestBegin(const char* file, const char* name, const UNITY_LINE_TYPE line)
+{
+    if (UnityJsonFile == NULL)
+    {
+        return;
+    }
+    UnityJsonEvent("test_begin");
+    UnityJsonTest(file, name, line);
+    (void)fputs("}\n", UnityJsonFile);
+}
+
+/*-----------------------------------------------*/
+static void UnityJsonAssertFail(const UNITY_FAILURE_T* failure)
+{
+    FILE* const out = UnityJsonFile;
+
+    if (out == NULL)
+    {
+        return;
+    }
+
+    UnityJsonEvent("assert_fail");
+    UnityJsonTest(failure->File, failure->TestName, failure->Line);
+    (void)fputs(",\"message\":", out);
+    UnityFilePutJson(out, failure->Message);
+    (void)fputs(",\"text\":", out);
+    UnityFilePutJson(out, failure->Text);
+    if (failure->Flags & UNITY_FAILURE_HAS_VALUES)
+    {
+        (void)fputs(",\"expected\":", out);
+        UnityFilePutValue(out, failure->Expected, failure->Style);
+        (void)fputs(",\"actual\":", out);
+        UnityFilePutValue(out, failure->Actual, failure->Style);
+    }
+    if (failure->Flags & UNITY_FAILURE_HAS_INDEX)
+    {
+        (void)fputs(",\"index\":", out);
+        UnityFilePutNumber(out, (UNITY_UINT)failure->Index);
+    }
+    (void)fputs("}\n", out);
+}
+
+/*-----------------------------------------------*/
+static void UnityJsonTestEnd(const UNITY_TEST_RESULT_T* result)
+{
+    static const char* const statuses[] = { "PASS", "FAIL", "IGNORE" };
+    FILE* const out = UnityJsonFile;
+
+    if (out == NULL)
+    {
+        return;
+    }
+
+    UnityJsonEvent("test_end");
+    UnityJsonTest(result->File, result->TestName, result->Line);
+    (void)fputs(",\"status\":\"", out);
+    (void)fputs(statuses[result->Result], out);
+    (void)fputs("\",\"message\":", out);
+    UnityFilePutJson(out, result->Message);
+    (void)fputs(",\"output\":", out);
+    UnityFilePutJson(out, result->Output);
+    (void)fputs(",\"duration_ns\":", out);
+    UnityFilePutNumber(out, (UNITY_UINT)result->Duration);
+#if UNITY_TIME_UNITS_PER_MS == 1000u
+    if (result->Duration != 0)
+    {
+        (void)fputs("000", out); /* kept in microseconds */
+    }
+#endif
+    (void)fputs("}\n", out);
+}
+
+/*-----------------------------------------------*/
+static void UnityJsonSuiteEnd(const UNITY_COUNTER_TYPE tests, const UNITY_COUNTER_TYPE failures, const UNITY_COUNTER_TYPE ignores)
+{
+    FILE* const out = UnityJsonFile;
+
+    if (out == NULL)
+    {
+        return;
+    }
+
+    UnityJsonEvent("suite_end");
+    (void)fputs(",\"tests\":", out);
+    UnityFilePutNumber(out, (UNITY_UINT)tests);
+    (void)fputs(",\"failures\":", out);
+    UnityFilePutNumber(out, (UNITY_UINT)failures);
+    (void)fputs(",\"ignored\":", out);
+    UnityFilePutNumber(out, (UNITY_UINT)ignores);
+    (void)fputs("}\n", out);
+    (void)fclose(out);
+    UnityJsonFile = NULL;
+}
+
+static const struct UNITY_REPORTER_T UnityReporterJson =
+{
+    UnityJsonSuiteBegin, UnityJsonTestBegin, NULL, UnityJsonAssertFail, UnityJsonTestEnd, UnityJsonSuiteEnd
+};
+
+/*-----------------------------------------------*/
+static int UnityReportTo(FILE** file, const char** file_path, const char* path, const struct UNITY_REPORTER_T* reporter)
+{
+    if ((*file_path != NULL) || (path == NULL))
+    {
+        return 1;
+    }
+    *file = fopen(path, "w");
+    if (*file == NULL)
+    {
+        return 1;
+    }
+    if (UnityAddReporter(reporter) != 0)
+    {
+        (void)fclose(*file);
+        *file = NULL;
+        return 1;
+    }
+    /* The file is closed when each suite ends, and opened again if another one follows */
+    *file_path = path;
+    return 0;
+}
+
+/*-----------------------------------------------*/
+int UnityReportJUnitTo(const char* path)
+{
+    UnityJUnitCountsAt = -1;
+    UnityJUnitEndAt = -1;
+    return UnityReportTo(&UnityJUnitFile, &UnityJUnitPath, path, &UnityReporterJUnit);
+}
+
+/*-----------------------------------------------*/
+int UnityReportJsonTo(const char* path)
+{
+    return UnityReportTo(&UnityJsonFile, &UnityJsonPath, path, &UnityReporterJson);
+}
+
+#endif /* UNITY_INCLUDE_FILE_REPORTERS */
+
+/*-----------------------------------------------
+ * Command Line Argument Support
+ *-----------------------------------------------*/
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+
+char* UnityOptionIncludeNamed = NULL;
+char* UnityOptionExcludeNamed = NULL;
+int UnityStrictMatch          = 0;
+
+/*-----------------------------------------------*/
+static const char* UnityLongOptionValue(const char* arg, const char* option)
+{
+    while ((*option != 0) && (*arg == *option))
+    {
+        arg++;
+        option++;
+    }
+    if (*option != 0)
+    {
+        return NULL;
+    }
+    return arg;
+}
+
+/*-----------------------------------------------*/
+static int UnityParseSeedOption(int argc, char** argv, int* i)
+{
+    const char* seed = UnityLongOptionValue(argv[*i], "--seed");
+    UNITY_UINT value = 0;
+
+    if (*seed == '=')
+    {
+        seed++;
+    }
+    else if ((*seed == 0) && (++(*i) < argc))
+    {
+        seed = argv[*i];
+    }
+    if ((*seed < '0') || (*seed > '9'))
+    {
+        UnityPrint("ERROR: No Seed Number");
+        UNITY_PRINT_EOL();
+        return 1;
+    }
+    while ((*seed >= '0') && (*seed <= '9'))
+    {
+        value = (value * 10) + (UNITY_UINT)(*seed++ - '0');
+    }
+    UnitySeed = value;
+    return 0;
+}
+
+#ifdef UNITY_INCLUDE_FUZZ
+
+/*-----------------------------------------------*/
+static int UnityParseFuzzOption(int argc, char** argv, int* i)
+{
+    const char* corpus = UnityLongOptionValue(argv[*i], "--corpus");
+    const char* jobs = UnityLongOptionValue(argv[*i], "--jobs");
+    const char* value = (corpus != NULL) ? corpus : jobs;
+
+    if (*value == '=')
+    {
+        value++;
+    }
+    else if ((*value == 0) && (++(*i) < argc))
+    {
+        value = argv[*i];
+    }
+    else
+    {
+        value = "";
+    }
+    if (corpus != NULL)
+    {
+        if (*value == 0)
+        {
+            UnityPrint("ERROR: No Corpus Directory");
+            UNITY_PRINT_EOL();
+            return 1;
+        }
+        UnityFuzzCorpus = value;
+        return 0;
+    }
+    if ((*value < '0') || (*value > '9'))
+    {
+        UnityPrint("ERROR: No Number of Jobs");
+        UNITY_PRINT_EOL();
+        return 1;
+    }
+    UnityFuzzJobs = 0;
+    while ((*value >= '0') && (*value <= '9'))
+    {
+        UnityFuzzJobs = (UnityFuzzJobs * 10) + (*value++ - '0');
+    }
+    return 0;
+}
+#endif
+
+#ifdef UNITY_INCLUDE_FILE_REPORTERS
+
+/*-----------------------------------------------*/
+static int UnityParseReportOption(int argc, char** argv, int* i)
+{
+    const char* path = UnityLongOptionValue(argv[*i], "--report-junit");
+    int (*report)(const char*) = UnityReportJUnitTo;
+
+    if (path == NULL)
+    {
+        path = UnityLongOptionValue(argv[*i], "--report-json");
+        report = UnityReportJsonTo;
+    }
+    if ((path == NULL) || ((*path != 0) && (*path != '=')))
+    {
+        UnityPrint("ERROR: Unknown Option ");
+        UnityPrint(argv[*i]);
+        UNITY_PRINT_EOL();
+        return 1;
+    }
+    if (*path == '=')
+    {
+        path++;
+    }
+    else if (++(*i) < argc)
+    {
+        path = argv[*i];
+    }
+    else
+    {
+        UnityPrint("ERROR: No File to Report To");
+        UNITY_PRINT_EOL();
+        return 1;
+    }
+    if (report(path) != 0)
+    {
+        UnityPrint("ERROR: Cannot Report To ");
+        UnityPrint(path);
+        UNITY_PRINT_EOL();
+        return 1;
+    }
+    return 0;
+}
+#endif
 
 /*-----------------------------------------------*/
 int UnityParseOptions(int argc, char** argv)
 {
     int i;
+    const char* slowest;
     UnityOptionIncludeNamed = NULL;
     UnityOptionExcludeNamed = NULL;
     UnityStrictMatch = 0;
@@ -2646,11 +5332,42 @@ int UnityParseOptions(int argc, char** argv)
                         return 1;
                     }
                     break;
+                case 's': /* silent */
+                    UnityVerbosity = UNITY_VERBOSITY_SILENT;
+                    break;
                 case 'q': /* quiet */
-                    UnityVerbosity = 0;
+                    UnityVerbosity = UNITY_VERBOSITY_DOTS;
                     break;
                 case 'v': /* verbose */
-                    UnityVerbosity = 2;
+                    UnityVerbosity = UNITY_VERBOSITY_VERBOSE;
+                    break;
+                case 't': /* report this many of the slowest tests */
+                    if (argv[i][2] == '=')
+                    {
+                        slowest = &argv[i][3];
+                    }
+                    else if (++i < argc)
+                    {
+                        slowest = argv[i];
+                    }
+                    else
+                    {
+                        UnityPrint("ERROR: No Number of Slowest Tests to Report");
+                        UNITY_PRINT_EOL();
+                        return 1;
+                    }
+#ifdef UNITY_EXEC_TIME_BUILTIN
+                    {
+                        UNITY_COUNTER_TYPE count = 0;
+                        while ((*slowest >= '0') && (*slowest <= '9'))
+                        {
+                            count = (count * 10) + (UNITY_COUNTER_TYPE)(*slowest++ - '0');
+                        }
+                        UnitySetSlowestTestCount(count);
+                    }
+#else
+                    (void)slowest; /* only the built-in exec time keeps track of slow tests */
+#endif
                     break;
                 case 'x': /* exclude tests with name including this string */
                     if (argv[i][2] == '=')
@@ -2668,6 +5385,37 @@ int UnityParseOptions(int argc, char** argv)
                         return 1;
                     }
                     break;
+                case '-': /* --seed NUM, --corpus DIR, --jobs NUM, --report-junit PATH or --report-json PATH */
+                    if (UnityLongOptionValue(argv[i], "--seed") != NULL)
+                    {
+                        if (UnityParseSeedOption(argc, argv, &i) == 0)
+                        {
+                            break;
+                        }
+                        return 1;
+                    }
+#ifdef UNITY_INCLUDE_FUZZ
+                    if ((UnityLongOptionValue(argv[i], "--corpus") != NULL) ||
+                        (UnityLongOptionValue(argv[i], "--jobs") != NULL))
+                    {
+                        if (UnityParseFuzzOption(argc, argv, &i) == 0)
+                        {
+                            break;
+                        }
+                        return 1;
+                    }
+#endif
+#ifdef UNITY_INCLUDE_FILE_REPORTERS
+                    if (UnityParseReportOption(argc, argv, &i) == 0)
+                    {
+                        break;
+                    }
+#else
+                    UnityPrint("ERROR: Unknown Option ");
+                    UnityPrint(argv[i]);
+                    UNITY_PRINT_EOL();
+#endif
+                    return 1;
                 default:
                     UnityPrint("ERROR: Unknown Option ");
                     UNITY_OUTPUT_CHAR(argv[i][1]);
@@ -2680,9 +5428,20 @@ int UnityParseOptions(int argc, char** argv)
                     UnityPrint("-f NAME   Filter to run only tests whose name includes NAME"); UNITY_PRINT_EOL();
                     UnityPrint("-n NAME   Run only the test named NAME"); UNITY_PRINT_EOL();
                     UnityPrint("-h        show this Help menu"); UNITY_PRINT_EOL();
-                    UnityPrint("-q        Quiet/decrease verbosity"); UNITY_PRINT_EOL();
-                    UnityPrint("-v        increase Verbosity"); UNITY_PRINT_EOL();
+                    UnityPrint("-q        Quiet: a dot for each passing test"); UNITY_PRINT_EOL();
+                    UnityPrint("-s        Silent: only failures and ignores are printed"); UNITY_PRINT_EOL();
+                    UnityPrint("-t NUM    report the NUM slowest Tests when timing"); UNITY_PRINT_EOL();
+                    UnityPrint("-v        Verbose: phase times and details on PASS lines"); UNITY_PRINT_EOL();
                     UnityPrint("-x NAME   eXclude tests whose name includes NAME"); UNITY_PRINT_EOL();
+                    UnityPrint("--seed NUM  seed for tests that draw random inputs"); UNITY_PRINT_EOL();
+#ifdef UNITY_INCLUDE_FUZZ
+                    UnityPrint("--corpus DIR  replay fuzz test inputs from DIR/<test name>"); UNITY_PRINT_EOL();
+                    UnityPrint("--jobs NUM    replay fuzz test inputs in NUM processes"); UNITY_PRINT_EOL();
+#endif
+#ifdef UNITY_INCLUDE_FILE_REPORTERS
+                    UnityPrint("--report-junit PATH  write a JUnit XML report to PATH"); UNITY_PRINT_EOL();
+                    UnityPrint("--report-json PATH   write JSON lines events to PATH"); UNITY_PRINT_EOL();
+#endif
                     UNITY_OUTPUT_FLUSH();
                     return 1;
             }
@@ -346,6 +346,145 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
   #endif
 #endif
 
+/* Tokenized output is binary output that sends 32-bit tokens in place of strings */
+#if defined(UNITY_OUTPUT_TOKENIZED) && !defined(UNITY_OUTPUT_BINARY)
+  #define UNITY_OUTPUT_BINARY
+#endif
+
+/* Binary output and failure text capture need to see every character Unity writes, so
+ * UNITY_OUTPUT_CHAR is routed through UnityOutputChar, which passes it on to the output
+ * configured above. unity.c defines UNITY_OUTPUT_INTERCEPT_OWNER because it is the one
+ * that calls the real output. */
+#ifdef UNITY_OUTPUT_BINARY
+  #define UNITY_OUTPUT_INTERCEPT
+
+  /* Characters collected into one text record. A newline always ends the record. */
+  #ifndef UNITY_OUTPUT_BINARY_TEXT_SIZE
+  #define UNITY_OUTPUT_BINARY_TEXT_SIZE 64
+  #endif
+
+  /* File and test names remembered by the sender (and so by the decoder) at once */
+  #ifndef UNITY_OUTPUT_BINARY_STRINGS
+  #define UNITY_OUTPUT_BINARY_STRINGS 8
+  #endif
+#endif
+
+/* The file reporters put Unity's own description of each failure in their reports.
+ * Binary output doesn't send that text as characters, so there is nothing to keep. */
+#if defined(UNITY_INCLUDE_FILE_REPORTERS) && !defined(UNITY_FAILURE_TEXT_SIZE)
+  #define UNITY_FAILURE_TEXT_SIZE 256
+#endif
+#if defined(UNITY_FAILURE_TEXT_SIZE) && !defined(UNITY_OUTPUT_BINARY)
+  #define UNITY_CAPTURE_FAILURE_TEXT
+  #define UNITY_OUTPUT_INTERCEPT
+#endif
+
+/* Capturing what a test writes to stdout and stderr points those descriptors somewhere
+ * else while the test runs, so Unity's own output is held back until they are restored.
+ * The redirection is done with dup2, so it needs a POSIX host. */
+#if defined(UNITY_CAPTURE_TEST_OUTPUT) && (defined(__unix__) || defined(__APPLE__))
+  #define UNITY_CAPTURING_TEST_OUTPUT
+  #define UNITY_OUTPUT_INTERCEPT
+
+  /* The end of a failing test's output that is kept and printed with the failure */
+  #ifndef UNITY_CAPTURE_TEST_OUTPUT_SIZE
+  #define UNITY_CAPTURE_TEST_OUTPUT_SIZE 1024
+  #endif
+#endif
+
+#ifdef UNITY_OUTPUT_INTERCEPT
+  void UnityOutputChar(int c);
+  #ifndef UNITY_OUTPUT_INTERCEPT_OWNER
+    #undef UNITY_OUTPUT_CHAR
+    #define UNITY_OUTPUT_CHAR(a) UnityOutputChar(a)
+  #endif
+#endif
+
+/*-------------------------------------------------------
+ * Tokenized Strings
+ *-------------------------------------------------------*/
+
+/* Without tokenized output every string is used as it is, and none of the hashing below is
+ * seen by the compiler */
+#ifndef UNITY_OUTPUT_TOKENIZED
+#define UNITY_TOKENIZE(s) s
+typedef const char* UNITY_TOKENIZED_NAME_T;
+#define UNITY_TOKENIZED_NAME(s) s
+#else
+
+/* UNITY_TOKEN(s) hashes a string literal into a 32-bit token while compiling: the length
+ * plus each of the first 32 and the last 32 characters times successive powers of 65599,
+ * wrapping at 32 bits. Long __FILE__ paths differ at the end, so the end is hashed too.
+ * auto/extract_tokens.rb computes the same hash to build the database used to expand them,
+ * and fails if two of its strings end up with the same token. */
+#define UNITY_TOKEN_K      ((UNITY_UINT32)65599u)
+#define UNITY_TOKEN_K4     (UNITY_TOKEN_K * UNITY_TOKEN_K * UNITY_TOKEN_K * UNITY_TOKEN_K)
+#define UNITY_TOKEN_K16    (UNITY_TOKEN_K4 * UNITY_TOKEN_K4 * UNITY_TOKEN_K4 * UNITY_TOKEN_K4)
+#define UNITY_TOKEN_LEN(s) (sizeof("" s) - 1)
+#define UNITY_TOKEN_HEAD(s, i) \
+    ((UNITY_UINT32)(((i) < UNITY_TOKEN_LEN(s)) ? (unsigned char)("" s)[((i) < UNITY_TOKEN_LEN(s)) ? (i) : 0] : 0))
+#define UNITY_TOKEN_TAIL(s, i) \
+    ((UNITY_UINT32)(((i) < UNITY_TOKEN_LEN(s)) ? (unsigned char)("" s)[((i) < UNITY_TOKEN_LEN(s)) ? UNITY_TOKEN_LEN(s) - 1 - (i) : 0] : 0))
+#define UNITY_TOKEN_4(c, s, i, k) \
+    (c(s, (i)) * (k) + \
+     c(s, (i) + 1) * (k) * UNITY_TOKEN_K + \
+     c(s, (i) + 2) * (k) * UNITY_TOKEN_K * UNITY_TOKEN_K + \
+     c(s, (i) + 3) * (k) * UNITY_TOKEN_K * UNITY_TOKEN_K * UNITY_TOKEN_K)
+#define UNITY_TOKEN_16(c, s, i, k) \
+    (UNITY_TOKEN_4(c, s, (i), (k)) + \
+     UNITY_TOKEN_4(c, s, (i) + 4, (k) * UNITY_TOKEN_K4) + \
+     UNITY_TOKEN_4(c, s, (i) + 8, (k) * UNITY_TOKEN_K4 * UNITY_TOKEN_K4) + \
+     UNITY_TOKEN_4(c, s, (i) + 12, (k) * UNITY_TOKEN_K4 * UNITY_TOKEN_K4 * UNITY_TOKEN_K4))
+#define UNITY_TOKEN(s) \
+    ((UNITY_UINT32)UNITY_TOKEN_LEN(s) + \
+     UNITY_TOKEN_16(UNITY_TOKEN_HEAD, s, 0, UNITY_TOKEN_K) + \
+     UNITY_TOKEN_16(UNITY_TOKEN_HEAD, s, 16, UNITY_TOKEN_K * UNITY_TOKEN_K16) + \
+     UNITY_TOKEN_16(UNITY_TOKEN_TAIL, s, 0, UNITY_TOKEN_K * UNITY_TOKEN_K16 * UNITY_TOKEN_K16) + \
+     UNITY_TOKEN_16(UNITY_TOKEN_TAIL, s, 16, UNITY_TOKEN_K * UNITY_TOKEN_K16 * UNITY_TOKEN_K16 * UNITY_TOKEN_K16))
+
+/* In tokenized mode a string is replaced by a marker byte and its token, seven bits to a
+ * byte, low bits first, so it can still be handed around as a const char*. Seven bit bytes
+ * stay inside the range of a char however it is signed, which keeps -pedantic quiet about
+ * static initializers. Nothing of the text itself ends up in the image. UNITY_TOKENIZE is
+ * used on messages, test names and the test file name, which have to be string literals.
+ * Unity keeps some of those pointers after the call they were passed to, so each use gets
+ * bytes that live as long as the program: a template in C++11, a static in a statement
+ * expression with GCC and Clang, and otherwise only a C99 compound literal, which lasts
+ * until the end of the enclosing block. */
+#define UNITY_TOKEN_MARK 0x01
+#define UNITY_TOKEN_SIZE 6 /* the mark and five bytes of token */
+#define UNITY_TOKEN_BYTE(s, d) ((char)((UNITY_TOKEN(s) / (d)) % 128u))
+#define UNITY_TOKEN_BYTES(s) \
+    { UNITY_TOKEN_MARK, UNITY_TOKEN_BYTE(s, 1u), UNITY_TOKEN_BYTE(s, 128u), UNITY_TOKEN_BYTE(s, 16384u), \
+      UNITY_TOKEN_BYTE(s, 2097152u), UNITY_TOKEN_BYTE(s, 268435456u), 0 }
+
+#if defined(__cplusplus) && (__cplusplus >= 201103L)
+extern "C++"
+{
+template <UNITY_UINT32 token> struct UnityTokenBytes
+{
+    static const char bytes[UNITY_TOKEN_SIZE + 1];
+};
+template <UNITY_UINT32 token> const char UnityTokenBytes<token>::bytes[UNITY_TOKEN_SIZE + 1] =
+    { UNITY_TOKEN_MARK, (char)(token % 128u), (char)((token / 128u) % 128u), (char)((token / 16384u) % 128u),
+      (char)((token / 2097152u) % 128u), (char)((token / 268435456u) % 128u), 0 };
+}
+#define UNITY_TOKENIZE(s) (UnityTokenBytes<(UNITY_TOKEN(s))>::bytes)
+#elif defined(__GNUC__)
+#define UNITY_TOKENIZE(s) (__extension__ ({ static const char unity_token_[] = UNITY_TOKEN_BYTES(s); unity_token_; }))
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#define UNITY_TOKENIZE(s) ((const char[])UNITY_TOKEN_BYTES(s))
+#else
+#error "UNITY_OUTPUT_TOKENIZED needs C99 compound literals, C++11 or a GCC compatible compiler"
+#endif
+
+/* UNITY_TOKENIZE can't initialize a static table, so names kept in one (like the
+ * generated runner's parameterized cases) are declared as a UNITY_TOKENIZED_NAME_T and
+ * initialized with UNITY_TOKENIZED_NAME(s). The member is still used as a const char*. */
+typedef char UNITY_TOKENIZED_NAME_T[UNITY_TOKEN_SIZE + 1];
+#define UNITY_TOKENIZED_NAME(s) UNITY_TOKEN_BYTES(s)
+#endif /* UNITY_OUTPUT_TOKENIZED */
+
 #ifndef UNITY_OUTPUT_FLUSH
   #ifdef UNITY_USE_FLUSH_STDOUT
     /* We want to use the stdout flush utility */
@@ -397,46 +536,48 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
       !defined(UNITY_TIME_TYPE)
       /* If none any of these macros are defined then try to provide a default implementation */
 
-    #if defined(UNITY_CLOCK_MS)
-      /* This is a simple way to get a default implementation on platforms that support getting a millisecond counter */
-      #define UNITY_TIME_TYPE UNITY_UINT
-      #define UNITY_EXEC_TIME_START() Unity.CurrentTestStartTime = UNITY_CLOCK_MS()
-      #define UNITY_EXEC_TIME_STOP() Unity.CurrentTestStopTime = UNITY_CLOCK_MS()
-      #define UNITY_PRINT_EXEC_TIME() { \
-        UNITY_UINT execTimeMs = (Unity.CurrentTestStopTime - Unity.CurrentTestStartTime); \
-        UnityPrint(" ("); \
-        UnityPrintNumberUnsigned(execTimeMs); \
-        UnityPrint(" ms)"); \
-        }
-    #elif defined(_WIN32)
-      #include <time.h>
-      #define UNITY_TIME_TYPE clock_t
-      #define UNITY_GET_TIME(t) t = (clock_t)((clock() * 1000) / CLOCKS_PER_SEC)
-      #define UNITY_EXEC_TIME_START() UNITY_GET_TIME(Unity.CurrentTestStartTime)
-      #define UNITY_EXEC_TIME_STOP() UNITY_GET_TIME(Unity.CurrentTestStopTime)
-      #define UNITY_PRINT_EXEC_TIME() { \
-        UNITY_UINT execTimeMs = (Unity.CurrentTestStopTime - Unity.CurrentTestStartTime); \
-        UnityPrint(" ("); \
-        UnityPrintNumberUnsigned(execTimeMs); \
-        UnityPrint(" ms)"); \
-        }
-    #elif defined(__unix__) || defined(__APPLE__)
-      #include <time.h>
-      #define UNITY_TIME_TYPE struct timespec
-      #define UNITY_GET_TIME(t) clock_gettime(CLOCK_MONOTONIC, &t)
-      #define UNITY_EXEC_TIME_START() UNITY_GET_TIME(Unity.CurrentTestStartTime)
-      #define UNITY_EXEC_TIME_STOP() UNITY_GET_TIME(Unity.CurrentTestStopTime)
-      #define UNITY_PRINT_EXEC_TIME() do { \
-        UNITY_UINT execTimeMs = (UNITY_UINT)((Unity.CurrentTestStopTime.tv_sec - Unity.CurrentTestStartTime.tv_sec) * 1000L); \
-        execTimeMs += (UNITY_UINT)((Unity.CurrentTestStopTime.tv_nsec - Unity.CurrentTestStartTime.tv_nsec) / 1000000L); \
-        UnityPrint(" ("); \
-        UnityPrintNumberUnsigned(execTimeMs); \
-        UnityPrint(" ms)"); \
-        } while(0)
+    #if defined(UNITY_CLOCK_NS) || defined(UNITY_CLOCK_MS) || defined(_WIN32) || defined(__unix__) || defined(__APPLE__)
+      /* Unity reads the clock itself (see UnityClockNow) and keeps every phase of each test in
+       * nanoseconds, or in microseconds when there is no 64-bit type to hold them */
+      #define UNITY_EXEC_TIME_BUILTIN
+      #ifdef UNITY_SUPPORT_64
+        #define UNITY_TIME_TYPE UNITY_UINT64
+        #define UNITY_TIME_UNITS_PER_MS 1000000u
+      #else
+        #define UNITY_TIME_TYPE UNITY_UINT32
+        #define UNITY_TIME_UNITS_PER_MS 1000u
+      #endif
+      #define UNITY_EXEC_TIME_START() UnityExecTimeStart()
+      #define UNITY_EXEC_TIME_PHASE(phase) UnityExecTimePhase(phase)
+      #define UNITY_EXEC_TIME_STOP() UnityExecTimeStop()
+      #define UNITY_PRINT_EXEC_TIME() UnityPrintExecTime()
     #endif
   #endif
 #endif
 
+#ifdef UNITY_EXEC_TIME_BUILTIN
+typedef enum
+{
+    UNITY_EXEC_PHASE_SETUP = 0,
+    UNITY_EXEC_PHASE_BODY,
+    UNITY_EXEC_PHASE_TEARDOWN,
+    UNITY_EXEC_PHASE_COUNT
+} UNITY_EXEC_PHASE_T;
+
+#ifndef UNITY_EXEC_TIME_SLOWEST
+#define UNITY_EXEC_TIME_SLOWEST 5
+#endif
+
+#ifndef UNITY_EXEC_TIME_SLOWEST_MAX
+#define UNITY_EXEC_TIME_SLOWEST_MAX 32
+#endif
+
+/* Longest test name kept in the list of slowest tests */
+#ifndef UNITY_EXEC_TIME_NAME_SIZE
+#define UNITY_EXEC_TIME_NAME_SIZE 128
+#endif
+#endif
+
 #ifndef UNITY_EXEC_TIME_START
 #define UNITY_EXEC_TIME_START() do { /* nothing*/ } while (0)
 #endif
@@ -445,14 +586,62 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
 #define UNITY_EXEC_TIME_STOP()  do { /* nothing*/ } while (0)
 #endif
 
+#ifndef UNITY_EXEC_TIME_PHASE
+#define UNITY_EXEC_TIME_PHASE(phase) do { /* nothing*/ } while (0)
+#endif
+
 #ifndef UNITY_TIME_TYPE
 #define UNITY_TIME_TYPE         UNITY_UINT
 #endif
 
+/* Durations handed to the reporters are taken to be in nanoseconds unless Unity's own clock says otherwise */
+#ifndef UNITY_TIME_UNITS_PER_MS
+#define UNITY_TIME_UNITS_PER_MS 1000000u
+#endif
+
 #ifndef UNITY_PRINT_EXEC_TIME
 #define UNITY_PRINT_EXEC_TIME() do { /* nothing*/ } while (0)
 #endif
 
+#ifdef UNITY_INCLUDE_PERF_COUNTERS
+  #if defined(__linux__)
+    /* Per-test counters are gathered with perf_event_open, so they are only available on Linux */
+    #define UNITY_PERF_COUNTERS_START() UnityPerfCountersStart()
+    #define UNITY_PERF_COUNTERS_STOP()  UnityPerfCountersStop()
+    #define UNITY_PRINT_PERF_COUNTERS() UnityPrintPerfCounters()
+  #endif
+#endif
+
+#ifndef UNITY_PERF_COUNTERS_START
+#define UNITY_PERF_COUNTERS_START() do { /* nothing*/ } while (0)
+#endif
+
+#ifndef UNITY_PERF_COUNTERS_STOP
+#define UNITY_PERF_COUNTERS_STOP()  do { /* nothing*/ } while (0)
+#endif
+
+#ifndef UNITY_PRINT_PERF_COUNTERS
+#define UNITY_PRINT_PERF_COUNTERS() do { /* nothing*/ } while (0)
+#endif
+
+#ifdef UNITY_CAPTURING_TEST_OUTPUT
+  #define UNITY_CAPTURE_OUTPUT_START()  UnityCaptureOutputStart()
+  #define UNITY_CAPTURE_OUTPUT_STOP()   UnityCaptureOutputStop()
+  #define UNITY_PRINT_CAPTURED_OUTPUT() UnityPrintCapturedOutput()
+#endif
+
+#ifndef UNITY_CAPTURE_OUTPUT_START
+#define UNITY_CAPTURE_OUTPUT_START()  do { /* nothing*/ } while (0)
+#endif
+
+#ifndef UNITY_CAPTURE_OUTPUT_STOP
+#define UNITY_CAPTURE_OUTPUT_STOP()   do { /* nothing*/ } while (0)
+#endif
+
+#ifndef UNITY_PRINT_CAPTURED_OUTPUT
+#define UNITY_PRINT_CAPTURED_OUTPUT() do { /* nothing*/ } while (0)
+#endif
+
 #ifndef UNITY_FAILURE_DETAIL_SEPARATOR
 #define UNITY_FAILURE_DETAIL_SEPARATOR ":"
 #endif
@@ -580,11 +769,75 @@ struct UNITY_STORAGE_T
 #ifdef UNITY_INCLUDE_EXEC_TIME
     UNITY_TIME_TYPE CurrentTestStartTime;
     UNITY_TIME_TYPE CurrentTestStopTime;
+#ifdef UNITY_EXEC_TIME_BUILTIN
+    UNITY_TIME_TYPE CurrentPhaseStartTime;
+    UNITY_TIME_TYPE CurrentTestPhaseTime[UNITY_EXEC_PHASE_COUNT];
+    UNITY_TIME_TYPE TotalPhaseTime[UNITY_EXEC_PHASE_COUNT];
+    UNITY_COUNTER_TYPE CurrentTestPhase;
+#endif
 #endif
 #ifndef UNITY_EXCLUDE_SETJMP_H
     jmp_buf AbortFrame;
 #endif
 };
+
+/*-------------------------------------------------------
+ * Reporters
+ *-------------------------------------------------------*/
+
+typedef enum
+{
+    UNITY_RESULT_PASS = 0,
+    UNITY_RESULT_FAIL,
+    UNITY_RESULT_IGNORE
+} UNITY_RESULT_T;
+
+#define UNITY_FAILURE_HAS_VALUES (0x1)
+#define UNITY_FAILURE_HAS_INDEX  (0x2)
+
+/* What went wrong in a failed assertion. Expected, Actual and Style are only set
+ * for integer comparisons, Index only for arrays; Flags says which ones are. Text is
+ * what Unity printed after FAIL:, kept only when UNITY_FAILURE_TEXT_SIZE is set. */
+typedef struct UNITY_FAILURE_T
+{
+    const char* File;
+    const char* TestName;
+    const char* Message;
+    const char* Text;
+    UNITY_LINE_TYPE Line;
+    UNITY_INT Expected;
+    UNITY_INT Actual;
+    UNITY_DISPLAY_STYLE_T Style;
+    UNITY_UINT32 Index;
+    UNITY_UINT8 Flags;
+} UNITY_FAILURE_T;
+
+/* How a test ended. Duration is in the units of UNITY_TIME_TYPE (UNITY_TIME_UNITS_PER_MS
+ * to the millisecond with the built-in clock) and 0 unless UNITY_INCLUDE_EXEC_TIME is defined.
+ * Output is what a failing test wrote to stdout and stderr when
+ * UNITY_CAPTURE_TEST_OUTPUT is on, and NULL otherwise. */
+typedef struct UNITY_TEST_RESULT_T
+{
+    const char* File;
+    const char* TestName;
+    const char* Message;
+    const char* Output;
+    UNITY_LINE_TYPE Line;
+    UNITY_RESULT_T Result;
+    UNITY_TIME_TYPE Duration;
+} UNITY_TEST_RESULT_T;
+
+/* Any of these may be NULL. ResultsBegin starts a line of Unity's own output
+ * (like "file:line:test:"), so only the reporter printing that should set it. */
+struct UNITY_REPORTER_T
+{
+    void (*SuiteBegin)(const char* file);
+    void (*TestBegin)(const char* file, const char* name, const UNITY_LINE_TYPE line);
+    void (*ResultsBegin)(const char* file, const UNITY_LINE_TYPE line);
+    void (*AssertFail)(const UNITY_FAILURE_T* failure);
+    void (*TestEnd)(const UNITY_TEST_RESULT_T* result);
+    void (*SuiteEnd)(const UNITY_COUNTER_TYPE tests, const UNITY_COUNTER_TYPE failures, const UNITY_COUNTER_TYPE ignores);
+};
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
@@ -599,6 +852,25 @@ void UnityBegin(const char* filename);
 int  UnityEnd(void);
 void UnitySetTestFile(const char* filename);
 void UnityConcludeTest(void);
+void UnityReportTestBegin(void);
+void UnityReportTestEnd(void);
+
+/* How much UnityConcludeTest says about a passing test. The command line's -s, -q and -v
+ * pick one at run time, like the fixture's options of the same names. */
+#define UNITY_VERBOSITY_SILENT  0 /* nothing, only failures and ignores are printed */
+#define UNITY_VERBOSITY_DOTS    1 /* a '.' for each passing test */
+#define UNITY_VERBOSITY_NORMAL  2 /* a PASS line for each passing test */
+#define UNITY_VERBOSITY_VERBOSE 3 /* PASS lines with the time of each phase and the detail stack */
+
+#ifndef UNITY_DEFAULT_VERBOSITY
+#define UNITY_DEFAULT_VERBOSITY UNITY_VERBOSITY_NORMAL
+#endif
+
+extern int UnityVerbosity;
+
+/* The seed for tests that draw random inputs, such as the property extra. Zero until one
+ * is given with the command line's --seed, or picked by the first of them that needs it. */
+extern UNITY_UINT UnitySeed;
 
 #ifndef RUN_TEST
 void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum);
@@ -606,6 +878,87 @@ void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int
 #define UNITY_SKIP_DEFAULT_RUNNER
 #endif
 
+/* A fuzz test takes the bytes of one input. The generated runner replays each file in the
+ * test's corpus directory as a test of its own, and can instead be built with
+ * UNITY_FUZZ_ENTRY as a libFuzzer target, where a failing input aborts. */
+#define TEST_FUZZ(name, data, size)                            \
+    void name(const unsigned char* data, size_t size);         \
+    void name(const unsigned char* data, size_t size)
+
+#ifdef UNITY_INCLUDE_FUZZ
+  #ifndef UNITY_FUZZ_CORPUS
+    #define UNITY_FUZZ_CORPUS "corpus"
+  #endif
+  #ifndef UNITY_FUZZ_JOBS
+    #define UNITY_FUZZ_JOBS 1
+  #endif
+  /* Room for the path of a corpus input, and for the name it is reported under */
+  #ifndef UNITY_FUZZ_PATH_SIZE
+    #define UNITY_FUZZ_PATH_SIZE 256
+  #endif
+
+typedef void (*UnityFuzzFunction)(const unsigned char* data, size_t size);
+typedef void (*UnityTestRunFunction)(UnityTestFunction Func, const char* FuncName, UNITY_LINE_TYPE FuncLineNum);
+
+/* Where corpus inputs are read from, and how many processes replay them. The command
+ * line's --corpus and --jobs set these at run time. */
+extern const char* UnityFuzzCorpus;
+extern int UnityFuzzJobs;
+
+void UnityFuzzReplay(UnityFuzzFunction Func, const char* FuncName, UNITY_LINE_TYPE FuncLineNum, UnityTestRunFunction Run);
+void UnityFuzzOneInput(UnityFuzzFunction Func, const char* FuncName, UNITY_LINE_TYPE FuncLineNum, const unsigned char* data, size_t size);
+#endif
+
+#ifdef UNITY_EXEC_TIME_BUILTIN
+void UnityExecTimeStart(void);
+void UnityExecTimePhase(UNITY_EXEC_PHASE_T phase);
+void UnityExecTimeStop(void);
+void UnityPrintExecTime(void);
+void UnitySetSlowestTestCount(UNITY_COUNTER_TYPE count);
+#endif
+
+#if defined(UNITY_INCLUDE_PERF_COUNTERS) && defined(__linux__)
+void UnityPerfCountersStart(void);
+void UnityPerfCountersStop(void);
+void UnityPrintPerfCounters(void);
+#endif
+
+#ifdef UNITY_CAPTURING_TEST_OUTPUT
+void UnityCaptureOutputStart(void);
+void UnityCaptureOutputStop(void);
+void UnityPrintCapturedOutput(void);
+#endif
+
+#ifndef UNITY_MAX_REPORTERS
+#define UNITY_MAX_REPORTERS 4
+#endif
+
+int  UnityAddReporter(const struct UNITY_REPORTER_T* reporter);
+void UnityRemoveReporter(const struct UNITY_REPORTER_T* reporter);
+
+/* While quiet, failures still abort the test but Unity prints nothing and tells no
+ * reporter about them, for extras that run a test body many times before reporting */
+void UnitySetQuiet(const int quiet);
+
+/* A runner that leaves a line open while a test runs (a failure, the fixture's test name or
+ * progress dot) marks it with UnitySetLineOpen, and extras printing whole lines of their own
+ * during the test call UnityEndOpenLine first */
+void UnitySetLineOpen(const int open);
+void UnityEndOpenLine(void);
+
+extern const struct UNITY_REPORTER_T UnityReporterText;
+extern const struct UNITY_REPORTER_T UnityReporterEclipse;
+extern const struct UNITY_REPORTER_T UnityReporterIarWorkbench;
+extern const struct UNITY_REPORTER_T UnityReporterQtCreator;
+#ifdef UNITY_OUTPUT_BINARY
+extern const struct UNITY_REPORTER_T UnityReporterBinary;
+#endif
+
+#ifdef UNITY_INCLUDE_FILE_REPORTERS
+int UnityReportJUnitTo(const char* path);
+int UnityReportJsonTo(const char* path);
+#endif
+
 /*-------------------------------------------------------
  * Details Support
  *-------------------------------------------------------*/
@@ -945,7 +1298,7 @@ extern const char UnityStrErrDetailStack[];
 #ifndef RUN_TEST
 #ifdef UNITY_SUPPORT_VARIADIC_MACROS
 #define RUN_TEST(...) RUN_TEST_AT_LINE(__VA_ARGS__, __LINE__, throwaway)
-#define RUN_TEST_AT_LINE(func, line, ...) UnityDefaultTestRun(func, #func, line)
+#define RUN_TEST_AT_LINE(func, line, ...) UnityDefaultTestRun(func, UNITY_TOKENIZE(#func), line)
 #endif
 #endif
 
@@ -961,15 +1314,25 @@ extern const char UnityStrErrDetailStack[];
     #if !defined(TEST_MATRIX) && !defined(UNITY_EXCLUDE_TEST_MATRIX)
       #define TEST_MATRIX(...)
     #endif
+    #if !defined(TEST_MATRIX_PAIRWISE) && !defined(UNITY_EXCLUDE_TEST_MATRIX_PAIRWISE)
+      #define TEST_MATRIX_PAIRWISE(...)
+    #endif
+    #if !defined(TEST_VALUES_FROM) && !defined(UNITY_EXCLUDE_TEST_VALUES_FROM)
+      #define TEST_VALUES_FROM(...)
+    #endif
+  #endif
+  /* Room for the name of each case of a TEST_VALUES_FROM test, which is built while running */
+  #ifndef UNITY_VALUES_NAME_SIZE
+    #define UNITY_VALUES_NAME_SIZE 128
   #endif
 #endif
 
 /* If we can't do the tricky version, we'll just have to require them to always include the line number */
 #ifndef RUN_TEST
 #ifdef CMOCK
-#define RUN_TEST(func, num) UnityDefaultTestRun(func, #func, num)
+#define RUN_TEST(func, num) UnityDefaultTestRun(func, UNITY_TOKENIZE(#func), num)
 #else
-#define RUN_TEST(func) UnityDefaultTestRun(func, #func, __LINE__)
+#define RUN_TEST(func) UnityDefaultTestRun(func, UNITY_TOKENIZE(#func), __LINE__)
 #endif
 #endif
 
@@ -981,7 +1344,7 @@ extern const char UnityStrErrDetailStack[];
     Unity.NumberOfTests++;
 
 #ifndef UNITY_BEGIN
-#define UNITY_BEGIN() UnityBegin(__FILE__)
+#define UNITY_BEGIN() UnityBegin(UNITY_TOKENIZE(__FILE__))
 #endif
 
 #ifndef UNITY_END
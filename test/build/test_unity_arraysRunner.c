@@ -0,0 +1,554 @@
+#include "unity.h" /* Autogenerated by awk in Makefile */
+void testInt64ArrayWithinDelta(void);
+void testInt64ArrayWithinDeltaAndMessage(void);
+void testInt64ArrayNotWithinDelta(void);
+void testInt64ArrayNotWithinDeltaAndMessage(void);
+void testInt64ArrayWithinDeltaPointless(void);
+void testInt64ArrayWithinDeltaPointlessAndMessage(void);
+void testInt64ArrayWithinDeltaExpectedNull(void);
+void testInt64ArrayWithinDeltaExpectedNullAndMessage(void);
+void testInt64ArrayWithinDeltaActualNull(void);
+void testInt64ArrayWithinDeltaActualNullAndMessage(void);
+void testInt64ArrayWithinDeltaSamePointer(void);
+void testInt64ArrayWithinDeltaSamePointerAndMessage(void);
+void testIntArrayWithinDelta(void);
+void testIntArrayWithinDeltaAndMessage(void);
+void testIntArrayNotWithinDelta(void);
+void testIntArrayNotWithinDeltaAndMessage(void);
+void testIntArrayWithinDeltaPointless(void);
+void testIntArrayWithinDeltaPointlessAndMessage(void);
+void testIntArrayWithinDeltaExpectedNull(void);
+void testIntArrayWithinDeltaExpectedNullAndMessage(void);
+void testIntArrayWithinDeltaActualNull(void);
+void testIntArrayWithinDeltaActualNullAndMessage(void);
+void testIntArrayWithinDeltaSamePointer(void);
+void testIntArrayWithinDeltaSamePointerAndMessage(void);
+void testInt16ArrayWithinDelta(void);
+void testInt16ArrayWithinDeltaAndMessage(void);
+void testInt16ArrayNotWithinDelta(void);
+void testInt16ArrayNotWithinDeltaAndMessage(void);
+void testInt16ArrayWithinDeltaPointless(void);
+void testInt16ArrayWithinDeltaPointlessAndMessage(void);
+void testInt16ArrayWithinDeltaExpectedNull(void);
+void testInt16ArrayWithinDeltaExpectedNullAndMessage(void);
+void testInt16ArrayWithinDeltaActualNull(void);
+void testInt16ArrayWithinDeltaActualNullAndMessage(void);
+void testInt16ArrayWithinDeltaSamePointer(void);
+void testInt16ArrayWithinDeltaSamePointerAndMessage(void);
+void testInt8ArrayWithinDelta(void);
+void testInt8ArrayWithinDeltaAndMessage(void);
+void testInt8ArrayNotWithinDelta(void);
+void testInt8ArrayNotWithinDeltaAndMessage(void);
+void testInt8ArrayWithinDeltaPointless(void);
+void testInt8ArrayWithinDeltaPointlessAndMessage(void);
+void testInt8ArrayWithinDeltaExpectedNull(void);
+void testInt8ArrayWithinDeltaExpectedNullAndMessage(void);
+void testInt8ArrayWithinDeltaActualNull(void);
+void testInt8ArrayWithinDeltaActualNullAndMessage(void);
+void testInt8ArrayWithinDeltaSamePointer(void);
+void testInt8ArrayWithinDeltaSamePointerAndMessage(void);
+void testCHARArrayWithinDelta(void);
+void testCHARArrayWithinDeltaAndMessage(void);
+void testCHARArrayNotWithinDelta(void);
+void testCHARArrayNotWithinDeltaAndMessage(void);
+void testCHARArrayWithinDeltaPointless(void);
+void testCHARArrayWithinDeltaPointlessAndMessage(void);
+void testCHARArrayWithinDeltaExpectedNull(void);
+void testCHARArrayWithinDeltaExpectedNullAndMessage(void);
+void testCHARArrayWithinDeltaActualNull(void);
+void testCHARArrayWithinDeltaActualNullAndMessage(void);
+void testCHARArrayWithinDeltaSamePointer(void);
+void testCHARArrayWithinDeltaSamePointerAndMessage(void);
+void testUInt64ArrayWithinDelta(void);
+void testUInt64ArrayWithinDeltaAndMessage(void);
+void testUInt64ArrayNotWithinDelta(void);
+void testUInt64ArrayNotWithinDeltaAndMessage(void);
+void testUInt64ArrayWithinDeltaPointless(void);
+void testUInt64ArrayWithinDeltaPointlessAndMessage(void);
+void testUInt64ArrayWithinDeltaExpectedNull(void);
+void testUInt64ArrayWithinDeltaExpectedNullAndMessage(void);
+void testUInt64ArrayWithinDeltaActualNull(void);
+void testUInt64ArrayWithinDeltaActualNullAndMessage(void);
+void testUInt64ArrayWithinDeltaSamePointer(void);
+void testUInt64ArrayWithinDeltaSamePointerAndMessage(void);
+void testUIntArrayWithinDelta(void);
+void testUIntArrayWithinDeltaAndMessage(void);
+void testUIntArrayNotWithinDelta(void);
+void testUIntArrayNotWithinDeltaAndMessage(void);
+void testUIntArrayWithinDeltaPointless(void);
+void testUIntArrayWithinDeltaPointlessAndMessage(void);
+void testUIntArrayWithinDeltaExpectedNull(void);
+void testUIntArrayWithinDeltaExpectedNullAndMessage(void);
+void testUIntArrayWithinDeltaActualNull(void);
+void testUIntArrayWithinDeltaActualNullAndMessage(void);
+void testUIntArrayWithinDeltaSamePointer(void);
+void testUIntArrayWithinDeltaSamePointerAndMessage(void);
+void testUInt16ArrayWithinDelta(void);
+void testUInt16ArrayWithinDeltaAndMessage(void);
+void testUInt16ArrayNotWithinDelta(void);
+void testUInt16ArrayNotWithinDeltaAndMessage(void);
+void testUInt16ArrayWithinDeltaPointless(void);
+void testUInt16ArrayWithinDeltaPointlessAndMessage(void);
+void testUInt16ArrayWithinDeltaExpectedNull(void);
+void testUInt16ArrayWithinDeltaExpectedNullAndMessage(void);
+void testUInt16ArrayWithinDeltaActualNull(void);
+void testUInt16ArrayWithinDeltaActualNullAndMessage(void);
+void testUInt16ArrayWithinDeltaSamePointer(void);
+void testUInt16ArrayWithinDeltaSamePointerAndMessage(void);
+void testUInt8ArrayWithinDelta(void);
+void testUInt8ArrayWithinDeltaAndMessage(void);
+void testUInt8ArrayNotWithinDelta(void);
+void testUInt8ArrayNotWithinDeltaAndMessage(void);
+void testUInt8ArrayWithinDeltaPointless(void);
+void testUInt8ArrayWithinDeltaPointlessAndMessage(void);
+void testUInt8ArrayWithinDeltaExpectedNull(void);
+void testUInt8ArrayWithinDeltaExpectedNullAndMessage(void);
+void testUInt8ArrayWithinDeltaActualNull(void);
+void testUInt8ArrayWithinDeltaActualNullAndMessage(void);
+void testUInt8ArrayWithinDeltaSamePointer(void);
+void testUInt8ArrayWithinDeltaSamePointerAndMessage(void);
+void testHEX64ArrayWithinDelta(void);
+void testHEX64ArrayWithinDeltaShouldNotHaveSignIssues(void);
+void testHEX64ArrayWithinDeltaAndMessage(void);
+void testHEX64ArrayNotWithinDelta(void);
+void testHEX64ArrayNotWithinDeltaAndMessage(void);
+void testHEX64ArrayWithinDeltaPointless(void);
+void testHEX64ArrayWithinDeltaPointlessAndMessage(void);
+void testHEX64ArrayWithinDeltaExpectedNull(void);
+void testHEX64ArrayWithinDeltaExpectedNullAndMessage(void);
+void testHEX64ArrayWithinDeltaActualNull(void);
+void testHEX64ArrayWithinDeltaActualNullAndMessage(void);
+void testHEX64ArrayWithinDeltaSamePointer(void);
+void testHEX64ArrayWithinDeltaSamePointerAndMessage(void);
+void testHEX32ArrayWithinDelta(void);
+void testHEX32ArrayWithinDeltaShouldNotHaveSignIssues(void);
+void testHEX32ArrayWithinDeltaAndMessage(void);
+void testHEX32ArrayNotWithinDelta(void);
+void testHEX32ArrayNotWithinDeltaAndMessage(void);
+void testHEX32ArrayWithinDeltaPointless(void);
+void testHEX32ArrayWithinDeltaPointlessAndMessage(void);
+void testHEX32ArrayWithinDeltaExpectedNull(void);
+void testHEX32ArrayWithinDeltaExpectedNullAndMessage(void);
+void testHEX32ArrayWithinDeltaActualNull(void);
+void testHEX32ArrayWithinDeltaActualNullAndMessage(void);
+void testHEX32ArrayWithinDeltaSamePointer(void);
+void testHEX32ArrayWithinDeltaSamePointerAndMessage(void);
+void testHEX16ArrayWithinDelta(void);
+void testHEX16ArrayWithinDeltaShouldNotHaveSignIssues(void);
+void testHEX16ArrayWithinDeltaAndMessage(void);
+void testHEX16ArrayNotWithinDelta(void);
+void testHEX16ArrayNotWithinDeltaAndMessage(void);
+void testHEX16ArrayWithinDeltaPointless(void);
+void testHEX16ArrayWithinDeltaPointlessAndMessage(void);
+void testHEX16ArrayWithinDeltaExpectedNull(void);
+void testHEX16ArrayWithinDeltaExpectedNullAndMessage(void);
+void testHEX16ArrayWithinDeltaActualNull(void);
+void testHEX16ArrayWithinDeltaActualNullAndMessage(void);
+void testHEX16ArrayWithinDeltaSamePointer(void);
+void testHEX16ArrayWithinDeltaSamePointerAndMessage(void);
+void testHEX8ArrayWithinDelta(void);
+void testHEX8ArrayWithinDeltaAndMessage(void);
+void testHEX8ArrayNotWithinDelta(void);
+void testHEX8ArrayWithinDeltaShouldNotHaveSignIssues(void);
+void testHEX8ArrayNotWithinDeltaAndMessage(void);
+void testHEX8ArrayWithinDeltaPointless(void);
+void testHEX8ArrayWithinDeltaPointlessAndMessage(void);
+void testHEX8ArrayWithinDeltaExpectedNull(void);
+void testHEX8ArrayWithinDeltaExpectedNullAndMessage(void);
+void testHEX8ArrayWithinDeltaActualNull(void);
+void testHEX8ArrayWithinDeltaActualNullAndMessage(void);
+void testHEX8ArrayWithinDeltaSamePointer(void);
+void testHEX8ArrayWithinDeltaSamePointerAndMessage(void);
+void testEqualIntArrays(void);
+void testNotEqualIntArraysNullExpected(void);
+void testNotEqualIntArraysNullActual(void);
+void testNotEqualIntArrays1(void);
+void testNotEqualIntArrays2(void);
+void testNotEqualIntArrays3(void);
+void testNotEqualIntArraysLengthZero(void);
+void testEqualIntEachEqual(void);
+void testNotEqualIntEachEqualNullActual(void);
+void testNotEqualIntEachEqual1(void);
+void testNotEqualIntEachEqual2(void);
+void testNotEqualIntEachEqual3(void);
+void testNotEqualEachEqualLengthZero(void);
+void testEqualPtrArrays(void);
+void testNotEqualPtrArraysNullExpected(void);
+void testNotEqualPtrArraysNullActual(void);
+void testNotEqualPtrArrays1(void);
+void testNotEqualPtrArrays2(void);
+void testNotEqualPtrArrays3(void);
+void testEqualPtrEachEqual(void);
+void testNotEqualPtrEachEqualNullExpected(void);
+void testNotEqualPtrEachEqualNullActual(void);
+void testNotEqualPtrEachEqual1(void);
+void testNotEqualPtrEachEqual2(void);
+void testNotEqualPtrEachEqual3(void);
+void testEqualInt8Arrays(void);
+void testNotEqualInt8Arrays(void);
+void testEqualInt8EachEqual(void);
+void testNotEqualInt8EachEqual(void);
+void testEqualCHARArrays(void);
+void testNotEqualCHARArrays(void);
+void testEqualCHAREachEqual(void);
+void testNotEqualCHAREachEqual(void);
+void testEqualUIntArrays(void);
+void testNotEqualUIntArrays1(void);
+void testNotEqualUIntArrays2(void);
+void testNotEqualUIntArrays3(void);
+void testEqualUIntEachEqual(void);
+void testNotEqualUIntEachEqual1(void);
+void testNotEqualUIntEachEqual2(void);
+void testNotEqualUIntEachEqual3(void);
+void testEqualInt16Arrays(void);
+void testNotEqualInt16Arrays(void);
+void testEqualInt16EachEqual(void);
+void testNotEqualInt16EachEqual(void);
+void testEqualInt32Arrays(void);
+void testNotEqualInt32Arrays(void);
+void testEqualInt32EachEqual(void);
+void testNotEqualInt32EachEqual(void);
+void testEqualUINT8Arrays(void);
+void testNotEqualUINT8Arrays1(void);
+void testNotEqualUINT8Arrays2(void);
+void testNotEqualUINT8Arrays3(void);
+void testEqualUINT16Arrays(void);
+void testNotEqualUINT16Arrays1(void);
+void testNotEqualUINT16Arrays2(void);
+void testNotEqualUINT16Arrays3(void);
+void testEqualUINT32Arrays(void);
+void testNotEqualUINT32Arrays1(void);
+void testNotEqualUINT32Arrays2(void);
+void testNotEqualUINT32Arrays3(void);
+void testEqualHEXArrays(void);
+void testNotEqualHEXArrays1(void);
+void testNotEqualHEXArrays2(void);
+void testNotEqualHEXArrays3(void);
+void testEqualHEX32Arrays(void);
+void testNotEqualHEX32Arrays1(void);
+void testNotEqualHEX32Arrays2(void);
+void testNotEqualHEX32Arrays3(void);
+void testEqualHEX16Arrays(void);
+void testNotEqualHEX16Arrays1(void);
+void testNotEqualHEX16Arrays2(void);
+void testNotEqualHEX16Arrays3(void);
+void testEqualHEX8Arrays(void);
+void testNotEqualHEX8Arrays1(void);
+void testNotEqualHEX8Arrays2(void);
+void testNotEqualHEX8Arrays3(void);
+void testEqualUINT8EachEqual(void);
+void testNotEqualUINT8EachEqual1(void);
+void testNotEqualUINT8EachEqual2(void);
+void testNotEqualUINT8EachEqual3(void);
+void testEqualUINT16EachEqual(void);
+void testNotEqualUINT16EachEqual1(void);
+void testNotEqualUINT16EachEqual2(void);
+void testNotEqualUINT16EachEqual3(void);
+void testEqualUINT32EachEqual(void);
+void testNotEqualUINT32EachEqual1(void);
+void testNotEqualUINT32EachEqual2(void);
+void testNotEqualUINT32EachEqual3(void);
+void testEqualHEXEachEqual(void);
+void testNotEqualHEXEachEqual1(void);
+void testNotEqualHEXEachEqual2(void);
+void testNotEqualHEXEachEqual3(void);
+void testEqualHEX32EachEqual(void);
+void testNotEqualHEX32EachEqual1(void);
+void testNotEqualHEX32EachEqual2(void);
+void testNotEqualHEX32EachEqual3(void);
+void testEqualHEX16EachEqual(void);
+void testNotEqualHEX16EachEqual1(void);
+void testNotEqualHEX16EachEqual2(void);
+void testNotEqualHEX16EachEqual3(void);
+void testEqualHEX8EachEqual(void);
+void testNotEqualHEX8EachEqual1(void);
+void testNotEqualHEX8EachEqual2(void);
+void testNotEqualHEX8EachEqual3(void);
+void testEqualHEX64Arrays(void);
+void testEqualUint64Arrays(void);
+void testEqualInt64Arrays(void);
+void testNotEqualHEX64Arrays1(void);
+void testNotEqualHEX64Arrays2(void);
+void testNotEqualUint64Arrays(void);
+void testNotEqualInt64Arrays(void);
+void testVerifyIntPassingPointerComparisonOnZeroLengthArray(void);
+void testVerifyIntFailingPointerComparisonOnZeroLengthArray(void);
+int main(void)
+{
+    UnityBegin("tests/test_unity_arrays.c");
+    RUN_TEST(testInt64ArrayWithinDelta, 37);
+    RUN_TEST(testInt64ArrayWithinDeltaAndMessage, 51);
+    RUN_TEST(testInt64ArrayNotWithinDelta, 65);
+    RUN_TEST(testInt64ArrayNotWithinDeltaAndMessage, 79);
+    RUN_TEST(testInt64ArrayWithinDeltaPointless, 93);
+    RUN_TEST(testInt64ArrayWithinDeltaPointlessAndMessage, 107);
+    RUN_TEST(testInt64ArrayWithinDeltaExpectedNull, 121);
+    RUN_TEST(testInt64ArrayWithinDeltaExpectedNullAndMessage, 134);
+    RUN_TEST(testInt64ArrayWithinDeltaActualNull, 147);
+    RUN_TEST(testInt64ArrayWithinDeltaActualNullAndMessage, 160);
+    RUN_TEST(testInt64ArrayWithinDeltaSamePointer, 173);
+    RUN_TEST(testInt64ArrayWithinDeltaSamePointerAndMessage, 184);
+    RUN_TEST(testIntArrayWithinDelta, 195);
+    RUN_TEST(testIntArrayWithinDeltaAndMessage, 205);
+    RUN_TEST(testIntArrayNotWithinDelta, 215);
+    RUN_TEST(testIntArrayNotWithinDeltaAndMessage, 225);
+    RUN_TEST(testIntArrayWithinDeltaPointless, 235);
+    RUN_TEST(testIntArrayWithinDeltaPointlessAndMessage, 245);
+    RUN_TEST(testIntArrayWithinDeltaExpectedNull, 255);
+    RUN_TEST(testIntArrayWithinDeltaExpectedNullAndMessage, 264);
+    RUN_TEST(testIntArrayWithinDeltaActualNull, 273);
+    RUN_TEST(testIntArrayWithinDeltaActualNullAndMessage, 282);
+    RUN_TEST(testIntArrayWithinDeltaSamePointer, 291);
+    RUN_TEST(testIntArrayWithinDeltaSamePointerAndMessage, 298);
+    RUN_TEST(testInt16ArrayWithinDelta, 305);
+    RUN_TEST(testInt16ArrayWithinDeltaAndMessage, 315);
+    RUN_TEST(testInt16ArrayNotWithinDelta, 325);
+    RUN_TEST(testInt16ArrayNotWithinDeltaAndMessage, 335);
+    RUN_TEST(testInt16ArrayWithinDeltaPointless, 345);
+    RUN_TEST(testInt16ArrayWithinDeltaPointlessAndMessage, 355);
+    RUN_TEST(testInt16ArrayWithinDeltaExpectedNull, 365);
+    RUN_TEST(testInt16ArrayWithinDeltaExpectedNullAndMessage, 374);
+    RUN_TEST(testInt16ArrayWithinDeltaActualNull, 383);
+    RUN_TEST(testInt16ArrayWithinDeltaActualNullAndMessage, 392);
+    RUN_TEST(testInt16ArrayWithinDeltaSamePointer, 401);
+    RUN_TEST(testInt16ArrayWithinDeltaSamePointerAndMessage, 408);
+    RUN_TEST(testInt8ArrayWithinDelta, 415);
+    RUN_TEST(testInt8ArrayWithinDeltaAndMessage, 425);
+    RUN_TEST(testInt8ArrayNotWithinDelta, 435);
+    RUN_TEST(testInt8ArrayNotWithinDeltaAndMessage, 445);
+    RUN_TEST(testInt8ArrayWithinDeltaPointless, 455);
+    RUN_TEST(testInt8ArrayWithinDeltaPointlessAndMessage, 465);
+    RUN_TEST(testInt8ArrayWithinDeltaExpectedNull, 475);
+    RUN_TEST(testInt8ArrayWithinDeltaExpectedNullAndMessage, 484);
+    RUN_TEST(testInt8ArrayWithinDeltaActualNull, 493);
+    RUN_TEST(testInt8ArrayWithinDeltaActualNullAndMessage, 502);
+    RUN_TEST(testInt8ArrayWithinDeltaSamePointer, 511);
+    RUN_TEST(testInt8ArrayWithinDeltaSamePointerAndMessage, 518);
+    RUN_TEST(testCHARArrayWithinDelta, 525);
+    RUN_TEST(testCHARArrayWithinDeltaAndMessage, 535);
+    RUN_TEST(testCHARArrayNotWithinDelta, 545);
+    RUN_TEST(testCHARArrayNotWithinDeltaAndMessage, 555);
+    RUN_TEST(testCHARArrayWithinDeltaPointless, 565);
+    RUN_TEST(testCHARArrayWithinDeltaPointlessAndMessage, 575);
+    RUN_TEST(testCHARArrayWithinDeltaExpectedNull, 585);
+    RUN_TEST(testCHARArrayWithinDeltaExpectedNullAndMessage, 594);
+    RUN_TEST(testCHARArrayWithinDeltaActualNull, 603);
+    RUN_TEST(testCHARArrayWithinDeltaActualNullAndMessage, 612);
+    RUN_TEST(testCHARArrayWithinDeltaSamePointer, 621);
+    RUN_TEST(testCHARArrayWithinDeltaSamePointerAndMessage, 628);
+    RUN_TEST(testUInt64ArrayWithinDelta, 635);
+    RUN_TEST(testUInt64ArrayWithinDeltaAndMessage, 649);
+    RUN_TEST(testUInt64ArrayNotWithinDelta, 663);
+    RUN_TEST(testUInt64ArrayNotWithinDeltaAndMessage, 677);
+    RUN_TEST(testUInt64ArrayWithinDeltaPointless, 691);
+    RUN_TEST(testUInt64ArrayWithinDeltaPointlessAndMessage, 705);
+    RUN_TEST(testUInt64ArrayWithinDeltaExpectedNull, 719);
+    RUN_TEST(testUInt64ArrayWithinDeltaExpectedNullAndMessage, 732);
+    RUN_TEST(testUInt64ArrayWithinDeltaActualNull, 745);
+    RUN_TEST(testUInt64ArrayWithinDeltaActualNullAndMessage, 758);
+    RUN_TEST(testUInt64ArrayWithinDeltaSamePointer, 771);
+    RUN_TEST(testUInt64ArrayWithinDeltaSamePointerAndMessage, 782);
+    RUN_TEST(testUIntArrayWithinDelta, 793);
+    RUN_TEST(testUIntArrayWithinDeltaAndMessage, 803);
+    RUN_TEST(testUIntArrayNotWithinDelta, 813);
+    RUN_TEST(testUIntArrayNotWithinDeltaAndMessage, 823);
+    RUN_TEST(testUIntArrayWithinDeltaPointless, 833);
+    RUN_TEST(testUIntArrayWithinDeltaPointlessAndMessage, 843);
+    RUN_TEST(testUIntArrayWithinDeltaExpectedNull, 853);
+    RUN_TEST(testUIntArrayWithinDeltaExpectedNullAndMessage, 862);
+    RUN_TEST(testUIntArrayWithinDeltaActualNull, 871);
+    RUN_TEST(testUIntArrayWithinDeltaActualNullAndMessage, 880);
+    RUN_TEST(testUIntArrayWithinDeltaSamePointer, 889);
+    RUN_TEST(testUIntArrayWithinDeltaSamePointerAndMessage, 896);
+    RUN_TEST(testUInt16ArrayWithinDelta, 903);
+    RUN_TEST(testUInt16ArrayWithinDeltaAndMessage, 913);
+    RUN_TEST(testUInt16ArrayNotWithinDelta, 923);
+    RUN_TEST(testUInt16ArrayNotWithinDeltaAndMessage, 933);
+    RUN_TEST(testUInt16ArrayWithinDeltaPointless, 943);
+    RUN_TEST(testUInt16ArrayWithinDeltaPointlessAndMessage, 953);
+    RUN_TEST(testUInt16ArrayWithinDeltaExpectedNull, 963);
+    RUN_TEST(testUInt16ArrayWithinDeltaExpectedNullAndMessage, 972);
+    RUN_TEST(testUInt16ArrayWithinDeltaActualNull, 981);
+    RUN_TEST(testUInt16ArrayWithinDeltaActualNullAndMessage, 990);
+    RUN_TEST(testUInt16ArrayWithinDeltaSamePointer, 999);
+    RUN_TEST(testUInt16ArrayWithinDeltaSamePointerAndMessage, 1006);
+    RUN_TEST(testUInt8ArrayWithinDelta, 1013);
+    RUN_TEST(testUInt8ArrayWithinDeltaAndMessage, 1023);
+    RUN_TEST(testUInt8ArrayNotWithinDelta, 1033);
+    RUN_TEST(testUInt8ArrayNotWithinDeltaAndMessage, 1043);
+    RUN_TEST(testUInt8ArrayWithinDeltaPointless, 1053);
+    RUN_TEST(testUInt8ArrayWithinDeltaPointlessAndMessage, 1063);
+    RUN_TEST(testUInt8ArrayWithinDeltaExpectedNull, 1073);
+    RUN_TEST(testUInt8ArrayWithinDeltaExpectedNullAndMessage, 1082);
+    RUN_TEST(testUInt8ArrayWithinDeltaActualNull, 1091);
+    RUN_TEST(testUInt8ArrayWithinDeltaActualNullAndMessage, 1100);
+    RUN_TEST(testUInt8ArrayWithinDeltaSamePointer, 1109);
+    RUN_TEST(testUInt8ArrayWithinDeltaSamePointerAndMessage, 1116);
+    RUN_TEST(testHEX64ArrayWithinDelta, 1123);
+    RUN_TEST(testHEX64ArrayWithinDeltaShouldNotHaveSignIssues, 1137);
+    RUN_TEST(testHEX64ArrayWithinDeltaAndMessage, 1149);
+    RUN_TEST(testHEX64ArrayNotWithinDelta, 1163);
+    RUN_TEST(testHEX64ArrayNotWithinDeltaAndMessage, 1177);
+    RUN_TEST(testHEX64ArrayWithinDeltaPointless, 1191);
+    RUN_TEST(testHEX64ArrayWithinDeltaPointlessAndMessage, 1205);
+    RUN_TEST(testHEX64ArrayWithinDeltaExpectedNull, 1219);
+    RUN_TEST(testHEX64ArrayWithinDeltaExpectedNullAndMessage, 1232);
+    RUN_TEST(testHEX64ArrayWithinDeltaActualNull, 1245);
+    RUN_TEST(testHEX64ArrayWithinDeltaActualNullAndMessage, 1258);
+    RUN_TEST(testHEX64ArrayWithinDeltaSamePointer, 1271);
+    RUN_TEST(testHEX64ArrayWithinDeltaSamePointerAndMessage, 1282);
+    RUN_TEST(testHEX32ArrayWithinDelta, 1293);
+    RUN_TEST(testHEX32ArrayWithinDeltaShouldNotHaveSignIssues, 1303);
+    RUN_TEST(testHEX32ArrayWithinDeltaAndMessage, 1311);
+    RUN_TEST(testHEX32ArrayNotWithinDelta, 1321);
+    RUN_TEST(testHEX32ArrayNotWithinDeltaAndMessage, 1331);
+    RUN_TEST(testHEX32ArrayWithinDeltaPointless, 1341);
+    RUN_TEST(testHEX32ArrayWithinDeltaPointlessAndMessage, 1351);
+    RUN_TEST(testHEX32ArrayWithinDeltaExpectedNull, 1361);
+    RUN_TEST(testHEX32ArrayWithinDeltaExpectedNullAndMessage, 1370);
+    RUN_TEST(testHEX32ArrayWithinDeltaActualNull, 1379);
+    RUN_TEST(testHEX32ArrayWithinDeltaActualNullAndMessage, 1388);
+    RUN_TEST(testHEX32ArrayWithinDeltaSamePointer, 1397);
+    RUN_TEST(testHEX32ArrayWithinDeltaSamePointerAndMessage, 1404);
+    RUN_TEST(testHEX16ArrayWithinDelta, 1412);
+    RUN_TEST(testHEX16ArrayWithinDeltaShouldNotHaveSignIssues, 1422);
+    RUN_TEST(testHEX16ArrayWithinDeltaAndMessage, 1430);
+    RUN_TEST(testHEX16ArrayNotWithinDelta, 1440);
+    RUN_TEST(testHEX16ArrayNotWithinDeltaAndMessage, 1450);
+    RUN_TEST(testHEX16ArrayWithinDeltaPointless, 1460);
+    RUN_TEST(testHEX16ArrayWithinDeltaPointlessAndMessage, 1470);
+    RUN_TEST(testHEX16ArrayWithinDeltaExpectedNull, 1480);
+    RUN_TEST(testHEX16ArrayWithinDeltaExpectedNullAndMessage, 1489);
+    RUN_TEST(testHEX16ArrayWithinDeltaActualNull, 1498);
+    RUN_TEST(testHEX16ArrayWithinDeltaActualNullAndMessage, 1507);
+    RUN_TEST(testHEX16ArrayWithinDeltaSamePointer, 1516);
+    RUN_TEST(testHEX16ArrayWithinDeltaSamePointerAndMessage, 1523);
+    RUN_TEST(testHEX8ArrayWithinDelta, 1530);
+    RUN_TEST(testHEX8ArrayWithinDeltaAndMessage, 1540);
+    RUN_TEST(testHEX8ArrayNotWithinDelta, 1550);
+    RUN_TEST(testHEX8ArrayWithinDeltaShouldNotHaveSignIssues, 1560);
+    RUN_TEST(testHEX8ArrayNotWithinDeltaAndMessage, 1568);
+    RUN_TEST(testHEX8ArrayWithinDeltaPointless, 1578);
+    RUN_TEST(testHEX8ArrayWithinDeltaPointlessAndMessage, 1588);
+    RUN_TEST(testHEX8ArrayWithinDeltaExpectedNull, 1598);
+    RUN_TEST(testHEX8ArrayWithinDeltaExpectedNullAndMessage, 1607);
+    RUN_TEST(testHEX8ArrayWithinDeltaActualNull, 1616);
+    RUN_TEST(testHEX8ArrayWithinDeltaActualNullAndMessage, 1625);
+    RUN_TEST(testHEX8ArrayWithinDeltaSamePointer, 1634);
+    RUN_TEST(testHEX8ArrayWithinDeltaSamePointerAndMessage, 1641);
+    RUN_TEST(testEqualIntArrays, 1648);
+    RUN_TEST(testNotEqualIntArraysNullExpected, 1663);
+    RUN_TEST(testNotEqualIntArraysNullActual, 1673);
+    RUN_TEST(testNotEqualIntArrays1, 1683);
+    RUN_TEST(testNotEqualIntArrays2, 1693);
+    RUN_TEST(testNotEqualIntArrays3, 1703);
+    RUN_TEST(testNotEqualIntArraysLengthZero, 1713);
+    RUN_TEST(testEqualIntEachEqual, 1723);
+    RUN_TEST(testNotEqualIntEachEqualNullActual, 1737);
+    RUN_TEST(testNotEqualIntEachEqual1, 1746);
+    RUN_TEST(testNotEqualIntEachEqual2, 1755);
+    RUN_TEST(testNotEqualIntEachEqual3, 1764);
+    RUN_TEST(testNotEqualEachEqualLengthZero, 1773);
+    RUN_TEST(testEqualPtrArrays, 1782);
+    RUN_TEST(testNotEqualPtrArraysNullExpected, 1799);
+    RUN_TEST(testNotEqualPtrArraysNullActual, 1811);
+    RUN_TEST(testNotEqualPtrArrays1, 1823);
+    RUN_TEST(testNotEqualPtrArrays2, 1836);
+    RUN_TEST(testNotEqualPtrArrays3, 1849);
+    RUN_TEST(testEqualPtrEachEqual, 1862);
+    RUN_TEST(testNotEqualPtrEachEqualNullExpected, 1879);
+    RUN_TEST(testNotEqualPtrEachEqualNullActual, 1890);
+    RUN_TEST(testNotEqualPtrEachEqual1, 1900);
+    RUN_TEST(testNotEqualPtrEachEqual2, 1911);
+    RUN_TEST(testNotEqualPtrEachEqual3, 1922);
+    RUN_TEST(testEqualInt8Arrays, 1933);
+    RUN_TEST(testNotEqualInt8Arrays, 1947);
+    RUN_TEST(testEqualInt8EachEqual, 1957);
+    RUN_TEST(testNotEqualInt8EachEqual, 1971);
+    RUN_TEST(testEqualCHARArrays, 1980);
+    RUN_TEST(testNotEqualCHARArrays, 1994);
+    RUN_TEST(testEqualCHAREachEqual, 2004);
+    RUN_TEST(testNotEqualCHAREachEqual, 2018);
+    RUN_TEST(testEqualUIntArrays, 2027);
+    RUN_TEST(testNotEqualUIntArrays1, 2041);
+    RUN_TEST(testNotEqualUIntArrays2, 2051);
+    RUN_TEST(testNotEqualUIntArrays3, 2061);
+    RUN_TEST(testEqualUIntEachEqual, 2071);
+    RUN_TEST(testNotEqualUIntEachEqual1, 2085);
+    RUN_TEST(testNotEqualUIntEachEqual2, 2094);
+    RUN_TEST(testNotEqualUIntEachEqual3, 2103);
+    RUN_TEST(testEqualInt16Arrays, 2112);
+    RUN_TEST(testNotEqualInt16Arrays, 2126);
+    RUN_TEST(testEqualInt16EachEqual, 2136);
+    RUN_TEST(testNotEqualInt16EachEqual, 2150);
+    RUN_TEST(testEqualInt32Arrays, 2159);
+    RUN_TEST(testNotEqualInt32Arrays, 2173);
+    RUN_TEST(testEqualInt32EachEqual, 2183);
+    RUN_TEST(testNotEqualInt32EachEqual, 2197);
+    RUN_TEST(testEqualUINT8Arrays, 2206);
+    RUN_TEST(testNotEqualUINT8Arrays1, 2220);
+    RUN_TEST(testNotEqualUINT8Arrays2, 2230);
+    RUN_TEST(testNotEqualUINT8Arrays3, 2240);
+    RUN_TEST(testEqualUINT16Arrays, 2251);
+    RUN_TEST(testNotEqualUINT16Arrays1, 2265);
+    RUN_TEST(testNotEqualUINT16Arrays2, 2275);
+    RUN_TEST(testNotEqualUINT16Arrays3, 2285);
+    RUN_TEST(testEqualUINT32Arrays, 2295);
+    RUN_TEST(testNotEqualUINT32Arrays1, 2309);
+    RUN_TEST(testNotEqualUINT32Arrays2, 2319);
+    RUN_TEST(testNotEqualUINT32Arrays3, 2329);
+    RUN_TEST(testEqualHEXArrays, 2339);
+    RUN_TEST(testNotEqualHEXArrays1, 2353);
+    RUN_TEST(testNotEqualHEXArrays2, 2363);
+    RUN_TEST(testNotEqualHEXArrays3, 2373);
+    RUN_TEST(testEqualHEX32Arrays, 2383);
+    RUN_TEST(testNotEqualHEX32Arrays1, 2397);
+    RUN_TEST(testNotEqualHEX32Arrays2, 2407);
+    RUN_TEST(testNotEqualHEX32Arrays3, 2417);
+    RUN_TEST(testEqualHEX16Arrays, 2427);
+    RUN_TEST(testNotEqualHEX16Arrays1, 2441);
+    RUN_TEST(testNotEqualHEX16Arrays2, 2451);
+    RUN_TEST(testNotEqualHEX16Arrays3, 2461);
+    RUN_TEST(testEqualHEX8Arrays, 2471);
+    RUN_TEST(testNotEqualHEX8Arrays1, 2485);
+    RUN_TEST(testNotEqualHEX8Arrays2, 2495);
+    RUN_TEST(testNotEqualHEX8Arrays3, 2505);
+    RUN_TEST(testEqualUINT8EachEqual, 2515);
+    RUN_TEST(testNotEqualUINT8EachEqual1, 2529);
+    RUN_TEST(testNotEqualUINT8EachEqual2, 2538);
+    RUN_TEST(testNotEqualUINT8EachEqual3, 2547);
+    RUN_TEST(testEqualUINT16EachEqual, 2556);
+    RUN_TEST(testNotEqualUINT16EachEqual1, 2570);
+    RUN_TEST(testNotEqualUINT16EachEqual2, 2579);
+    RUN_TEST(testNotEqualUINT16EachEqual3, 2588);
+    RUN_TEST(testEqualUINT32EachEqual, 2597);
+    RUN_TEST(testNotEqualUINT32EachEqual1, 2611);
+    RUN_TEST(testNotEqualUINT32EachEqual2, 2620);
+    RUN_TEST(testNotEqualUINT32EachEqual3, 2629);
+    RUN_TEST(testEqualHEXEachEqual, 2638);
+    RUN_TEST(testNotEqualHEXEachEqual1, 2652);
+    RUN_TEST(testNotEqualHEXEachEqual2, 2661);
+    RUN_TEST(testNotEqualHEXEachEqual3, 2670);
+    RUN_TEST(testEqualHEX32EachEqual, 2679);
+    RUN_TEST(testNotEqualHEX32EachEqual1, 2693);
+    RUN_TEST(testNotEqualHEX32EachEqual2, 2702);
+    RUN_TEST(testNotEqualHEX32EachEqual3, 2711);
+    RUN_TEST(testEqualHEX16EachEqual, 2720);
+    RUN_TEST(testNotEqualHEX16EachEqual1, 2734);
+    RUN_TEST(testNotEqualHEX16EachEqual2, 2743);
+    RUN_TEST(testNotEqualHEX16EachEqual3, 2752);
+    RUN_TEST(testEqualHEX8EachEqual, 2761);
+    RUN_TEST(testNotEqualHEX8EachEqual1, 2775);
+    RUN_TEST(testNotEqualHEX8EachEqual2, 2784);
+    RUN_TEST(testNotEqualHEX8EachEqual3, 2793);
+    RUN_TEST(testEqualHEX64Arrays, 2802);
+    RUN_TEST(testEqualUint64Arrays, 2820);
+    RUN_TEST(testEqualInt64Arrays, 2838);
+    RUN_TEST(testNotEqualHEX64Arrays1, 2857);
+    RUN_TEST(testNotEqualHEX64Arrays2, 2871);
+    RUN_TEST(testNotEqualUint64Arrays, 2885);
+    RUN_TEST(testNotEqualInt64Arrays, 2899);
+    RUN_TEST(testVerifyIntPassingPointerComparisonOnZeroLengthArray, 2913);
+    RUN_TEST(testVerifyIntFailingPointerComparisonOnZeroLengthArray, 2927);
+    return UNITY_END();
+}
@@ -0,0 +1,1191 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "self_assessment_utils.h"
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testInt64ArrayWithinDelta(void);
+extern void testInt64ArrayWithinDeltaAndMessage(void);
+extern void testInt64ArrayNotWithinDelta(void);
+extern void testInt64ArrayNotWithinDeltaAndMessage(void);
+extern void testInt64ArrayWithinDeltaPointless(void);
+extern void testInt64ArrayWithinDeltaPointlessAndMessage(void);
+extern void testInt64ArrayWithinDeltaExpectedNull(void);
+extern void testInt64ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testInt64ArrayWithinDeltaActualNull(void);
+extern void testInt64ArrayWithinDeltaActualNullAndMessage(void);
+extern void testInt64ArrayWithinDeltaSamePointer(void);
+extern void testInt64ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testIntArrayWithinDelta(void);
+extern void testIntArrayWithinDeltaAndMessage(void);
+extern void testIntArrayNotWithinDelta(void);
+extern void testIntArrayNotWithinDeltaAndMessage(void);
+extern void testIntArrayWithinDeltaPointless(void);
+extern void testIntArrayWithinDeltaPointlessAndMessage(void);
+extern void testIntArrayWithinDeltaExpectedNull(void);
+extern void testIntArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testIntArrayWithinDeltaActualNull(void);
+extern void testIntArrayWithinDeltaActualNullAndMessage(void);
+extern void testIntArrayWithinDeltaSamePointer(void);
+extern void testIntArrayWithinDeltaSamePointerAndMessage(void);
+extern void testInt16ArrayWithinDelta(void);
+extern void testInt16ArrayWithinDeltaAndMessage(void);
+extern void testInt16ArrayNotWithinDelta(void);
+extern void testInt16ArrayNotWithinDeltaAndMessage(void);
+extern void testInt16ArrayWithinDeltaPointless(void);
+extern void testInt16ArrayWithinDeltaPointlessAndMessage(void);
+extern void testInt16ArrayWithinDeltaExpectedNull(void);
+extern void testInt16ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testInt16ArrayWithinDeltaActualNull(void);
+extern void testInt16ArrayWithinDeltaActualNullAndMessage(void);
+extern void testInt16ArrayWithinDeltaSamePointer(void);
+extern void testInt16ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testInt8ArrayWithinDelta(void);
+extern void testInt8ArrayWithinDeltaAndMessage(void);
+extern void testInt8ArrayNotWithinDelta(void);
+extern void testInt8ArrayNotWithinDeltaAndMessage(void);
+extern void testInt8ArrayWithinDeltaPointless(void);
+extern void testInt8ArrayWithinDeltaPointlessAndMessage(void);
+extern void testInt8ArrayWithinDeltaExpectedNull(void);
+extern void testInt8ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testInt8ArrayWithinDeltaActualNull(void);
+extern void testInt8ArrayWithinDeltaActualNullAndMessage(void);
+extern void testInt8ArrayWithinDeltaSamePointer(void);
+extern void testInt8ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testCHARArrayWithinDelta(void);
+extern void testCHARArrayWithinDeltaAndMessage(void);
+extern void testCHARArrayNotWithinDelta(void);
+extern void testCHARArrayNotWithinDeltaAndMessage(void);
+extern void testCHARArrayWithinDeltaPointless(void);
+extern void testCHARArrayWithinDeltaPointlessAndMessage(void);
+extern void testCHARArrayWithinDeltaExpectedNull(void);
+extern void testCHARArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testCHARArrayWithinDeltaActualNull(void);
+extern void testCHARArrayWithinDeltaActualNullAndMessage(void);
+extern void testCHARArrayWithinDeltaSamePointer(void);
+extern void testCHARArrayWithinDeltaSamePointerAndMessage(void);
+extern void testUInt64ArrayWithinDelta(void);
+extern void testUInt64ArrayWithinDeltaAndMessage(void);
+extern void testUInt64ArrayNotWithinDelta(void);
+extern void testUInt64ArrayNotWithinDeltaAndMessage(void);
+extern void testUInt64ArrayWithinDeltaPointless(void);
+extern void testUInt64ArrayWithinDeltaPointlessAndMessage(void);
+extern void testUInt64ArrayWithinDeltaExpectedNull(void);
+extern void testUInt64ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testUInt64ArrayWithinDeltaActualNull(void);
+extern void testUInt64ArrayWithinDeltaActualNullAndMessage(void);
+extern void testUInt64ArrayWithinDeltaSamePointer(void);
+extern void testUInt64ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testUIntArrayWithinDelta(void);
+extern void testUIntArrayWithinDeltaAndMessage(void);
+extern void testUIntArrayNotWithinDelta(void);
+extern void testUIntArrayNotWithinDeltaAndMessage(void);
+extern void testUIntArrayWithinDeltaPointless(void);
+extern void testUIntArrayWithinDeltaPointlessAndMessage(void);
+extern void testUIntArrayWithinDeltaExpectedNull(void);
+extern void testUIntArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testUIntArrayWithinDeltaActualNull(void);
+extern void testUIntArrayWithinDeltaActualNullAndMessage(void);
+extern void testUIntArrayWithinDeltaSamePointer(void);
+extern void testUIntArrayWithinDeltaSamePointerAndMessage(void);
+extern void testUInt16ArrayWithinDelta(void);
+extern void testUInt16ArrayWithinDeltaAndMessage(void);
+extern void testUInt16ArrayNotWithinDelta(void);
+extern void testUInt16ArrayNotWithinDeltaAndMessage(void);
+extern void testUInt16ArrayWithinDeltaPointless(void);
+extern void testUInt16ArrayWithinDeltaPointlessAndMessage(void);
+extern void testUInt16ArrayWithinDeltaExpectedNull(void);
+extern void testUInt16ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testUInt16ArrayWithinDeltaActualNull(void);
+extern void testUInt16ArrayWithinDeltaActualNullAndMessage(void);
+extern void testUInt16ArrayWithinDeltaSamePointer(void);
+extern void testUInt16ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testUInt8ArrayWithinDelta(void);
+extern void testUInt8ArrayWithinDeltaAndMessage(void);
+extern void testUInt8ArrayNotWithinDelta(void);
+extern void testUInt8ArrayNotWithinDeltaAndMessage(void);
+extern void testUInt8ArrayWithinDeltaPointless(void);
+extern void testUInt8ArrayWithinDeltaPointlessAndMessage(void);
+extern void testUInt8ArrayWithinDeltaExpectedNull(void);
+extern void testUInt8ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testUInt8ArrayWithinDeltaActualNull(void);
+extern void testUInt8ArrayWithinDeltaActualNullAndMessage(void);
+extern void testUInt8ArrayWithinDeltaSamePointer(void);
+extern void testUInt8ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testHEX64ArrayWithinDelta(void);
+extern void testHEX64ArrayWithinDeltaShouldNotHaveSignIssues(void);
+extern void testHEX64ArrayWithinDeltaAndMessage(void);
+extern void testHEX64ArrayNotWithinDelta(void);
+extern void testHEX64ArrayNotWithinDeltaAndMessage(void);
+extern void testHEX64ArrayWithinDeltaPointless(void);
+extern void testHEX64ArrayWithinDeltaPointlessAndMessage(void);
+extern void testHEX64ArrayWithinDeltaExpectedNull(void);
+extern void testHEX64ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testHEX64ArrayWithinDeltaActualNull(void);
+extern void testHEX64ArrayWithinDeltaActualNullAndMessage(void);
+extern void testHEX64ArrayWithinDeltaSamePointer(void);
+extern void testHEX64ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testHEX32ArrayWithinDelta(void);
+extern void testHEX32ArrayWithinDeltaShouldNotHaveSignIssues(void);
+extern void testHEX32ArrayWithinDeltaAndMessage(void);
+extern void testHEX32ArrayNotWithinDelta(void);
+extern void testHEX32ArrayNotWithinDeltaAndMessage(void);
+extern void testHEX32ArrayWithinDeltaPointless(void);
+extern void testHEX32ArrayWithinDeltaPointlessAndMessage(void);
+extern void testHEX32ArrayWithinDeltaExpectedNull(void);
+extern void testHEX32ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testHEX32ArrayWithinDeltaActualNull(void);
+extern void testHEX32ArrayWithinDeltaActualNullAndMessage(void);
+extern void testHEX32ArrayWithinDeltaSamePointer(void);
+extern void testHEX32ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testHEX16ArrayWithinDelta(void);
+extern void testHEX16ArrayWithinDeltaShouldNotHaveSignIssues(void);
+extern void testHEX16ArrayWithinDeltaAndMessage(void);
+extern void testHEX16ArrayNotWithinDelta(void);
+extern void testHEX16ArrayNotWithinDeltaAndMessage(void);
+extern void testHEX16ArrayWithinDeltaPointless(void);
+extern void testHEX16ArrayWithinDeltaPointlessAndMessage(void);
+extern void testHEX16ArrayWithinDeltaExpectedNull(void);
+extern void testHEX16ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testHEX16ArrayWithinDeltaActualNull(void);
+extern void testHEX16ArrayWithinDeltaActualNullAndMessage(void);
+extern void testHEX16ArrayWithinDeltaSamePointer(void);
+extern void testHEX16ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testHEX8ArrayWithinDelta(void);
+extern void testHEX8ArrayWithinDeltaAndMessage(void);
+extern void testHEX8ArrayNotWithinDelta(void);
+extern void testHEX8ArrayWithinDeltaShouldNotHaveSignIssues(void);
+extern void testHEX8ArrayNotWithinDeltaAndMessage(void);
+extern void testHEX8ArrayWithinDeltaPointless(void);
+extern void testHEX8ArrayWithinDeltaPointlessAndMessage(void);
+extern void testHEX8ArrayWithinDeltaExpectedNull(void);
+extern void testHEX8ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testHEX8ArrayWithinDeltaActualNull(void);
+extern void testHEX8ArrayWithinDeltaActualNullAndMessage(void);
+extern void testHEX8ArrayWithinDeltaSamePointer(void);
+extern void testHEX8ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testEqualIntArrays(void);
+extern void testNotEqualIntArraysNullExpected(void);
+extern void testNotEqualIntArraysNullActual(void);
+extern void testNotEqualIntArrays1(void);
+extern void testNotEqualIntArrays2(void);
+extern void testNotEqualIntArrays3(void);
+extern void testNotEqualIntArraysLengthZero(void);
+extern void testEqualIntEachEqual(void);
+extern void testNotEqualIntEachEqualNullActual(void);
+extern void testNotEqualIntEachEqual1(void);
+extern void testNotEqualIntEachEqual2(void);
+extern void testNotEqualIntEachEqual3(void);
+extern void testNotEqualEachEqualLengthZero(void);
+extern void testEqualPtrArrays(void);
+extern void testNotEqualPtrArraysNullExpected(void);
+extern void testNotEqualPtrArraysNullActual(void);
+extern void testNotEqualPtrArrays1(void);
+extern void testNotEqualPtrArrays2(void);
+extern void testNotEqualPtrArrays3(void);
+extern void testEqualPtrEachEqual(void);
+extern void testNotEqualPtrEachEqualNullExpected(void);
+extern void testNotEqualPtrEachEqualNullActual(void);
+extern void testNotEqualPtrEachEqual1(void);
+extern void testNotEqualPtrEachEqual2(void);
+extern void testNotEqualPtrEachEqual3(void);
+extern void testEqualInt8Arrays(void);
+extern void testNotEqualInt8Arrays(void);
+extern void testEqualInt8EachEqual(void);
+extern void testNotEqualInt8EachEqual(void);
+extern void testEqualCHARArrays(void);
+extern void testNotEqualCHARArrays(void);
+extern void testEqualCHAREachEqual(void);
+extern void testNotEqualCHAREachEqual(void);
+extern void testEqualUIntArrays(void);
+extern void testNotEqualUIntArrays1(void);
+extern void testNotEqualUIntArrays2(void);
+extern void testNotEqualUIntArrays3(void);
+extern void testEqualUIntEachEqual(void);
+extern void testNotEqualUIntEachEqual1(void);
+extern void testNotEqualUIntEachEqual2(void);
+extern void testNotEqualUIntEachEqual3(void);
+extern void testEqualInt16Arrays(void);
+extern void testNotEqualInt16Arrays(void);
+extern void testEqualInt16EachEqual(void);
+extern void testNotEqualInt16EachEqual(void);
+extern void testEqualInt32Arrays(void);
+extern void testNotEqualInt32Arrays(void);
+extern void testEqualInt32EachEqual(void);
+extern void testNotEqualInt32EachEqual(void);
+extern void testEqualUINT8Arrays(void);
+extern void testNotEqualUINT8Arrays1(void);
+extern void testNotEqualUINT8Arrays2(void);
+extern void testNotEqualUINT8Arrays3(void);
+extern void testEqualUINT16Arrays(void);
+extern void testNotEqualUINT16Arrays1(void);
+extern void testNotEqualUINT16Arrays2(void);
+extern void testNotEqualUINT16Arrays3(void);
+extern void testEqualUINT32Arrays(void);
+extern void testNotEqualUINT32Arrays1(void);
+extern void testNotEqualUINT32Arrays2(void);
+extern void testNotEqualUINT32Arrays3(void);
+extern void testEqualHEXArrays(void);
+extern void testNotEqualHEXArrays1(void);
+extern void testNotEqualHEXArrays2(void);
+extern void testNotEqualHEXArrays3(void);
+extern void testEqualHEX32Arrays(void);
+extern void testNotEqualHEX32Arrays1(void);
+extern void testNotEqualHEX32Arrays2(void);
+extern void testNotEqualHEX32Arrays3(void);
+extern void testEqualHEX16Arrays(void);
+extern void testNotEqualHEX16Arrays1(void);
+extern void testNotEqualHEX16Arrays2(void);
+extern void testNotEqualHEX16Arrays3(void);
+extern void testEqualHEX8Arrays(void);
+extern void testNotEqualHEX8Arrays1(void);
+extern void testNotEqualHEX8Arrays2(void);
+extern void testNotEqualHEX8Arrays3(void);
+extern void testEqualUINT8EachEqual(void);
+extern void testNotEqualUINT8EachEqual1(void);
+extern void testNotEqualUINT8EachEqual2(void);
+extern void testNotEqualUINT8EachEqual3(void);
+extern void testEqualUINT16EachEqual(void);
+extern void testNotEqualUINT16EachEqual1(void);
+extern void testNotEqualUINT16EachEqual2(void);
+extern void testNotEqualUINT16EachEqual3(void);
+extern void testEqualUINT32EachEqual(void);
+extern void testNotEqualUINT32EachEqual1(void);
+extern void testNotEqualUINT32EachEqual2(void);
+extern void testNotEqualUINT32EachEqual3(void);
+extern void testEqualHEXEachEqual(void);
+extern void testNotEqualHEXEachEqual1(void);
+extern void testNotEqualHEXEachEqual2(void);
+extern void testNotEqualHEXEachEqual3(void);
+extern void testEqualHEX32EachEqual(void);
+extern void testNotEqualHEX32EachEqual1(void);
+extern void testNotEqualHEX32EachEqual2(void);
+extern void testNotEqualHEX32EachEqual3(void);
+extern void testEqualHEX16EachEqual(void);
+extern void testNotEqualHEX16EachEqual1(void);
+extern void testNotEqualHEX16EachEqual2(void);
+extern void testNotEqualHEX16EachEqual3(void);
+extern void testEqualHEX8EachEqual(void);
+extern void testNotEqualHEX8EachEqual1(void);
+extern void testNotEqualHEX8EachEqual2(void);
+extern void testNotEqualHEX8EachEqual3(void);
+extern void testEqualHEX64Arrays(void);
+extern void testEqualUint64Arrays(void);
+extern void testEqualInt64Arrays(void);
+extern void testNotEqualHEX64Arrays1(void);
+extern void testNotEqualHEX64Arrays2(void);
+extern void testNotEqualUint64Arrays(void);
+extern void testNotEqualInt64Arrays(void);
+extern void testVerifyIntPassingPointerComparisonOnZeroLengthArray(void);
+extern void testVerifyIntFailingPointerComparisonOnZeroLengthArray(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("tests/test_unity_arrays.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[274];
+
+  run_test_params_arr[0].func = testInt64ArrayWithinDelta;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("testInt64ArrayWithinDelta");
+  run_test_params_arr[0].line_num = 37;
+  run_test_params_arr[1].func = testInt64ArrayWithinDeltaAndMessage;
+  run_test_params_arr[1].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaAndMessage");
+  run_test_params_arr[1].line_num = 51;
+  run_test_params_arr[2].func = testInt64ArrayNotWithinDelta;
+  run_test_params_arr[2].name = UNITY_TOKENIZE("testInt64ArrayNotWithinDelta");
+  run_test_params_arr[2].line_num = 65;
+  run_test_params_arr[3].func = testInt64ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("testInt64ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[3].line_num = 79;
+  run_test_params_arr[4].func = testInt64ArrayWithinDeltaPointless;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaPointless");
+  run_test_params_arr[4].line_num = 93;
+  run_test_params_arr[5].func = testInt64ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[5].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[5].line_num = 107;
+  run_test_params_arr[6].func = testInt64ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[6].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[6].line_num = 121;
+  run_test_params_arr[7].func = testInt64ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[7].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[7].line_num = 134;
+  run_test_params_arr[8].func = testInt64ArrayWithinDeltaActualNull;
+  run_test_params_arr[8].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaActualNull");
+  run_test_params_arr[8].line_num = 147;
+  run_test_params_arr[9].func = testInt64ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[9].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[9].line_num = 160;
+  run_test_params_arr[10].func = testInt64ArrayWithinDeltaSamePointer;
+  run_test_params_arr[10].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaSamePointer");
+  run_test_params_arr[10].line_num = 173;
+  run_test_params_arr[11].func = testInt64ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[11].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[11].line_num = 184;
+  run_test_params_arr[12].func = testIntArrayWithinDelta;
+  run_test_params_arr[12].name = UNITY_TOKENIZE("testIntArrayWithinDelta");
+  run_test_params_arr[12].line_num = 195;
+  run_test_params_arr[13].func = testIntArrayWithinDeltaAndMessage;
+  run_test_params_arr[13].name = UNITY_TOKENIZE("testIntArrayWithinDeltaAndMessage");
+  run_test_params_arr[13].line_num = 205;
+  run_test_params_arr[14].func = testIntArrayNotWithinDelta;
+  run_test_params_arr[14].name = UNITY_TOKENIZE("testIntArrayNotWithinDelta");
+  run_test_params_arr[14].line_num = 215;
+  run_test_params_arr[15].func = testIntArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[15].name = UNITY_TOKENIZE("testIntArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[15].line_num = 225;
+  run_test_params_arr[16].func = testIntArrayWithinDeltaPointless;
+  run_test_params_arr[16].name = UNITY_TOKENIZE("testIntArrayWithinDeltaPointless");
+  run_test_params_arr[16].line_num = 235;
+  run_test_params_arr[17].func = testIntArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[17].name = UNITY_TOKENIZE("testIntArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[17].line_num = 245;
+  run_test_params_arr[18].func = testIntArrayWithinDeltaExpectedNull;
+  run_test_params_arr[18].name = UNITY_TOKENIZE("testIntArrayWithinDeltaExpectedNull");
+  run_test_params_arr[18].line_num = 255;
+  run_test_params_arr[19].func = testIntArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[19].name = UNITY_TOKENIZE("testIntArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[19].line_num = 264;
+  run_test_params_arr[20].func = testIntArrayWithinDeltaActualNull;
+  run_test_params_arr[20].name = UNITY_TOKENIZE("testIntArrayWithinDeltaActualNull");
+  run_test_params_arr[20].line_num = 273;
+  run_test_params_arr[21].func = testIntArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[21].name = UNITY_TOKENIZE("testIntArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[21].line_num = 282;
+  run_test_params_arr[22].func = testIntArrayWithinDeltaSamePointer;
+  run_test_params_arr[22].name = UNITY_TOKENIZE("testIntArrayWithinDeltaSamePointer");
+  run_test_params_arr[22].line_num = 291;
+  run_test_params_arr[23].func = testIntArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[23].name = UNITY_TOKENIZE("testIntArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[23].line_num = 298;
+  run_test_params_arr[24].func = testInt16ArrayWithinDelta;
+  run_test_params_arr[24].name = UNITY_TOKENIZE("testInt16ArrayWithinDelta");
+  run_test_params_arr[24].line_num = 305;
+  run_test_params_arr[25].func = testInt16ArrayWithinDeltaAndMessage;
+  run_test_params_arr[25].name = UNITY_TOKENIZE("testInt16ArrayWithinDeltaAndMessage");
+  run_test_params_arr[25].line_num = 315;
+  run_test_params_arr[26].func = testInt16ArrayNotWithinDelta;
+  run_test_params_arr[26].name = UNITY_TOKENIZE("testInt16ArrayNotWithinDelta");
+  run_test_params_arr[26].line_num = 325;
+  run_test_params_arr[27].func = testInt16ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[27].name = UNITY_TOKENIZE("testInt16ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[27].line_num = 335;
+  run_test_params_arr[28].func = testInt16ArrayWithinDeltaPointless;
+  run_test_params_arr[28].name = UNITY_TOKENIZE("testInt16ArrayWithinDeltaPointless");
+  run_test_params_arr[28].line_num = 345;
+  run_test_params_arr[29].func = testInt16ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[29].name = UNITY_TOKENIZE("testInt16ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[29].line_num = 355;
+  run_test_params_arr[30].func = testInt16ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[30].name = UNITY_TOKENIZE("testInt16ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[30].line_num = 365;
+  run_test_params_arr[31].func = testInt16ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[31].name = UNITY_TOKENIZE("testInt16ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[31].line_num = 374;
+  run_test_params_arr[32].func = testInt16ArrayWithinDeltaActualNull;
+  run_test_params_arr[32].name = UNITY_TOKENIZE("testInt16ArrayWithinDeltaActualNull");
+  run_test_params_arr[32].line_num = 383;
+  run_test_params_arr[33].func = testInt16ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[33].name = UNITY_TOKENIZE("testInt16ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[33].line_num = 392;
+  run_test_params_arr[34].func = testInt16ArrayWithinDeltaSamePointer;
+  run_test_params_arr[34].name = UNITY_TOKENIZE("testInt16ArrayWithinDeltaSamePointer");
+  run_test_params_arr[34].line_num = 401;
+  run_test_params_arr[35].func = testInt16ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[35].name = UNITY_TOKENIZE("testInt16ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[35].line_num = 408;
+  run_test_params_arr[36].func = testInt8ArrayWithinDelta;
+  run_test_params_arr[36].name = UNITY_TOKENIZE("testInt8ArrayWithinDelta");
+  run_test_params_arr[36].line_num = 415;
+  run_test_params_arr[37].func = testInt8ArrayWithinDeltaAndMessage;
+  run_test_params_arr[37].name = UNITY_TOKENIZE("testInt8ArrayWithinDeltaAndMessage");
+  run_test_params_arr[37].line_num = 425;
+  run_test_params_arr[38].func = testInt8ArrayNotWithinDelta;
+  run_test_params_arr[38].name = UNITY_TOKENIZE("testInt8ArrayNotWithinDelta");
+  run_test_params_arr[38].line_num = 435;
+  run_test_params_arr[39].func = testInt8ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[39].name = UNITY_TOKENIZE("testInt8ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[39].line_num = 445;
+  run_test_params_arr[40].func = testInt8ArrayWithinDeltaPointless;
+  run_test_params_arr[40].name = UNITY_TOKENIZE("testInt8ArrayWithinDeltaPointless");
+  run_test_params_arr[40].line_num = 455;
+  run_test_params_arr[41].func = testInt8ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[41].name = UNITY_TOKENIZE("testInt8ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[41].line_num = 465;
+  run_test_params_arr[42].func = testInt8ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[42].name = UNITY_TOKENIZE("testInt8ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[42].line_num = 475;
+  run_test_params_arr[43].func = testInt8ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[43].name = UNITY_TOKENIZE("testInt8ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[43].line_num = 484;
+  run_test_params_arr[44].func = testInt8ArrayWithinDeltaActualNull;
+  run_test_params_arr[44].name = UNITY_TOKENIZE("testInt8ArrayWithinDeltaActualNull");
+  run_test_params_arr[44].line_num = 493;
+  run_test_params_arr[45].func = testInt8ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[45].name = UNITY_TOKENIZE("testInt8ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[45].line_num = 502;
+  run_test_params_arr[46].func = testInt8ArrayWithinDeltaSamePointer;
+  run_test_params_arr[46].name = UNITY_TOKENIZE("testInt8ArrayWithinDeltaSamePointer");
+  run_test_params_arr[46].line_num = 511;
+  run_test_params_arr[47].func = testInt8ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[47].name = UNITY_TOKENIZE("testInt8ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[47].line_num = 518;
+  run_test_params_arr[48].func = testCHARArrayWithinDelta;
+  run_test_params_arr[48].name = UNITY_TOKENIZE("testCHARArrayWithinDelta");
+  run_test_params_arr[48].line_num = 525;
+  run_test_params_arr[49].func = testCHARArrayWithinDeltaAndMessage;
+  run_test_params_arr[49].name = UNITY_TOKENIZE("testCHARArrayWithinDeltaAndMessage");
+  run_test_params_arr[49].line_num = 535;
+  run_test_params_arr[50].func = testCHARArrayNotWithinDelta;
+  run_test_params_arr[50].name = UNITY_TOKENIZE("testCHARArrayNotWithinDelta");
+  run_test_params_arr[50].line_num = 545;
+  run_test_params_arr[51].func = testCHARArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[51].name = UNITY_TOKENIZE("testCHARArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[51].line_num = 555;
+  run_test_params_arr[52].func = testCHARArrayWithinDeltaPointless;
+  run_test_params_arr[52].name = UNITY_TOKENIZE("testCHARArrayWithinDeltaPointless");
+  run_test_params_arr[52].line_num = 565;
+  run_test_params_arr[53].func = testCHARArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[53].name = UNITY_TOKENIZE("testCHARArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[53].line_num = 575;
+  run_test_params_arr[54].func = testCHARArrayWithinDeltaExpectedNull;
+  run_test_params_arr[54].name = UNITY_TOKENIZE("testCHARArrayWithinDeltaExpectedNull");
+  run_test_params_arr[54].line_num = 585;
+  run_test_params_arr[55].func = testCHARArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[55].name = UNITY_TOKENIZE("testCHARArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[55].line_num = 594;
+  run_test_params_arr[56].func = testCHARArrayWithinDeltaActualNull;
+  run_test_params_arr[56].name = UNITY_TOKENIZE("testCHARArrayWithinDeltaActualNull");
+  run_test_params_arr[56].line_num = 603;
+  run_test_params_arr[57].func = testCHARArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[57].name = UNITY_TOKENIZE("testCHARArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[57].line_num = 612;
+  run_test_params_arr[58].func = testCHARArrayWithinDeltaSamePointer;
+  run_test_params_arr[58].name = UNITY_TOKENIZE("testCHARArrayWithinDeltaSamePointer");
+  run_test_params_arr[58].line_num = 621;
+  run_test_params_arr[59].func = testCHARArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[59].name = UNITY_TOKENIZE("testCHARArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[59].line_num = 628;
+  run_test_params_arr[60].func = testUInt64ArrayWithinDelta;
+  run_test_params_arr[60].name = UNITY_TOKENIZE("testUInt64ArrayWithinDelta");
+  run_test_params_arr[60].line_num = 635;
+  run_test_params_arr[61].func = testUInt64ArrayWithinDeltaAndMessage;
+  run_test_params_arr[61].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaAndMessage");
+  run_test_params_arr[61].line_num = 649;
+  run_test_params_arr[62].func = testUInt64ArrayNotWithinDelta;
+  run_test_params_arr[62].name = UNITY_TOKENIZE("testUInt64ArrayNotWithinDelta");
+  run_test_params_arr[62].line_num = 663;
+  run_test_params_arr[63].func = testUInt64ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[63].name = UNITY_TOKENIZE("testUInt64ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[63].line_num = 677;
+  run_test_params_arr[64].func = testUInt64ArrayWithinDeltaPointless;
+  run_test_params_arr[64].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaPointless");
+  run_test_params_arr[64].line_num = 691;
+  run_test_params_arr[65].func = testUInt64ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[65].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[65].line_num = 705;
+  run_test_params_arr[66].func = testUInt64ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[66].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[66].line_num = 719;
+  run_test_params_arr[67].func = testUInt64ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[67].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[67].line_num = 732;
+  run_test_params_arr[68].func = testUInt64ArrayWithinDeltaActualNull;
+  run_test_params_arr[68].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaActualNull");
+  run_test_params_arr[68].line_num = 745;
+  run_test_params_arr[69].func = testUInt64ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[69].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[69].line_num = 758;
+  run_test_params_arr[70].func = testUInt64ArrayWithinDeltaSamePointer;
+  run_test_params_arr[70].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaSamePointer");
+  run_test_params_arr[70].line_num = 771;
+  run_test_params_arr[71].func = testUInt64ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[71].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[71].line_num = 782;
+  run_test_params_arr[72].func = testUIntArrayWithinDelta;
+  run_test_params_arr[72].name = UNITY_TOKENIZE("testUIntArrayWithinDelta");
+  run_test_params_arr[72].line_num = 793;
+  run_test_params_arr[73].func = testUIntArrayWithinDeltaAndMessage;
+  run_test_params_arr[73].name = UNITY_TOKENIZE("testUIntArrayWithinDeltaAndMessage");
+  run_test_params_arr[73].line_num = 803;
+  run_test_params_arr[74].func = testUIntArrayNotWithinDelta;
+  run_test_params_arr[74].name = UNITY_TOKENIZE("testUIntArrayNotWithinDelta");
+  run_test_params_arr[74].line_num = 813;
+  run_test_params_arr[75].func = testUIntArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[75].name = UNITY_TOKENIZE("testUIntArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[75].line_num = 823;
+  run_test_params_arr[76].func = testUIntArrayWithinDeltaPointless;
+  run_test_params_arr[76].name = UNITY_TOKENIZE("testUIntArrayWithinDeltaPointless");
+  run_test_params_arr[76].line_num = 833;
+  run_test_params_arr[77].func = testUIntArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[77].name = UNITY_TOKENIZE("testUIntArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[77].line_num = 843;
+  run_test_params_arr[78].func = testUIntArrayWithinDeltaExpectedNull;
+  run_test_params_arr[78].name = UNITY_TOKENIZE("testUIntArrayWithinDeltaExpectedNull");
+  run_test_params_arr[78].line_num = 853;
+  run_test_params_arr[79].func = testUIntArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[79].name = UNITY_TOKENIZE("testUIntArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[79].line_num = 862;
+  run_test_params_arr[80].func = testUIntArrayWithinDeltaActualNull;
+  run_test_params_arr[80].name = UNITY_TOKENIZE("testUIntArrayWithinDeltaActualNull");
+  run_test_params_arr[80].line_num = 871;
+  run_test_params_arr[81].func = testUIntArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[81].name = UNITY_TOKENIZE("testUIntArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[81].line_num = 880;
+  run_test_params_arr[82].func = testUIntArrayWithinDeltaSamePointer;
+  run_test_params_arr[82].name = UNITY_TOKENIZE("testUIntArrayWithinDeltaSamePointer");
+  run_test_params_arr[82].line_num = 889;
+  run_test_params_arr[83].func = testUIntArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[83].name = UNITY_TOKENIZE("testUIntArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[83].line_num = 896;
+  run_test_params_arr[84].func = testUInt16ArrayWithinDelta;
+  run_test_params_arr[84].name = UNITY_TOKENIZE("testUInt16ArrayWithinDelta");
+  run_test_params_arr[84].line_num = 903;
+  run_test_params_arr[85].func = testUInt16ArrayWithinDeltaAndMessage;
+  run_test_params_arr[85].name = UNITY_TOKENIZE("testUInt16ArrayWithinDeltaAndMessage");
+  run_test_params_arr[85].line_num = 913;
+  run_test_params_arr[86].func = testUInt16ArrayNotWithinDelta;
+  run_test_params_arr[86].name = UNITY_TOKENIZE("testUInt16ArrayNotWithinDelta");
+  run_test_params_arr[86].line_num = 923;
+  run_test_params_arr[87].func = testUInt16ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[87].name = UNITY_TOKENIZE("testUInt16ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[87].line_num = 933;
+  run_test_params_arr[88].func = testUInt16ArrayWithinDeltaPointless;
+  run_test_params_arr[88].name = UNITY_TOKENIZE("testUInt16ArrayWithinDeltaPointless");
+  run_test_params_arr[88].line_num = 943;
+  run_test_params_arr[89].func = testUInt16ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[89].name = UNITY_TOKENIZE("testUInt16ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[89].line_num = 953;
+  run_test_params_arr[90].func = testUInt16ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[90].name = UNITY_TOKENIZE("testUInt16ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[90].line_num = 963;
+  run_test_params_arr[91].func = testUInt16ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[91].name = UNITY_TOKENIZE("testUInt16ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[91].line_num = 972;
+  run_test_params_arr[92].func = testUInt16ArrayWithinDeltaActualNull;
+  run_test_params_arr[92].name = UNITY_TOKENIZE("testUInt16ArrayWithinDeltaActualNull");
+  run_test_params_arr[92].line_num = 981;
+  run_test_params_arr[93].func = testUInt16ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[93].name = UNITY_TOKENIZE("testUInt16ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[93].line_num = 990;
+  run_test_params_arr[94].func = testUInt16ArrayWithinDeltaSamePointer;
+  run_test_params_arr[94].name = UNITY_TOKENIZE("testUInt16ArrayWithinDeltaSamePointer");
+  run_test_params_arr[94].line_num = 999;
+  run_test_params_arr[95].func = testUInt16ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[95].name = UNITY_TOKENIZE("testUInt16ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[95].line_num = 1006;
+  run_test_params_arr[96].func = testUInt8ArrayWithinDelta;
+  run_test_params_arr[96].name = UNITY_TOKENIZE("testUInt8ArrayWithinDelta");
+  run_test_params_arr[96].line_num = 1013;
+  run_test_params_arr[97].func = testUInt8ArrayWithinDeltaAndMessage;
+  run_test_params_arr[97].name = UNITY_TOKENIZE("testUInt8ArrayWithinDeltaAndMessage");
+  run_test_params_arr[97].line_num = 1023;
+  run_test_params_arr[98].func = testUInt8ArrayNotWithinDelta;
+  run_test_params_arr[98].name = UNITY_TOKENIZE("testUInt8ArrayNotWithinDelta");
+  run_test_params_arr[98].line_num = 1033;
+  run_test_params_arr[99].func = testUInt8ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[99].name = UNITY_TOKENIZE("testUInt8ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[99].line_num = 1043;
+  run_test_params_arr[100].func = testUInt8ArrayWithinDeltaPointless;
+  run_test_params_arr[100].name = UNITY_TOKENIZE("testUInt8ArrayWithinDeltaPointless");
+  run_test_params_arr[100].line_num = 1053;
+  run_test_params_arr[101].func = testUInt8ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[101].name = UNITY_TOKENIZE("testUInt8ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[101].line_num = 1063;
+  run_test_params_arr[102].func = testUInt8ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[102].name = UNITY_TOKENIZE("testUInt8ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[102].line_num = 1073;
+  run_test_params_arr[103].func = testUInt8ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[103].name = UNITY_TOKENIZE("testUInt8ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[103].line_num = 1082;
+  run_test_params_arr[104].func = testUInt8ArrayWithinDeltaActualNull;
+  run_test_params_arr[104].name = UNITY_TOKENIZE("testUInt8ArrayWithinDeltaActualNull");
+  run_test_params_arr[104].line_num = 1091;
+  run_test_params_arr[105].func = testUInt8ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[105].name = UNITY_TOKENIZE("testUInt8ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[105].line_num = 1100;
+  run_test_params_arr[106].func = testUInt8ArrayWithinDeltaSamePointer;
+  run_test_params_arr[106].name = UNITY_TOKENIZE("testUInt8ArrayWithinDeltaSamePointer");
+  run_test_params_arr[106].line_num = 1109;
+  run_test_params_arr[107].func = testUInt8ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[107].name = UNITY_TOKENIZE("testUInt8ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[107].line_num = 1116;
+  run_test_params_arr[108].func = testHEX64ArrayWithinDelta;
+  run_test_params_arr[108].name = UNITY_TOKENIZE("testHEX64ArrayWithinDelta");
+  run_test_params_arr[108].line_num = 1123;
+  run_test_params_arr[109].func = testHEX64ArrayWithinDeltaShouldNotHaveSignIssues;
+  run_test_params_arr[109].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaShouldNotHaveSignIssues");
+  run_test_params_arr[109].line_num = 1137;
+  run_test_params_arr[110].func = testHEX64ArrayWithinDeltaAndMessage;
+  run_test_params_arr[110].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaAndMessage");
+  run_test_params_arr[110].line_num = 1149;
+  run_test_params_arr[111].func = testHEX64ArrayNotWithinDelta;
+  run_test_params_arr[111].name = UNITY_TOKENIZE("testHEX64ArrayNotWithinDelta");
+  run_test_params_arr[111].line_num = 1163;
+  run_test_params_arr[112].func = testHEX64ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[112].name = UNITY_TOKENIZE("testHEX64ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[112].line_num = 1177;
+  run_test_params_arr[113].func = testHEX64ArrayWithinDeltaPointless;
+  run_test_params_arr[113].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaPointless");
+  run_test_params_arr[113].line_num = 1191;
+  run_test_params_arr[114].func = testHEX64ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[114].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[114].line_num = 1205;
+  run_test_params_arr[115].func = testHEX64ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[115].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[115].line_num = 1219;
+  run_test_params_arr[116].func = testHEX64ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[116].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[116].line_num = 1232;
+  run_test_params_arr[117].func = testHEX64ArrayWithinDeltaActualNull;
+  run_test_params_arr[117].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaActualNull");
+  run_test_params_arr[117].line_num = 1245;
+  run_test_params_arr[118].func = testHEX64ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[118].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[118].line_num = 1258;
+  run_test_params_arr[119].func = testHEX64ArrayWithinDeltaSamePointer;
+  run_test_params_arr[119].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaSamePointer");
+  run_test_params_arr[119].line_num = 1271;
+  run_test_params_arr[120].func = testHEX64ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[120].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[120].line_num = 1282;
+  run_test_params_arr[121].func = testHEX32ArrayWithinDelta;
+  run_test_params_arr[121].name = UNITY_TOKENIZE("testHEX32ArrayWithinDelta");
+  run_test_params_arr[121].line_num = 1293;
+  run_test_params_arr[122].func = testHEX32ArrayWithinDeltaShouldNotHaveSignIssues;
+  run_test_params_arr[122].name = UNITY_TOKENIZE("testHEX32ArrayWithinDeltaShouldNotHaveSignIssues");
+  run_test_params_arr[122].line_num = 1303;
+  run_test_params_arr[123].func = testHEX32ArrayWithinDeltaAndMessage;
+  run_test_params_arr[123].name = UNITY_TOKENIZE("testHEX32ArrayWithinDeltaAndMessage");
+  run_test_params_arr[123].line_num = 1311;
+  run_test_params_arr[124].func = testHEX32ArrayNotWithinDelta;
+  run_test_params_arr[124].name = UNITY_TOKENIZE("testHEX32ArrayNotWithinDelta");
+  run_test_params_arr[124].line_num = 1321;
+  run_test_params_arr[125].func = testHEX32ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[125].name = UNITY_TOKENIZE("testHEX32ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[125].line_num = 1331;
+  run_test_params_arr[126].func = testHEX32ArrayWithinDeltaPointless;
+  run_test_params_arr[126].name = UNITY_TOKENIZE("testHEX32ArrayWithinDeltaPointless");
+  run_test_params_arr[126].line_num = 1341;
+  run_test_params_arr[127].func = testHEX32ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[127].name = UNITY_TOKENIZE("testHEX32ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[127].line_num = 1351;
+  run_test_params_arr[128].func = testHEX32ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[128].name = UNITY_TOKENIZE("testHEX32ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[128].line_num = 1361;
+  run_test_params_arr[129].func = testHEX32ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[129].name = UNITY_TOKENIZE("testHEX32ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[129].line_num = 1370;
+  run_test_params_arr[130].func = testHEX32ArrayWithinDeltaActualNull;
+  run_test_params_arr[130].name = UNITY_TOKENIZE("testHEX32ArrayWithinDeltaActualNull");
+  run_test_params_arr[130].line_num = 1379;
+  run_test_params_arr[131].func = testHEX32ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[131].name = UNITY_TOKENIZE("testHEX32ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[131].line_num = 1388;
+  run_test_params_arr[132].func = testHEX32ArrayWithinDeltaSamePointer;
+  run_test_params_arr[132].name = UNITY_TOKENIZE("testHEX32ArrayWithinDeltaSamePointer");
+  run_test_params_arr[132].line_num = 1397;
+  run_test_params_arr[133].func = testHEX32ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[133].name = UNITY_TOKENIZE("testHEX32ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[133].line_num = 1404;
+  run_test_params_arr[134].func = testHEX16ArrayWithinDelta;
+  run_test_params_arr[134].name = UNITY_TOKENIZE("testHEX16ArrayWithinDelta");
+  run_test_params_arr[134].line_num = 1412;
+  run_test_params_arr[135].func = testHEX16ArrayWithinDeltaShouldNotHaveSignIssues;
+  run_test_params_arr[135].name = UNITY_TOKENIZE("testHEX16ArrayWithinDeltaShouldNotHaveSignIssues");
+  run_test_params_arr[135].line_num = 1422;
+  run_test_params_arr[136].func = testHEX16ArrayWithinDeltaAndMessage;
+  run_test_params_arr[136].name = UNITY_TOKENIZE("testHEX16ArrayWithinDeltaAndMessage");
+  run_test_params_arr[136].line_num = 1430;
+  run_test_params_arr[137].func = testHEX16ArrayNotWithinDelta;
+  run_test_params_arr[137].name = UNITY_TOKENIZE("testHEX16ArrayNotWithinDelta");
+  run_test_params_arr[137].line_num = 1440;
+  run_test_params_arr[138].func = testHEX16ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[138].name = UNITY_TOKENIZE("testHEX16ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[138].line_num = 1450;
+  run_test_params_arr[139].func = testHEX16ArrayWithinDeltaPointless;
+  run_test_params_arr[139].name = UNITY_TOKENIZE("testHEX16ArrayWithinDeltaPointless");
+  run_test_params_arr[139].line_num = 1460;
+  run_test_params_arr[140].func = testHEX16ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[140].name = UNITY_TOKENIZE("testHEX16ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[140].line_num = 1470;
+  run_test_params_arr[141].func = testHEX16ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[141].name = UNITY_TOKENIZE("testHEX16ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[141].line_num = 1480;
+  run_test_params_arr[142].func = testHEX16ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[142].name = UNITY_TOKENIZE("testHEX16ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[142].line_num = 1489;
+  run_test_params_arr[143].func = testHEX16ArrayWithinDeltaActualNull;
+  run_test_params_arr[143].name = UNITY_TOKENIZE("testHEX16ArrayWithinDeltaActualNull");
+  run_test_params_arr[143].line_num = 1498;
+  run_test_params_arr[144].func = testHEX16ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[144].name = UNITY_TOKENIZE("testHEX16ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[144].line_num = 1507;
+  run_test_params_arr[145].func = testHEX16ArrayWithinDeltaSamePointer;
+  run_test_params_arr[145].name = UNITY_TOKENIZE("testHEX16ArrayWithinDeltaSamePointer");
+  run_test_params_arr[145].line_num = 1516;
+  run_test_params_arr[146].func = testHEX16ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[146].name = UNITY_TOKENIZE("testHEX16ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[146].line_num = 1523;
+  run_test_params_arr[147].func = testHEX8ArrayWithinDelta;
+  run_test_params_arr[147].name = UNITY_TOKENIZE("testHEX8ArrayWithinDelta");
+  run_test_params_arr[147].line_num = 1530;
+  run_test_params_arr[148].func = testHEX8ArrayWithinDeltaAndMessage;
+  run_test_params_arr[148].name = UNITY_TOKENIZE("testHEX8ArrayWithinDeltaAndMessage");
+  run_test_params_arr[148].line_num = 1540;
+  run_test_params_arr[149].func = testHEX8ArrayNotWithinDelta;
+  run_test_params_arr[149].name = UNITY_TOKENIZE("testHEX8ArrayNotWithinDelta");
+  run_test_params_arr[149].line_num = 1550;
+  run_test_params_arr[150].func = testHEX8ArrayWithinDeltaShouldNotHaveSignIssues;
+  run_test_params_arr[150].name = UNITY_TOKENIZE("testHEX8ArrayWithinDeltaShouldNotHaveSignIssues");
+  run_test_params_arr[150].line_num = 1560;
+  run_test_params_arr[151].func = testHEX8ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[151].name = UNITY_TOKENIZE("testHEX8ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[151].line_num = 1568;
+  run_test_params_arr[152].func = testHEX8ArrayWithinDeltaPointless;
+  run_test_params_arr[152].name = UNITY_TOKENIZE("testHEX8ArrayWithinDeltaPointless");
+  run_test_params_arr[152].line_num = 1578;
+  run_test_params_arr[153].func = testHEX8ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[153].name = UNITY_TOKENIZE("testHEX8ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[153].line_num = 1588;
+  run_test_params_arr[154].func = testHEX8ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[154].name = UNITY_TOKENIZE("testHEX8ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[154].line_num = 1598;
+  run_test_params_arr[155].func = testHEX8ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[155].name = UNITY_TOKENIZE("testHEX8ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[155].line_num = 1607;
+  run_test_params_arr[156].func = testHEX8ArrayWithinDeltaActualNull;
+  run_test_params_arr[156].name = UNITY_TOKENIZE("testHEX8ArrayWithinDeltaActualNull");
+  run_test_params_arr[156].line_num = 1616;
+  run_test_params_arr[157].func = testHEX8ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[157].name = UNITY_TOKENIZE("testHEX8ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[157].line_num = 1625;
+  run_test_params_arr[158].func = testHEX8ArrayWithinDeltaSamePointer;
+  run_test_params_arr[158].name = UNITY_TOKENIZE("testHEX8ArrayWithinDeltaSamePointer");
+  run_test_params_arr[158].line_num = 1634;
+  run_test_params_arr[159].func = testHEX8ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[159].name = UNITY_TOKENIZE("testHEX8ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[159].line_num = 1641;
+  run_test_params_arr[160].func = testEqualIntArrays;
+  run_test_params_arr[160].name = UNITY_TOKENIZE("testEqualIntArrays");
+  run_test_params_arr[160].line_num = 1648;
+  run_test_params_arr[161].func = testNotEqualIntArraysNullExpected;
+  run_test_params_arr[161].name = UNITY_TOKENIZE("testNotEqualIntArraysNullExpected");
+  run_test_params_arr[161].line_num = 1663;
+  run_test_params_arr[162].func = testNotEqualIntArraysNullActual;
+  run_test_params_arr[162].name = UNITY_TOKENIZE("testNotEqualIntArraysNullActual");
+  run_test_params_arr[162].line_num = 1673;
+  run_test_params_arr[163].func = testNotEqualIntArrays1;
+  run_test_params_arr[163].name = UNITY_TOKENIZE("testNotEqualIntArrays1");
+  run_test_params_arr[163].line_num = 1683;
+  run_test_params_arr[164].func = testNotEqualIntArrays2;
+  run_test_params_arr[164].name = UNITY_TOKENIZE("testNotEqualIntArrays2");
+  run_test_params_arr[164].line_num = 1693;
+  run_test_params_arr[165].func = testNotEqualIntArrays3;
+  run_test_params_arr[165].name = UNITY_TOKENIZE("testNotEqualIntArrays3");
+  run_test_params_arr[165].line_num = 1703;
+  run_test_params_arr[166].func = testNotEqualIntArraysLengthZero;
+  run_test_params_arr[166].name = UNITY_TOKENIZE("testNotEqualIntArraysLengthZero");
+  run_test_params_arr[166].line_num = 1713;
+  run_test_params_arr[167].func = testEqualIntEachEqual;
+  run_test_params_arr[167].name = UNITY_TOKENIZE("testEqualIntEachEqual");
+  run_test_params_arr[167].line_num = 1723;
+  run_test_params_arr[168].func = testNotEqualIntEachEqualNullActual;
+  run_test_params_arr[168].name = UNITY_TOKENIZE("testNotEqualIntEachEqualNullActual");
+  run_test_params_arr[168].line_num = 1737;
+  run_test_params_arr[169].func = testNotEqualIntEachEqual1;
+  run_test_params_arr[169].name = UNITY_TOKENIZE("testNotEqualIntEachEqual1");
+  run_test_params_arr[169].line_num = 1746;
+  run_test_params_arr[170].func = testNotEqualIntEachEqual2;
+  run_test_params_arr[170].name = UNITY_TOKENIZE("testNotEqualIntEachEqual2");
+  run_test_params_arr[170].line_num = 1755;
+  run_test_params_arr[171].func = testNotEqualIntEachEqual3;
+  run_test_params_arr[171].name = UNITY_TOKENIZE("testNotEqualIntEachEqual3");
+  run_test_params_arr[171].line_num = 1764;
+  run_test_params_arr[172].func = testNotEqualEachEqualLengthZero;
+  run_test_params_arr[172].name = UNITY_TOKENIZE("testNotEqualEachEqualLengthZero");
+  run_test_params_arr[172].line_num = 1773;
+  run_test_params_arr[173].func = testEqualPtrArrays;
+  run_test_params_arr[173].name = UNITY_TOKENIZE("testEqualPtrArrays");
+  run_test_params_arr[173].line_num = 1782;
+  run_test_params_arr[174].func = testNotEqualPtrArraysNullExpected;
+  run_test_params_arr[174].name = UNITY_TOKENIZE("testNotEqualPtrArraysNullExpected");
+  run_test_params_arr[174].line_num = 1799;
+  run_test_params_arr[175].func = testNotEqualPtrArraysNullActual;
+  run_test_params_arr[175].name = UNITY_TOKENIZE("testNotEqualPtrArraysNullActual");
+  run_test_params_arr[175].line_num = 1811;
+  run_test_params_arr[176].func = testNotEqualPtrArrays1;
+  run_test_params_arr[176].name = UNITY_TOKENIZE("testNotEqualPtrArrays1");
+  run_test_params_arr[176].line_num = 1823;
+  run_test_params_arr[177].func = testNotEqualPtrArrays2;
+  run_test_params_arr[177].name = UNITY_TOKENIZE("testNotEqualPtrArrays2");
+  run_test_params_arr[177].line_num = 1836;
+  run_test_params_arr[178].func = testNotEqualPtrArrays3;
+  run_test_params_arr[178].name = UNITY_TOKENIZE("testNotEqualPtrArrays3");
+  run_test_params_arr[178].line_num = 1849;
+  run_test_params_arr[179].func = testEqualPtrEachEqual;
+  run_test_params_arr[179].name = UNITY_TOKENIZE("testEqualPtrEachEqual");
+  run_test_params_arr[179].line_num = 1862;
+  run_test_params_arr[180].func = testNotEqualPtrEachEqualNullExpected;
+  run_test_params_arr[180].name = UNITY_TOKENIZE("testNotEqualPtrEachEqualNullExpected");
+  run_test_params_arr[180].line_num = 1879;
+  run_test_params_arr[181].func = testNotEqualPtrEachEqualNullActual;
+  run_test_params_arr[181].name = UNITY_TOKENIZE("testNotEqualPtrEachEqualNullActual");
+  run_test_params_arr[181].line_num = 1890;
+  run_test_params_arr[182].func = testNotEqualPtrEachEqual1;
+  run_test_params_arr[182].name = UNITY_TOKENIZE("testNotEqualPtrEachEqual1");
+  run_test_params_arr[182].line_num = 1900;
+  run_test_params_arr[183].func = testNotEqualPtrEachEqual2;
+  run_test_params_arr[183].name = UNITY_TOKENIZE("testNotEqualPtrEachEqual2");
+  run_test_params_arr[183].line_num = 1911;
+  run_test_params_arr[184].func = testNotEqualPtrEachEqual3;
+  run_test_params_arr[184].name = UNITY_TOKENIZE("testNotEqualPtrEachEqual3");
+  run_test_params_arr[184].line_num = 1922;
+  run_test_params_arr[185].func = testEqualInt8Arrays;
+  run_test_params_arr[185].name = UNITY_TOKENIZE("testEqualInt8Arrays");
+  run_test_params_arr[185].line_num = 1933;
+  run_test_params_arr[186].func = testNotEqualInt8Arrays;
+  run_test_params_arr[186].name = UNITY_TOKENIZE("testNotEqualInt8Arrays");
+  run_test_params_arr[186].line_num = 1947;
+  run_test_params_arr[187].func = testEqualInt8EachEqual;
+  run_test_params_arr[187].name = UNITY_TOKENIZE("testEqualInt8EachEqual");
+  run_test_params_arr[187].line_num = 1957;
+  run_test_params_arr[188].func = testNotEqualInt8EachEqual;
+  run_test_params_arr[188].name = UNITY_TOKENIZE("testNotEqualInt8EachEqual");
+  run_test_params_arr[188].line_num = 1971;
+  run_test_params_arr[189].func = testEqualCHARArrays;
+  run_test_params_arr[189].name = UNITY_TOKENIZE("testEqualCHARArrays");
+  run_test_params_arr[189].line_num = 1980;
+  run_test_params_arr[190].func = testNotEqualCHARArrays;
+  run_test_params_arr[190].name = UNITY_TOKENIZE("testNotEqualCHARArrays");
+  run_test_params_arr[190].line_num = 1994;
+  run_test_params_arr[191].func = testEqualCHAREachEqual;
+  run_test_params_arr[191].name = UNITY_TOKENIZE("testEqualCHAREachEqual");
+  run_test_params_arr[191].line_num = 2004;
+  run_test_params_arr[192].func = testNotEqualCHAREachEqual;
+  run_test_params_arr[192].name = UNITY_TOKENIZE("testNotEqualCHAREachEqual");
+  run_test_params_arr[192].line_num = 2018;
+  run_test_params_arr[193].func = testEqualUIntArrays;
+  run_test_params_arr[193].name = UNITY_TOKENIZE("testEqualUIntArrays");
+  run_test_params_arr[193].line_num = 2027;
+  run_test_params_arr[194].func = testNotEqualUIntArrays1;
+  run_test_params_arr[194].name = UNITY_TOKENIZE("testNotEqualUIntArrays1");
+  run_test_params_arr[194].line_num = 2041;
+  run_test_params_arr[195].func = testNotEqualUIntArrays2;
+  run_test_params_arr[195].name = UNITY_TOKENIZE("testNotEqualUIntArrays2");
+  run_test_params_arr[195].line_num = 2051;
+  run_test_params_arr[196].func = testNotEqualUIntArrays3;
+  run_test_params_arr[196].name = UNITY_TOKENIZE("testNotEqualUIntArrays3");
+  run_test_params_arr[196].line_num = 2061;
+  run_test_params_arr[197].func = testEqualUIntEachEqual;
+  run_test_params_arr[197].name = UNITY_TOKENIZE("testEqualUIntEachEqual");
+  run_test_params_arr[197].line_num = 2071;
+  run_test_params_arr[198].func = testNotEqualUIntEachEqual1;
+  run_test_params_arr[198].name = UNITY_TOKENIZE("testNotEqualUIntEachEqual1");
+  run_test_params_arr[198].line_num = 2085;
+  run_test_params_arr[199].func = testNotEqualUIntEachEqual2;
+  run_test_params_arr[199].name = UNITY_TOKENIZE("testNotEqualUIntEachEqual2");
+  run_test_params_arr[199].line_num = 2094;
+  run_test_params_arr[200].func = testNotEqualUIntEachEqual3;
+  run_test_params_arr[200].name = UNITY_TOKENIZE("testNotEqualUIntEachEqual3");
+  run_test_params_arr[200].line_num = 2103;
+  run_test_params_arr[201].func = testEqualInt16Arrays;
+  run_test_params_arr[201].name = UNITY_TOKENIZE("testEqualInt16Arrays");
+  run_test_params_arr[201].line_num = 2112;
+  run_test_params_arr[202].func = testNotEqualInt16Arrays;
+  run_test_params_arr[202].name = UNITY_TOKENIZE("testNotEqualInt16Arrays");
+  run_test_params_arr[202].line_num = 2126;
+  run_test_params_arr[203].func = testEqualInt16EachEqual;
+  run_test_params_arr[203].name = UNITY_TOKENIZE("testEqualInt16EachEqual");
+  run_test_params_arr[203].line_num = 2136;
+  run_test_params_arr[204].func = testNotEqualInt16EachEqual;
+  run_test_params_arr[204].name = UNITY_TOKENIZE("testNotEqualInt16EachEqual");
+  run_test_params_arr[204].line_num = 2150;
+  run_test_params_arr[205].func = testEqualInt32Arrays;
+  run_test_params_arr[205].name = UNITY_TOKENIZE("testEqualInt32Arrays");
+  run_test_params_arr[205].line_num = 2159;
+  run_test_params_arr[206].func = testNotEqualInt32Arrays;
+  run_test_params_arr[206].name = UNITY_TOKENIZE("testNotEqualInt32Arrays");
+  run_test_params_arr[206].line_num = 2173;
+  run_test_params_arr[207].func = testEqualInt32EachEqual;
+  run_test_params_arr[207].name = UNITY_TOKENIZE("testEqualInt32EachEqual");
+  run_test_params_arr[207].line_num = 2183;
+  run_test_params_arr[208].func = testNotEqualInt32EachEqual;
+  run_test_params_arr[208].name = UNITY_TOKENIZE("testNotEqualInt32EachEqual");
+  run_test_params_arr[208].line_num = 2197;
+  run_test_params_arr[209].func = testEqualUINT8Arrays;
+  run_test_params_arr[209].name = UNITY_TOKENIZE("testEqualUINT8Arrays");
+  run_test_params_arr[209].line_num = 2206;
+  run_test_params_arr[210].func = testNotEqualUINT8Arrays1;
+  run_test_params_arr[210].name = UNITY_TOKENIZE("testNotEqualUINT8Arrays1");
+  run_test_params_arr[210].line_num = 2220;
+  run_test_params_arr[211].func = testNotEqualUINT8Arrays2;
+  run_test_params_arr[211].name = UNITY_TOKENIZE("testNotEqualUINT8Arrays2");
+  run_test_params_arr[211].line_num = 2230;
+  run_test_params_arr[212].func = testNotEqualUINT8Arrays3;
+  run_test_params_arr[212].name = UNITY_TOKENIZE("testNotEqualUINT8Arrays3");
+  run_test_params_arr[212].line_num = 2240;
+  run_test_params_arr[213].func = testEqualUINT16Arrays;
+  run_test_params_arr[213].name = UNITY_TOKENIZE("testEqualUINT16Arrays");
+  run_test_params_arr[213].line_num = 2251;
+  run_test_params_arr[214].func = testNotEqualUINT16Arrays1;
+  run_test_params_arr[214].name = UNITY_TOKENIZE("testNotEqualUINT16Arrays1");
+  run_test_params_arr[214].line_num = 2265;
+  run_test_params_arr[215].func = testNotEqualUINT16Arrays2;
+  run_test_params_arr[215].name = UNITY_TOKENIZE("testNotEqualUINT16Arrays2");
+  run_test_params_arr[215].line_num = 2275;
+  run_test_params_arr[216].func = testNotEqualUINT16Arrays3;
+  run_test_params_arr[216].name = UNITY_TOKENIZE("testNotEqualUINT16Arrays3");
+  run_test_params_arr[216].line_num = 2285;
+  run_test_params_arr[217].func = testEqualUINT32Arrays;
+  run_test_params_arr[217].name = UNITY_TOKENIZE("testEqualUINT32Arrays");
+  run_test_params_arr[217].line_num = 2295;
+  run_test_params_arr[218].func = testNotEqualUINT32Arrays1;
+  run_test_params_arr[218].name = UNITY_TOKENIZE("testNotEqualUINT32Arrays1");
+  run_test_params_arr[218].line_num = 2309;
+  run_test_params_arr[219].func = testNotEqualUINT32Arrays2;
+  run_test_params_arr[219].name = UNITY_TOKENIZE("testNotEqualUINT32Arrays2");
+  run_test_params_arr[219].line_num = 2319;
+  run_test_params_arr[220].func = testNotEqualUINT32Arrays3;
+  run_test_params_arr[220].name = UNITY_TOKENIZE("testNotEqualUINT32Arrays3");
+  run_test_params_arr[220].line_num = 2329;
+  run_test_params_arr[221].func = testEqualHEXArrays;
+  run_test_params_arr[221].name = UNITY_TOKENIZE("testEqualHEXArrays");
+  run_test_params_arr[221].line_num = 2339;
+  run_test_params_arr[222].func = testNotEqualHEXArrays1;
+  run_test_params_arr[222].name = UNITY_TOKENIZE("testNotEqualHEXArrays1");
+  run_test_params_arr[222].line_num = 2353;
+  run_test_params_arr[223].func = testNotEqualHEXArrays2;
+  run_test_params_arr[223].name = UNITY_TOKENIZE("testNotEqualHEXArrays2");
+  run_test_params_arr[223].line_num = 2363;
+  run_test_params_arr[224].func = testNotEqualHEXArrays3;
+  run_test_params_arr[224].name = UNITY_TOKENIZE("testNotEqualHEXArrays3");
+  run_test_params_arr[224].line_num = 2373;
+  run_test_params_arr[225].func = testEqualHEX32Arrays;
+  run_test_params_arr[225].name = UNITY_TOKENIZE("testEqualHEX32Arrays");
+  run_test_params_arr[225].line_num = 2383;
+  run_test_params_arr[226].func = testNotEqualHEX32Arrays1;
+  run_test_params_arr[226].name = UNITY_TOKENIZE("testNotEqualHEX32Arrays1");
+  run_test_params_arr[226].line_num = 2397;
+  run_test_params_arr[227].func = testNotEqualHEX32Arrays2;
+  run_test_params_arr[227].name = UNITY_TOKENIZE("testNotEqualHEX32Arrays2");
+  run_test_params_arr[227].line_num = 2407;
+  run_test_params_arr[228].func = testNotEqualHEX32Arrays3;
+  run_test_params_arr[228].name = UNITY_TOKENIZE("testNotEqualHEX32Arrays3");
+  run_test_params_arr[228].line_num = 2417;
+  run_test_params_arr[229].func = testEqualHEX16Arrays;
+  run_test_params_arr[229].name = UNITY_TOKENIZE("testEqualHEX16Arrays");
+  run_test_params_arr[229].line_num = 2427;
+  run_test_params_arr[230].func = testNotEqualHEX16Arrays1;
+  run_test_params_arr[230].name = UNITY_TOKENIZE("testNotEqualHEX16Arrays1");
+  run_test_params_arr[230].line_num = 2441;
+  run_test_params_arr[231].func = testNotEqualHEX16Arrays2;
+  run_test_params_arr[231].name = UNITY_TOKENIZE("testNotEqualHEX16Arrays2");
+  run_test_params_arr[231].line_num = 2451;
+  run_test_params_arr[232].func = testNotEqualHEX16Arrays3;
+  run_test_params_arr[232].name = UNITY_TOKENIZE("testNotEqualHEX16Arrays3");
+  run_test_params_arr[232].line_num = 2461;
+  run_test_params_arr[233].func = testEqualHEX8Arrays;
+  run_test_params_arr[233].name = UNITY_TOKENIZE("testEqualHEX8Arrays");
+  run_test_params_arr[233].line_num = 2471;
+  run_test_params_arr[234].func = testNotEqualHEX8Arrays1;
+  run_test_params_arr[234].name = UNITY_TOKENIZE("testNotEqualHEX8Arrays1");
+  run_test_params_arr[234].line_num = 2485;
+  run_test_params_arr[235].func = testNotEqualHEX8Arrays2;
+  run_test_params_arr[235].name = UNITY_TOKENIZE("testNotEqualHEX8Arrays2");
+  run_test_params_arr[235].line_num = 2495;
+  run_test_params_arr[236].func = testNotEqualHEX8Arrays3;
+  run_test_params_arr[236].name = UNITY_TOKENIZE("testNotEqualHEX8Arrays3");
+  run_test_params_arr[236].line_num = 2505;
+  run_test_params_arr[237].func = testEqualUINT8EachEqual;
+  run_test_params_arr[237].name = UNITY_TOKENIZE("testEqualUINT8EachEqual");
+  run_test_params_arr[237].line_num = 2515;
+  run_test_params_arr[238].func = testNotEqualUINT8EachEqual1;
+  run_test_params_arr[238].name = UNITY_TOKENIZE("testNotEqualUINT8EachEqual1");
+  run_test_params_arr[238].line_num = 2529;
+  run_test_params_arr[239].func = testNotEqualUINT8EachEqual2;
+  run_test_params_arr[239].name = UNITY_TOKENIZE("testNotEqualUINT8EachEqual2");
+  run_test_params_arr[239].line_num = 2538;
+  run_test_params_arr[240].func = testNotEqualUINT8EachEqual3;
+  run_test_params_arr[240].name = UNITY_TOKENIZE("testNotEqualUINT8EachEqual3");
+  run_test_params_arr[240].line_num = 2547;
+  run_test_params_arr[241].func = testEqualUINT16EachEqual;
+  run_test_params_arr[241].name = UNITY_TOKENIZE("testEqualUINT16EachEqual");
+  run_test_params_arr[241].line_num = 2556;
+  run_test_params_arr[242].func = testNotEqualUINT16EachEqual1;
+  run_test_params_arr[242].name = UNITY_TOKENIZE("testNotEqualUINT16EachEqual1");
+  run_test_params_arr[242].line_num = 2570;
+  run_test_params_arr[243].func = testNotEqualUINT16EachEqual2;
+  run_test_params_arr[243].name = UNITY_TOKENIZE("testNotEqualUINT16EachEqual2");
+  run_test_params_arr[243].line_num = 2579;
+  run_test_params_arr[244].func = testNotEqualUINT16EachEqual3;
+  run_test_params_arr[244].name = UNITY_TOKENIZE("testNotEqualUINT16EachEqual3");
+  run_test_params_arr[244].line_num = 2588;
+  run_test_params_arr[245].func = testEqualUINT32EachEqual;
+  run_test_params_arr[245].name = UNITY_TOKENIZE("testEqualUINT32EachEqual");
+  run_test_params_arr[245].line_num = 2597;
+  run_test_params_arr[246].func = testNotEqualUINT32EachEqual1;
+  run_test_params_arr[246].name = UNITY_TOKENIZE("testNotEqualUINT32EachEqual1");
+  run_test_params_arr[246].line_num = 2611;
+  run_test_params_arr[247].func = testNotEqualUINT32EachEqual2;
+  run_test_params_arr[247].name = UNITY_TOKENIZE("testNotEqualUINT32EachEqual2");
+  run_test_params_arr[247].line_num = 2620;
+  run_test_params_arr[248].func = testNotEqualUINT32EachEqual3;
+  run_test_params_arr[248].name = UNITY_TOKENIZE("testNotEqualUINT32EachEqual3");
+  run_test_params_arr[248].line_num = 2629;
+  run_test_params_arr[249].func = testEqualHEXEachEqual;
+  run_test_params_arr[249].name = UNITY_TOKENIZE("testEqualHEXEachEqual");
+  run_test_params_arr[249].line_num = 2638;
+  run_test_params_arr[250].func = testNotEqualHEXEachEqual1;
+  run_test_params_arr[250].name = UNITY_TOKENIZE("testNotEqualHEXEachEqual1");
+  run_test_params_arr[250].line_num = 2652;
+  run_test_params_arr[251].func = testNotEqualHEXEachEqual2;
+  run_test_params_arr[251].name = UNITY_TOKENIZE("testNotEqualHEXEachEqual2");
+  run_test_params_arr[251].line_num = 2661;
+  run_test_params_arr[252].func = testNotEqualHEXEachEqual3;
+  run_test_params_arr[252].name = UNITY_TOKENIZE("testNotEqualHEXEachEqual3");
+  run_test_params_arr[252].line_num = 2670;
+  run_test_params_arr[253].func = testEqualHEX32EachEqual;
+  run_test_params_arr[253].name = UNITY_TOKENIZE("testEqualHEX32EachEqual");
+  run_test_params_arr[253].line_num = 2679;
+  run_test_params_arr[254].func = testNotEqualHEX32EachEqual1;
+  run_test_params_arr[254].name = UNITY_TOKENIZE("testNotEqualHEX32EachEqual1");
+  run_test_params_arr[254].line_num = 2693;
+  run_test_params_arr[255].func = testNotEqualHEX32EachEqual2;
+  run_test_params_arr[255].name = UNITY_TOKENIZE("testNotEqualHEX32EachEqual2");
+  run_test_params_arr[255].line_num = 2702;
+  run_test_params_arr[256].func = testNotEqualHEX32EachEqual3;
+  run_test_params_arr[256].name = UNITY_TOKENIZE("testNotEqualHEX32EachEqual3");
+  run_test_params_arr[256].line_num = 2711;
+  run_test_params_arr[257].func = testEqualHEX16EachEqual;
+  run_test_params_arr[257].name = UNITY_TOKENIZE("testEqualHEX16EachEqual");
+  run_test_params_arr[257].line_num = 2720;
+  run_test_params_arr[258].func = testNotEqualHEX16EachEqual1;
+  run_test_params_arr[258].name = UNITY_TOKENIZE("testNotEqualHEX16EachEqual1");
+  run_test_params_arr[258].line_num = 2734;
+  run_test_params_arr[259].func = testNotEqualHEX16EachEqual2;
+  run_test_params_arr[259].name = UNITY_TOKENIZE("testNotEqualHEX16EachEqual2");
+  run_test_params_arr[259].line_num = 2743;
+  run_test_params_arr[260].func = testNotEqualHEX16EachEqual3;
+  run_test_params_arr[260].name = UNITY_TOKENIZE("testNotEqualHEX16EachEqual3");
+  run_test_params_arr[260].line_num = 2752;
+  run_test_params_arr[261].func = testEqualHEX8EachEqual;
+  run_test_params_arr[261].name = UNITY_TOKENIZE("testEqualHEX8EachEqual");
+  run_test_params_arr[261].line_num = 2761;
+  run_test_params_arr[262].func = testNotEqualHEX8EachEqual1;
+  run_test_params_arr[262].name = UNITY_TOKENIZE("testNotEqualHEX8EachEqual1");
+  run_test_params_arr[262].line_num = 2775;
+  run_test_params_arr[263].func = testNotEqualHEX8EachEqual2;
+  run_test_params_arr[263].name = UNITY_TOKENIZE("testNotEqualHEX8EachEqual2");
+  run_test_params_arr[263].line_num = 2784;
+  run_test_params_arr[264].func = testNotEqualHEX8EachEqual3;
+  run_test_params_arr[264].name = UNITY_TOKENIZE("testNotEqualHEX8EachEqual3");
+  run_test_params_arr[264].line_num = 2793;
+  run_test_params_arr[265].func = testEqualHEX64Arrays;
+  run_test_params_arr[265].name = UNITY_TOKENIZE("testEqualHEX64Arrays");
+  run_test_params_arr[265].line_num = 2802;
+  run_test_params_arr[266].func = testEqualUint64Arrays;
+  run_test_params_arr[266].name = UNITY_TOKENIZE("testEqualUint64Arrays");
+  run_test_params_arr[266].line_num = 2820;
+  run_test_params_arr[267].func = testEqualInt64Arrays;
+  run_test_params_arr[267].name = UNITY_TOKENIZE("testEqualInt64Arrays");
+  run_test_params_arr[267].line_num = 2838;
+  run_test_params_arr[268].func = testNotEqualHEX64Arrays1;
+  run_test_params_arr[268].name = UNITY_TOKENIZE("testNotEqualHEX64Arrays1");
+  run_test_params_arr[268].line_num = 2857;
+  run_test_params_arr[269].func = testNotEqualHEX64Arrays2;
+  run_test_params_arr[269].name = UNITY_TOKENIZE("testNotEqualHEX64Arrays2");
+  run_test_params_arr[269].line_num = 2871;
+  run_test_params_arr[270].func = testNotEqualUint64Arrays;
+  run_test_params_arr[270].name = UNITY_TOKENIZE("testNotEqualUint64Arrays");
+  run_test_params_arr[270].line_num = 2885;
+  run_test_params_arr[271].func = testNotEqualInt64Arrays;
+  run_test_params_arr[271].name = UNITY_TOKENIZE("testNotEqualInt64Arrays");
+  run_test_params_arr[271].line_num = 2899;
+  run_test_params_arr[272].func = testVerifyIntPassingPointerComparisonOnZeroLengthArray;
+  run_test_params_arr[272].name = UNITY_TOKENIZE("testVerifyIntPassingPointerComparisonOnZeroLengthArray");
+  run_test_params_arr[272].line_num = 2913;
+  run_test_params_arr[273].func = testVerifyIntFailingPointerComparisonOnZeroLengthArray;
+  run_test_params_arr[273].name = UNITY_TOKENIZE("testVerifyIntFailingPointerComparisonOnZeroLengthArray");
+  run_test_params_arr[273].line_num = 2927;
+
+  for (int i = 0; i < 274; i++)
+  {
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
@@ -0,0 +1,68 @@
+#include "unity.h" /* Autogenerated by awk in Makefile */
+void testUnitySizeInitializationReminder(void);
+void testMessageShouldDisplayMessageWithoutEndingAndGoOnToFail(void);
+void testTrue(void);
+void testFalse(void);
+void testSingleStatement(void);
+void testPreviousPass(void);
+void testNotVanilla(void);
+void testNotTrue(void);
+void testNotFalse(void);
+void testNotUnless(void);
+void testNotNotEqual(void);
+void testFail(void);
+void testIsNull(void);
+void testIsNullShouldFailIfNot(void);
+void testNotNullShouldFailIfNULL(void);
+void testIsEmpty(void);
+void testIsEmptyShouldFailIfNot(void);
+void testNotEmptyShouldFailIfEmpty(void);
+void testIgnore(void);
+void testIgnoreMessage(void);
+void testProtection(void);
+void testFailureCountIncrementsAndIsReturnedAtEnd(void);
+void testThatDetailsCanBeHandleOneDetail(void);
+void testThatDetailsCanHandleTestFail(void);
+void testThatDetailsCanBeHandleTwoDetails(void);
+void testThatDetailsCanBeHandleSingleDetailClearingTwoDetails(void);
+void testReporterGetsFailedValuesAndMessage(void);
+void testReporterGetsFailedArrayIndex(void);
+void testReporterGetsPlainFailureWithoutValues(void);
+void testReporterGetsIgnoredTestEnd(void);
+void testReportersAreLimitedAndCanBeRemoved(void);
+int main(void)
+{
+    UnityBegin("tests/test_unity_core.c");
+    RUN_TEST(testUnitySizeInitializationReminder, 37);
+    RUN_TEST(testMessageShouldDisplayMessageWithoutEndingAndGoOnToFail, 115);
+    RUN_TEST(testTrue, 124);
+    RUN_TEST(testFalse, 131);
+    RUN_TEST(testSingleStatement, 138);
+    RUN_TEST(testPreviousPass, 151);
+    RUN_TEST(testNotVanilla, 156);
+    RUN_TEST(testNotTrue, 163);
+    RUN_TEST(testNotFalse, 170);
+    RUN_TEST(testNotUnless, 177);
+    RUN_TEST(testNotNotEqual, 184);
+    RUN_TEST(testFail, 191);
+    RUN_TEST(testIsNull, 198);
+    RUN_TEST(testIsNullShouldFailIfNot, 207);
+    RUN_TEST(testNotNullShouldFailIfNULL, 216);
+    RUN_TEST(testIsEmpty, 225);
+    RUN_TEST(testIsEmptyShouldFailIfNot, 234);
+    RUN_TEST(testNotEmptyShouldFailIfEmpty, 243);
+    RUN_TEST(testIgnore, 252);
+    RUN_TEST(testIgnoreMessage, 260);
+    RUN_TEST(testProtection, 268);
+    RUN_TEST(testFailureCountIncrementsAndIsReturnedAtEnd, 292);
+    RUN_TEST(testThatDetailsCanBeHandleOneDetail, 325);
+    RUN_TEST(testThatDetailsCanHandleTestFail, 338);
+    RUN_TEST(testThatDetailsCanBeHandleTwoDetails, 351);
+    RUN_TEST(testThatDetailsCanBeHandleSingleDetailClearingTwoDetails, 364);
+    RUN_TEST(testReporterGetsFailedValuesAndMessage, 397);
+    RUN_TEST(testReporterGetsFailedArrayIndex, 416);
+    RUN_TEST(testReporterGetsPlainFailureWithoutValues, 437);
+    RUN_TEST(testReporterGetsIgnoredTestEnd, 451);
+    RUN_TEST(testReportersAreLimitedAndCanBeRemoved, 468);
+    return UNITY_END();
+}
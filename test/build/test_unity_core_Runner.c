@@ -0,0 +1,219 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "self_assessment_utils.h"
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testUnitySizeInitializationReminder(void);
+extern void testMessageShouldDisplayMessageWithoutEndingAndGoOnToFail(void);
+extern void testTrue(void);
+extern void testFalse(void);
+extern void testSingleStatement(void);
+extern void testPreviousPass(void);
+extern void testNotVanilla(void);
+extern void testNotTrue(void);
+extern void testNotFalse(void);
+extern void testNotUnless(void);
+extern void testNotNotEqual(void);
+extern void testFail(void);
+extern void testIsNull(void);
+extern void testIsNullShouldFailIfNot(void);
+extern void testNotNullShouldFailIfNULL(void);
+extern void testIsEmpty(void);
+extern void testIsEmptyShouldFailIfNot(void);
+extern void testNotEmptyShouldFailIfEmpty(void);
+extern void testIgnore(void);
+extern void testIgnoreMessage(void);
+extern void testProtection(void);
+extern void testFailureCountIncrementsAndIsReturnedAtEnd(void);
+extern void testThatDetailsCanBeHandleOneDetail(void);
+extern void testThatDetailsCanHandleTestFail(void);
+extern void testThatDetailsCanBeHandleTwoDetails(void);
+extern void testThatDetailsCanBeHandleSingleDetailClearingTwoDetails(void);
+extern void testReporterGetsFailedValuesAndMessage(void);
+extern void testReporterGetsFailedArrayIndex(void);
+extern void testReporterGetsPlainFailureWithoutValues(void);
+extern void testReporterGetsIgnoredTestEnd(void);
+extern void testReportersAreLimitedAndCanBeRemoved(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("tests/test_unity_core.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[31];
+
+  run_test_params_arr[0].func = testUnitySizeInitializationReminder;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("testUnitySizeInitializationReminder");
+  run_test_params_arr[0].line_num = 37;
+  run_test_params_arr[1].func = testMessageShouldDisplayMessageWithoutEndingAndGoOnToFail;
+  run_test_params_arr[1].name = UNITY_TOKENIZE("testMessageShouldDisplayMessageWithoutEndingAndGoOnToFail");
+  run_test_params_arr[1].line_num = 115;
+  run_test_params_arr[2].func = testTrue;
+  run_test_params_arr[2].name = UNITY_TOKENIZE("testTrue");
+  run_test_params_arr[2].line_num = 124;
+  run_test_params_arr[3].func = testFalse;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("testFalse");
+  run_test_params_arr[3].line_num = 131;
+  run_test_params_arr[4].func = testSingleStatement;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("testSingleStatement");
+  run_test_params_arr[4].line_num = 138;
+  run_test_params_arr[5].func = testPreviousPass;
+  run_test_params_arr[5].name = UNITY_TOKENIZE("testPreviousPass");
+  run_test_params_arr[5].line_num = 151;
+  run_test_params_arr[6].func = testNotVanilla;
+  run_test_params_arr[6].name = UNITY_TOKENIZE("testNotVanilla");
+  run_test_params_arr[6].line_num = 156;
+  run_test_params_arr[7].func = testNotTrue;
+  run_test_params_arr[7].name = UNITY_TOKENIZE("testNotTrue");
+  run_test_params_arr[7].line_num = 163;
+  run_test_params_arr[8].func = testNotFalse;
+  run_test_params_arr[8].name = UNITY_TOKENIZE("testNotFalse");
+  run_test_params_arr[8].line_num = 170;
+  run_test_params_arr[9].func = testNotUnless;
+  run_test_params_arr[9].name = UNITY_TOKENIZE("testNotUnless");
+  run_test_params_arr[9].line_num = 177;
+  run_test_params_arr[10].func = testNotNotEqual;
+  run_test_params_arr[10].name = UNITY_TOKENIZE("testNotNotEqual");
+  run_test_params_arr[10].line_num = 184;
+  run_test_params_arr[11].func = testFail;
+  run_test_params_arr[11].name = UNITY_TOKENIZE("testFail");
+  run_test_params_arr[11].line_num = 191;
+  run_test_params_arr[12].func = testIsNull;
+  run_test_params_arr[12].name = UNITY_TOKENIZE("testIsNull");
+  run_test_params_arr[12].line_num = 198;
+  run_test_params_arr[13].func = testIsNullShouldFailIfNot;
+  run_test_params_arr[13].name = UNITY_TOKENIZE("testIsNullShouldFailIfNot");
+  run_test_params_arr[13].line_num = 207;
+  run_test_params_arr[14].func = testNotNullShouldFailIfNULL;
+  run_test_params_arr[14].name = UNITY_TOKENIZE("testNotNullShouldFailIfNULL");
+  run_test_params_arr[14].line_num = 216;
+  run_test_params_arr[15].func = testIsEmpty;
+  run_test_params_arr[15].name = UNITY_TOKENIZE("testIsEmpty");
+  run_test_params_arr[15].line_num = 225;
+  run_test_params_arr[16].func = testIsEmptyShouldFailIfNot;
+  run_test_params_arr[16].name = UNITY_TOKENIZE("testIsEmptyShouldFailIfNot");
+  run_test_params_arr[16].line_num = 234;
+  run_test_params_arr[17].func = testNotEmptyShouldFailIfEmpty;
+  run_test_params_arr[17].name = UNITY_TOKENIZE("testNotEmptyShouldFailIfEmpty");
+  run_test_params_arr[17].line_num = 243;
+  run_test_params_arr[18].func = testIgnore;
+  run_test_params_arr[18].name = UNITY_TOKENIZE("testIgnore");
+  run_test_params_arr[18].line_num = 252;
+  run_test_params_arr[19].func = testIgnoreMessage;
+  run_test_params_arr[19].name = UNITY_TOKENIZE("testIgnoreMessage");
+  run_test_params_arr[19].line_num = 260;
+  run_test_params_arr[20].func = testProtection;
+  run_test_params_arr[20].name = UNITY_TOKENIZE("testProtection");
+  run_test_params_arr[20].line_num = 268;
+  run_test_params_arr[21].func = testFailureCountIncrementsAndIsReturnedAtEnd;
+  run_test_params_arr[21].name = UNITY_TOKENIZE("testFailureCountIncrementsAndIsReturnedAtEnd");
+  run_test_params_arr[21].line_num = 292;
+  run_test_params_arr[22].func = testThatDetailsCanBeHandleOneDetail;
+  run_test_params_arr[22].name = UNITY_TOKENIZE("testThatDetailsCanBeHandleOneDetail");
+  run_test_params_arr[22].line_num = 325;
+  run_test_params_arr[23].func = testThatDetailsCanHandleTestFail;
+  run_test_params_arr[23].name = UNITY_TOKENIZE("testThatDetailsCanHandleTestFail");
+  run_test_params_arr[23].line_num = 338;
+  run_test_params_arr[24].func = testThatDetailsCanBeHandleTwoDetails;
+  run_test_params_arr[24].name = UNITY_TOKENIZE("testThatDetailsCanBeHandleTwoDetails");
+  run_test_params_arr[24].line_num = 351;
+  run_test_params_arr[25].func = testThatDetailsCanBeHandleSingleDetailClearingTwoDetails;
+  run_test_params_arr[25].name = UNITY_TOKENIZE("testThatDetailsCanBeHandleSingleDetailClearingTwoDetails");
+  run_test_params_arr[25].line_num = 364;
+  run_test_params_arr[26].func = testReporterGetsFailedValuesAndMessage;
+  run_test_params_arr[26].name = UNITY_TOKENIZE("testReporterGetsFailedValuesAndMessage");
+  run_test_params_arr[26].line_num = 397;
+  run_test_params_arr[27].func = testReporterGetsFailedArrayIndex;
+  run_test_params_arr[27].name = UNITY_TOKENIZE("testReporterGetsFailedArrayIndex");
+  run_test_params_arr[27].line_num = 416;
+  run_test_params_arr[28].func = testReporterGetsPlainFailureWithoutValues;
+  run_test_params_arr[28].name = UNITY_TOKENIZE("testReporterGetsPlainFailureWithoutValues");
+  run_test_params_arr[28].line_num = 437;
+  run_test_params_arr[29].func = testReporterGetsIgnoredTestEnd;
+  run_test_params_arr[29].name = UNITY_TOKENIZE("testReporterGetsIgnoredTestEnd");
+  run_test_params_arr[29].line_num = 451;
+  run_test_params_arr[30].func = testReportersAreLimitedAndCanBeRemoved;
+  run_test_params_arr[30].name = UNITY_TOKENIZE("testReportersAreLimitedAndCanBeRemoved");
+  run_test_params_arr[30].line_num = 468;
+
+  for (int i = 0; i < 31; i++)
+  {
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
@@ -0,0 +1,208 @@
+#include "unity.h" /* Autogenerated by awk in Makefile */
+void testDoublesWithinDelta(void);
+void testDoublesNotWithinDelta(void);
+void testDoublesEqual(void);
+void testDoublesNotEqual(void);
+void testDoublesNotEqualNegative1(void);
+void testDoublesNotEqualNegative2(void);
+void testDoublesNotEqualActualNaN(void);
+void testDoublesNotEqualExpectedNaN(void);
+void testDoublesEqualBothNaN(void);
+void testDoublesNotEqualInfNaN(void);
+void testDoublesNotEqualNaNInf(void);
+void testDoublesNotEqualActualInf(void);
+void testDoublesNotEqualExpectedInf(void);
+void testDoublesEqualBothInf(void);
+void testDoublesNotEqualPlusMinusInf(void);
+void testDoublesGreaterThan(void);
+void testDoublesGreaterThanInf(void);
+void testDoublesNotGreaterThan(void);
+void testDoublesNotGreaterThanNanActual(void);
+void testDoublesNotGreaterThanNanThreshold(void);
+void testDoublesNotGreaterThanNanBoth(void);
+void testDoublesNotGreaterThanInfActual(void);
+void testDoublesNotGreaterThanNegInf(void);
+void testDoublesNotGreaterThanBothInf(void);
+void testDoublesNotGreaterThanBothNegInf(void);
+void testDoublesGreaterOrEqual(void);
+void testDoublesGreaterOrEqualInf(void);
+void testDoublesNotGreaterOrEqual(void);
+void testDoublesNotGreaterOrEqualNanActual(void);
+void testDoublesNotGreaterOrEqualNanThreshold(void);
+void testDoublesGreaterOrEqualNanBoth(void);
+void testDoublesNotGreaterOrEqualInfActual(void);
+void testDoublesNotGreaterOrEqualNegInf(void);
+void testDoublesGreaterOrEqualBothInf(void);
+void testDoublesGreaterOrEqualBothNegInf(void);
+void testDoublesLessThan(void);
+void testDoublesLessThanInf(void);
+void testDoublesNotLessThan(void);
+void testDoublesNotLessThanNanActual(void);
+void testDoublesNotLessThanNanThreshold(void);
+void testDoublesNotLessThanNanBoth(void);
+void testDoublesNotLessThanInf(void);
+void testDoublesNotLessThanNegInf(void);
+void testDoublesNotLessThanBothInf(void);
+void testDoublesNotLessThanBothNegInf(void);
+void testDoublesLessOrEqual(void);
+void testDoublesLessOrEqualInf(void);
+void testDoublesNotLessOrEqual(void);
+void testDoublesNotLessOrEqualNanActual(void);
+void testDoublesNotLessOrEqualNanThreshold(void);
+void testDoublesLessOrEqualNanBoth(void);
+void testDoublesNotLessOrEqualInf(void);
+void testDoublesNotLessOrEqualNegInf(void);
+void testDoublesLessOrEqualBothInf(void);
+void testDoublesLessOrEqualBothNegInf(void);
+void testDoubleIsPosInf1(void);
+void testDoubleIsPosInf2(void);
+void testDoubleIsNegInf1(void);
+void testDoubleIsNegInf2(void);
+void testDoubleIsNotPosInf1(void);
+void testDoubleIsNotPosInf2(void);
+void testDoubleIsNotNegInf(void);
+void testDoubleIsNan1(void);
+void testDoubleIsNan2(void);
+void testDoubleIsNotNan1(void);
+void testDoubleIsNotNan2(void);
+void testDoubleInfIsNotNan(void);
+void testDoubleNanIsNotInf(void);
+void testDoubleIsDeterminate1(void);
+void testDoubleIsDeterminate2(void);
+void testDoubleIsNotDeterminate1(void);
+void testDoubleIsNotDeterminate2(void);
+void testDoubleTraitFailsOnInvalidTrait(void);
+void testEqualDoubleArrays(void);
+void testNotEqualDoubleArraysExpectedNull(void);
+void testNotEqualDoubleArraysActualNull(void);
+void testNotEqualDoubleArrays1(void);
+void testNotEqualDoubleArrays2(void);
+void testNotEqualDoubleArrays3(void);
+void testNotEqualDoubleArraysNegative1(void);
+void testNotEqualDoubleArraysNegative2(void);
+void testNotEqualDoubleArraysNegative3(void);
+void testEqualDoubleArraysNaN(void);
+void testEqualDoubleArraysInf(void);
+void testNotEqualDoubleArraysLengthZero(void);
+void testDoubleArraysWithin(void);
+void testDoubleArraysWithinUnusualDelta(void);
+void testEqualDoubleEachEqual(void);
+void testNotEqualDoubleEachEqualActualNull(void);
+void testNotEqualDoubleEachEqual1(void);
+void testNotEqualDoubleEachEqual2(void);
+void testNotEqualDoubleEachEqual3(void);
+void testNotEqualDoubleEachEqualNegative1(void);
+void testNotEqualDoubleEachEqualNegative2(void);
+void testNotEqualDoubleEachEqualNegative3(void);
+void testEqualDoubleEachEqualNaN(void);
+void testEqualDoubleEachEqualInf(void);
+void testNotEqualDoubleEachEqualLengthZero(void);
+void testDoublePrinting(void);
+void testDoublePrintingRoundTiesToEven(void);
+void testDoublePrintingInfinityAndNaN(void);
+int main(void)
+{
+    UnityBegin("tests/test_unity_doubles.c");
+    RUN_TEST(testDoublesWithinDelta, 37);
+    RUN_TEST(testDoublesNotWithinDelta, 53);
+    RUN_TEST(testDoublesEqual, 67);
+    RUN_TEST(testDoublesNotEqual, 83);
+    RUN_TEST(testDoublesNotEqualNegative1, 96);
+    RUN_TEST(testDoublesNotEqualNegative2, 109);
+    RUN_TEST(testDoublesNotEqualActualNaN, 122);
+    RUN_TEST(testDoublesNotEqualExpectedNaN, 135);
+    RUN_TEST(testDoublesEqualBothNaN, 148);
+    RUN_TEST(testDoublesNotEqualInfNaN, 161);
+    RUN_TEST(testDoublesNotEqualNaNInf, 174);
+    RUN_TEST(testDoublesNotEqualActualInf, 187);
+    RUN_TEST(testDoublesNotEqualExpectedInf, 200);
+    RUN_TEST(testDoublesEqualBothInf, 213);
+    RUN_TEST(testDoublesNotEqualPlusMinusInf, 226);
+    RUN_TEST(testDoublesGreaterThan, 239);
+    RUN_TEST(testDoublesGreaterThanInf, 250);
+    RUN_TEST(testDoublesNotGreaterThan, 261);
+    RUN_TEST(testDoublesNotGreaterThanNanActual, 272);
+    RUN_TEST(testDoublesNotGreaterThanNanThreshold, 283);
+    RUN_TEST(testDoublesNotGreaterThanNanBoth, 294);
+    RUN_TEST(testDoublesNotGreaterThanInfActual, 305);
+    RUN_TEST(testDoublesNotGreaterThanNegInf, 316);
+    RUN_TEST(testDoublesNotGreaterThanBothInf, 327);
+    RUN_TEST(testDoublesNotGreaterThanBothNegInf, 338);
+    RUN_TEST(testDoublesGreaterOrEqual, 349);
+    RUN_TEST(testDoublesGreaterOrEqualInf, 362);
+    RUN_TEST(testDoublesNotGreaterOrEqual, 373);
+    RUN_TEST(testDoublesNotGreaterOrEqualNanActual, 384);
+    RUN_TEST(testDoublesNotGreaterOrEqualNanThreshold, 395);
+    RUN_TEST(testDoublesGreaterOrEqualNanBoth, 406);
+    RUN_TEST(testDoublesNotGreaterOrEqualInfActual, 415);
+    RUN_TEST(testDoublesNotGreaterOrEqualNegInf, 426);
+    RUN_TEST(testDoublesGreaterOrEqualBothInf, 437);
+    RUN_TEST(testDoublesGreaterOrEqualBothNegInf, 446);
+    RUN_TEST(testDoublesLessThan, 455);
+    RUN_TEST(testDoublesLessThanInf, 466);
+    RUN_TEST(testDoublesNotLessThan, 477);
+    RUN_TEST(testDoublesNotLessThanNanActual, 488);
+    RUN_TEST(testDoublesNotLessThanNanThreshold, 499);
+    RUN_TEST(testDoublesNotLessThanNanBoth, 510);
+    RUN_TEST(testDoublesNotLessThanInf, 521);
+    RUN_TEST(testDoublesNotLessThanNegInf, 532);
+    RUN_TEST(testDoublesNotLessThanBothInf, 543);
+    RUN_TEST(testDoublesNotLessThanBothNegInf, 554);
+    RUN_TEST(testDoublesLessOrEqual, 565);
+    RUN_TEST(testDoublesLessOrEqualInf, 578);
+    RUN_TEST(testDoublesNotLessOrEqual, 589);
+    RUN_TEST(testDoublesNotLessOrEqualNanActual, 600);
+    RUN_TEST(testDoublesNotLessOrEqualNanThreshold, 611);
+    RUN_TEST(testDoublesLessOrEqualNanBoth, 622);
+    RUN_TEST(testDoublesNotLessOrEqualInf, 631);
+    RUN_TEST(testDoublesNotLessOrEqualNegInf, 642);
+    RUN_TEST(testDoublesLessOrEqualBothInf, 653);
+    RUN_TEST(testDoublesLessOrEqualBothNegInf, 662);
+    RUN_TEST(testDoubleIsPosInf1, 671);
+    RUN_TEST(testDoubleIsPosInf2, 680);
+    RUN_TEST(testDoubleIsNegInf1, 691);
+    RUN_TEST(testDoubleIsNegInf2, 700);
+    RUN_TEST(testDoubleIsNotPosInf1, 711);
+    RUN_TEST(testDoubleIsNotPosInf2, 722);
+    RUN_TEST(testDoubleIsNotNegInf, 731);
+    RUN_TEST(testDoubleIsNan1, 742);
+    RUN_TEST(testDoubleIsNan2, 751);
+    RUN_TEST(testDoubleIsNotNan1, 762);
+    RUN_TEST(testDoubleIsNotNan2, 773);
+    RUN_TEST(testDoubleInfIsNotNan, 782);
+    RUN_TEST(testDoubleNanIsNotInf, 793);
+    RUN_TEST(testDoubleIsDeterminate1, 804);
+    RUN_TEST(testDoubleIsDeterminate2, 815);
+    RUN_TEST(testDoubleIsNotDeterminate1, 826);
+    RUN_TEST(testDoubleIsNotDeterminate2, 837);
+    RUN_TEST(testDoubleTraitFailsOnInvalidTrait, 848);
+    RUN_TEST(testEqualDoubleArrays, 859);
+    RUN_TEST(testNotEqualDoubleArraysExpectedNull, 878);
+    RUN_TEST(testNotEqualDoubleArraysActualNull, 892);
+    RUN_TEST(testNotEqualDoubleArrays1, 906);
+    RUN_TEST(testNotEqualDoubleArrays2, 920);
+    RUN_TEST(testNotEqualDoubleArrays3, 934);
+    RUN_TEST(testNotEqualDoubleArraysNegative1, 948);
+    RUN_TEST(testNotEqualDoubleArraysNegative2, 962);
+    RUN_TEST(testNotEqualDoubleArraysNegative3, 976);
+    RUN_TEST(testEqualDoubleArraysNaN, 990);
+    RUN_TEST(testEqualDoubleArraysInf, 1002);
+    RUN_TEST(testNotEqualDoubleArraysLengthZero, 1014);
+    RUN_TEST(testDoubleArraysWithin, 1028);
+    RUN_TEST(testDoubleArraysWithinUnusualDelta, 1053);
+    RUN_TEST(testEqualDoubleEachEqual, 1069);
+    RUN_TEST(testNotEqualDoubleEachEqualActualNull, 1087);
+    RUN_TEST(testNotEqualDoubleEachEqual1, 1100);
+    RUN_TEST(testNotEqualDoubleEachEqual2, 1113);
+    RUN_TEST(testNotEqualDoubleEachEqual3, 1126);
+    RUN_TEST(testNotEqualDoubleEachEqualNegative1, 1139);
+    RUN_TEST(testNotEqualDoubleEachEqualNegative2, 1152);
+    RUN_TEST(testNotEqualDoubleEachEqualNegative3, 1165);
+    RUN_TEST(testEqualDoubleEachEqualNaN, 1178);
+    RUN_TEST(testEqualDoubleEachEqualInf, 1189);
+    RUN_TEST(testNotEqualDoubleEachEqualLengthZero, 1200);
+    RUN_TEST(testDoublePrinting, 1213);
+    RUN_TEST(testDoublePrintingRoundTiesToEven, 1260);
+    RUN_TEST(testDoublePrintingInfinityAndNaN, 1275);
+    return UNITY_END();
+}
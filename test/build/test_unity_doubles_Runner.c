@@ -0,0 +1,499 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "self_assessment_utils.h"
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testDoublesWithinDelta(void);
+extern void testDoublesNotWithinDelta(void);
+extern void testDoublesEqual(void);
+extern void testDoublesNotEqual(void);
+extern void testDoublesNotEqualNegative1(void);
+extern void testDoublesNotEqualNegative2(void);
+extern void testDoublesNotEqualActualNaN(void);
+extern void testDoublesNotEqualExpectedNaN(void);
+extern void testDoublesEqualBothNaN(void);
+extern void testDoublesNotEqualInfNaN(void);
+extern void testDoublesNotEqualNaNInf(void);
+extern void testDoublesNotEqualActualInf(void);
+extern void testDoublesNotEqualExpectedInf(void);
+extern void testDoublesEqualBothInf(void);
+extern void testDoublesNotEqualPlusMinusInf(void);
+extern void testDoublesGreaterThan(void);
+extern void testDoublesGreaterThanInf(void);
+extern void testDoublesNotGreaterThan(void);
+extern void testDoublesNotGreaterThanNanActual(void);
+extern void testDoublesNotGreaterThanNanThreshold(void);
+extern void testDoublesNotGreaterThanNanBoth(void);
+extern void testDoublesNotGreaterThanInfActual(void);
+extern void testDoublesNotGreaterThanNegInf(void);
+extern void testDoublesNotGreaterThanBothInf(void);
+extern void testDoublesNotGreaterThanBothNegInf(void);
+extern void testDoublesGreaterOrEqual(void);
+extern void testDoublesGreaterOrEqualInf(void);
+extern void testDoublesNotGreaterOrEqual(void);
+extern void testDoublesNotGreaterOrEqualNanActual(void);
+extern void testDoublesNotGreaterOrEqualNanThreshold(void);
+extern void testDoublesGreaterOrEqualNanBoth(void);
+extern void testDoublesNotGreaterOrEqualInfActual(void);
+extern void testDoublesNotGreaterOrEqualNegInf(void);
+extern void testDoublesGreaterOrEqualBothInf(void);
+extern void testDoublesGreaterOrEqualBothNegInf(void);
+extern void testDoublesLessThan(void);
+extern void testDoublesLessThanInf(void);
+extern void testDoublesNotLessThan(void);
+extern void testDoublesNotLessThanNanActual(void);
+extern void testDoublesNotLessThanNanThreshold(void);
+extern void testDoublesNotLessThanNanBoth(void);
+extern void testDoublesNotLessThanInf(void);
+extern void testDoublesNotLessThanNegInf(void);
+extern void testDoublesNotLessThanBothInf(void);
+extern void testDoublesNotLessThanBothNegInf(void);
+extern void testDoublesLessOrEqual(void);
+extern void testDoublesLessOrEqualInf(void);
+extern void testDoublesNotLessOrEqual(void);
+extern void testDoublesNotLessOrEqualNanActual(void);
+extern void testDoublesNotLessOrEqualNanThreshold(void);
+extern void testDoublesLessOrEqualNanBoth(void);
+extern void testDoublesNotLessOrEqualInf(void);
+extern void testDoublesNotLessOrEqualNegInf(void);
+extern void testDoublesLessOrEqualBothInf(void);
+extern void testDoublesLessOrEqualBothNegInf(void);
+extern void testDoubleIsPosInf1(void);
+extern void testDoubleIsPosInf2(void);
+extern void testDoubleIsNegInf1(void);
+extern void testDoubleIsNegInf2(void);
+extern void testDoubleIsNotPosInf1(void);
+extern void testDoubleIsNotPosInf2(void);
+extern void testDoubleIsNotNegInf(void);
+extern void testDoubleIsNan1(void);
+extern void testDoubleIsNan2(void);
+extern void testDoubleIsNotNan1(void);
+extern void testDoubleIsNotNan2(void);
+extern void testDoubleInfIsNotNan(void);
+extern void testDoubleNanIsNotInf(void);
+extern void testDoubleIsDeterminate1(void);
+extern void testDoubleIsDeterminate2(void);
+extern void testDoubleIsNotDeterminate1(void);
+extern void testDoubleIsNotDeterminate2(void);
+extern void testDoubleTraitFailsOnInvalidTrait(void);
+extern void testEqualDoubleArrays(void);
+extern void testNotEqualDoubleArraysExpectedNull(void);
+extern void testNotEqualDoubleArraysActualNull(void);
+extern void testNotEqualDoubleArrays1(void);
+extern void testNotEqualDoubleArrays2(void);
+extern void testNotEqualDoubleArrays3(void);
+extern void testNotEqualDoubleArraysNegative1(void);
+extern void testNotEqualDoubleArraysNegative2(void);
+extern void testNotEqualDoubleArraysNegative3(void);
+extern void testEqualDoubleArraysNaN(void);
+extern void testEqualDoubleArraysInf(void);
+extern void testNotEqualDoubleArraysLengthZero(void);
+extern void testDoubleArraysWithin(void);
+extern void testDoubleArraysWithinUnusualDelta(void);
+extern void testEqualDoubleEachEqual(void);
+extern void testNotEqualDoubleEachEqualActualNull(void);
+extern void testNotEqualDoubleEachEqual1(void);
+extern void testNotEqualDoubleEachEqual2(void);
+extern void testNotEqualDoubleEachEqual3(void);
+extern void testNotEqualDoubleEachEqualNegative1(void);
+extern void testNotEqualDoubleEachEqualNegative2(void);
+extern void testNotEqualDoubleEachEqualNegative3(void);
+extern void testEqualDoubleEachEqualNaN(void);
+extern void testEqualDoubleEachEqualInf(void);
+extern void testNotEqualDoubleEachEqualLengthZero(void);
+extern void testDoublePrinting(void);
+extern void testDoublePrintingRoundTiesToEven(void);
+extern void testDoublePrintingInfinityAndNaN(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("tests/test_unity_doubles.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[101];
+
+  run_test_params_arr[0].func = testDoublesWithinDelta;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("testDoublesWithinDelta");
+  run_test_params_arr[0].line_num = 37;
+  run_test_params_arr[1].func = testDoublesNotWithinDelta;
+  run_test_params_arr[1].name = UNITY_TOKENIZE("testDoublesNotWithinDelta");
+  run_test_params_arr[1].line_num = 53;
+  run_test_params_arr[2].func = testDoublesEqual;
+  run_test_params_arr[2].name = UNITY_TOKENIZE("testDoublesEqual");
+  run_test_params_arr[2].line_num = 67;
+  run_test_params_arr[3].func = testDoublesNotEqual;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("testDoublesNotEqual");
+  run_test_params_arr[3].line_num = 83;
+  run_test_params_arr[4].func = testDoublesNotEqualNegative1;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("testDoublesNotEqualNegative1");
+  run_test_params_arr[4].line_num = 96;
+  run_test_params_arr[5].func = testDoublesNotEqualNegative2;
+  run_test_params_arr[5].name = UNITY_TOKENIZE("testDoublesNotEqualNegative2");
+  run_test_params_arr[5].line_num = 109;
+  run_test_params_arr[6].func = testDoublesNotEqualActualNaN;
+  run_test_params_arr[6].name = UNITY_TOKENIZE("testDoublesNotEqualActualNaN");
+  run_test_params_arr[6].line_num = 122;
+  run_test_params_arr[7].func = testDoublesNotEqualExpectedNaN;
+  run_test_params_arr[7].name = UNITY_TOKENIZE("testDoublesNotEqualExpectedNaN");
+  run_test_params_arr[7].line_num = 135;
+  run_test_params_arr[8].func = testDoublesEqualBothNaN;
+  run_test_params_arr[8].name = UNITY_TOKENIZE("testDoublesEqualBothNaN");
+  run_test_params_arr[8].line_num = 148;
+  run_test_params_arr[9].func = testDoublesNotEqualInfNaN;
+  run_test_params_arr[9].name = UNITY_TOKENIZE("testDoublesNotEqualInfNaN");
+  run_test_params_arr[9].line_num = 161;
+  run_test_params_arr[10].func = testDoublesNotEqualNaNInf;
+  run_test_params_arr[10].name = UNITY_TOKENIZE("testDoublesNotEqualNaNInf");
+  run_test_params_arr[10].line_num = 174;
+  run_test_params_arr[11].func = testDoublesNotEqualActualInf;
+  run_test_params_arr[11].name = UNITY_TOKENIZE("testDoublesNotEqualActualInf");
+  run_test_params_arr[11].line_num = 187;
+  run_test_params_arr[12].func = testDoublesNotEqualExpectedInf;
+  run_test_params_arr[12].name = UNITY_TOKENIZE("testDoublesNotEqualExpectedInf");
+  run_test_params_arr[12].line_num = 200;
+  run_test_params_arr[13].func = testDoublesEqualBothInf;
+  run_test_params_arr[13].name = UNITY_TOKENIZE("testDoublesEqualBothInf");
+  run_test_params_arr[13].line_num = 213;
+  run_test_params_arr[14].func = testDoublesNotEqualPlusMinusInf;
+  run_test_params_arr[14].name = UNITY_TOKENIZE("testDoublesNotEqualPlusMinusInf");
+  run_test_params_arr[14].line_num = 226;
+  run_test_params_arr[15].func = testDoublesGreaterThan;
+  run_test_params_arr[15].name = UNITY_TOKENIZE("testDoublesGreaterThan");
+  run_test_params_arr[15].line_num = 239;
+  run_test_params_arr[16].func = testDoublesGreaterThanInf;
+  run_test_params_arr[16].name = UNITY_TOKENIZE("testDoublesGreaterThanInf");
+  run_test_params_arr[16].line_num = 250;
+  run_test_params_arr[17].func = testDoublesNotGreaterThan;
+  run_test_params_arr[17].name = UNITY_TOKENIZE("testDoublesNotGreaterThan");
+  run_test_params_arr[17].line_num = 261;
+  run_test_params_arr[18].func = testDoublesNotGreaterThanNanActual;
+  run_test_params_arr[18].name = UNITY_TOKENIZE("testDoublesNotGreaterThanNanActual");
+  run_test_params_arr[18].line_num = 272;
+  run_test_params_arr[19].func = testDoublesNotGreaterThanNanThreshold;
+  run_test_params_arr[19].name = UNITY_TOKENIZE("testDoublesNotGreaterThanNanThreshold");
+  run_test_params_arr[19].line_num = 283;
+  run_test_params_arr[20].func = testDoublesNotGreaterThanNanBoth;
+  run_test_params_arr[20].name = UNITY_TOKENIZE("testDoublesNotGreaterThanNanBoth");
+  run_test_params_arr[20].line_num = 294;
+  run_test_params_arr[21].func = testDoublesNotGreaterThanInfActual;
+  run_test_params_arr[21].name = UNITY_TOKENIZE("testDoublesNotGreaterThanInfActual");
+  run_test_params_arr[21].line_num = 305;
+  run_test_params_arr[22].func = testDoublesNotGreaterThanNegInf;
+  run_test_params_arr[22].name = UNITY_TOKENIZE("testDoublesNotGreaterThanNegInf");
+  run_test_params_arr[22].line_num = 316;
+  run_test_params_arr[23].func = testDoublesNotGreaterThanBothInf;
+  run_test_params_arr[23].name = UNITY_TOKENIZE("testDoublesNotGreaterThanBothInf");
+  run_test_params_arr[23].line_num = 327;
+  run_test_params_arr[24].func = testDoublesNotGreaterThanBothNegInf;
+  run_test_params_arr[24].name = UNITY_TOKENIZE("testDoublesNotGreaterThanBothNegInf");
+  run_test_params_arr[24].line_num = 338;
+  run_test_params_arr[25].func = testDoublesGreaterOrEqual;
+  run_test_params_arr[25].name = UNITY_TOKENIZE("testDoublesGreaterOrEqual");
+  run_test_params_arr[25].line_num = 349;
+  run_test_params_arr[26].func = testDoublesGreaterOrEqualInf;
+  run_test_params_arr[26].name = UNITY_TOKENIZE("testDoublesGreaterOrEqualInf");
+  run_test_params_arr[26].line_num = 362;
+  run_test_params_arr[27].func = testDoublesNotGreaterOrEqual;
+  run_test_params_arr[27].name = UNITY_TOKENIZE("testDoublesNotGreaterOrEqual");
+  run_test_params_arr[27].line_num = 373;
+  run_test_params_arr[28].func = testDoublesNotGreaterOrEqualNanActual;
+  run_test_params_arr[28].name = UNITY_TOKENIZE("testDoublesNotGreaterOrEqualNanActual");
+  run_test_params_arr[28].line_num = 384;
+  run_test_params_arr[29].func = testDoublesNotGreaterOrEqualNanThreshold;
+  run_test_params_arr[29].name = UNITY_TOKENIZE("testDoublesNotGreaterOrEqualNanThreshold");
+  run_test_params_arr[29].line_num = 395;
+  run_test_params_arr[30].func = testDoublesGreaterOrEqualNanBoth;
+  run_test_params_arr[30].name = UNITY_TOKENIZE("testDoublesGreaterOrEqualNanBoth");
+  run_test_params_arr[30].line_num = 406;
+  run_test_params_arr[31].func = testDoublesNotGreaterOrEqualInfActual;
+  run_test_params_arr[31].name = UNITY_TOKENIZE("testDoublesNotGreaterOrEqualInfActual");
+  run_test_params_arr[31].line_num = 415;
+  run_test_params_arr[32].func = testDoublesNotGreaterOrEqualNegInf;
+  run_test_params_arr[32].name = UNITY_TOKENIZE("testDoublesNotGreaterOrEqualNegInf");
+  run_test_params_arr[32].line_num = 426;
+  run_test_params_arr[33].func = testDoublesGreaterOrEqualBothInf;
+  run_test_params_arr[33].name = UNITY_TOKENIZE("testDoublesGreaterOrEqualBothInf");
+  run_test_params_arr[33].line_num = 437;
+  run_test_params_arr[34].func = testDoublesGreaterOrEqualBothNegInf;
+  run_test_params_arr[34].name = UNITY_TOKENIZE("testDoublesGreaterOrEqualBothNegInf");
+  run_test_params_arr[34].line_num = 446;
+  run_test_params_arr[35].func = testDoublesLessThan;
+  run_test_params_arr[35].name = UNITY_TOKENIZE("testDoublesLessThan");
+  run_test_params_arr[35].line_num = 455;
+  run_test_params_arr[36].func = testDoublesLessThanInf;
+  run_test_params_arr[36].name = UNITY_TOKENIZE("testDoublesLessThanInf");
+  run_test_params_arr[36].line_num = 466;
+  run_test_params_arr[37].func = testDoublesNotLessThan;
+  run_test_params_arr[37].name = UNITY_TOKENIZE("testDoublesNotLessThan");
+  run_test_params_arr[37].line_num = 477;
+  run_test_params_arr[38].func = testDoublesNotLessThanNanActual;
+  run_test_params_arr[38].name = UNITY_TOKENIZE("testDoublesNotLessThanNanActual");
+  run_test_params_arr[38].line_num = 488;
+  run_test_params_arr[39].func = testDoublesNotLessThanNanThreshold;
+  run_test_params_arr[39].name = UNITY_TOKENIZE("testDoublesNotLessThanNanThreshold");
+  run_test_params_arr[39].line_num = 499;
+  run_test_params_arr[40].func = testDoublesNotLessThanNanBoth;
+  run_test_params_arr[40].name = UNITY_TOKENIZE("testDoublesNotLessThanNanBoth");
+  run_test_params_arr[40].line_num = 510;
+  run_test_params_arr[41].func = testDoublesNotLessThanInf;
+  run_test_params_arr[41].name = UNITY_TOKENIZE("testDoublesNotLessThanInf");
+  run_test_params_arr[41].line_num = 521;
+  run_test_params_arr[42].func = testDoublesNotLessThanNegInf;
+  run_test_params_arr[42].name = UNITY_TOKENIZE("testDoublesNotLessThanNegInf");
+  run_test_params_arr[42].line_num = 532;
+  run_test_params_arr[43].func = testDoublesNotLessThanBothInf;
+  run_test_params_arr[43].name = UNITY_TOKENIZE("testDoublesNotLessThanBothInf");
+  run_test_params_arr[43].line_num = 543;
+  run_test_params_arr[44].func = testDoublesNotLessThanBothNegInf;
+  run_test_params_arr[44].name = UNITY_TOKENIZE("testDoublesNotLessThanBothNegInf");
+  run_test_params_arr[44].line_num = 554;
+  run_test_params_arr[45].func = testDoublesLessOrEqual;
+  run_test_params_arr[45].name = UNITY_TOKENIZE("testDoublesLessOrEqual");
+  run_test_params_arr[45].line_num = 565;
+  run_test_params_arr[46].func = testDoublesLessOrEqualInf;
+  run_test_params_arr[46].name = UNITY_TOKENIZE("testDoublesLessOrEqualInf");
+  run_test_params_arr[46].line_num = 578;
+  run_test_params_arr[47].func = testDoublesNotLessOrEqual;
+  run_test_params_arr[47].name = UNITY_TOKENIZE("testDoublesNotLessOrEqual");
+  run_test_params_arr[47].line_num = 589;
+  run_test_params_arr[48].func = testDoublesNotLessOrEqualNanActual;
+  run_test_params_arr[48].name = UNITY_TOKENIZE("testDoublesNotLessOrEqualNanActual");
+  run_test_params_arr[48].line_num = 600;
+  run_test_params_arr[49].func = testDoublesNotLessOrEqualNanThreshold;
+  run_test_params_arr[49].name = UNITY_TOKENIZE("testDoublesNotLessOrEqualNanThreshold");
+  run_test_params_arr[49].line_num = 611;
+  run_test_params_arr[50].func = testDoublesLessOrEqualNanBoth;
+  run_test_params_arr[50].name = UNITY_TOKENIZE("testDoublesLessOrEqualNanBoth");
+  run_test_params_arr[50].line_num = 622;
+  run_test_params_arr[51].func = testDoublesNotLessOrEqualInf;
+  run_test_params_arr[51].name = UNITY_TOKENIZE("testDoublesNotLessOrEqualInf");
+  run_test_params_arr[51].line_num = 631;
+  run_test_params_arr[52].func = testDoublesNotLessOrEqualNegInf;
+  run_test_params_arr[52].name = UNITY_TOKENIZE("testDoublesNotLessOrEqualNegInf");
+  run_test_params_arr[52].line_num = 642;
+  run_test_params_arr[53].func = testDoublesLessOrEqualBothInf;
+  run_test_params_arr[53].name = UNITY_TOKENIZE("testDoublesLessOrEqualBothInf");
+  run_test_params_arr[53].line_num = 653;
+  run_test_params_arr[54].func = testDoublesLessOrEqualBothNegInf;
+  run_test_params_arr[54].name = UNITY_TOKENIZE("testDoublesLessOrEqualBothNegInf");
+  run_test_params_arr[54].line_num = 662;
+  run_test_params_arr[55].func = testDoubleIsPosInf1;
+  run_test_params_arr[55].name = UNITY_TOKENIZE("testDoubleIsPosInf1");
+  run_test_params_arr[55].line_num = 671;
+  run_test_params_arr[56].func = testDoubleIsPosInf2;
+  run_test_params_arr[56].name = UNITY_TOKENIZE("testDoubleIsPosInf2");
+  run_test_params_arr[56].line_num = 680;
+  run_test_params_arr[57].func = testDoubleIsNegInf1;
+  run_test_params_arr[57].name = UNITY_TOKENIZE("testDoubleIsNegInf1");
+  run_test_params_arr[57].line_num = 691;
+  run_test_params_arr[58].func = testDoubleIsNegInf2;
+  run_test_params_arr[58].name = UNITY_TOKENIZE("testDoubleIsNegInf2");
+  run_test_params_arr[58].line_num = 700;
+  run_test_params_arr[59].func = testDoubleIsNotPosInf1;
+  run_test_params_arr[59].name = UNITY_TOKENIZE("testDoubleIsNotPosInf1");
+  run_test_params_arr[59].line_num = 711;
+  run_test_params_arr[60].func = testDoubleIsNotPosInf2;
+  run_test_params_arr[60].name = UNITY_TOKENIZE("testDoubleIsNotPosInf2");
+  run_test_params_arr[60].line_num = 722;
+  run_test_params_arr[61].func = testDoubleIsNotNegInf;
+  run_test_params_arr[61].name = UNITY_TOKENIZE("testDoubleIsNotNegInf");
+  run_test_params_arr[61].line_num = 731;
+  run_test_params_arr[62].func = testDoubleIsNan1;
+  run_test_params_arr[62].name = UNITY_TOKENIZE("testDoubleIsNan1");
+  run_test_params_arr[62].line_num = 742;
+  run_test_params_arr[63].func = testDoubleIsNan2;
+  run_test_params_arr[63].name = UNITY_TOKENIZE("testDoubleIsNan2");
+  run_test_params_arr[63].line_num = 751;
+  run_test_params_arr[64].func = testDoubleIsNotNan1;
+  run_test_params_arr[64].name = UNITY_TOKENIZE("testDoubleIsNotNan1");
+  run_test_params_arr[64].line_num = 762;
+  run_test_params_arr[65].func = testDoubleIsNotNan2;
+  run_test_params_arr[65].name = UNITY_TOKENIZE("testDoubleIsNotNan2");
+  run_test_params_arr[65].line_num = 773;
+  run_test_params_arr[66].func = testDoubleInfIsNotNan;
+  run_test_params_arr[66].name = UNITY_TOKENIZE("testDoubleInfIsNotNan");
+  run_test_params_arr[66].line_num = 782;
+  run_test_params_arr[67].func = testDoubleNanIsNotInf;
+  run_test_params_arr[67].name = UNITY_TOKENIZE("testDoubleNanIsNotInf");
+  run_test_params_arr[67].line_num = 793;
+  run_test_params_arr[68].func = testDoubleIsDeterminate1;
+  run_test_params_arr[68].name = UNITY_TOKENIZE("testDoubleIsDeterminate1");
+  run_test_params_arr[68].line_num = 804;
+  run_test_params_arr[69].func = testDoubleIsDeterminate2;
+  run_test_params_arr[69].name = UNITY_TOKENIZE("testDoubleIsDeterminate2");
+  run_test_params_arr[69].line_num = 815;
+  run_test_params_arr[70].func = testDoubleIsNotDeterminate1;
+  run_test_params_arr[70].name = UNITY_TOKENIZE("testDoubleIsNotDeterminate1");
+  run_test_params_arr[70].line_num = 826;
+  run_test_params_arr[71].func = testDoubleIsNotDeterminate2;
+  run_test_params_arr[71].name = UNITY_TOKENIZE("testDoubleIsNotDeterminate2");
+  run_test_params_arr[71].line_num = 837;
+  run_test_params_arr[72].func = testDoubleTraitFailsOnInvalidTrait;
+  run_test_params_arr[72].name = UNITY_TOKENIZE("testDoubleTraitFailsOnInvalidTrait");
+  run_test_params_arr[72].line_num = 848;
+  run_test_params_arr[73].func = testEqualDoubleArrays;
+  run_test_params_arr[73].name = UNITY_TOKENIZE("testEqualDoubleArrays");
+  run_test_params_arr[73].line_num = 859;
+  run_test_params_arr[74].func = testNotEqualDoubleArraysExpectedNull;
+  run_test_params_arr[74].name = UNITY_TOKENIZE("testNotEqualDoubleArraysExpectedNull");
+  run_test_params_arr[74].line_num = 878;
+  run_test_params_arr[75].func = testNotEqualDoubleArraysActualNull;
+  run_test_params_arr[75].name = UNITY_TOKENIZE("testNotEqualDoubleArraysActualNull");
+  run_test_params_arr[75].line_num = 892;
+  run_test_params_arr[76].func = testNotEqualDoubleArrays1;
+  run_test_params_arr[76].name = UNITY_TOKENIZE("testNotEqualDoubleArrays1");
+  run_test_params_arr[76].line_num = 906;
+  run_test_params_arr[77].func = testNotEqualDoubleArrays2;
+  run_test_params_arr[77].name = UNITY_TOKENIZE("testNotEqualDoubleArrays2");
+  run_test_params_arr[77].line_num = 920;
+  run_test_params_arr[78].func = testNotEqualDoubleArrays3;
+  run_test_params_arr[78].name = UNITY_TOKENIZE("testNotEqualDoubleArrays3");
+  run_test_params_arr[78].line_num = 934;
+  run_test_params_arr[79].func = testNotEqualDoubleArraysNegative1;
+  run_test_params_arr[79].name = UNITY_TOKENIZE("testNotEqualDoubleArraysNegative1");
+  run_test_params_arr[79].line_num = 948;
+  run_test_params_arr[80].func = testNotEqualDoubleArraysNegative2;
+  run_test_params_arr[80].name = UNITY_TOKENIZE("testNotEqualDoubleArraysNegative2");
+  run_test_params_arr[80].line_num = 962;
+  run_test_params_arr[81].func = testNotEqualDoubleArraysNegative3;
+  run_test_params_arr[81].name = UNITY_TOKENIZE("testNotEqualDoubleArraysNegative3");
+  run_test_params_arr[81].line_num = 976;
+  run_test_params_arr[82].func = testEqualDoubleArraysNaN;
+  run_test_params_arr[82].name = UNITY_TOKENIZE("testEqualDoubleArraysNaN");
+  run_test_params_arr[82].line_num = 990;
+  run_test_params_arr[83].func = testEqualDoubleArraysInf;
+  run_test_params_arr[83].name = UNITY_TOKENIZE("testEqualDoubleArraysInf");
+  run_test_params_arr[83].line_num = 1002;
+  run_test_params_arr[84].func = testNotEqualDoubleArraysLengthZero;
+  run_test_params_arr[84].name = UNITY_TOKENIZE("testNotEqualDoubleArraysLengthZero");
+  run_test_params_arr[84].line_num = 1014;
+  run_test_params_arr[85].func = testDoubleArraysWithin;
+  run_test_params_arr[85].name = UNITY_TOKENIZE("testDoubleArraysWithin");
+  run_test_params_arr[85].line_num = 1028;
+  run_test_params_arr[86].func = testDoubleArraysWithinUnusualDelta;
+  run_test_params_arr[86].name = UNITY_TOKENIZE("testDoubleArraysWithinUnusualDelta");
+  run_test_params_arr[86].line_num = 1053;
+  run_test_params_arr[87].func = testEqualDoubleEachEqual;
+  run_test_params_arr[87].name = UNITY_TOKENIZE("testEqualDoubleEachEqual");
+  run_test_params_arr[87].line_num = 1069;
+  run_test_params_arr[88].func = testNotEqualDoubleEachEqualActualNull;
+  run_test_params_arr[88].name = UNITY_TOKENIZE("testNotEqualDoubleEachEqualActualNull");
+  run_test_params_arr[88].line_num = 1087;
+  run_test_params_arr[89].func = testNotEqualDoubleEachEqual1;
+  run_test_params_arr[89].name = UNITY_TOKENIZE("testNotEqualDoubleEachEqual1");
+  run_test_params_arr[89].line_num = 1100;
+  run_test_params_arr[90].func = testNotEqualDoubleEachEqual2;
+  run_test_params_arr[90].name = UNITY_TOKENIZE("testNotEqualDoubleEachEqual2");
+  run_test_params_arr[90].line_num = 1113;
+  run_test_params_arr[91].func = testNotEqualDoubleEachEqual3;
+  run_test_params_arr[91].name = UNITY_TOKENIZE("testNotEqualDoubleEachEqual3");
+  run_test_params_arr[91].line_num = 1126;
+  run_test_params_arr[92].func = testNotEqualDoubleEachEqualNegative1;
+  run_test_params_arr[92].name = UNITY_TOKENIZE("testNotEqualDoubleEachEqualNegative1");
+  run_test_params_arr[92].line_num = 1139;
+  run_test_params_arr[93].func = testNotEqualDoubleEachEqualNegative2;
+  run_test_params_arr[93].name = UNITY_TOKENIZE("testNotEqualDoubleEachEqualNegative2");
+  run_test_params_arr[93].line_num = 1152;
+  run_test_params_arr[94].func = testNotEqualDoubleEachEqualNegative3;
+  run_test_params_arr[94].name = UNITY_TOKENIZE("testNotEqualDoubleEachEqualNegative3");
+  run_test_params_arr[94].line_num = 1165;
+  run_test_params_arr[95].func = testEqualDoubleEachEqualNaN;
+  run_test_params_arr[95].name = UNITY_TOKENIZE("testEqualDoubleEachEqualNaN");
+  run_test_params_arr[95].line_num = 1178;
+  run_test_params_arr[96].func = testEqualDoubleEachEqualInf;
+  run_test_params_arr[96].name = UNITY_TOKENIZE("testEqualDoubleEachEqualInf");
+  run_test_params_arr[96].line_num = 1189;
+  run_test_params_arr[97].func = testNotEqualDoubleEachEqualLengthZero;
+  run_test_params_arr[97].name = UNITY_TOKENIZE("testNotEqualDoubleEachEqualLengthZero");
+  run_test_params_arr[97].line_num = 1200;
+  run_test_params_arr[98].func = testDoublePrinting;
+  run_test_params_arr[98].name = UNITY_TOKENIZE("testDoublePrinting");
+  run_test_params_arr[98].line_num = 1213;
+  run_test_params_arr[99].func = testDoublePrintingRoundTiesToEven;
+  run_test_params_arr[99].name = UNITY_TOKENIZE("testDoublePrintingRoundTiesToEven");
+  run_test_params_arr[99].line_num = 1260;
+  run_test_params_arr[100].func = testDoublePrintingInfinityAndNaN;
+  run_test_params_arr[100].name = UNITY_TOKENIZE("testDoublePrintingInfinityAndNaN");
+  run_test_params_arr[100].line_num = 1275;
+
+  for (int i = 0; i < 101; i++)
+  {
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
@@ -0,0 +1,210 @@
+#include "unity.h" /* Autogenerated by awk in Makefile */
+void testFloatsWithinDelta(void);
+void testFloatsNotWithinDelta(void);
+void testFloatsEqual(void);
+void testFloatsNotEqual(void);
+void testFloatsNotEqualNegative1(void);
+void testFloatsNotEqualNegative2(void);
+void testFloatsNotEqualActualNaN(void);
+void testFloatsNotEqualExpectedNaN(void);
+void testFloatsEqualBothNaN(void);
+void testFloatsNotEqualInfNaN(void);
+void testFloatsNotEqualNaNInf(void);
+void testFloatsNotEqualActualInf(void);
+void testFloatsNotEqualExpectedInf(void);
+void testFloatsEqualBothInf(void);
+void testFloatsNotEqualPlusMinusInf(void);
+void testFloatsGreaterThan(void);
+void testFloatsGreaterThanInf(void);
+void testFloatsNotGreaterThan(void);
+void testFloatsNotGreaterThanNanActual(void);
+void testFloatsNotGreaterThanNanThreshold(void);
+void testFloatsNotGreaterThanNanBoth(void);
+void testFloatsNotGreaterThanInfActual(void);
+void testFloatsNotGreaterThanNegInf(void);
+void testFloatsNotGreaterThanBothInf(void);
+void testFloatsNotGreaterThanBothNegInf(void);
+void testFloatsGreaterOrEqual(void);
+void testFloatsGreaterOrEqualInf(void);
+void testFloatsNotGreaterOrEqual(void);
+void testFloatsNotGreaterOrEqualNanActual(void);
+void testFloatsNotGreaterOrEqualNanThreshold(void);
+void testFloatsGreaterOrEqualNanBoth(void);
+void testFloatsNotGreaterOrEqualInfActual(void);
+void testFloatsNotGreaterOrEqualNegInf(void);
+void testFloatsGreaterOrEqualBothInf(void);
+void testFloatsGreaterOrEqualBothNegInf(void);
+void testFloatsLessThan(void);
+void testFloatsLessThanInf(void);
+void testFloatsNotLessThan(void);
+void testFloatsNotLessThanNanActual(void);
+void testFloatsNotLessThanNanThreshold(void);
+void testFloatsNotLessThanNanBoth(void);
+void testFloatsNotLessThanInf(void);
+void testFloatsNotLessThanNegInf(void);
+void testFloatsNotLessThanBothInf(void);
+void testFloatsNotLessThanBothNegInf(void);
+void testFloatsLessOrEqual(void);
+void testFloatsLessOrEqualInf(void);
+void testFloatsNotLessOrEqual(void);
+void testFloatsNotLessOrEqualNanActual(void);
+void testFloatsNotLessOrEqualNanThreshold(void);
+void testFloatsLessOrEqualNanBoth(void);
+void testFloatsNotLessOrEqualInf(void);
+void testFloatsNotLessOrEqualNegInf(void);
+void testFloatsLessOrEqualBothInf(void);
+void testFloatsLessOrEqualBothNegInf(void);
+void testFloatIsPosInf1(void);
+void testFloatIsPosInf2(void);
+void testFloatIsNegInf1(void);
+void testFloatIsNegInf2(void);
+void testFloatIsNotPosInf1(void);
+void testFloatIsNotPosInf2(void);
+void testFloatIsNotNegInf(void);
+void testFloatIsNan1(void);
+void testFloatIsNan2(void);
+void testFloatIsNotNan1(void);
+void testFloatIsNotNan2(void);
+void testFloatInfIsNotNan(void);
+void testFloatNanIsNotInf(void);
+void testFloatIsDeterminate1(void);
+void testFloatIsDeterminate2(void);
+void testFloatIsNotDeterminate1(void);
+void testFloatIsNotDeterminate2(void);
+void testFloatTraitFailsOnInvalidTrait(void);
+void testEqualFloatArrays(void);
+void testNotEqualFloatArraysExpectedNull(void);
+void testNotEqualFloatArraysActualNull(void);
+void testNotEqualFloatArrays1(void);
+void testNotEqualFloatArrays2(void);
+void testNotEqualFloatArrays3(void);
+void testNotEqualFloatArraysNegative1(void);
+void testNotEqualFloatArraysNegative2(void);
+void testNotEqualFloatArraysNegative3(void);
+void testEqualFloatArraysNaN(void);
+void testEqualFloatArraysInf(void);
+void testNotEqualFloatArraysLengthZero(void);
+void testFloatArraysWithin(void);
+void testFloatArraysWithinUnusualDelta(void);
+void testEqualFloatEachEqual(void);
+void testNotEqualFloatEachEqualActualNull(void);
+void testNotEqualFloatEachEqual1(void);
+void testNotEqualFloatEachEqual2(void);
+void testNotEqualFloatEachEqual3(void);
+void testNotEqualFloatEachEqualNegative1(void);
+void testNotEqualFloatEachEqualNegative2(void);
+void testNotEqualFloatEachEqualNegative3(void);
+void testEqualFloatEachEqualNaN(void);
+void testEqualFloatEachEqualInf(void);
+void testNotEqualFloatEachEqualLengthZero(void);
+void testFloatPrinting(void);
+void testFloatPrintingRoundTiesToEven(void);
+void testFloatPrintingInfinityAndNaN(void);
+void testFloatPrintingRandomSamples(void);
+int main(void)
+{
+    UnityBegin("tests/test_unity_floats.c");
+    RUN_TEST(testFloatsWithinDelta, 37);
+    RUN_TEST(testFloatsNotWithinDelta, 53);
+    RUN_TEST(testFloatsEqual, 66);
+    RUN_TEST(testFloatsNotEqual, 82);
+    RUN_TEST(testFloatsNotEqualNegative1, 95);
+    RUN_TEST(testFloatsNotEqualNegative2, 108);
+    RUN_TEST(testFloatsNotEqualActualNaN, 121);
+    RUN_TEST(testFloatsNotEqualExpectedNaN, 134);
+    RUN_TEST(testFloatsEqualBothNaN, 147);
+    RUN_TEST(testFloatsNotEqualInfNaN, 160);
+    RUN_TEST(testFloatsNotEqualNaNInf, 173);
+    RUN_TEST(testFloatsNotEqualActualInf, 186);
+    RUN_TEST(testFloatsNotEqualExpectedInf, 199);
+    RUN_TEST(testFloatsEqualBothInf, 212);
+    RUN_TEST(testFloatsNotEqualPlusMinusInf, 225);
+    RUN_TEST(testFloatsGreaterThan, 238);
+    RUN_TEST(testFloatsGreaterThanInf, 249);
+    RUN_TEST(testFloatsNotGreaterThan, 260);
+    RUN_TEST(testFloatsNotGreaterThanNanActual, 271);
+    RUN_TEST(testFloatsNotGreaterThanNanThreshold, 282);
+    RUN_TEST(testFloatsNotGreaterThanNanBoth, 293);
+    RUN_TEST(testFloatsNotGreaterThanInfActual, 304);
+    RUN_TEST(testFloatsNotGreaterThanNegInf, 315);
+    RUN_TEST(testFloatsNotGreaterThanBothInf, 326);
+    RUN_TEST(testFloatsNotGreaterThanBothNegInf, 337);
+    RUN_TEST(testFloatsGreaterOrEqual, 348);
+    RUN_TEST(testFloatsGreaterOrEqualInf, 361);
+    RUN_TEST(testFloatsNotGreaterOrEqual, 372);
+    RUN_TEST(testFloatsNotGreaterOrEqualNanActual, 383);
+    RUN_TEST(testFloatsNotGreaterOrEqualNanThreshold, 394);
+    RUN_TEST(testFloatsGreaterOrEqualNanBoth, 405);
+    RUN_TEST(testFloatsNotGreaterOrEqualInfActual, 414);
+    RUN_TEST(testFloatsNotGreaterOrEqualNegInf, 425);
+    RUN_TEST(testFloatsGreaterOrEqualBothInf, 436);
+    RUN_TEST(testFloatsGreaterOrEqualBothNegInf, 445);
+    RUN_TEST(testFloatsLessThan, 454);
+    RUN_TEST(testFloatsLessThanInf, 465);
+    RUN_TEST(testFloatsNotLessThan, 476);
+    RUN_TEST(testFloatsNotLessThanNanActual, 487);
+    RUN_TEST(testFloatsNotLessThanNanThreshold, 498);
+    RUN_TEST(testFloatsNotLessThanNanBoth, 509);
+    RUN_TEST(testFloatsNotLessThanInf, 520);
+    RUN_TEST(testFloatsNotLessThanNegInf, 531);
+    RUN_TEST(testFloatsNotLessThanBothInf, 542);
+    RUN_TEST(testFloatsNotLessThanBothNegInf, 553);
+    RUN_TEST(testFloatsLessOrEqual, 563);
+    RUN_TEST(testFloatsLessOrEqualInf, 576);
+    RUN_TEST(testFloatsNotLessOrEqual, 587);
+    RUN_TEST(testFloatsNotLessOrEqualNanActual, 598);
+    RUN_TEST(testFloatsNotLessOrEqualNanThreshold, 609);
+    RUN_TEST(testFloatsLessOrEqualNanBoth, 620);
+    RUN_TEST(testFloatsNotLessOrEqualInf, 629);
+    RUN_TEST(testFloatsNotLessOrEqualNegInf, 640);
+    RUN_TEST(testFloatsLessOrEqualBothInf, 651);
+    RUN_TEST(testFloatsLessOrEqualBothNegInf, 660);
+    RUN_TEST(testFloatIsPosInf1, 669);
+    RUN_TEST(testFloatIsPosInf2, 678);
+    RUN_TEST(testFloatIsNegInf1, 689);
+    RUN_TEST(testFloatIsNegInf2, 698);
+    RUN_TEST(testFloatIsNotPosInf1, 709);
+    RUN_TEST(testFloatIsNotPosInf2, 720);
+    RUN_TEST(testFloatIsNotNegInf, 729);
+    RUN_TEST(testFloatIsNan1, 740);
+    RUN_TEST(testFloatIsNan2, 749);
+    RUN_TEST(testFloatIsNotNan1, 760);
+    RUN_TEST(testFloatIsNotNan2, 771);
+    RUN_TEST(testFloatInfIsNotNan, 780);
+    RUN_TEST(testFloatNanIsNotInf, 791);
+    RUN_TEST(testFloatIsDeterminate1, 802);
+    RUN_TEST(testFloatIsDeterminate2, 813);
+    RUN_TEST(testFloatIsNotDeterminate1, 824);
+    RUN_TEST(testFloatIsNotDeterminate2, 835);
+    RUN_TEST(testFloatTraitFailsOnInvalidTrait, 846);
+    RUN_TEST(testEqualFloatArrays, 857);
+    RUN_TEST(testNotEqualFloatArraysExpectedNull, 876);
+    RUN_TEST(testNotEqualFloatArraysActualNull, 890);
+    RUN_TEST(testNotEqualFloatArrays1, 904);
+    RUN_TEST(testNotEqualFloatArrays2, 918);
+    RUN_TEST(testNotEqualFloatArrays3, 932);
+    RUN_TEST(testNotEqualFloatArraysNegative1, 946);
+    RUN_TEST(testNotEqualFloatArraysNegative2, 960);
+    RUN_TEST(testNotEqualFloatArraysNegative3, 974);
+    RUN_TEST(testEqualFloatArraysNaN, 988);
+    RUN_TEST(testEqualFloatArraysInf, 1000);
+    RUN_TEST(testNotEqualFloatArraysLengthZero, 1012);
+    RUN_TEST(testFloatArraysWithin, 1026);
+    RUN_TEST(testFloatArraysWithinUnusualDelta, 1051);
+    RUN_TEST(testEqualFloatEachEqual, 1067);
+    RUN_TEST(testNotEqualFloatEachEqualActualNull, 1085);
+    RUN_TEST(testNotEqualFloatEachEqual1, 1098);
+    RUN_TEST(testNotEqualFloatEachEqual2, 1111);
+    RUN_TEST(testNotEqualFloatEachEqual3, 1124);
+    RUN_TEST(testNotEqualFloatEachEqualNegative1, 1137);
+    RUN_TEST(testNotEqualFloatEachEqualNegative2, 1150);
+    RUN_TEST(testNotEqualFloatEachEqualNegative3, 1163);
+    RUN_TEST(testEqualFloatEachEqualNaN, 1176);
+    RUN_TEST(testEqualFloatEachEqualInf, 1187);
+    RUN_TEST(testNotEqualFloatEachEqualLengthZero, 1198);
+    RUN_TEST(testFloatPrinting, 1214);
+    RUN_TEST(testFloatPrintingRoundTiesToEven, 1266);
+    RUN_TEST(testFloatPrintingInfinityAndNaN, 1285);
+    RUN_TEST(testFloatPrintingRandomSamples, 1380);
+    return UNITY_END();
+}
@@ -0,0 +1,503 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "self_assessment_utils.h"
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testFloatsWithinDelta(void);
+extern void testFloatsNotWithinDelta(void);
+extern void testFloatsEqual(void);
+extern void testFloatsNotEqual(void);
+extern void testFloatsNotEqualNegative1(void);
+extern void testFloatsNotEqualNegative2(void);
+extern void testFloatsNotEqualActualNaN(void);
+extern void testFloatsNotEqualExpectedNaN(void);
+extern void testFloatsEqualBothNaN(void);
+extern void testFloatsNotEqualInfNaN(void);
+extern void testFloatsNotEqualNaNInf(void);
+extern void testFloatsNotEqualActualInf(void);
+extern void testFloatsNotEqualExpectedInf(void);
+extern void testFloatsEqualBothInf(void);
+extern void testFloatsNotEqualPlusMinusInf(void);
+extern void testFloatsGreaterThan(void);
+extern void testFloatsGreaterThanInf(void);
+extern void testFloatsNotGreaterThan(void);
+extern void testFloatsNotGreaterThanNanActual(void);
+extern void testFloatsNotGreaterThanNanThreshold(void);
+extern void testFloatsNotGreaterThanNanBoth(void);
+extern void testFloatsNotGreaterThanInfActual(void);
+extern void testFloatsNotGreaterThanNegInf(void);
+extern void testFloatsNotGreaterThanBothInf(void);
+extern void testFloatsNotGreaterThanBothNegInf(void);
+extern void testFloatsGreaterOrEqual(void);
+extern void testFloatsGreaterOrEqualInf(void);
+extern void testFloatsNotGreaterOrEqual(void);
+extern void testFloatsNotGreaterOrEqualNanActual(void);
+extern void testFloatsNotGreaterOrEqualNanThreshold(void);
+extern void testFloatsGreaterOrEqualNanBoth(void);
+extern void testFloatsNotGreaterOrEqualInfActual(void);
+extern void testFloatsNotGreaterOrEqualNegInf(void);
+extern void testFloatsGreaterOrEqualBothInf(void);
+extern void testFloatsGreaterOrEqualBothNegInf(void);
+extern void testFloatsLessThan(void);
+extern void testFloatsLessThanInf(void);
+extern void testFloatsNotLessThan(void);
+extern void testFloatsNotLessThanNanActual(void);
+extern void testFloatsNotLessThanNanThreshold(void);
+extern void testFloatsNotLessThanNanBoth(void);
+extern void testFloatsNotLessThanInf(void);
+extern void testFloatsNotLessThanNegInf(void);
+extern void testFloatsNotLessThanBothInf(void);
+extern void testFloatsNotLessThanBothNegInf(void);
+extern void testFloatsLessOrEqual(void);
+extern void testFloatsLessOrEqualInf(void);
+extern void testFloatsNotLessOrEqual(void);
+extern void testFloatsNotLessOrEqualNanActual(void);
+extern void testFloatsNotLessOrEqualNanThreshold(void);
+extern void testFloatsLessOrEqualNanBoth(void);
+extern void testFloatsNotLessOrEqualInf(void);
+extern void testFloatsNotLessOrEqualNegInf(void);
+extern void testFloatsLessOrEqualBothInf(void);
+extern void testFloatsLessOrEqualBothNegInf(void);
+extern void testFloatIsPosInf1(void);
+extern void testFloatIsPosInf2(void);
+extern void testFloatIsNegInf1(void);
+extern void testFloatIsNegInf2(void);
+extern void testFloatIsNotPosInf1(void);
+extern void testFloatIsNotPosInf2(void);
+extern void testFloatIsNotNegInf(void);
+extern void testFloatIsNan1(void);
+extern void testFloatIsNan2(void);
+extern void testFloatIsNotNan1(void);
+extern void testFloatIsNotNan2(void);
+extern void testFloatInfIsNotNan(void);
+extern void testFloatNanIsNotInf(void);
+extern void testFloatIsDeterminate1(void);
+extern void testFloatIsDeterminate2(void);
+extern void testFloatIsNotDeterminate1(void);
+extern void testFloatIsNotDeterminate2(void);
+extern void testFloatTraitFailsOnInvalidTrait(void);
+extern void testEqualFloatArrays(void);
+extern void testNotEqualFloatArraysExpectedNull(void);
+extern void testNotEqualFloatArraysActualNull(void);
+extern void testNotEqualFloatArrays1(void);
+extern void testNotEqualFloatArrays2(void);
+extern void testNotEqualFloatArrays3(void);
+extern void testNotEqualFloatArraysNegative1(void);
+extern void testNotEqualFloatArraysNegative2(void);
+extern void testNotEqualFloatArraysNegative3(void);
+extern void testEqualFloatArraysNaN(void);
+extern void testEqualFloatArraysInf(void);
+extern void testNotEqualFloatArraysLengthZero(void);
+extern void testFloatArraysWithin(void);
+extern void testFloatArraysWithinUnusualDelta(void);
+extern void testEqualFloatEachEqual(void);
+extern void testNotEqualFloatEachEqualActualNull(void);
+extern void testNotEqualFloatEachEqual1(void);
+extern void testNotEqualFloatEachEqual2(void);
+extern void testNotEqualFloatEachEqual3(void);
+extern void testNotEqualFloatEachEqualNegative1(void);
+extern void testNotEqualFloatEachEqualNegative2(void);
+extern void testNotEqualFloatEachEqualNegative3(void);
+extern void testEqualFloatEachEqualNaN(void);
+extern void testEqualFloatEachEqualInf(void);
+extern void testNotEqualFloatEachEqualLengthZero(void);
+extern void testFloatPrinting(void);
+extern void testFloatPrintingRoundTiesToEven(void);
+extern void testFloatPrintingInfinityAndNaN(void);
+extern void testFloatPrintingRandomSamples(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("tests/test_unity_floats.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[102];
+
+  run_test_params_arr[0].func = testFloatsWithinDelta;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("testFloatsWithinDelta");
+  run_test_params_arr[0].line_num = 37;
+  run_test_params_arr[1].func = testFloatsNotWithinDelta;
+  run_test_params_arr[1].name = UNITY_TOKENIZE("testFloatsNotWithinDelta");
+  run_test_params_arr[1].line_num = 53;
+  run_test_params_arr[2].func = testFloatsEqual;
+  run_test_params_arr[2].name = UNITY_TOKENIZE("testFloatsEqual");
+  run_test_params_arr[2].line_num = 66;
+  run_test_params_arr[3].func = testFloatsNotEqual;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("testFloatsNotEqual");
+  run_test_params_arr[3].line_num = 82;
+  run_test_params_arr[4].func = testFloatsNotEqualNegative1;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("testFloatsNotEqualNegative1");
+  run_test_params_arr[4].line_num = 95;
+  run_test_params_arr[5].func = testFloatsNotEqualNegative2;
+  run_test_params_arr[5].name = UNITY_TOKENIZE("testFloatsNotEqualNegative2");
+  run_test_params_arr[5].line_num = 108;
+  run_test_params_arr[6].func = testFloatsNotEqualActualNaN;
+  run_test_params_arr[6].name = UNITY_TOKENIZE("testFloatsNotEqualActualNaN");
+  run_test_params_arr[6].line_num = 121;
+  run_test_params_arr[7].func = testFloatsNotEqualExpectedNaN;
+  run_test_params_arr[7].name = UNITY_TOKENIZE("testFloatsNotEqualExpectedNaN");
+  run_test_params_arr[7].line_num = 134;
+  run_test_params_arr[8].func = testFloatsEqualBothNaN;
+  run_test_params_arr[8].name = UNITY_TOKENIZE("testFloatsEqualBothNaN");
+  run_test_params_arr[8].line_num = 147;
+  run_test_params_arr[9].func = testFloatsNotEqualInfNaN;
+  run_test_params_arr[9].name = UNITY_TOKENIZE("testFloatsNotEqualInfNaN");
+  run_test_params_arr[9].line_num = 160;
+  run_test_params_arr[10].func = testFloatsNotEqualNaNInf;
+  run_test_params_arr[10].name = UNITY_TOKENIZE("testFloatsNotEqualNaNInf");
+  run_test_params_arr[10].line_num = 173;
+  run_test_params_arr[11].func = testFloatsNotEqualActualInf;
+  run_test_params_arr[11].name = UNITY_TOKENIZE("testFloatsNotEqualActualInf");
+  run_test_params_arr[11].line_num = 186;
+  run_test_params_arr[12].func = testFloatsNotEqualExpectedInf;
+  run_test_params_arr[12].name = UNITY_TOKENIZE("testFloatsNotEqualExpectedInf");
+  run_test_params_arr[12].line_num = 199;
+  run_test_params_arr[13].func = testFloatsEqualBothInf;
+  run_test_params_arr[13].name = UNITY_TOKENIZE("testFloatsEqualBothInf");
+  run_test_params_arr[13].line_num = 212;
+  run_test_params_arr[14].func = testFloatsNotEqualPlusMinusInf;
+  run_test_params_arr[14].name = UNITY_TOKENIZE("testFloatsNotEqualPlusMinusInf");
+  run_test_params_arr[14].line_num = 225;
+  run_test_params_arr[15].func = testFloatsGreaterThan;
+  run_test_params_arr[15].name = UNITY_TOKENIZE("testFloatsGreaterThan");
+  run_test_params_arr[15].line_num = 238;
+  run_test_params_arr[16].func = testFloatsGreaterThanInf;
+  run_test_params_arr[16].name = UNITY_TOKENIZE("testFloatsGreaterThanInf");
+  run_test_params_arr[16].line_num = 249;
+  run_test_params_arr[17].func = testFloatsNotGreaterThan;
+  run_test_params_arr[17].name = UNITY_TOKENIZE("testFloatsNotGreaterThan");
+  run_test_params_arr[17].line_num = 260;
+  run_test_params_arr[18].func = testFloatsNotGreaterThanNanActual;
+  run_test_params_arr[18].name = UNITY_TOKENIZE("testFloatsNotGreaterThanNanActual");
+  run_test_params_arr[18].line_num = 271;
+  run_test_params_arr[19].func = testFloatsNotGreaterThanNanThreshold;
+  run_test_params_arr[19].name = UNITY_TOKENIZE("testFloatsNotGreaterThanNanThreshold");
+  run_test_params_arr[19].line_num = 282;
+  run_test_params_arr[20].func = testFloatsNotGreaterThanNanBoth;
+  run_test_params_arr[20].name = UNITY_TOKENIZE("testFloatsNotGreaterThanNanBoth");
+  run_test_params_arr[20].line_num = 293;
+  run_test_params_arr[21].func = testFloatsNotGreaterThanInfActual;
+  run_test_params_arr[21].name = UNITY_TOKENIZE("testFloatsNotGreaterThanInfActual");
+  run_test_params_arr[21].line_num = 304;
+  run_test_params_arr[22].func = testFloatsNotGreaterThanNegInf;
+  run_test_params_arr[22].name = UNITY_TOKENIZE("testFloatsNotGreaterThanNegInf");
+  run_test_params_arr[22].line_num = 315;
+  run_test_params_arr[23].func = testFloatsNotGreaterThanBothInf;
+  run_test_params_arr[23].name = UNITY_TOKENIZE("testFloatsNotGreaterThanBothInf");
+  run_test_params_arr[23].line_num = 326;
+  run_test_params_arr[24].func = testFloatsNotGreaterThanBothNegInf;
+  run_test_params_arr[24].name = UNITY_TOKENIZE("testFloatsNotGreaterThanBothNegInf");
+  run_test_params_arr[24].line_num = 337;
+  run_test_params_arr[25].func = testFloatsGreaterOrEqual;
+  run_test_params_arr[25].name = UNITY_TOKENIZE("testFloatsGreaterOrEqual");
+  run_test_params_arr[25].line_num = 348;
+  run_test_params_arr[26].func = testFloatsGreaterOrEqualInf;
+  run_test_params_arr[26].name = UNITY_TOKENIZE("testFloatsGreaterOrEqualInf");
+  run_test_params_arr[26].line_num = 361;
+  run_test_params_arr[27].func = testFloatsNotGreaterOrEqual;
+  run_test_params_arr[27].name = UNITY_TOKENIZE("testFloatsNotGreaterOrEqual");
+  run_test_params_arr[27].line_num = 372;
+  run_test_params_arr[28].func = testFloatsNotGreaterOrEqualNanActual;
+  run_test_params_arr[28].name = UNITY_TOKENIZE("testFloatsNotGreaterOrEqualNanActual");
+  run_test_params_arr[28].line_num = 383;
+  run_test_params_arr[29].func = testFloatsNotGreaterOrEqualNanThreshold;
+  run_test_params_arr[29].name = UNITY_TOKENIZE("testFloatsNotGreaterOrEqualNanThreshold");
+  run_test_params_arr[29].line_num = 394;
+  run_test_params_arr[30].func = testFloatsGreaterOrEqualNanBoth;
+  run_test_params_arr[30].name = UNITY_TOKENIZE("testFloatsGreaterOrEqualNanBoth");
+  run_test_params_arr[30].line_num = 405;
+  run_test_params_arr[31].func = testFloatsNotGreaterOrEqualInfActual;
+  run_test_params_arr[31].name = UNITY_TOKENIZE("testFloatsNotGreaterOrEqualInfActual");
+  run_test_params_arr[31].line_num = 414;
+  run_test_params_arr[32].func = testFloatsNotGreaterOrEqualNegInf;
+  run_test_params_arr[32].name = UNITY_TOKENIZE("testFloatsNotGreaterOrEqualNegInf");
+  run_test_params_arr[32].line_num = 425;
+  run_test_params_arr[33].func = testFloatsGreaterOrEqualBothInf;
+  run_test_params_arr[33].name = UNITY_TOKENIZE("testFloatsGreaterOrEqualBothInf");
+  run_test_params_arr[33].line_num = 436;
+  run_test_params_arr[34].func = testFloatsGreaterOrEqualBothNegInf;
+  run_test_params_arr[34].name = UNITY_TOKENIZE("testFloatsGreaterOrEqualBothNegInf");
+  run_test_params_arr[34].line_num = 445;
+  run_test_params_arr[35].func = testFloatsLessThan;
+  run_test_params_arr[35].name = UNITY_TOKENIZE("testFloatsLessThan");
+  run_test_params_arr[35].line_num = 454;
+  run_test_params_arr[36].func = testFloatsLessThanInf;
+  run_test_params_arr[36].name = UNITY_TOKENIZE("testFloatsLessThanInf");
+  run_test_params_arr[36].line_num = 465;
+  run_test_params_arr[37].func = testFloatsNotLessThan;
+  run_test_params_arr[37].name = UNITY_TOKENIZE("testFloatsNotLessThan");
+  run_test_params_arr[37].line_num = 476;
+  run_test_params_arr[38].func = testFloatsNotLessThanNanActual;
+  run_test_params_arr[38].name = UNITY_TOKENIZE("testFloatsNotLessThanNanActual");
+  run_test_params_arr[38].line_num = 487;
+  run_test_params_arr[39].func = testFloatsNotLessThanNanThreshold;
+  run_test_params_arr[39].name = UNITY_TOKENIZE("testFloatsNotLessThanNanThreshold");
+  run_test_params_arr[39].line_num = 498;
+  run_test_params_arr[40].func = testFloatsNotLessThanNanBoth;
+  run_test_params_arr[40].name = UNITY_TOKENIZE("testFloatsNotLessThanNanBoth");
+  run_test_params_arr[40].line_num = 509;
+  run_test_params_arr[41].func = testFloatsNotLessThanInf;
+  run_test_params_arr[41].name = UNITY_TOKENIZE("testFloatsNotLessThanInf");
+  run_test_params_arr[41].line_num = 520;
+  run_test_params_arr[42].func = testFloatsNotLessThanNegInf;
+  run_test_params_arr[42].name = UNITY_TOKENIZE("testFloatsNotLessThanNegInf");
+  run_test_params_arr[42].line_num = 531;
+  run_test_params_arr[43].func = testFloatsNotLessThanBothInf;
+  run_test_params_arr[43].name = UNITY_TOKENIZE("testFloatsNotLessThanBothInf");
+  run_test_params_arr[43].line_num = 542;
+  run_test_params_arr[44].func = testFloatsNotLessThanBothNegInf;
+  run_test_params_arr[44].name = UNITY_TOKENIZE("testFloatsNotLessThanBothNegInf");
+  run_test_params_arr[44].line_num = 553;
+  run_test_params_arr[45].func = testFloatsLessOrEqual;
+  run_test_params_arr[45].name = UNITY_TOKENIZE("testFloatsLessOrEqual");
+  run_test_params_arr[45].line_num = 563;
+  run_test_params_arr[46].func = testFloatsLessOrEqualInf;
+  run_test_params_arr[46].name = UNITY_TOKENIZE("testFloatsLessOrEqualInf");
+  run_test_params_arr[46].line_num = 576;
+  run_test_params_arr[47].func = testFloatsNotLessOrEqual;
+  run_test_params_arr[47].name = UNITY_TOKENIZE("testFloatsNotLessOrEqual");
+  run_test_params_arr[47].line_num = 587;
+  run_test_params_arr[48].func = testFloatsNotLessOrEqualNanActual;
+  run_test_params_arr[48].name = UNITY_TOKENIZE("testFloatsNotLessOrEqualNanActual");
+  run_test_params_arr[48].line_num = 598;
+  run_test_params_arr[49].func = testFloatsNotLessOrEqualNanThreshold;
+  run_test_params_arr[49].name = UNITY_TOKENIZE("testFloatsNotLessOrEqualNanThreshold");
+  run_test_params_arr[49].line_num = 609;
+  run_test_params_arr[50].func = testFloatsLessOrEqualNanBoth;
+  run_test_params_arr[50].name = UNITY_TOKENIZE("testFloatsLessOrEqualNanBoth");
+  run_test_params_arr[50].line_num = 620;
+  run_test_params_arr[51].func = testFloatsNotLessOrEqualInf;
+  run_test_params_arr[51].name = UNITY_TOKENIZE("testFloatsNotLessOrEqualInf");
+  run_test_params_arr[51].line_num = 629;
+  run_test_params_arr[52].func = testFloatsNotLessOrEqualNegInf;
+  run_test_params_arr[52].name = UNITY_TOKENIZE("testFloatsNotLessOrEqualNegInf");
+  run_test_params_arr[52].line_num = 640;
+  run_test_params_arr[53].func = testFloatsLessOrEqualBothInf;
+  run_test_params_arr[53].name = UNITY_TOKENIZE("testFloatsLessOrEqualBothInf");
+  run_test_params_arr[53].line_num = 651;
+  run_test_params_arr[54].func = testFloatsLessOrEqualBothNegInf;
+  run_test_params_arr[54].name = UNITY_TOKENIZE("testFloatsLessOrEqualBothNegInf");
+  run_test_params_arr[54].line_num = 660;
+  run_test_params_arr[55].func = testFloatIsPosInf1;
+  run_test_params_arr[55].name = UNITY_TOKENIZE("testFloatIsPosInf1");
+  run_test_params_arr[55].line_num = 669;
+  run_test_params_arr[56].func = testFloatIsPosInf2;
+  run_test_params_arr[56].name = UNITY_TOKENIZE("testFloatIsPosInf2");
+  run_test_params_arr[56].line_num = 678;
+  run_test_params_arr[57].func = testFloatIsNegInf1;
+  run_test_params_arr[57].name = UNITY_TOKENIZE("testFloatIsNegInf1");
+  run_test_params_arr[57].line_num = 689;
+  run_test_params_arr[58].func = testFloatIsNegInf2;
+  run_test_params_arr[58].name = UNITY_TOKENIZE("testFloatIsNegInf2");
+  run_test_params_arr[58].line_num = 698;
+  run_test_params_arr[59].func = testFloatIsNotPosInf1;
+  run_test_params_arr[59].name = UNITY_TOKENIZE("testFloatIsNotPosInf1");
+  run_test_params_arr[59].line_num = 709;
+  run_test_params_arr[60].func = testFloatIsNotPosInf2;
+  run_test_params_arr[60].name = UNITY_TOKENIZE("testFloatIsNotPosInf2");
+  run_test_params_arr[60].line_num = 720;
+  run_test_params_arr[61].func = testFloatIsNotNegInf;
+  run_test_params_arr[61].name = UNITY_TOKENIZE("testFloatIsNotNegInf");
+  run_test_params_arr[61].line_num = 729;
+  run_test_params_arr[62].func = testFloatIsNan1;
+  run_test_params_arr[62].name = UNITY_TOKENIZE("testFloatIsNan1");
+  run_test_params_arr[62].line_num = 740;
+  run_test_params_arr[63].func = testFloatIsNan2;
+  run_test_params_arr[63].name = UNITY_TOKENIZE("testFloatIsNan2");
+  run_test_params_arr[63].line_num = 749;
+  run_test_params_arr[64].func = testFloatIsNotNan1;
+  run_test_params_arr[64].name = UNITY_TOKENIZE("testFloatIsNotNan1");
+  run_test_params_arr[64].line_num = 760;
+  run_test_params_arr[65].func = testFloatIsNotNan2;
+  run_test_params_arr[65].name = UNITY_TOKENIZE("testFloatIsNotNan2");
+  run_test_params_arr[65].line_num = 771;
+  run_test_params_arr[66].func = testFloatInfIsNotNan;
+  run_test_params_arr[66].name = UNITY_TOKENIZE("testFloatInfIsNotNan");
+  run_test_params_arr[66].line_num = 780;
+  run_test_params_arr[67].func = testFloatNanIsNotInf;
+  run_test_params_arr[67].name = UNITY_TOKENIZE("testFloatNanIsNotInf");
+  run_test_params_arr[67].line_num = 791;
+  run_test_params_arr[68].func = testFloatIsDeterminate1;
+  run_test_params_arr[68].name = UNITY_TOKENIZE("testFloatIsDeterminate1");
+  run_test_params_arr[68].line_num = 802;
+  run_test_params_arr[69].func = testFloatIsDeterminate2;
+  run_test_params_arr[69].name = UNITY_TOKENIZE("testFloatIsDeterminate2");
+  run_test_params_arr[69].line_num = 813;
+  run_test_params_arr[70].func = testFloatIsNotDeterminate1;
+  run_test_params_arr[70].name = UNITY_TOKENIZE("testFloatIsNotDeterminate1");
+  run_test_params_arr[70].line_num = 824;
+  run_test_params_arr[71].func = testFloatIsNotDeterminate2;
+  run_test_params_arr[71].name = UNITY_TOKENIZE("testFloatIsNotDeterminate2");
+  run_test_params_arr[71].line_num = 835;
+  run_test_params_arr[72].func = testFloatTraitFailsOnInvalidTrait;
+  run_test_params_arr[72].name = UNITY_TOKENIZE("testFloatTraitFailsOnInvalidTrait");
+  run_test_params_arr[72].line_num = 846;
+  run_test_params_arr[73].func = testEqualFloatArrays;
+  run_test_params_arr[73].name = UNITY_TOKENIZE("testEqualFloatArrays");
+  run_test_params_arr[73].line_num = 857;
+  run_test_params_arr[74].func = testNotEqualFloatArraysExpectedNull;
+  run_test_params_arr[74].name = UNITY_TOKENIZE("testNotEqualFloatArraysExpectedNull");
+  run_test_params_arr[74].line_num = 876;
+  run_test_params_arr[75].func = testNotEqualFloatArraysActualNull;
+  run_test_params_arr[75].name = UNITY_TOKENIZE("testNotEqualFloatArraysActualNull");
+  run_test_params_arr[75].line_num = 890;
+  run_test_params_arr[76].func = testNotEqualFloatArrays1;
+  run_test_params_arr[76].name = UNITY_TOKENIZE("testNotEqualFloatArrays1");
+  run_test_params_arr[76].line_num = 904;
+  run_test_params_arr[77].func = testNotEqualFloatArrays2;
+  run_test_params_arr[77].name = UNITY_TOKENIZE("testNotEqualFloatArrays2");
+  run_test_params_arr[77].line_num = 918;
+  run_test_params_arr[78].func = testNotEqualFloatArrays3;
+  run_test_params_arr[78].name = UNITY_TOKENIZE("testNotEqualFloatArrays3");
+  run_test_params_arr[78].line_num = 932;
+  run_test_params_arr[79].func = testNotEqualFloatArraysNegative1;
+  run_test_params_arr[79].name = UNITY_TOKENIZE("testNotEqualFloatArraysNegative1");
+  run_test_params_arr[79].line_num = 946;
+  run_test_params_arr[80].func = testNotEqualFloatArraysNegative2;
+  run_test_params_arr[80].name = UNITY_TOKENIZE("testNotEqualFloatArraysNegative2");
+  run_test_params_arr[80].line_num = 960;
+  run_test_params_arr[81].func = testNotEqualFloatArraysNegative3;
+  run_test_params_arr[81].name = UNITY_TOKENIZE("testNotEqualFloatArraysNegative3");
+  run_test_params_arr[81].line_num = 974;
+  run_test_params_arr[82].func = testEqualFloatArraysNaN;
+  run_test_params_arr[82].name = UNITY_TOKENIZE("testEqualFloatArraysNaN");
+  run_test_params_arr[82].line_num = 988;
+  run_test_params_arr[83].func = testEqualFloatArraysInf;
+  run_test_params_arr[83].name = UNITY_TOKENIZE("testEqualFloatArraysInf");
+  run_test_params_arr[83].line_num = 1000;
+  run_test_params_arr[84].func = testNotEqualFloatArraysLengthZero;
+  run_test_params_arr[84].name = UNITY_TOKENIZE("testNotEqualFloatArraysLengthZero");
+  run_test_params_arr[84].line_num = 1012;
+  run_test_params_arr[85].func = testFloatArraysWithin;
+  run_test_params_arr[85].name = UNITY_TOKENIZE("testFloatArraysWithin");
+  run_test_params_arr[85].line_num = 1026;
+  run_test_params_arr[86].func = testFloatArraysWithinUnusualDelta;
+  run_test_params_arr[86].name = UNITY_TOKENIZE("testFloatArraysWithinUnusualDelta");
+  run_test_params_arr[86].line_num = 1051;
+  run_test_params_arr[87].func = testEqualFloatEachEqual;
+  run_test_params_arr[87].name = UNITY_TOKENIZE("testEqualFloatEachEqual");
+  run_test_params_arr[87].line_num = 1067;
+  run_test_params_arr[88].func = testNotEqualFloatEachEqualActualNull;
+  run_test_params_arr[88].name = UNITY_TOKENIZE("testNotEqualFloatEachEqualActualNull");
+  run_test_params_arr[88].line_num = 1085;
+  run_test_params_arr[89].func = testNotEqualFloatEachEqual1;
+  run_test_params_arr[89].name = UNITY_TOKENIZE("testNotEqualFloatEachEqual1");
+  run_test_params_arr[89].line_num = 1098;
+  run_test_params_arr[90].func = testNotEqualFloatEachEqual2;
+  run_test_params_arr[90].name = UNITY_TOKENIZE("testNotEqualFloatEachEqual2");
+  run_test_params_arr[90].line_num = 1111;
+  run_test_params_arr[91].func = testNotEqualFloatEachEqual3;
+  run_test_params_arr[91].name = UNITY_TOKENIZE("testNotEqualFloatEachEqual3");
+  run_test_params_arr[91].line_num = 1124;
+  run_test_params_arr[92].func = testNotEqualFloatEachEqualNegative1;
+  run_test_params_arr[92].name = UNITY_TOKENIZE("testNotEqualFloatEachEqualNegative1");
+  run_test_params_arr[92].line_num = 1137;
+  run_test_params_arr[93].func = testNotEqualFloatEachEqualNegative2;
+  run_test_params_arr[93].name = UNITY_TOKENIZE("testNotEqualFloatEachEqualNegative2");
+  run_test_params_arr[93].line_num = 1150;
+  run_test_params_arr[94].func = testNotEqualFloatEachEqualNegative3;
+  run_test_params_arr[94].name = UNITY_TOKENIZE("testNotEqualFloatEachEqualNegative3");
+  run_test_params_arr[94].line_num = 1163;
+  run_test_params_arr[95].func = testEqualFloatEachEqualNaN;
+  run_test_params_arr[95].name = UNITY_TOKENIZE("testEqualFloatEachEqualNaN");
+  run_test_params_arr[95].line_num = 1176;
+  run_test_params_arr[96].func = testEqualFloatEachEqualInf;
+  run_test_params_arr[96].name = UNITY_TOKENIZE("testEqualFloatEachEqualInf");
+  run_test_params_arr[96].line_num = 1187;
+  run_test_params_arr[97].func = testNotEqualFloatEachEqualLengthZero;
+  run_test_params_arr[97].name = UNITY_TOKENIZE("testNotEqualFloatEachEqualLengthZero");
+  run_test_params_arr[97].line_num = 1198;
+  run_test_params_arr[98].func = testFloatPrinting;
+  run_test_params_arr[98].name = UNITY_TOKENIZE("testFloatPrinting");
+  run_test_params_arr[98].line_num = 1214;
+  run_test_params_arr[99].func = testFloatPrintingRoundTiesToEven;
+  run_test_params_arr[99].name = UNITY_TOKENIZE("testFloatPrintingRoundTiesToEven");
+  run_test_params_arr[99].line_num = 1266;
+  run_test_params_arr[100].func = testFloatPrintingInfinityAndNaN;
+  run_test_params_arr[100].name = UNITY_TOKENIZE("testFloatPrintingInfinityAndNaN");
+  run_test_params_arr[100].line_num = 1285;
+  run_test_params_arr[101].func = testFloatPrintingRandomSamples;
+  run_test_params_arr[101].name = UNITY_TOKENIZE("testFloatPrintingRandomSamples");
+  run_test_params_arr[101].line_num = 1380;
+
+  for (int i = 0; i < 102; i++)
+  {
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
@@ -0,0 +1,522 @@
+#include "unity.h" /* Autogenerated by awk in Makefile */
+void testNotEqualInts(void);
+void testNotEqualInt8s(void);
+void testNotEqualChars(void);
+void testNotEqualInt16s(void);
+void testNotEqualInt32s(void);
+void testNotEqualBits(void);
+void testNotEqualUInts(void);
+void testNotEqualUInt8s(void);
+void testNotEqualUInt16s(void);
+void testNotEqualUInt32s(void);
+void testNotEqualHex8s(void);
+void testNotEqualHex8sIfSigned(void);
+void testNotEqualHex16s(void);
+void testNotEqualHex16sIfSigned(void);
+void testNotEqualHex32s(void);
+void testNotEqualHex32sIfSigned(void);
+void testEqualInts(void);
+void testEqualInt8s(void);
+void testEqualInt8sWhenThereAreDifferencesOutside8Bits(void);
+void testEqualChars(void);
+void testEqualCharsWhenThereAreDifferencesOutside8Bits(void);
+void testEqualInt16s(void);
+void testEqualInt16sNegatives(void);
+void testEqualInt16sWhenThereAreDifferencesOutside16Bits(void);
+void testEqualInt32s(void);
+void testEqualInt32sNegatives(void);
+void testEqualUints(void);
+void testEqualUint8s(void);
+void testEqualUint8sWhenThereAreDifferencesOutside8Bits(void);
+void testEqualUint16s(void);
+void testEqualUint16sWhenThereAreDifferencesOutside16Bits(void);
+void testEqualUint32s(void);
+void testNotEqual(void);
+void testEqualHex8s(void);
+void testEqualHex8sWhenThereAreDifferencesOutside8Bits(void);
+void testEqualHex8sNegatives(void);
+void testEqualHex16s(void);
+void testEqualHex16sWhenThereAreDifferencesOutside16Bits(void);
+void testEqualHex32s(void);
+void testEqualBits(void);
+void testNotEqualBitHigh(void);
+void testNotEqualBitLow(void);
+void testNotEqualBitsHigh(void);
+void testNotEqualBitsLow(void);
+void testEqualShorts(void);
+void testEqualUShorts(void);
+void testEqualUInts(void);
+void testEqualUChars(void);
+void testEqualPointers(void);
+void testNotEqualPointers(void);
+void testNotEqualPtr(void);
+void testNotNotEqualPointers(void);
+void testNotNotEqualPointers_BothNull(void);
+void testIntsWithinDelta(void);
+void testIntsWithinDeltaAndCustomMessage(void);
+void testIntsNotWithinDelta(void);
+void testIntsNotWithinDeltaAndCustomMessage(void);
+void testUIntsWithinDelta(void);
+void testUIntsWithinDeltaAndCustomMessage(void);
+void testUIntsNotWithinDelta(void);
+void testUIntsNotWithinDeltaAndCustomMessage(void);
+void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirst(void);
+void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirstAndCustomMessage(void);
+void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirst(void);
+void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirstAndCustomMessage(void);
+void testHEX32sWithinDelta(void);
+void testHEX32sWithinDeltaShouldIgnoreSign(void);
+void testHEX32sWithinDeltaAndCustomMessage(void);
+void testHEX32sNotWithinDelta(void);
+void testHEX32sNotWithinDeltaAndCustomMessage(void);
+void testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+void testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage(void);
+void testHEX16sWithinDelta(void);
+void testHEX16sWithinDeltaShouldIgnoreSign(void);
+void testHEX16sWithinDeltaAndCustomMessage(void);
+void testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+void testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+void testHEX16sNotWithinDelta(void);
+void testHEX16sNotWithinDeltaAndCustomMessage(void);
+void testHEX8sWithinDelta(void);
+void testHEX8sWithinDeltaShouldIgnoreSign(void);
+void testHEX8sWithinDeltaAndCustomMessage(void);
+void testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+void testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+void testHEX8sNotWithinDelta(void);
+void testHEX8sNotWithinDeltaAndCustomMessage(void);
+void testUINT32sWithinDelta(void);
+void testUINT32sWithinDeltaAndCustomMessage(void);
+void testUINT32sNotWithinDelta(void);
+void testUINT32sNotWithinDeltaAndCustomMessage(void);
+void testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+void testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage(void);
+void testUINT16sWithinDelta(void);
+void testUINT16sWithinDeltaAndCustomMessage(void);
+void testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+void testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+void testUINT16sNotWithinDelta(void);
+void testUINT16sNotWithinDeltaAndCustomMessage(void);
+void testUINT8sWithinDelta(void);
+void testUINT8sWithinDeltaAndCustomMessage(void);
+void testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+void testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+void testUINT8sNotWithinDelta(void);
+void testUINT8sNotWithinDeltaAndCustomMessage(void);
+void testINT32sWithinDelta(void);
+void testINT32sWithinDeltaAndCustomMessage(void);
+void testINT32sNotWithinDelta(void);
+void testINT32sNotWithinDeltaAndDifferenceOverflows(void);
+void testINT32sNotWithinDeltaAndCustomMessage(void);
+void testINT16sWithinDelta(void);
+void testINT16sWithinDeltaAndCustomMessage(void);
+void testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+void testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+void testINT16sNotWithinDelta(void);
+void testINT16sNotWithinDeltaAndCustomMessage(void);
+void testINT8sWithinDelta(void);
+void testINT8sWithinDeltaAndCustomMessage(void);
+void testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+void testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+void testINT8sNotWithinDelta(void);
+void testINT8sNotWithinDeltaAndCustomMessage(void);
+void testCHARsWithinDelta(void);
+void testCHARsWithinDeltaAndCustomMessage(void);
+void testCHARsWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+void testCHARsWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+void testCHARsNotWithinDelta(void);
+void testCHARsNotWithinDeltaAndCustomMessage(void);
+void testNotEqualINT(void);
+void testNotNotEqualINT(void);
+void testNotEqualINT8(void);
+void testNotNotEqualINT8(void);
+void testNotEqualCHAR(void);
+void testNotNotEqualCHAR(void);
+void testNotEqualINT16(void);
+void testNotNotEqualINT16(void);
+void testNotEqualINT32(void);
+void testNotNotEqualINT32(void);
+void testNotEqualUINT(void);
+void testNotNotEqualUINT(void);
+void testNotEqualUINT8(void);
+void testNotNotEqualUINT8(void);
+void testNotEqualUINT16(void);
+void testNotNotEqualUINT16(void);
+void testNotEqualUINT32(void);
+void testNotNotEqualUINT32(void);
+void testNotEqualHEX8(void);
+void testNotNotEqualHEX8(void);
+void testNotEqualHEX16(void);
+void testNotNotEqualHEX16(void);
+void testNotEqualHEX32(void);
+void testNotNotEqualHEX32(void);
+void testGreaterThan(void);
+void testNotGreaterThan(void);
+void testGreaterThanINT(void);
+void testNotGreaterThanINT(void);
+void testGreaterThanINT8(void);
+void testNotGreaterThanINT8(void);
+void testGreaterThanCHAR(void);
+void testNotGreaterThanCHAR(void);
+void testGreaterThanINT16(void);
+void testNotGreaterThanINT16(void);
+void testGreaterThanINT32(void);
+void testNotGreaterThanINT32(void);
+void testGreaterThanUINT(void);
+void testNotGreaterThanUINT(void);
+void testGreaterThanUINT8(void);
+void testNotGreaterThanUINT8(void);
+void testGreaterThanUINT16(void);
+void testNotGreaterThanUINT16(void);
+void testGreaterThanUINT32(void);
+void testNotGreaterThanUINT32(void);
+void testGreaterThanHEX8(void);
+void testNotGreaterThanHEX8(void);
+void testGreaterThanHEX16(void);
+void testNotGreaterThanHEX16(void);
+void testGreaterThanHEX32(void);
+void testNotGreaterThanHEX32(void);
+void testGreaterOrEqual(void);
+void testNotGreaterOrEqual(void);
+void testGreaterOrEqualINT(void);
+void testNotGreaterOrEqualINT(void);
+void testGreaterOrEqualINT8(void);
+void testNotGreaterOrEqualINT8(void);
+void testGreaterOrEqualCHAR(void);
+void testNotGreaterOrEqualCHAR(void);
+void testGreaterOrEqualINT16(void);
+void testNotGreaterOrEqualINT16(void);
+void testGreaterOrEqualINT32(void);
+void testNotGreaterOrEqualINT32(void);
+void testGreaterOrEqualUINT(void);
+void testNotGreaterOrEqualUINT(void);
+void testGreaterOrEqualUINT8(void);
+void testNotGreaterOrEqualUINT8(void);
+void testGreaterOrEqualUINT16(void);
+void testNotGreaterOrEqualUINT16(void);
+void testGreaterOrEqualUINT32(void);
+void testNotGreaterOrEqualUINT32(void);
+void testGreaterOrEqualHEX8(void);
+void testNotGreaterOrEqualHEX8(void);
+void testGreaterOrEqualHEX16(void);
+void testNotGreaterOrEqualHEX16(void);
+void testGreaterOrEqualHEX32(void);
+void testNotGreaterOrEqualHEX32(void);
+void testLessThan(void);
+void testNotLessThan(void);
+void testLessThanINT(void);
+void testNotLessThanINT(void);
+void testLessThanINT8(void);
+void testNotLessThanINT8(void);
+void testLessThanCHAR(void);
+void testNotLessThanCHAR(void);
+void testLessThanINT16(void);
+void testNotLessThanINT16(void);
+void testLessThanINT32(void);
+void testNotLessThanINT32(void);
+void testLessThanUINT(void);
+void testNotLessThanUINT(void);
+void testLessThanUINT8(void);
+void testNotLessThanUINT8(void);
+void testLessThanUINT16(void);
+void testNotLessThanUINT16(void);
+void testLessThanUINT32(void);
+void testNotLessThanUINT32(void);
+void testLessThanHEX8(void);
+void testNotLessThanHEX8(void);
+void testLessThanHEX16(void);
+void testNotLessThanHEX16(void);
+void testLessThanHEX32(void);
+void testNotLessThanHEX32(void);
+void testLessOrEqual(void);
+void testNotLessOrEqual(void);
+void testLessOrEqualINT(void);
+void testNotLessOrEqualINT(void);
+void testLessOrEqualINT8(void);
+void testNotLessOrEqualINT8(void);
+void testLessOrEqualCHAR(void);
+void testNotLessOrEqualCHAR(void);
+void testLessOrEqualINT16(void);
+void testNotLessOrEqualINT16(void);
+void testLessOrEqualINT32(void);
+void testNotLessOrEqualINT32(void);
+void testLessOrEqualUINT(void);
+void testNotLessOrEqualUINT(void);
+void testLessOrEqualUINT8(void);
+void testNotLessOrEqualUINT8(void);
+void testLessOrEqualUINT16(void);
+void testNotLessOrEqualUINT16(void);
+void testLessOrEqualUINT32(void);
+void testNotLessOrEqualUINT32(void);
+void testLessOrEqualHEX8(void);
+void testNotLessOrEqualHEX8(void);
+void testLessOrEqualHEX16(void);
+void testNotLessOrEqualHEX16(void);
+void testLessOrEqualHEX32(void);
+void testNotLessOrEqualHEX32(void);
+void testHexPrintsUpToMaxNumberOfNibbles(void);
+void testPrintNumbers32(void);
+void testPrintNumbersUnsigned32(void);
+int main(void)
+{
+    UnityBegin("tests/test_unity_integers.c");
+    RUN_TEST(testNotEqualInts, 37);
+    RUN_TEST(testNotEqualInt8s, 44);
+    RUN_TEST(testNotEqualChars, 51);
+    RUN_TEST(testNotEqualInt16s, 58);
+    RUN_TEST(testNotEqualInt32s, 65);
+    RUN_TEST(testNotEqualBits, 74);
+    RUN_TEST(testNotEqualUInts, 81);
+    RUN_TEST(testNotEqualUInt8s, 93);
+    RUN_TEST(testNotEqualUInt16s, 105);
+    RUN_TEST(testNotEqualUInt32s, 117);
+    RUN_TEST(testNotEqualHex8s, 129);
+    RUN_TEST(testNotEqualHex8sIfSigned, 141);
+    RUN_TEST(testNotEqualHex16s, 153);
+    RUN_TEST(testNotEqualHex16sIfSigned, 165);
+    RUN_TEST(testNotEqualHex32s, 177);
+    RUN_TEST(testNotEqualHex32sIfSigned, 189);
+    RUN_TEST(testEqualInts, 201);
+    RUN_TEST(testEqualInt8s, 221);
+    RUN_TEST(testEqualInt8sWhenThereAreDifferencesOutside8Bits, 240);
+    RUN_TEST(testEqualChars, 246);
+    RUN_TEST(testEqualCharsWhenThereAreDifferencesOutside8Bits, 265);
+    RUN_TEST(testEqualInt16s, 272);
+    RUN_TEST(testEqualInt16sNegatives, 291);
+    RUN_TEST(testEqualInt16sWhenThereAreDifferencesOutside16Bits, 310);
+    RUN_TEST(testEqualInt32s, 316);
+    RUN_TEST(testEqualInt32sNegatives, 335);
+    RUN_TEST(testEqualUints, 355);
+    RUN_TEST(testEqualUint8s, 376);
+    RUN_TEST(testEqualUint8sWhenThereAreDifferencesOutside8Bits, 395);
+    RUN_TEST(testEqualUint16s, 401);
+    RUN_TEST(testEqualUint16sWhenThereAreDifferencesOutside16Bits, 420);
+    RUN_TEST(testEqualUint32s, 426);
+    RUN_TEST(testNotEqual, 445);
+    RUN_TEST(testEqualHex8s, 456);
+    RUN_TEST(testEqualHex8sWhenThereAreDifferencesOutside8Bits, 475);
+    RUN_TEST(testEqualHex8sNegatives, 481);
+    RUN_TEST(testEqualHex16s, 500);
+    RUN_TEST(testEqualHex16sWhenThereAreDifferencesOutside16Bits, 519);
+    RUN_TEST(testEqualHex32s, 525);
+    RUN_TEST(testEqualBits, 544);
+    RUN_TEST(testNotEqualBitHigh, 560);
+    RUN_TEST(testNotEqualBitLow, 569);
+    RUN_TEST(testNotEqualBitsHigh, 578);
+    RUN_TEST(testNotEqualBitsLow, 589);
+    RUN_TEST(testEqualShorts, 600);
+    RUN_TEST(testEqualUShorts, 620);
+    RUN_TEST(testEqualUInts, 640);
+    RUN_TEST(testEqualUChars, 660);
+    RUN_TEST(testEqualPointers, 679);
+    RUN_TEST(testNotEqualPointers, 696);
+    RUN_TEST(testNotEqualPtr, 703);
+    RUN_TEST(testNotNotEqualPointers, 720);
+    RUN_TEST(testNotNotEqualPointers_BothNull, 730);
+    RUN_TEST(testIntsWithinDelta, 737);
+    RUN_TEST(testIntsWithinDeltaAndCustomMessage, 749);
+    RUN_TEST(testIntsNotWithinDelta, 761);
+    RUN_TEST(testIntsNotWithinDeltaAndCustomMessage, 768);
+    RUN_TEST(testUIntsWithinDelta, 775);
+    RUN_TEST(testUIntsWithinDeltaAndCustomMessage, 782);
+    RUN_TEST(testUIntsNotWithinDelta, 789);
+    RUN_TEST(testUIntsNotWithinDeltaAndCustomMessage, 796);
+    RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirst, 803);
+    RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirstAndCustomMessage, 810);
+    RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirst, 817);
+    RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirstAndCustomMessage, 824);
+    RUN_TEST(testHEX32sWithinDelta, 831);
+    RUN_TEST(testHEX32sWithinDeltaShouldIgnoreSign, 838);
+    RUN_TEST(testHEX32sWithinDeltaAndCustomMessage, 843);
+    RUN_TEST(testHEX32sNotWithinDelta, 850);
+    RUN_TEST(testHEX32sNotWithinDeltaAndCustomMessage, 857);
+    RUN_TEST(testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPass, 864);
+    RUN_TEST(testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage, 871);
+    RUN_TEST(testHEX16sWithinDelta, 878);
+    RUN_TEST(testHEX16sWithinDeltaShouldIgnoreSign, 885);
+    RUN_TEST(testHEX16sWithinDeltaAndCustomMessage, 890);
+    RUN_TEST(testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits, 897);
+    RUN_TEST(testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage, 902);
+    RUN_TEST(testHEX16sNotWithinDelta, 907);
+    RUN_TEST(testHEX16sNotWithinDeltaAndCustomMessage, 914);
+    RUN_TEST(testHEX8sWithinDelta, 921);
+    RUN_TEST(testHEX8sWithinDeltaShouldIgnoreSign, 928);
+    RUN_TEST(testHEX8sWithinDeltaAndCustomMessage, 933);
+    RUN_TEST(testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 940);
+    RUN_TEST(testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 945);
+    RUN_TEST(testHEX8sNotWithinDelta, 950);
+    RUN_TEST(testHEX8sNotWithinDeltaAndCustomMessage, 957);
+    RUN_TEST(testUINT32sWithinDelta, 966);
+    RUN_TEST(testUINT32sWithinDeltaAndCustomMessage, 973);
+    RUN_TEST(testUINT32sNotWithinDelta, 980);
+    RUN_TEST(testUINT32sNotWithinDeltaAndCustomMessage, 987);
+    RUN_TEST(testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPass, 994);
+    RUN_TEST(testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage, 1001);
+    RUN_TEST(testUINT16sWithinDelta, 1008);
+    RUN_TEST(testUINT16sWithinDeltaAndCustomMessage, 1015);
+    RUN_TEST(testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits, 1022);
+    RUN_TEST(testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage, 1027);
+    RUN_TEST(testUINT16sNotWithinDelta, 1032);
+    RUN_TEST(testUINT16sNotWithinDeltaAndCustomMessage, 1039);
+    RUN_TEST(testUINT8sWithinDelta, 1046);
+    RUN_TEST(testUINT8sWithinDeltaAndCustomMessage, 1053);
+    RUN_TEST(testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 1060);
+    RUN_TEST(testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 1065);
+    RUN_TEST(testUINT8sNotWithinDelta, 1070);
+    RUN_TEST(testUINT8sNotWithinDeltaAndCustomMessage, 1077);
+    RUN_TEST(testINT32sWithinDelta, 1084);
+    RUN_TEST(testINT32sWithinDeltaAndCustomMessage, 1091);
+    RUN_TEST(testINT32sNotWithinDelta, 1096);
+    RUN_TEST(testINT32sNotWithinDeltaAndDifferenceOverflows, 1103);
+    RUN_TEST(testINT32sNotWithinDeltaAndCustomMessage, 1109);
+    RUN_TEST(testINT16sWithinDelta, 1116);
+    RUN_TEST(testINT16sWithinDeltaAndCustomMessage, 1123);
+    RUN_TEST(testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits, 1128);
+    RUN_TEST(testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage, 1133);
+    RUN_TEST(testINT16sNotWithinDelta, 1138);
+    RUN_TEST(testINT16sNotWithinDeltaAndCustomMessage, 1145);
+    RUN_TEST(testINT8sWithinDelta, 1152);
+    RUN_TEST(testINT8sWithinDeltaAndCustomMessage, 1159);
+    RUN_TEST(testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 1164);
+    RUN_TEST(testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 1169);
+    RUN_TEST(testINT8sNotWithinDelta, 1174);
+    RUN_TEST(testINT8sNotWithinDeltaAndCustomMessage, 1181);
+    RUN_TEST(testCHARsWithinDelta, 1188);
+    RUN_TEST(testCHARsWithinDeltaAndCustomMessage, 1195);
+    RUN_TEST(testCHARsWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 1200);
+    RUN_TEST(testCHARsWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 1205);
+    RUN_TEST(testCHARsNotWithinDelta, 1210);
+    RUN_TEST(testCHARsNotWithinDeltaAndCustomMessage, 1217);
+    RUN_TEST(testNotEqualINT, 1224);
+    RUN_TEST(testNotNotEqualINT, 1240);
+    RUN_TEST(testNotEqualINT8, 1247);
+    RUN_TEST(testNotNotEqualINT8, 1263);
+    RUN_TEST(testNotEqualCHAR, 1270);
+    RUN_TEST(testNotNotEqualCHAR, 1286);
+    RUN_TEST(testNotEqualINT16, 1293);
+    RUN_TEST(testNotNotEqualINT16, 1309);
+    RUN_TEST(testNotEqualINT32, 1316);
+    RUN_TEST(testNotNotEqualINT32, 1332);
+    RUN_TEST(testNotEqualUINT, 1339);
+    RUN_TEST(testNotNotEqualUINT, 1355);
+    RUN_TEST(testNotEqualUINT8, 1362);
+    RUN_TEST(testNotNotEqualUINT8, 1378);
+    RUN_TEST(testNotEqualUINT16, 1385);
+    RUN_TEST(testNotNotEqualUINT16, 1401);
+    RUN_TEST(testNotEqualUINT32, 1408);
+    RUN_TEST(testNotNotEqualUINT32, 1424);
+    RUN_TEST(testNotEqualHEX8, 1431);
+    RUN_TEST(testNotNotEqualHEX8, 1447);
+    RUN_TEST(testNotEqualHEX16, 1454);
+    RUN_TEST(testNotNotEqualHEX16, 1470);
+    RUN_TEST(testNotEqualHEX32, 1477);
+    RUN_TEST(testNotNotEqualHEX32, 1493);
+    RUN_TEST(testGreaterThan, 1502);
+    RUN_TEST(testNotGreaterThan, 1518);
+    RUN_TEST(testGreaterThanINT, 1525);
+    RUN_TEST(testNotGreaterThanINT, 1541);
+    RUN_TEST(testGreaterThanINT8, 1548);
+    RUN_TEST(testNotGreaterThanINT8, 1564);
+    RUN_TEST(testGreaterThanCHAR, 1571);
+    RUN_TEST(testNotGreaterThanCHAR, 1587);
+    RUN_TEST(testGreaterThanINT16, 1594);
+    RUN_TEST(testNotGreaterThanINT16, 1610);
+    RUN_TEST(testGreaterThanINT32, 1617);
+    RUN_TEST(testNotGreaterThanINT32, 1633);
+    RUN_TEST(testGreaterThanUINT, 1640);
+    RUN_TEST(testNotGreaterThanUINT, 1656);
+    RUN_TEST(testGreaterThanUINT8, 1663);
+    RUN_TEST(testNotGreaterThanUINT8, 1679);
+    RUN_TEST(testGreaterThanUINT16, 1686);
+    RUN_TEST(testNotGreaterThanUINT16, 1702);
+    RUN_TEST(testGreaterThanUINT32, 1709);
+    RUN_TEST(testNotGreaterThanUINT32, 1725);
+    RUN_TEST(testGreaterThanHEX8, 1732);
+    RUN_TEST(testNotGreaterThanHEX8, 1748);
+    RUN_TEST(testGreaterThanHEX16, 1755);
+    RUN_TEST(testNotGreaterThanHEX16, 1771);
+    RUN_TEST(testGreaterThanHEX32, 1778);
+    RUN_TEST(testNotGreaterThanHEX32, 1794);
+    RUN_TEST(testGreaterOrEqual, 1801);
+    RUN_TEST(testNotGreaterOrEqual, 1823);
+    RUN_TEST(testGreaterOrEqualINT, 1830);
+    RUN_TEST(testNotGreaterOrEqualINT, 1852);
+    RUN_TEST(testGreaterOrEqualINT8, 1859);
+    RUN_TEST(testNotGreaterOrEqualINT8, 1881);
+    RUN_TEST(testGreaterOrEqualCHAR, 1888);
+    RUN_TEST(testNotGreaterOrEqualCHAR, 1910);
+    RUN_TEST(testGreaterOrEqualINT16, 1917);
+    RUN_TEST(testNotGreaterOrEqualINT16, 1939);
+    RUN_TEST(testGreaterOrEqualINT32, 1946);
+    RUN_TEST(testNotGreaterOrEqualINT32, 1968);
+    RUN_TEST(testGreaterOrEqualUINT, 1975);
+    RUN_TEST(testNotGreaterOrEqualUINT, 1997);
+    RUN_TEST(testGreaterOrEqualUINT8, 2004);
+    RUN_TEST(testNotGreaterOrEqualUINT8, 2026);
+    RUN_TEST(testGreaterOrEqualUINT16, 2033);
+    RUN_TEST(testNotGreaterOrEqualUINT16, 2055);
+    RUN_TEST(testGreaterOrEqualUINT32, 2062);
+    RUN_TEST(testNotGreaterOrEqualUINT32, 2084);
+    RUN_TEST(testGreaterOrEqualHEX8, 2091);
+    RUN_TEST(testNotGreaterOrEqualHEX8, 2113);
+    RUN_TEST(testGreaterOrEqualHEX16, 2120);
+    RUN_TEST(testNotGreaterOrEqualHEX16, 2142);
+    RUN_TEST(testGreaterOrEqualHEX32, 2149);
+    RUN_TEST(testNotGreaterOrEqualHEX32, 2171);
+    RUN_TEST(testLessThan, 2180);
+    RUN_TEST(testNotLessThan, 2196);
+    RUN_TEST(testLessThanINT, 2203);
+    RUN_TEST(testNotLessThanINT, 2219);
+    RUN_TEST(testLessThanINT8, 2226);
+    RUN_TEST(testNotLessThanINT8, 2242);
+    RUN_TEST(testLessThanCHAR, 2249);
+    RUN_TEST(testNotLessThanCHAR, 2265);
+    RUN_TEST(testLessThanINT16, 2272);
+    RUN_TEST(testNotLessThanINT16, 2288);
+    RUN_TEST(testLessThanINT32, 2295);
+    RUN_TEST(testNotLessThanINT32, 2311);
+    RUN_TEST(testLessThanUINT, 2318);
+    RUN_TEST(testNotLessThanUINT, 2334);
+    RUN_TEST(testLessThanUINT8, 2341);
+    RUN_TEST(testNotLessThanUINT8, 2357);
+    RUN_TEST(testLessThanUINT16, 2364);
+    RUN_TEST(testNotLessThanUINT16, 2380);
+    RUN_TEST(testLessThanUINT32, 2387);
+    RUN_TEST(testNotLessThanUINT32, 2403);
+    RUN_TEST(testLessThanHEX8, 2410);
+    RUN_TEST(testNotLessThanHEX8, 2426);
+    RUN_TEST(testLessThanHEX16, 2433);
+    RUN_TEST(testNotLessThanHEX16, 2449);
+    RUN_TEST(testLessThanHEX32, 2456);
+    RUN_TEST(testNotLessThanHEX32, 2472);
+    RUN_TEST(testLessOrEqual, 2479);
+    RUN_TEST(testNotLessOrEqual, 2501);
+    RUN_TEST(testLessOrEqualINT, 2508);
+    RUN_TEST(testNotLessOrEqualINT, 2530);
+    RUN_TEST(testLessOrEqualINT8, 2537);
+    RUN_TEST(testNotLessOrEqualINT8, 2559);
+    RUN_TEST(testLessOrEqualCHAR, 2566);
+    RUN_TEST(testNotLessOrEqualCHAR, 2588);
+    RUN_TEST(testLessOrEqualINT16, 2595);
+    RUN_TEST(testNotLessOrEqualINT16, 2617);
+    RUN_TEST(testLessOrEqualINT32, 2624);
+    RUN_TEST(testNotLessOrEqualINT32, 2646);
+    RUN_TEST(testLessOrEqualUINT, 2653);
+    RUN_TEST(testNotLessOrEqualUINT, 2675);
+    RUN_TEST(testLessOrEqualUINT8, 2682);
+    RUN_TEST(testNotLessOrEqualUINT8, 2704);
+    RUN_TEST(testLessOrEqualUINT16, 2711);
+    RUN_TEST(testNotLessOrEqualUINT16, 2733);
+    RUN_TEST(testLessOrEqualUINT32, 2740);
+    RUN_TEST(testNotLessOrEqualUINT32, 2762);
+    RUN_TEST(testLessOrEqualHEX8, 2769);
+    RUN_TEST(testNotLessOrEqualHEX8, 2791);
+    RUN_TEST(testLessOrEqualHEX16, 2798);
+    RUN_TEST(testNotLessOrEqualHEX16, 2820);
+    RUN_TEST(testLessOrEqualHEX32, 2827);
+    RUN_TEST(testNotLessOrEqualHEX32, 2849);
+    RUN_TEST(testHexPrintsUpToMaxNumberOfNibbles, 2856);
+    RUN_TEST(testPrintNumbers32, 2872);
+    RUN_TEST(testPrintNumbersUnsigned32, 2886);
+    return UNITY_END();
+}
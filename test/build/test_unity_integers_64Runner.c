@@ -0,0 +1,116 @@
+#include "unity.h" /* Autogenerated by awk in Makefile */
+void testInt64ArrayWithinDelta(void);
+void testInt64ArrayWithinDeltaAndMessage(void);
+void testInt64ArrayNotWithinDelta(void);
+void testInt64ArrayNotWithinDeltaAndMessage(void);
+void testInt64ArrayWithinDeltaPointless(void);
+void testInt64ArrayWithinDeltaPointlessAndMessage(void);
+void testInt64ArrayWithinDeltaExpectedNull(void);
+void testInt64ArrayWithinDeltaExpectedNullAndMessage(void);
+void testInt64ArrayWithinDeltaActualNull(void);
+void testInt64ArrayWithinDeltaActualNullAndMessage(void);
+void testInt64ArrayWithinDeltaSamePointer(void);
+void testInt64ArrayWithinDeltaSamePointerAndMessage(void);
+void testUInt64ArrayWithinDelta(void);
+void testUInt64ArrayWithinDeltaAndMessage(void);
+void testUInt64ArrayNotWithinDelta(void);
+void testUInt64ArrayNotWithinDeltaAndMessage(void);
+void testUInt64ArrayWithinDeltaPointless(void);
+void testUInt64ArrayWithinDeltaPointlessAndMessage(void);
+void testUInt64ArrayWithinDeltaExpectedNull(void);
+void testUInt64ArrayWithinDeltaExpectedNullAndMessage(void);
+void testUInt64ArrayWithinDeltaActualNull(void);
+void testUInt64ArrayWithinDeltaActualNullAndMessage(void);
+void testUInt64ArrayWithinDeltaSamePointer(void);
+void testUInt64ArrayWithinDeltaSamePointerAndMessage(void);
+void testHEX64ArrayWithinDelta(void);
+void testHEX64ArrayWithinDeltaAndMessage(void);
+void testHEX64ArrayNotWithinDelta(void);
+void testHEX64ArrayNotWithinDeltaAndMessage(void);
+void testHEX64ArrayWithinDeltaPointless(void);
+void testHEX64ArrayWithinDeltaPointlessAndMessage(void);
+void testHEX64ArrayWithinDeltaExpectedNull(void);
+void testHEX64ArrayWithinDeltaExpectedNullAndMessage(void);
+void testHEX64ArrayWithinDeltaActualNull(void);
+void testHEX64ArrayWithinDeltaActualNullAndMessage(void);
+void testHEX64ArrayWithinDeltaSamePointer(void);
+void testHEX64ArrayWithinDeltaSamePointerAndMessage(void);
+void testEqualHex64s(void);
+void testEqualUint64s(void);
+void testEqualInt64s(void);
+void testNotEqualHex64s(void);
+void testNotEqualUint64s(void);
+void testNotEqualInt64s(void);
+void testNotEqualHex64sIfSigned(void);
+void testHEX64sWithinDelta(void);
+void testHEX32sWithinDeltaShouldIgnoreSign(void);
+void testHEX64sNotWithinDelta(void);
+void testHEX64sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+void testUINT64sWithinDelta(void);
+void testUINT64sNotWithinDelta(void);
+void testUINT64sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+void testINT64sWithinDelta(void);
+void testINT64sNotWithinDelta(void);
+void testINT64sNotWithinDeltaAndDifferenceOverflows(void);
+void testPrintNumbersInt64(void);
+void testPrintNumbersUInt64(void);
+int main(void)
+{
+    UnityBegin("tests/test_unity_integers_64.c");
+    RUN_TEST(testInt64ArrayWithinDelta, 37);
+    RUN_TEST(testInt64ArrayWithinDeltaAndMessage, 51);
+    RUN_TEST(testInt64ArrayNotWithinDelta, 65);
+    RUN_TEST(testInt64ArrayNotWithinDeltaAndMessage, 79);
+    RUN_TEST(testInt64ArrayWithinDeltaPointless, 93);
+    RUN_TEST(testInt64ArrayWithinDeltaPointlessAndMessage, 107);
+    RUN_TEST(testInt64ArrayWithinDeltaExpectedNull, 121);
+    RUN_TEST(testInt64ArrayWithinDeltaExpectedNullAndMessage, 134);
+    RUN_TEST(testInt64ArrayWithinDeltaActualNull, 147);
+    RUN_TEST(testInt64ArrayWithinDeltaActualNullAndMessage, 160);
+    RUN_TEST(testInt64ArrayWithinDeltaSamePointer, 173);
+    RUN_TEST(testInt64ArrayWithinDeltaSamePointerAndMessage, 184);
+    RUN_TEST(testUInt64ArrayWithinDelta, 195);
+    RUN_TEST(testUInt64ArrayWithinDeltaAndMessage, 209);
+    RUN_TEST(testUInt64ArrayNotWithinDelta, 223);
+    RUN_TEST(testUInt64ArrayNotWithinDeltaAndMessage, 237);
+    RUN_TEST(testUInt64ArrayWithinDeltaPointless, 251);
+    RUN_TEST(testUInt64ArrayWithinDeltaPointlessAndMessage, 265);
+    RUN_TEST(testUInt64ArrayWithinDeltaExpectedNull, 279);
+    RUN_TEST(testUInt64ArrayWithinDeltaExpectedNullAndMessage, 292);
+    RUN_TEST(testUInt64ArrayWithinDeltaActualNull, 305);
+    RUN_TEST(testUInt64ArrayWithinDeltaActualNullAndMessage, 318);
+    RUN_TEST(testUInt64ArrayWithinDeltaSamePointer, 331);
+    RUN_TEST(testUInt64ArrayWithinDeltaSamePointerAndMessage, 342);
+    RUN_TEST(testHEX64ArrayWithinDelta, 353);
+    RUN_TEST(testHEX64ArrayWithinDeltaAndMessage, 367);
+    RUN_TEST(testHEX64ArrayNotWithinDelta, 381);
+    RUN_TEST(testHEX64ArrayNotWithinDeltaAndMessage, 395);
+    RUN_TEST(testHEX64ArrayWithinDeltaPointless, 409);
+    RUN_TEST(testHEX64ArrayWithinDeltaPointlessAndMessage, 423);
+    RUN_TEST(testHEX64ArrayWithinDeltaExpectedNull, 437);
+    RUN_TEST(testHEX64ArrayWithinDeltaExpectedNullAndMessage, 450);
+    RUN_TEST(testHEX64ArrayWithinDeltaActualNull, 463);
+    RUN_TEST(testHEX64ArrayWithinDeltaActualNullAndMessage, 476);
+    RUN_TEST(testHEX64ArrayWithinDeltaSamePointer, 489);
+    RUN_TEST(testHEX64ArrayWithinDeltaSamePointerAndMessage, 500);
+    RUN_TEST(testEqualHex64s, 511);
+    RUN_TEST(testEqualUint64s, 534);
+    RUN_TEST(testEqualInt64s, 557);
+    RUN_TEST(testNotEqualHex64s, 581);
+    RUN_TEST(testNotEqualUint64s, 597);
+    RUN_TEST(testNotEqualInt64s, 613);
+    RUN_TEST(testNotEqualHex64sIfSigned, 629);
+    RUN_TEST(testHEX64sWithinDelta, 645);
+    RUN_TEST(testHEX32sWithinDeltaShouldIgnoreSign, 656);
+    RUN_TEST(testHEX64sNotWithinDelta, 665);
+    RUN_TEST(testHEX64sNotWithinDeltaEvenThoughASignedIntWouldPass, 676);
+    RUN_TEST(testUINT64sWithinDelta, 687);
+    RUN_TEST(testUINT64sNotWithinDelta, 698);
+    RUN_TEST(testUINT64sNotWithinDeltaEvenThoughASignedIntWouldPass, 709);
+    RUN_TEST(testINT64sWithinDelta, 720);
+    RUN_TEST(testINT64sNotWithinDelta, 731);
+    RUN_TEST(testINT64sNotWithinDeltaAndDifferenceOverflows, 742);
+    RUN_TEST(testPrintNumbersInt64, 753);
+    RUN_TEST(testPrintNumbersUInt64, 769);
+    return UNITY_END();
+}
@@ -0,0 +1,315 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "self_assessment_utils.h"
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testInt64ArrayWithinDelta(void);
+extern void testInt64ArrayWithinDeltaAndMessage(void);
+extern void testInt64ArrayNotWithinDelta(void);
+extern void testInt64ArrayNotWithinDeltaAndMessage(void);
+extern void testInt64ArrayWithinDeltaPointless(void);
+extern void testInt64ArrayWithinDeltaPointlessAndMessage(void);
+extern void testInt64ArrayWithinDeltaExpectedNull(void);
+extern void testInt64ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testInt64ArrayWithinDeltaActualNull(void);
+extern void testInt64ArrayWithinDeltaActualNullAndMessage(void);
+extern void testInt64ArrayWithinDeltaSamePointer(void);
+extern void testInt64ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testUInt64ArrayWithinDelta(void);
+extern void testUInt64ArrayWithinDeltaAndMessage(void);
+extern void testUInt64ArrayNotWithinDelta(void);
+extern void testUInt64ArrayNotWithinDeltaAndMessage(void);
+extern void testUInt64ArrayWithinDeltaPointless(void);
+extern void testUInt64ArrayWithinDeltaPointlessAndMessage(void);
+extern void testUInt64ArrayWithinDeltaExpectedNull(void);
+extern void testUInt64ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testUInt64ArrayWithinDeltaActualNull(void);
+extern void testUInt64ArrayWithinDeltaActualNullAndMessage(void);
+extern void testUInt64ArrayWithinDeltaSamePointer(void);
+extern void testUInt64ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testHEX64ArrayWithinDelta(void);
+extern void testHEX64ArrayWithinDeltaAndMessage(void);
+extern void testHEX64ArrayNotWithinDelta(void);
+extern void testHEX64ArrayNotWithinDeltaAndMessage(void);
+extern void testHEX64ArrayWithinDeltaPointless(void);
+extern void testHEX64ArrayWithinDeltaPointlessAndMessage(void);
+extern void testHEX64ArrayWithinDeltaExpectedNull(void);
+extern void testHEX64ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testHEX64ArrayWithinDeltaActualNull(void);
+extern void testHEX64ArrayWithinDeltaActualNullAndMessage(void);
+extern void testHEX64ArrayWithinDeltaSamePointer(void);
+extern void testHEX64ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testEqualHex64s(void);
+extern void testEqualUint64s(void);
+extern void testEqualInt64s(void);
+extern void testNotEqualHex64s(void);
+extern void testNotEqualUint64s(void);
+extern void testNotEqualInt64s(void);
+extern void testNotEqualHex64sIfSigned(void);
+extern void testHEX64sWithinDelta(void);
+extern void testHEX32sWithinDeltaShouldIgnoreSign(void);
+extern void testHEX64sNotWithinDelta(void);
+extern void testHEX64sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+extern void testUINT64sWithinDelta(void);
+extern void testUINT64sNotWithinDelta(void);
+extern void testUINT64sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+extern void testINT64sWithinDelta(void);
+extern void testINT64sNotWithinDelta(void);
+extern void testINT64sNotWithinDeltaAndDifferenceOverflows(void);
+extern void testPrintNumbersInt64(void);
+extern void testPrintNumbersUInt64(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("tests/test_unity_integers_64.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[55];
+
+  run_test_params_arr[0].func = testInt64ArrayWithinDelta;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("testInt64ArrayWithinDelta");
+  run_test_params_arr[0].line_num = 37;
+  run_test_params_arr[1].func = testInt64ArrayWithinDeltaAndMessage;
+  run_test_params_arr[1].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaAndMessage");
+  run_test_params_arr[1].line_num = 51;
+  run_test_params_arr[2].func = testInt64ArrayNotWithinDelta;
+  run_test_params_arr[2].name = UNITY_TOKENIZE("testInt64ArrayNotWithinDelta");
+  run_test_params_arr[2].line_num = 65;
+  run_test_params_arr[3].func = testInt64ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("testInt64ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[3].line_num = 79;
+  run_test_params_arr[4].func = testInt64ArrayWithinDeltaPointless;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaPointless");
+  run_test_params_arr[4].line_num = 93;
+  run_test_params_arr[5].func = testInt64ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[5].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[5].line_num = 107;
+  run_test_params_arr[6].func = testInt64ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[6].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[6].line_num = 121;
+  run_test_params_arr[7].func = testInt64ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[7].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[7].line_num = 134;
+  run_test_params_arr[8].func = testInt64ArrayWithinDeltaActualNull;
+  run_test_params_arr[8].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaActualNull");
+  run_test_params_arr[8].line_num = 147;
+  run_test_params_arr[9].func = testInt64ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[9].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[9].line_num = 160;
+  run_test_params_arr[10].func = testInt64ArrayWithinDeltaSamePointer;
+  run_test_params_arr[10].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaSamePointer");
+  run_test_params_arr[10].line_num = 173;
+  run_test_params_arr[11].func = testInt64ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[11].name = UNITY_TOKENIZE("testInt64ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[11].line_num = 184;
+  run_test_params_arr[12].func = testUInt64ArrayWithinDelta;
+  run_test_params_arr[12].name = UNITY_TOKENIZE("testUInt64ArrayWithinDelta");
+  run_test_params_arr[12].line_num = 195;
+  run_test_params_arr[13].func = testUInt64ArrayWithinDeltaAndMessage;
+  run_test_params_arr[13].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaAndMessage");
+  run_test_params_arr[13].line_num = 209;
+  run_test_params_arr[14].func = testUInt64ArrayNotWithinDelta;
+  run_test_params_arr[14].name = UNITY_TOKENIZE("testUInt64ArrayNotWithinDelta");
+  run_test_params_arr[14].line_num = 223;
+  run_test_params_arr[15].func = testUInt64ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[15].name = UNITY_TOKENIZE("testUInt64ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[15].line_num = 237;
+  run_test_params_arr[16].func = testUInt64ArrayWithinDeltaPointless;
+  run_test_params_arr[16].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaPointless");
+  run_test_params_arr[16].line_num = 251;
+  run_test_params_arr[17].func = testUInt64ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[17].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[17].line_num = 265;
+  run_test_params_arr[18].func = testUInt64ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[18].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[18].line_num = 279;
+  run_test_params_arr[19].func = testUInt64ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[19].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[19].line_num = 292;
+  run_test_params_arr[20].func = testUInt64ArrayWithinDeltaActualNull;
+  run_test_params_arr[20].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaActualNull");
+  run_test_params_arr[20].line_num = 305;
+  run_test_params_arr[21].func = testUInt64ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[21].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[21].line_num = 318;
+  run_test_params_arr[22].func = testUInt64ArrayWithinDeltaSamePointer;
+  run_test_params_arr[22].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaSamePointer");
+  run_test_params_arr[22].line_num = 331;
+  run_test_params_arr[23].func = testUInt64ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[23].name = UNITY_TOKENIZE("testUInt64ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[23].line_num = 342;
+  run_test_params_arr[24].func = testHEX64ArrayWithinDelta;
+  run_test_params_arr[24].name = UNITY_TOKENIZE("testHEX64ArrayWithinDelta");
+  run_test_params_arr[24].line_num = 353;
+  run_test_params_arr[25].func = testHEX64ArrayWithinDeltaAndMessage;
+  run_test_params_arr[25].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaAndMessage");
+  run_test_params_arr[25].line_num = 367;
+  run_test_params_arr[26].func = testHEX64ArrayNotWithinDelta;
+  run_test_params_arr[26].name = UNITY_TOKENIZE("testHEX64ArrayNotWithinDelta");
+  run_test_params_arr[26].line_num = 381;
+  run_test_params_arr[27].func = testHEX64ArrayNotWithinDeltaAndMessage;
+  run_test_params_arr[27].name = UNITY_TOKENIZE("testHEX64ArrayNotWithinDeltaAndMessage");
+  run_test_params_arr[27].line_num = 395;
+  run_test_params_arr[28].func = testHEX64ArrayWithinDeltaPointless;
+  run_test_params_arr[28].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaPointless");
+  run_test_params_arr[28].line_num = 409;
+  run_test_params_arr[29].func = testHEX64ArrayWithinDeltaPointlessAndMessage;
+  run_test_params_arr[29].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaPointlessAndMessage");
+  run_test_params_arr[29].line_num = 423;
+  run_test_params_arr[30].func = testHEX64ArrayWithinDeltaExpectedNull;
+  run_test_params_arr[30].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaExpectedNull");
+  run_test_params_arr[30].line_num = 437;
+  run_test_params_arr[31].func = testHEX64ArrayWithinDeltaExpectedNullAndMessage;
+  run_test_params_arr[31].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaExpectedNullAndMessage");
+  run_test_params_arr[31].line_num = 450;
+  run_test_params_arr[32].func = testHEX64ArrayWithinDeltaActualNull;
+  run_test_params_arr[32].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaActualNull");
+  run_test_params_arr[32].line_num = 463;
+  run_test_params_arr[33].func = testHEX64ArrayWithinDeltaActualNullAndMessage;
+  run_test_params_arr[33].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaActualNullAndMessage");
+  run_test_params_arr[33].line_num = 476;
+  run_test_params_arr[34].func = testHEX64ArrayWithinDeltaSamePointer;
+  run_test_params_arr[34].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaSamePointer");
+  run_test_params_arr[34].line_num = 489;
+  run_test_params_arr[35].func = testHEX64ArrayWithinDeltaSamePointerAndMessage;
+  run_test_params_arr[35].name = UNITY_TOKENIZE("testHEX64ArrayWithinDeltaSamePointerAndMessage");
+  run_test_params_arr[35].line_num = 500;
+  run_test_params_arr[36].func = testEqualHex64s;
+  run_test_params_arr[36].name = UNITY_TOKENIZE("testEqualHex64s");
+  run_test_params_arr[36].line_num = 511;
+  run_test_params_arr[37].func = testEqualUint64s;
+  run_test_params_arr[37].name = UNITY_TOKENIZE("testEqualUint64s");
+  run_test_params_arr[37].line_num = 534;
+  run_test_params_arr[38].func = testEqualInt64s;
+  run_test_params_arr[38].name = UNITY_TOKENIZE("testEqualInt64s");
+  run_test_params_arr[38].line_num = 557;
+  run_test_params_arr[39].func = testNotEqualHex64s;
+  run_test_params_arr[39].name = UNITY_TOKENIZE("testNotEqualHex64s");
+  run_test_params_arr[39].line_num = 581;
+  run_test_params_arr[40].func = testNotEqualUint64s;
+  run_test_params_arr[40].name = UNITY_TOKENIZE("testNotEqualUint64s");
+  run_test_params_arr[40].line_num = 597;
+  run_test_params_arr[41].func = testNotEqualInt64s;
+  run_test_params_arr[41].name = UNITY_TOKENIZE("testNotEqualInt64s");
+  run_test_params_arr[41].line_num = 613;
+  run_test_params_arr[42].func = testNotEqualHex64sIfSigned;
+  run_test_params_arr[42].name = UNITY_TOKENIZE("testNotEqualHex64sIfSigned");
+  run_test_params_arr[42].line_num = 629;
+  run_test_params_arr[43].func = testHEX64sWithinDelta;
+  run_test_params_arr[43].name = UNITY_TOKENIZE("testHEX64sWithinDelta");
+  run_test_params_arr[43].line_num = 645;
+  run_test_params_arr[44].func = testHEX32sWithinDeltaShouldIgnoreSign;
+  run_test_params_arr[44].name = UNITY_TOKENIZE("testHEX32sWithinDeltaShouldIgnoreSign");
+  run_test_params_arr[44].line_num = 656;
+  run_test_params_arr[45].func = testHEX64sNotWithinDelta;
+  run_test_params_arr[45].name = UNITY_TOKENIZE("testHEX64sNotWithinDelta");
+  run_test_params_arr[45].line_num = 665;
+  run_test_params_arr[46].func = testHEX64sNotWithinDeltaEvenThoughASignedIntWouldPass;
+  run_test_params_arr[46].name = UNITY_TOKENIZE("testHEX64sNotWithinDeltaEvenThoughASignedIntWouldPass");
+  run_test_params_arr[46].line_num = 676;
+  run_test_params_arr[47].func = testUINT64sWithinDelta;
+  run_test_params_arr[47].name = UNITY_TOKENIZE("testUINT64sWithinDelta");
+  run_test_params_arr[47].line_num = 687;
+  run_test_params_arr[48].func = testUINT64sNotWithinDelta;
+  run_test_params_arr[48].name = UNITY_TOKENIZE("testUINT64sNotWithinDelta");
+  run_test_params_arr[48].line_num = 698;
+  run_test_params_arr[49].func = testUINT64sNotWithinDeltaEvenThoughASignedIntWouldPass;
+  run_test_params_arr[49].name = UNITY_TOKENIZE("testUINT64sNotWithinDeltaEvenThoughASignedIntWouldPass");
+  run_test_params_arr[49].line_num = 709;
+  run_test_params_arr[50].func = testINT64sWithinDelta;
+  run_test_params_arr[50].name = UNITY_TOKENIZE("testINT64sWithinDelta");
+  run_test_params_arr[50].line_num = 720;
+  run_test_params_arr[51].func = testINT64sNotWithinDelta;
+  run_test_params_arr[51].name = UNITY_TOKENIZE("testINT64sNotWithinDelta");
+  run_test_params_arr[51].line_num = 731;
+  run_test_params_arr[52].func = testINT64sNotWithinDeltaAndDifferenceOverflows;
+  run_test_params_arr[52].name = UNITY_TOKENIZE("testINT64sNotWithinDeltaAndDifferenceOverflows");
+  run_test_params_arr[52].line_num = 742;
+  run_test_params_arr[53].func = testPrintNumbersInt64;
+  run_test_params_arr[53].name = UNITY_TOKENIZE("testPrintNumbersInt64");
+  run_test_params_arr[53].line_num = 753;
+  run_test_params_arr[54].func = testPrintNumbersUInt64;
+  run_test_params_arr[54].name = UNITY_TOKENIZE("testPrintNumbersUInt64");
+  run_test_params_arr[54].line_num = 769;
+
+  for (int i = 0; i < 55; i++)
+  {
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
@@ -0,0 +1,1127 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "self_assessment_utils.h"
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testNotEqualInts(void);
+extern void testNotEqualInt8s(void);
+extern void testNotEqualChars(void);
+extern void testNotEqualInt16s(void);
+extern void testNotEqualInt32s(void);
+extern void testNotEqualBits(void);
+extern void testNotEqualUInts(void);
+extern void testNotEqualUInt8s(void);
+extern void testNotEqualUInt16s(void);
+extern void testNotEqualUInt32s(void);
+extern void testNotEqualHex8s(void);
+extern void testNotEqualHex8sIfSigned(void);
+extern void testNotEqualHex16s(void);
+extern void testNotEqualHex16sIfSigned(void);
+extern void testNotEqualHex32s(void);
+extern void testNotEqualHex32sIfSigned(void);
+extern void testEqualInts(void);
+extern void testEqualInt8s(void);
+extern void testEqualInt8sWhenThereAreDifferencesOutside8Bits(void);
+extern void testEqualChars(void);
+extern void testEqualCharsWhenThereAreDifferencesOutside8Bits(void);
+extern void testEqualInt16s(void);
+extern void testEqualInt16sNegatives(void);
+extern void testEqualInt16sWhenThereAreDifferencesOutside16Bits(void);
+extern void testEqualInt32s(void);
+extern void testEqualInt32sNegatives(void);
+extern void testEqualUints(void);
+extern void testEqualUint8s(void);
+extern void testEqualUint8sWhenThereAreDifferencesOutside8Bits(void);
+extern void testEqualUint16s(void);
+extern void testEqualUint16sWhenThereAreDifferencesOutside16Bits(void);
+extern void testEqualUint32s(void);
+extern void testNotEqual(void);
+extern void testEqualHex8s(void);
+extern void testEqualHex8sWhenThereAreDifferencesOutside8Bits(void);
+extern void testEqualHex8sNegatives(void);
+extern void testEqualHex16s(void);
+extern void testEqualHex16sWhenThereAreDifferencesOutside16Bits(void);
+extern void testEqualHex32s(void);
+extern void testEqualBits(void);
+extern void testNotEqualBitHigh(void);
+extern void testNotEqualBitLow(void);
+extern void testNotEqualBitsHigh(void);
+extern void testNotEqualBitsLow(void);
+extern void testEqualShorts(void);
+extern void testEqualUShorts(void);
+extern void testEqualUInts(void);
+extern void testEqualUChars(void);
+extern void testEqualPointers(void);
+extern void testNotEqualPointers(void);
+extern void testNotEqualPtr(void);
+extern void testNotNotEqualPointers(void);
+extern void testNotNotEqualPointers_BothNull(void);
+extern void testIntsWithinDelta(void);
+extern void testIntsWithinDeltaAndCustomMessage(void);
+extern void testIntsNotWithinDelta(void);
+extern void testIntsNotWithinDeltaAndCustomMessage(void);
+extern void testUIntsWithinDelta(void);
+extern void testUIntsWithinDeltaAndCustomMessage(void);
+extern void testUIntsNotWithinDelta(void);
+extern void testUIntsNotWithinDeltaAndCustomMessage(void);
+extern void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirst(void);
+extern void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirstAndCustomMessage(void);
+extern void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirst(void);
+extern void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirstAndCustomMessage(void);
+extern void testHEX32sWithinDelta(void);
+extern void testHEX32sWithinDeltaShouldIgnoreSign(void);
+extern void testHEX32sWithinDeltaAndCustomMessage(void);
+extern void testHEX32sNotWithinDelta(void);
+extern void testHEX32sNotWithinDeltaAndCustomMessage(void);
+extern void testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+extern void testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage(void);
+extern void testHEX16sWithinDelta(void);
+extern void testHEX16sWithinDeltaShouldIgnoreSign(void);
+extern void testHEX16sWithinDeltaAndCustomMessage(void);
+extern void testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+extern void testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+extern void testHEX16sNotWithinDelta(void);
+extern void testHEX16sNotWithinDeltaAndCustomMessage(void);
+extern void testHEX8sWithinDelta(void);
+extern void testHEX8sWithinDeltaShouldIgnoreSign(void);
+extern void testHEX8sWithinDeltaAndCustomMessage(void);
+extern void testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+extern void testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+extern void testHEX8sNotWithinDelta(void);
+extern void testHEX8sNotWithinDeltaAndCustomMessage(void);
+extern void testUINT32sWithinDelta(void);
+extern void testUINT32sWithinDeltaAndCustomMessage(void);
+extern void testUINT32sNotWithinDelta(void);
+extern void testUINT32sNotWithinDeltaAndCustomMessage(void);
+extern void testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+extern void testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage(void);
+extern void testUINT16sWithinDelta(void);
+extern void testUINT16sWithinDeltaAndCustomMessage(void);
+extern void testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+extern void testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+extern void testUINT16sNotWithinDelta(void);
+extern void testUINT16sNotWithinDeltaAndCustomMessage(void);
+extern void testUINT8sWithinDelta(void);
+extern void testUINT8sWithinDeltaAndCustomMessage(void);
+extern void testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+extern void testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+extern void testUINT8sNotWithinDelta(void);
+extern void testUINT8sNotWithinDeltaAndCustomMessage(void);
+extern void testINT32sWithinDelta(void);
+extern void testINT32sWithinDeltaAndCustomMessage(void);
+extern void testINT32sNotWithinDelta(void);
+extern void testINT32sNotWithinDeltaAndDifferenceOverflows(void);
+extern void testINT32sNotWithinDeltaAndCustomMessage(void);
+extern void testINT16sWithinDelta(void);
+extern void testINT16sWithinDeltaAndCustomMessage(void);
+extern void testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+extern void testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+extern void testINT16sNotWithinDelta(void);
+extern void testINT16sNotWithinDeltaAndCustomMessage(void);
+extern void testINT8sWithinDelta(void);
+extern void testINT8sWithinDeltaAndCustomMessage(void);
+extern void testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+extern void testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+extern void testINT8sNotWithinDelta(void);
+extern void testINT8sNotWithinDeltaAndCustomMessage(void);
+extern void testCHARsWithinDelta(void);
+extern void testCHARsWithinDeltaAndCustomMessage(void);
+extern void testCHARsWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+extern void testCHARsWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+extern void testCHARsNotWithinDelta(void);
+extern void testCHARsNotWithinDeltaAndCustomMessage(void);
+extern void testNotEqualINT(void);
+extern void testNotNotEqualINT(void);
+extern void testNotEqualINT8(void);
+extern void testNotNotEqualINT8(void);
+extern void testNotEqualCHAR(void);
+extern void testNotNotEqualCHAR(void);
+extern void testNotEqualINT16(void);
+extern void testNotNotEqualINT16(void);
+extern void testNotEqualINT32(void);
+extern void testNotNotEqualINT32(void);
+extern void testNotEqualUINT(void);
+extern void testNotNotEqualUINT(void);
+extern void testNotEqualUINT8(void);
+extern void testNotNotEqualUINT8(void);
+extern void testNotEqualUINT16(void);
+extern void testNotNotEqualUINT16(void);
+extern void testNotEqualUINT32(void);
+extern void testNotNotEqualUINT32(void);
+extern void testNotEqualHEX8(void);
+extern void testNotNotEqualHEX8(void);
+extern void testNotEqualHEX16(void);
+extern void testNotNotEqualHEX16(void);
+extern void testNotEqualHEX32(void);
+extern void testNotNotEqualHEX32(void);
+extern void testGreaterThan(void);
+extern void testNotGreaterThan(void);
+extern void testGreaterThanINT(void);
+extern void testNotGreaterThanINT(void);
+extern void testGreaterThanINT8(void);
+extern void testNotGreaterThanINT8(void);
+extern void testGreaterThanCHAR(void);
+extern void testNotGreaterThanCHAR(void);
+extern void testGreaterThanINT16(void);
+extern void testNotGreaterThanINT16(void);
+extern void testGreaterThanINT32(void);
+extern void testNotGreaterThanINT32(void);
+extern void testGreaterThanUINT(void);
+extern void testNotGreaterThanUINT(void);
+extern void testGreaterThanUINT8(void);
+extern void testNotGreaterThanUINT8(void);
+extern void testGreaterThanUINT16(void);
+extern void testNotGreaterThanUINT16(void);
+extern void testGreaterThanUINT32(void);
+extern void testNotGreaterThanUINT32(void);
+extern void testGreaterThanHEX8(void);
+extern void testNotGreaterThanHEX8(void);
+extern void testGreaterThanHEX16(void);
+extern void testNotGreaterThanHEX16(void);
+extern void testGreaterThanHEX32(void);
+extern void testNotGreaterThanHEX32(void);
+extern void testGreaterOrEqual(void);
+extern void testNotGreaterOrEqual(void);
+extern void testGreaterOrEqualINT(void);
+extern void testNotGreaterOrEqualINT(void);
+extern void testGreaterOrEqualINT8(void);
+extern void testNotGreaterOrEqualINT8(void);
+extern void testGreaterOrEqualCHAR(void);
+extern void testNotGreaterOrEqualCHAR(void);
+extern void testGreaterOrEqualINT16(void);
+extern void testNotGreaterOrEqualINT16(void);
+extern void testGreaterOrEqualINT32(void);
+extern void testNotGreaterOrEqualINT32(void);
+extern void testGreaterOrEqualUINT(void);
+extern void testNotGreaterOrEqualUINT(void);
+extern void testGreaterOrEqualUINT8(void);
+extern void testNotGreaterOrEqualUINT8(void);
+extern void testGreaterOrEqualUINT16(void);
+extern void testNotGreaterOrEqualUINT16(void);
+extern void testGreaterOrEqualUINT32(void);
+extern void testNotGreaterOrEqualUINT32(void);
+extern void testGreaterOrEqualHEX8(void);
+extern void testNotGreaterOrEqualHEX8(void);
+extern void testGreaterOrEqualHEX16(void);
+extern void testNotGreaterOrEqualHEX16(void);
+extern void testGreaterOrEqualHEX32(void);
+extern void testNotGreaterOrEqualHEX32(void);
+extern void testLessThan(void);
+extern void testNotLessThan(void);
+extern void testLessThanINT(void);
+extern void testNotLessThanINT(void);
+extern void testLessThanINT8(void);
+extern void testNotLessThanINT8(void);
+extern void testLessThanCHAR(void);
+extern void testNotLessThanCHAR(void);
+extern void testLessThanINT16(void);
+extern void testNotLessThanINT16(void);
+extern void testLessThanINT32(void);
+extern void testNotLessThanINT32(void);
+extern void testLessThanUINT(void);
+extern void testNotLessThanUINT(void);
+extern void testLessThanUINT8(void);
+extern void testNotLessThanUINT8(void);
+extern void testLessThanUINT16(void);
+extern void testNotLessThanUINT16(void);
+extern void testLessThanUINT32(void);
+extern void testNotLessThanUINT32(void);
+extern void testLessThanHEX8(void);
+extern void testNotLessThanHEX8(void);
+extern void testLessThanHEX16(void);
+extern void testNotLessThanHEX16(void);
+extern void testLessThanHEX32(void);
+extern void testNotLessThanHEX32(void);
+extern void testLessOrEqual(void);
+extern void testNotLessOrEqual(void);
+extern void testLessOrEqualINT(void);
+extern void testNotLessOrEqualINT(void);
+extern void testLessOrEqualINT8(void);
+extern void testNotLessOrEqualINT8(void);
+extern void testLessOrEqualCHAR(void);
+extern void testNotLessOrEqualCHAR(void);
+extern void testLessOrEqualINT16(void);
+extern void testNotLessOrEqualINT16(void);
+extern void testLessOrEqualINT32(void);
+extern void testNotLessOrEqualINT32(void);
+extern void testLessOrEqualUINT(void);
+extern void testNotLessOrEqualUINT(void);
+extern void testLessOrEqualUINT8(void);
+extern void testNotLessOrEqualUINT8(void);
+extern void testLessOrEqualUINT16(void);
+extern void testNotLessOrEqualUINT16(void);
+extern void testLessOrEqualUINT32(void);
+extern void testNotLessOrEqualUINT32(void);
+extern void testLessOrEqualHEX8(void);
+extern void testNotLessOrEqualHEX8(void);
+extern void testLessOrEqualHEX16(void);
+extern void testNotLessOrEqualHEX16(void);
+extern void testLessOrEqualHEX32(void);
+extern void testNotLessOrEqualHEX32(void);
+extern void testHexPrintsUpToMaxNumberOfNibbles(void);
+extern void testPrintNumbers32(void);
+extern void testPrintNumbersUnsigned32(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("tests/test_unity_integers.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[258];
+
+  run_test_params_arr[0].func = testNotEqualInts;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("testNotEqualInts");
+  run_test_params_arr[0].line_num = 37;
+  run_test_params_arr[1].func = testNotEqualInt8s;
+  run_test_params_arr[1].name = UNITY_TOKENIZE("testNotEqualInt8s");
+  run_test_params_arr[1].line_num = 44;
+  run_test_params_arr[2].func = testNotEqualChars;
+  run_test_params_arr[2].name = UNITY_TOKENIZE("testNotEqualChars");
+  run_test_params_arr[2].line_num = 51;
+  run_test_params_arr[3].func = testNotEqualInt16s;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("testNotEqualInt16s");
+  run_test_params_arr[3].line_num = 58;
+  run_test_params_arr[4].func = testNotEqualInt32s;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("testNotEqualInt32s");
+  run_test_params_arr[4].line_num = 65;
+  run_test_params_arr[5].func = testNotEqualBits;
+  run_test_params_arr[5].name = UNITY_TOKENIZE("testNotEqualBits");
+  run_test_params_arr[5].line_num = 74;
+  run_test_params_arr[6].func = testNotEqualUInts;
+  run_test_params_arr[6].name = UNITY_TOKENIZE("testNotEqualUInts");
+  run_test_params_arr[6].line_num = 81;
+  run_test_params_arr[7].func = testNotEqualUInt8s;
+  run_test_params_arr[7].name = UNITY_TOKENIZE("testNotEqualUInt8s");
+  run_test_params_arr[7].line_num = 93;
+  run_test_params_arr[8].func = testNotEqualUInt16s;
+  run_test_params_arr[8].name = UNITY_TOKENIZE("testNotEqualUInt16s");
+  run_test_params_arr[8].line_num = 105;
+  run_test_params_arr[9].func = testNotEqualUInt32s;
+  run_test_params_arr[9].name = UNITY_TOKENIZE("testNotEqualUInt32s");
+  run_test_params_arr[9].line_num = 117;
+  run_test_params_arr[10].func = testNotEqualHex8s;
+  run_test_params_arr[10].name = UNITY_TOKENIZE("testNotEqualHex8s");
+  run_test_params_arr[10].line_num = 129;
+  run_test_params_arr[11].func = testNotEqualHex8sIfSigned;
+  run_test_params_arr[11].name = UNITY_TOKENIZE("testNotEqualHex8sIfSigned");
+  run_test_params_arr[11].line_num = 141;
+  run_test_params_arr[12].func = testNotEqualHex16s;
+  run_test_params_arr[12].name = UNITY_TOKENIZE("testNotEqualHex16s");
+  run_test_params_arr[12].line_num = 153;
+  run_test_params_arr[13].func = testNotEqualHex16sIfSigned;
+  run_test_params_arr[13].name = UNITY_TOKENIZE("testNotEqualHex16sIfSigned");
+  run_test_params_arr[13].line_num = 165;
+  run_test_params_arr[14].func = testNotEqualHex32s;
+  run_test_params_arr[14].name = UNITY_TOKENIZE("testNotEqualHex32s");
+  run_test_params_arr[14].line_num = 177;
+  run_test_params_arr[15].func = testNotEqualHex32sIfSigned;
+  run_test_params_arr[15].name = UNITY_TOKENIZE("testNotEqualHex32sIfSigned");
+  run_test_params_arr[15].line_num = 189;
+  run_test_params_arr[16].func = testEqualInts;
+  run_test_params_arr[16].name = UNITY_TOKENIZE("testEqualInts");
+  run_test_params_arr[16].line_num = 201;
+  run_test_params_arr[17].func = testEqualInt8s;
+  run_test_params_arr[17].name = UNITY_TOKENIZE("testEqualInt8s");
+  run_test_params_arr[17].line_num = 221;
+  run_test_params_arr[18].func = testEqualInt8sWhenThereAreDifferencesOutside8Bits;
+  run_test_params_arr[18].name = UNITY_TOKENIZE("testEqualInt8sWhenThereAreDifferencesOutside8Bits");
+  run_test_params_arr[18].line_num = 240;
+  run_test_params_arr[19].func = testEqualChars;
+  run_test_params_arr[19].name = UNITY_TOKENIZE("testEqualChars");
+  run_test_params_arr[19].line_num = 246;
+  run_test_params_arr[20].func = testEqualCharsWhenThereAreDifferencesOutside8Bits;
+  run_test_params_arr[20].name = UNITY_TOKENIZE("testEqualCharsWhenThereAreDifferencesOutside8Bits");
+  run_test_params_arr[20].line_num = 265;
+  run_test_params_arr[21].func = testEqualInt16s;
+  run_test_params_arr[21].name = UNITY_TOKENIZE("testEqualInt16s");
+  run_test_params_arr[21].line_num = 272;
+  run_test_params_arr[22].func = testEqualInt16sNegatives;
+  run_test_params_arr[22].name = UNITY_TOKENIZE("testEqualInt16sNegatives");
+  run_test_params_arr[22].line_num = 291;
+  run_test_params_arr[23].func = testEqualInt16sWhenThereAreDifferencesOutside16Bits;
+  run_test_params_arr[23].name = UNITY_TOKENIZE("testEqualInt16sWhenThereAreDifferencesOutside16Bits");
+  run_test_params_arr[23].line_num = 310;
+  run_test_params_arr[24].func = testEqualInt32s;
+  run_test_params_arr[24].name = UNITY_TOKENIZE("testEqualInt32s");
+  run_test_params_arr[24].line_num = 316;
+  run_test_params_arr[25].func = testEqualInt32sNegatives;
+  run_test_params_arr[25].name = UNITY_TOKENIZE("testEqualInt32sNegatives");
+  run_test_params_arr[25].line_num = 335;
+  run_test_params_arr[26].func = testEqualUints;
+  run_test_params_arr[26].name = UNITY_TOKENIZE("testEqualUints");
+  run_test_params_arr[26].line_num = 355;
+  run_test_params_arr[27].func = testEqualUint8s;
+  run_test_params_arr[27].name = UNITY_TOKENIZE("testEqualUint8s");
+  run_test_params_arr[27].line_num = 376;
+  run_test_params_arr[28].func = testEqualUint8sWhenThereAreDifferencesOutside8Bits;
+  run_test_params_arr[28].name = UNITY_TOKENIZE("testEqualUint8sWhenThereAreDifferencesOutside8Bits");
+  run_test_params_arr[28].line_num = 395;
+  run_test_params_arr[29].func = testEqualUint16s;
+  run_test_params_arr[29].name = UNITY_TOKENIZE("testEqualUint16s");
+  run_test_params_arr[29].line_num = 401;
+  run_test_params_arr[30].func = testEqualUint16sWhenThereAreDifferencesOutside16Bits;
+  run_test_params_arr[30].name = UNITY_TOKENIZE("testEqualUint16sWhenThereAreDifferencesOutside16Bits");
+  run_test_params_arr[30].line_num = 420;
+  run_test_params_arr[31].func = testEqualUint32s;
+  run_test_params_arr[31].name = UNITY_TOKENIZE("testEqualUint32s");
+  run_test_params_arr[31].line_num = 426;
+  run_test_params_arr[32].func = testNotEqual;
+  run_test_params_arr[32].name = UNITY_TOKENIZE("testNotEqual");
+  run_test_params_arr[32].line_num = 445;
+  run_test_params_arr[33].func = testEqualHex8s;
+  run_test_params_arr[33].name = UNITY_TOKENIZE("testEqualHex8s");
+  run_test_params_arr[33].line_num = 456;
+  run_test_params_arr[34].func = testEqualHex8sWhenThereAreDifferencesOutside8Bits;
+  run_test_params_arr[34].name = UNITY_TOKENIZE("testEqualHex8sWhenThereAreDifferencesOutside8Bits");
+  run_test_params_arr[34].line_num = 475;
+  run_test_params_arr[35].func = testEqualHex8sNegatives;
+  run_test_params_arr[35].name = UNITY_TOKENIZE("testEqualHex8sNegatives");
+  run_test_params_arr[35].line_num = 481;
+  run_test_params_arr[36].func = testEqualHex16s;
+  run_test_params_arr[36].name = UNITY_TOKENIZE("testEqualHex16s");
+  run_test_params_arr[36].line_num = 500;
+  run_test_params_arr[37].func = testEqualHex16sWhenThereAreDifferencesOutside16Bits;
+  run_test_params_arr[37].name = UNITY_TOKENIZE("testEqualHex16sWhenThereAreDifferencesOutside16Bits");
+  run_test_params_arr[37].line_num = 519;
+  run_test_params_arr[38].func = testEqualHex32s;
+  run_test_params_arr[38].name = UNITY_TOKENIZE("testEqualHex32s");
+  run_test_params_arr[38].line_num = 525;
+  run_test_params_arr[39].func = testEqualBits;
+  run_test_params_arr[39].name = UNITY_TOKENIZE("testEqualBits");
+  run_test_params_arr[39].line_num = 544;
+  run_test_params_arr[40].func = testNotEqualBitHigh;
+  run_test_params_arr[40].name = UNITY_TOKENIZE("testNotEqualBitHigh");
+  run_test_params_arr[40].line_num = 560;
+  run_test_params_arr[41].func = testNotEqualBitLow;
+  run_test_params_arr[41].name = UNITY_TOKENIZE("testNotEqualBitLow");
+  run_test_params_arr[41].line_num = 569;
+  run_test_params_arr[42].func = testNotEqualBitsHigh;
+  run_test_params_arr[42].name = UNITY_TOKENIZE("testNotEqualBitsHigh");
+  run_test_params_arr[42].line_num = 578;
+  run_test_params_arr[43].func = testNotEqualBitsLow;
+  run_test_params_arr[43].name = UNITY_TOKENIZE("testNotEqualBitsLow");
+  run_test_params_arr[43].line_num = 589;
+  run_test_params_arr[44].func = testEqualShorts;
+  run_test_params_arr[44].name = UNITY_TOKENIZE("testEqualShorts");
+  run_test_params_arr[44].line_num = 600;
+  run_test_params_arr[45].func = testEqualUShorts;
+  run_test_params_arr[45].name = UNITY_TOKENIZE("testEqualUShorts");
+  run_test_params_arr[45].line_num = 620;
+  run_test_params_arr[46].func = testEqualUInts;
+  run_test_params_arr[46].name = UNITY_TOKENIZE("testEqualUInts");
+  run_test_params_arr[46].line_num = 640;
+  run_test_params_arr[47].func = testEqualUChars;
+  run_test_params_arr[47].name = UNITY_TOKENIZE("testEqualUChars");
+  run_test_params_arr[47].line_num = 660;
+  run_test_params_arr[48].func = testEqualPointers;
+  run_test_params_arr[48].name = UNITY_TOKENIZE("testEqualPointers");
+  run_test_params_arr[48].line_num = 679;
+  run_test_params_arr[49].func = testNotEqualPointers;
+  run_test_params_arr[49].name = UNITY_TOKENIZE("testNotEqualPointers");
+  run_test_params_arr[49].line_num = 696;
+  run_test_params_arr[50].func = testNotEqualPtr;
+  run_test_params_arr[50].name = UNITY_TOKENIZE("testNotEqualPtr");
+  run_test_params_arr[50].line_num = 703;
+  run_test_params_arr[51].func = testNotNotEqualPointers;
+  run_test_params_arr[51].name = UNITY_TOKENIZE("testNotNotEqualPointers");
+  run_test_params_arr[51].line_num = 720;
+  run_test_params_arr[52].func = testNotNotEqualPointers_BothNull;
+  run_test_params_arr[52].name = UNITY_TOKENIZE("testNotNotEqualPointers_BothNull");
+  run_test_params_arr[52].line_num = 730;
+  run_test_params_arr[53].func = testIntsWithinDelta;
+  run_test_params_arr[53].name = UNITY_TOKENIZE("testIntsWithinDelta");
+  run_test_params_arr[53].line_num = 737;
+  run_test_params_arr[54].func = testIntsWithinDeltaAndCustomMessage;
+  run_test_params_arr[54].name = UNITY_TOKENIZE("testIntsWithinDeltaAndCustomMessage");
+  run_test_params_arr[54].line_num = 749;
+  run_test_params_arr[55].func = testIntsNotWithinDelta;
+  run_test_params_arr[55].name = UNITY_TOKENIZE("testIntsNotWithinDelta");
+  run_test_params_arr[55].line_num = 761;
+  run_test_params_arr[56].func = testIntsNotWithinDeltaAndCustomMessage;
+  run_test_params_arr[56].name = UNITY_TOKENIZE("testIntsNotWithinDeltaAndCustomMessage");
+  run_test_params_arr[56].line_num = 768;
+  run_test_params_arr[57].func = testUIntsWithinDelta;
+  run_test_params_arr[57].name = UNITY_TOKENIZE("testUIntsWithinDelta");
+  run_test_params_arr[57].line_num = 775;
+  run_test_params_arr[58].func = testUIntsWithinDeltaAndCustomMessage;
+  run_test_params_arr[58].name = UNITY_TOKENIZE("testUIntsWithinDeltaAndCustomMessage");
+  run_test_params_arr[58].line_num = 782;
+  run_test_params_arr[59].func = testUIntsNotWithinDelta;
+  run_test_params_arr[59].name = UNITY_TOKENIZE("testUIntsNotWithinDelta");
+  run_test_params_arr[59].line_num = 789;
+  run_test_params_arr[60].func = testUIntsNotWithinDeltaAndCustomMessage;
+  run_test_params_arr[60].name = UNITY_TOKENIZE("testUIntsNotWithinDeltaAndCustomMessage");
+  run_test_params_arr[60].line_num = 796;
+  run_test_params_arr[61].func = testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirst;
+  run_test_params_arr[61].name = UNITY_TOKENIZE("testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirst");
+  run_test_params_arr[61].line_num = 803;
+  run_test_params_arr[62].func = testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirstAndCustomMessage;
+  run_test_params_arr[62].name = UNITY_TOKENIZE("testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirstAndCustomMessage");
+  run_test_params_arr[62].line_num = 810;
+  run_test_params_arr[63].func = testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirst;
+  run_test_params_arr[63].name = UNITY_TOKENIZE("testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirst");
+  run_test_params_arr[63].line_num = 817;
+  run_test_params_arr[64].func = testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirstAndCustomMessage;
+  run_test_params_arr[64].name = UNITY_TOKENIZE("testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirstAndCustomMessage");
+  run_test_params_arr[64].line_num = 824;
+  run_test_params_arr[65].func = testHEX32sWithinDelta;
+  run_test_params_arr[65].name = UNITY_TOKENIZE("testHEX32sWithinDelta");
+  run_test_params_arr[65].line_num = 831;
+  run_test_params_arr[66].func = testHEX32sWithinDeltaShouldIgnoreSign;
+  run_test_params_arr[66].name = UNITY_TOKENIZE("testHEX32sWithinDeltaShouldIgnoreSign");
+  run_test_params_arr[66].line_num = 838;
+  run_test_params_arr[67].func = testHEX32sWithinDeltaAndCustomMessage;
+  run_test_params_arr[67].name = UNITY_TOKENIZE("testHEX32sWithinDeltaAndCustomMessage");
+  run_test_params_arr[67].line_num = 843;
+  run_test_params_arr[68].func = testHEX32sNotWithinDelta;
+  run_test_params_arr[68].name = UNITY_TOKENIZE("testHEX32sNotWithinDelta");
+  run_test_params_arr[68].line_num = 850;
+  run_test_params_arr[69].func = testHEX32sNotWithinDeltaAndCustomMessage;
+  run_test_params_arr[69].name = UNITY_TOKENIZE("testHEX32sNotWithinDeltaAndCustomMessage");
+  run_test_params_arr[69].line_num = 857;
+  run_test_params_arr[70].func = testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPass;
+  run_test_params_arr[70].name = UNITY_TOKENIZE("testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPass");
+  run_test_params_arr[70].line_num = 864;
+  run_test_params_arr[71].func = testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage;
+  run_test_params_arr[71].name = UNITY_TOKENIZE("testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage");
+  run_test_params_arr[71].line_num = 871;
+  run_test_params_arr[72].func = testHEX16sWithinDelta;
+  run_test_params_arr[72].name = UNITY_TOKENIZE("testHEX16sWithinDelta");
+  run_test_params_arr[72].line_num = 878;
+  run_test_params_arr[73].func = testHEX16sWithinDeltaShouldIgnoreSign;
+  run_test_params_arr[73].name = UNITY_TOKENIZE("testHEX16sWithinDeltaShouldIgnoreSign");
+  run_test_params_arr[73].line_num = 885;
+  run_test_params_arr[74].func = testHEX16sWithinDeltaAndCustomMessage;
+  run_test_params_arr[74].name = UNITY_TOKENIZE("testHEX16sWithinDeltaAndCustomMessage");
+  run_test_params_arr[74].line_num = 890;
+  run_test_params_arr[75].func = testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits;
+  run_test_params_arr[75].name = UNITY_TOKENIZE("testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits");
+  run_test_params_arr[75].line_num = 897;
+  run_test_params_arr[76].func = testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage;
+  run_test_params_arr[76].name = UNITY_TOKENIZE("testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage");
+  run_test_params_arr[76].line_num = 902;
+  run_test_params_arr[77].func = testHEX16sNotWithinDelta;
+  run_test_params_arr[77].name = UNITY_TOKENIZE("testHEX16sNotWithinDelta");
+  run_test_params_arr[77].line_num = 907;
+  run_test_params_arr[78].func = testHEX16sNotWithinDeltaAndCustomMessage;
+  run_test_params_arr[78].name = UNITY_TOKENIZE("testHEX16sNotWithinDeltaAndCustomMessage");
+  run_test_params_arr[78].line_num = 914;
+  run_test_params_arr[79].func = testHEX8sWithinDelta;
+  run_test_params_arr[79].name = UNITY_TOKENIZE("testHEX8sWithinDelta");
+  run_test_params_arr[79].line_num = 921;
+  run_test_params_arr[80].func = testHEX8sWithinDeltaShouldIgnoreSign;
+  run_test_params_arr[80].name = UNITY_TOKENIZE("testHEX8sWithinDeltaShouldIgnoreSign");
+  run_test_params_arr[80].line_num = 928;
+  run_test_params_arr[81].func = testHEX8sWithinDeltaAndCustomMessage;
+  run_test_params_arr[81].name = UNITY_TOKENIZE("testHEX8sWithinDeltaAndCustomMessage");
+  run_test_params_arr[81].line_num = 933;
+  run_test_params_arr[82].func = testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits;
+  run_test_params_arr[82].name = UNITY_TOKENIZE("testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits");
+  run_test_params_arr[82].line_num = 940;
+  run_test_params_arr[83].func = testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage;
+  run_test_params_arr[83].name = UNITY_TOKENIZE("testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage");
+  run_test_params_arr[83].line_num = 945;
+  run_test_params_arr[84].func = testHEX8sNotWithinDelta;
+  run_test_params_arr[84].name = UNITY_TOKENIZE("testHEX8sNotWithinDelta");
+  run_test_params_arr[84].line_num = 950;
+  run_test_params_arr[85].func = testHEX8sNotWithinDeltaAndCustomMessage;
+  run_test_params_arr[85].name = UNITY_TOKENIZE("testHEX8sNotWithinDeltaAndCustomMessage");
+  run_test_params_arr[85].line_num = 957;
+  run_test_params_arr[86].func = testUINT32sWithinDelta;
+  run_test_params_arr[86].name = UNITY_TOKENIZE("testUINT32sWithinDelta");
+  run_test_params_arr[86].line_num = 966;
+  run_test_params_arr[87].func = testUINT32sWithinDeltaAndCustomMessage;
+  run_test_params_arr[87].name = UNITY_TOKENIZE("testUINT32sWithinDeltaAndCustomMessage");
+  run_test_params_arr[87].line_num = 973;
+  run_test_params_arr[88].func = testUINT32sNotWithinDelta;
+  run_test_params_arr[88].name = UNITY_TOKENIZE("testUINT32sNotWithinDelta");
+  run_test_params_arr[88].line_num = 980;
+  run_test_params_arr[89].func = testUINT32sNotWithinDeltaAndCustomMessage;
+  run_test_params_arr[89].name = UNITY_TOKENIZE("testUINT32sNotWithinDeltaAndCustomMessage");
+  run_test_params_arr[89].line_num = 987;
+  run_test_params_arr[90].func = testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPass;
+  run_test_params_arr[90].name = UNITY_TOKENIZE("testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPass");
+  run_test_params_arr[90].line_num = 994;
+  run_test_params_arr[91].func = testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage;
+  run_test_params_arr[91].name = UNITY_TOKENIZE("testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage");
+  run_test_params_arr[91].line_num = 1001;
+  run_test_params_arr[92].func = testUINT16sWithinDelta;
+  run_test_params_arr[92].name = UNITY_TOKENIZE("testUINT16sWithinDelta");
+  run_test_params_arr[92].line_num = 1008;
+  run_test_params_arr[93].func = testUINT16sWithinDeltaAndCustomMessage;
+  run_test_params_arr[93].name = UNITY_TOKENIZE("testUINT16sWithinDeltaAndCustomMessage");
+  run_test_params_arr[93].line_num = 1015;
+  run_test_params_arr[94].func = testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits;
+  run_test_params_arr[94].name = UNITY_TOKENIZE("testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits");
+  run_test_params_arr[94].line_num = 1022;
+  run_test_params_arr[95].func = testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage;
+  run_test_params_arr[95].name = UNITY_TOKENIZE("testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage");
+  run_test_params_arr[95].line_num = 1027;
+  run_test_params_arr[96].func = testUINT16sNotWithinDelta;
+  run_test_params_arr[96].name = UNITY_TOKENIZE("testUINT16sNotWithinDelta");
+  run_test_params_arr[96].line_num = 1032;
+  run_test_params_arr[97].func = testUINT16sNotWithinDeltaAndCustomMessage;
+  run_test_params_arr[97].name = UNITY_TOKENIZE("testUINT16sNotWithinDeltaAndCustomMessage");
+  run_test_params_arr[97].line_num = 1039;
+  run_test_params_arr[98].func = testUINT8sWithinDelta;
+  run_test_params_arr[98].name = UNITY_TOKENIZE("testUINT8sWithinDelta");
+  run_test_params_arr[98].line_num = 1046;
+  run_test_params_arr[99].func = testUINT8sWithinDeltaAndCustomMessage;
+  run_test_params_arr[99].name = UNITY_TOKENIZE("testUINT8sWithinDeltaAndCustomMessage");
+  run_test_params_arr[99].line_num = 1053;
+  run_test_params_arr[100].func = testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits;
+  run_test_params_arr[100].name = UNITY_TOKENIZE("testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits");
+  run_test_params_arr[100].line_num = 1060;
+  run_test_params_arr[101].func = testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage;
+  run_test_params_arr[101].name = UNITY_TOKENIZE("testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage");
+  run_test_params_arr[101].line_num = 1065;
+  run_test_params_arr[102].func = testUINT8sNotWithinDelta;
+  run_test_params_arr[102].name = UNITY_TOKENIZE("testUINT8sNotWithinDelta");
+  run_test_params_arr[102].line_num = 1070;
+  run_test_params_arr[103].func = testUINT8sNotWithinDeltaAndCustomMessage;
+  run_test_params_arr[103].name = UNITY_TOKENIZE("testUINT8sNotWithinDeltaAndCustomMessage");
+  run_test_params_arr[103].line_num = 1077;
+  run_test_params_arr[104].func = testINT32sWithinDelta;
+  run_test_params_arr[104].name = UNITY_TOKENIZE("testINT32sWithinDelta");
+  run_test_params_arr[104].line_num = 1084;
+  run_test_params_arr[105].func = testINT32sWithinDeltaAndCustomMessage;
+  run_test_params_arr[105].name = UNITY_TOKENIZE("testINT32sWithinDeltaAndCustomMessage");
+  run_test_params_arr[105].line_num = 1091;
+  run_test_params_arr[106].func = testINT32sNotWithinDelta;
+  run_test_params_arr[106].name = UNITY_TOKENIZE("testINT32sNotWithinDelta");
+  run_test_params_arr[106].line_num = 1096;
+  run_test_params_arr[107].func = testINT32sNotWithinDeltaAndDifferenceOverflows;
+  run_test_params_arr[107].name = UNITY_TOKENIZE("testINT32sNotWithinDeltaAndDifferenceOverflows");
+  run_test_params_arr[107].line_num = 1103;
+  run_test_params_arr[108].func = testINT32sNotWithinDeltaAndCustomMessage;
+  run_test_params_arr[108].name = UNITY_TOKENIZE("testINT32sNotWithinDeltaAndCustomMessage");
+  run_test_params_arr[108].line_num = 1109;
+  run_test_params_arr[109].func = testINT16sWithinDelta;
+  run_test_params_arr[109].name = UNITY_TOKENIZE("testINT16sWithinDelta");
+  run_test_params_arr[109].line_num = 1116;
+  run_test_params_arr[110].func = testINT16sWithinDeltaAndCustomMessage;
+  run_test_params_arr[110].name = UNITY_TOKENIZE("testINT16sWithinDeltaAndCustomMessage");
+  run_test_params_arr[110].line_num = 1123;
+  run_test_params_arr[111].func = testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits;
+  run_test_params_arr[111].name = UNITY_TOKENIZE("testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits");
+  run_test_params_arr[111].line_num = 1128;
+  run_test_params_arr[112].func = testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage;
+  run_test_params_arr[112].name = UNITY_TOKENIZE("testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage");
+  run_test_params_arr[112].line_num = 1133;
+  run_test_params_arr[113].func = testINT16sNotWithinDelta;
+  run_test_params_arr[113].name = UNITY_TOKENIZE("testINT16sNotWithinDelta");
+  run_test_params_arr[113].line_num = 1138;
+  run_test_params_arr[114].func = testINT16sNotWithinDeltaAndCustomMessage;
+  run_test_params_arr[114].name = UNITY_TOKENIZE("testINT16sNotWithinDeltaAndCustomMessage");
+  run_test_params_arr[114].line_num = 1145;
+  run_test_params_arr[115].func = testINT8sWithinDelta;
+  run_test_params_arr[115].name = UNITY_TOKENIZE("testINT8sWithinDelta");
+  run_test_params_arr[115].line_num = 1152;
+  run_test_params_arr[116].func = testINT8sWithinDeltaAndCustomMessage;
+  run_test_params_arr[116].name = UNITY_TOKENIZE("testINT8sWithinDeltaAndCustomMessage");
+  run_test_params_arr[116].line_num = 1159;
+  run_test_params_arr[117].func = testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits;
+  run_test_params_arr[117].name = UNITY_TOKENIZE("testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits");
+  run_test_params_arr[117].line_num = 1164;
+  run_test_params_arr[118].func = testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage;
+  run_test_params_arr[118].name = UNITY_TOKENIZE("testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage");
+  run_test_params_arr[118].line_num = 1169;
+  run_test_params_arr[119].func = testINT8sNotWithinDelta;
+  run_test_params_arr[119].name = UNITY_TOKENIZE("testINT8sNotWithinDelta");
+  run_test_params_arr[119].line_num = 1174;
+  run_test_params_arr[120].func = testINT8sNotWithinDeltaAndCustomMessage;
+  run_test_params_arr[120].name = UNITY_TOKENIZE("testINT8sNotWithinDeltaAndCustomMessage");
+  run_test_params_arr[120].line_num = 1181;
+  run_test_params_arr[121].func = testCHARsWithinDelta;
+  run_test_params_arr[121].name = UNITY_TOKENIZE("testCHARsWithinDelta");
+  run_test_params_arr[121].line_num = 1188;
+  run_test_params_arr[122].func = testCHARsWithinDeltaAndCustomMessage;
+  run_test_params_arr[122].name = UNITY_TOKENIZE("testCHARsWithinDeltaAndCustomMessage");
+  run_test_params_arr[122].line_num = 1195;
+  run_test_params_arr[123].func = testCHARsWithinDeltaWhenThereAreDifferenceOutsideOf8Bits;
+  run_test_params_arr[123].name = UNITY_TOKENIZE("testCHARsWithinDeltaWhenThereAreDifferenceOutsideOf8Bits");
+  run_test_params_arr[123].line_num = 1200;
+  run_test_params_arr[124].func = testCHARsWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage;
+  run_test_params_arr[124].name = UNITY_TOKENIZE("testCHARsWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage");
+  run_test_params_arr[124].line_num = 1205;
+  run_test_params_arr[125].func = testCHARsNotWithinDelta;
+  run_test_params_arr[125].name = UNITY_TOKENIZE("testCHARsNotWithinDelta");
+  run_test_params_arr[125].line_num = 1210;
+  run_test_params_arr[126].func = testCHARsNotWithinDeltaAndCustomMessage;
+  run_test_params_arr[126].name = UNITY_TOKENIZE("testCHARsNotWithinDeltaAndCustomMessage");
+  run_test_params_arr[126].line_num = 1217;
+  run_test_params_arr[127].func = testNotEqualINT;
+  run_test_params_arr[127].name = UNITY_TOKENIZE("testNotEqualINT");
+  run_test_params_arr[127].line_num = 1224;
+  run_test_params_arr[128].func = testNotNotEqualINT;
+  run_test_params_arr[128].name = UNITY_TOKENIZE("testNotNotEqualINT");
+  run_test_params_arr[128].line_num = 1240;
+  run_test_params_arr[129].func = testNotEqualINT8;
+  run_test_params_arr[129].name = UNITY_TOKENIZE("testNotEqualINT8");
+  run_test_params_arr[129].line_num = 1247;
+  run_test_params_arr[130].func = testNotNotEqualINT8;
+  run_test_params_arr[130].name = UNITY_TOKENIZE("testNotNotEqualINT8");
+  run_test_params_arr[130].line_num = 1263;
+  run_test_params_arr[131].func = testNotEqualCHAR;
+  run_test_params_arr[131].name = UNITY_TOKENIZE("testNotEqualCHAR");
+  run_test_params_arr[131].line_num = 1270;
+  run_test_params_arr[132].func = testNotNotEqualCHAR;
+  run_test_params_arr[132].name = UNITY_TOKENIZE("testNotNotEqualCHAR");
+  run_test_params_arr[132].line_num = 1286;
+  run_test_params_arr[133].func = testNotEqualINT16;
+  run_test_params_arr[133].name = UNITY_TOKENIZE("testNotEqualINT16");
+  run_test_params_arr[133].line_num = 1293;
+  run_test_params_arr[134].func = testNotNotEqualINT16;
+  run_test_params_arr[134].name = UNITY_TOKENIZE("testNotNotEqualINT16");
+  run_test_params_arr[134].line_num = 1309;
+  run_test_params_arr[135].func = testNotEqualINT32;
+  run_test_params_arr[135].name = UNITY_TOKENIZE("testNotEqualINT32");
+  run_test_params_arr[135].line_num = 1316;
+  run_test_params_arr[136].func = testNotNotEqualINT32;
+  run_test_params_arr[136].name = UNITY_TOKENIZE("testNotNotEqualINT32");
+  run_test_params_arr[136].line_num = 1332;
+  run_test_params_arr[137].func = testNotEqualUINT;
+  run_test_params_arr[137].name = UNITY_TOKENIZE("testNotEqualUINT");
+  run_test_params_arr[137].line_num = 1339;
+  run_test_params_arr[138].func = testNotNotEqualUINT;
+  run_test_params_arr[138].name = UNITY_TOKENIZE("testNotNotEqualUINT");
+  run_test_params_arr[138].line_num = 1355;
+  run_test_params_arr[139].func = testNotEqualUINT8;
+  run_test_params_arr[139].name = UNITY_TOKENIZE("testNotEqualUINT8");
+  run_test_params_arr[139].line_num = 1362;
+  run_test_params_arr[140].func = testNotNotEqualUINT8;
+  run_test_params_arr[140].name = UNITY_TOKENIZE("testNotNotEqualUINT8");
+  run_test_params_arr[140].line_num = 1378;
+  run_test_params_arr[141].func = testNotEqualUINT16;
+  run_test_params_arr[141].name = UNITY_TOKENIZE("testNotEqualUINT16");
+  run_test_params_arr[141].line_num = 1385;
+  run_test_params_arr[142].func = testNotNotEqualUINT16;
+  run_test_params_arr[142].name = UNITY_TOKENIZE("testNotNotEqualUINT16");
+  run_test_params_arr[142].line_num = 1401;
+  run_test_params_arr[143].func = testNotEqualUINT32;
+  run_test_params_arr[143].name = UNITY_TOKENIZE("testNotEqualUINT32");
+  run_test_params_arr[143].line_num = 1408;
+  run_test_params_arr[144].func = testNotNotEqualUINT32;
+  run_test_params_arr[144].name = UNITY_TOKENIZE("testNotNotEqualUINT32");
+  run_test_params_arr[144].line_num = 1424;
+  run_test_params_arr[145].func = testNotEqualHEX8;
+  run_test_params_arr[145].name = UNITY_TOKENIZE("testNotEqualHEX8");
+  run_test_params_arr[145].line_num = 1431;
+  run_test_params_arr[146].func = testNotNotEqualHEX8;
+  run_test_params_arr[146].name = UNITY_TOKENIZE("testNotNotEqualHEX8");
+  run_test_params_arr[146].line_num = 1447;
+  run_test_params_arr[147].func = testNotEqualHEX16;
+  run_test_params_arr[147].name = UNITY_TOKENIZE("testNotEqualHEX16");
+  run_test_params_arr[147].line_num = 1454;
+  run_test_params_arr[148].func = testNotNotEqualHEX16;
+  run_test_params_arr[148].name = UNITY_TOKENIZE("testNotNotEqualHEX16");
+  run_test_params_arr[148].line_num = 1470;
+  run_test_params_arr[149].func = testNotEqualHEX32;
+  run_test_params_arr[149].name = UNITY_TOKENIZE("testNotEqualHEX32");
+  run_test_params_arr[149].line_num = 1477;
+  run_test_params_arr[150].func = testNotNotEqualHEX32;
+  run_test_params_arr[150].name = UNITY_TOKENIZE("testNotNotEqualHEX32");
+  run_test_params_arr[150].line_num = 1493;
+  run_test_params_arr[151].func = testGreaterThan;
+  run_test_params_arr[151].name = UNITY_TOKENIZE("testGreaterThan");
+  run_test_params_arr[151].line_num = 1502;
+  run_test_params_arr[152].func = testNotGreaterThan;
+  run_test_params_arr[152].name = UNITY_TOKENIZE("testNotGreaterThan");
+  run_test_params_arr[152].line_num = 1518;
+  run_test_params_arr[153].func = testGreaterThanINT;
+  run_test_params_arr[153].name = UNITY_TOKENIZE("testGreaterThanINT");
+  run_test_params_arr[153].line_num = 1525;
+  run_test_params_arr[154].func = testNotGreaterThanINT;
+  run_test_params_arr[154].name = UNITY_TOKENIZE("testNotGreaterThanINT");
+  run_test_params_arr[154].line_num = 1541;
+  run_test_params_arr[155].func = testGreaterThanINT8;
+  run_test_params_arr[155].name = UNITY_TOKENIZE("testGreaterThanINT8");
+  run_test_params_arr[155].line_num = 1548;
+  run_test_params_arr[156].func = testNotGreaterThanINT8;
+  run_test_params_arr[156].name = UNITY_TOKENIZE("testNotGreaterThanINT8");
+  run_test_params_arr[156].line_num = 1564;
+  run_test_params_arr[157].func = testGreaterThanCHAR;
+  run_test_params_arr[157].name = UNITY_TOKENIZE("testGreaterThanCHAR");
+  run_test_params_arr[157].line_num = 1571;
+  run_test_params_arr[158].func = testNotGreaterThanCHAR;
+  run_test_params_arr[158].name = UNITY_TOKENIZE("testNotGreaterThanCHAR");
+  run_test_params_arr[158].line_num = 1587;
+  run_test_params_arr[159].func = testGreaterThanINT16;
+  run_test_params_arr[159].name = UNITY_TOKENIZE("testGreaterThanINT16");
+  run_test_params_arr[159].line_num = 1594;
+  run_test_params_arr[160].func = testNotGreaterThanINT16;
+  run_test_params_arr[160].name = UNITY_TOKENIZE("testNotGreaterThanINT16");
+  run_test_params_arr[160].line_num = 1610;
+  run_test_params_arr[161].func = testGreaterThanINT32;
+  run_test_params_arr[161].name = UNITY_TOKENIZE("testGreaterThanINT32");
+  run_test_params_arr[161].line_num = 1617;
+  run_test_params_arr[162].func = testNotGreaterThanINT32;
+  run_test_params_arr[162].name = UNITY_TOKENIZE("testNotGreaterThanINT32");
+  run_test_params_arr[162].line_num = 1633;
+  run_test_params_arr[163].func = testGreaterThanUINT;
+  run_test_params_arr[163].name = UNITY_TOKENIZE("testGreaterThanUINT");
+  run_test_params_arr[163].line_num = 1640;
+  run_test_params_arr[164].func = testNotGreaterThanUINT;
+  run_test_params_arr[164].name = UNITY_TOKENIZE("testNotGreaterThanUINT");
+  run_test_params_arr[164].line_num = 1656;
+  run_test_params_arr[165].func = testGreaterThanUINT8;
+  run_test_params_arr[165].name = UNITY_TOKENIZE("testGreaterThanUINT8");
+  run_test_params_arr[165].line_num = 1663;
+  run_test_params_arr[166].func = testNotGreaterThanUINT8;
+  run_test_params_arr[166].name = UNITY_TOKENIZE("testNotGreaterThanUINT8");
+  run_test_params_arr[166].line_num = 1679;
+  run_test_params_arr[167].func = testGreaterThanUINT16;
+  run_test_params_arr[167].name = UNITY_TOKENIZE("testGreaterThanUINT16");
+  run_test_params_arr[167].line_num = 1686;
+  run_test_params_arr[168].func = testNotGreaterThanUINT16;
+  run_test_params_arr[168].name = UNITY_TOKENIZE("testNotGreaterThanUINT16");
+  run_test_params_arr[168].line_num = 1702;
+  run_test_params_arr[169].func = testGreaterThanUINT32;
+  run_test_params_arr[169].name = UNITY_TOKENIZE("testGreaterThanUINT32");
+  run_test_params_arr[169].line_num = 1709;
+  run_test_params_arr[170].func = testNotGreaterThanUINT32;
+  run_test_params_arr[170].name = UNITY_TOKENIZE("testNotGreaterThanUINT32");
+  run_test_params_arr[170].line_num = 1725;
+  run_test_params_arr[171].func = testGreaterThanHEX8;
+  run_test_params_arr[171].name = UNITY_TOKENIZE("testGreaterThanHEX8");
+  run_test_params_arr[171].line_num = 1732;
+  run_test_params_arr[172].func = testNotGreaterThanHEX8;
+  run_test_params_arr[172].name = UNITY_TOKENIZE("testNotGreaterThanHEX8");
+  run_test_params_arr[172].line_num = 1748;
+  run_test_params_arr[173].func = testGreaterThanHEX16;
+  run_test_params_arr[173].name = UNITY_TOKENIZE("testGreaterThanHEX16");
+  run_test_params_arr[173].line_num = 1755;
+  run_test_params_arr[174].func = testNotGreaterThanHEX16;
+  run_test_params_arr[174].name = UNITY_TOKENIZE("testNotGreaterThanHEX16");
+  run_test_params_arr[174].line_num = 1771;
+  run_test_params_arr[175].func = testGreaterThanHEX32;
+  run_test_params_arr[175].name = UNITY_TOKENIZE("testGreaterThanHEX32");
+  run_test_params_arr[175].line_num = 1778;
+  run_test_params_arr[176].func = testNotGreaterThanHEX32;
+  run_test_params_arr[176].name = UNITY_TOKENIZE("testNotGreaterThanHEX32");
+  run_test_params_arr[176].line_num = 1794;
+  run_test_params_arr[177].func = testGreaterOrEqual;
+  run_test_params_arr[177].name = UNITY_TOKENIZE("testGreaterOrEqual");
+  run_test_params_arr[177].line_num = 1801;
+  run_test_params_arr[178].func = testNotGreaterOrEqual;
+  run_test_params_arr[178].name = UNITY_TOKENIZE("testNotGreaterOrEqual");
+  run_test_params_arr[178].line_num = 1823;
+  run_test_params_arr[179].func = testGreaterOrEqualINT;
+  run_test_params_arr[179].name = UNITY_TOKENIZE("testGreaterOrEqualINT");
+  run_test_params_arr[179].line_num = 1830;
+  run_test_params_arr[180].func = testNotGreaterOrEqualINT;
+  run_test_params_arr[180].name = UNITY_TOKENIZE("testNotGreaterOrEqualINT");
+  run_test_params_arr[180].line_num = 1852;
+  run_test_params_arr[181].func = testGreaterOrEqualINT8;
+  run_test_params_arr[181].name = UNITY_TOKENIZE("testGreaterOrEqualINT8");
+  run_test_params_arr[181].line_num = 1859;
+  run_test_params_arr[182].func = testNotGreaterOrEqualINT8;
+  run_test_params_arr[182].name = UNITY_TOKENIZE("testNotGreaterOrEqualINT8");
+  run_test_params_arr[182].line_num = 1881;
+  run_test_params_arr[183].func = testGreaterOrEqualCHAR;
+  run_test_params_arr[183].name = UNITY_TOKENIZE("testGreaterOrEqualCHAR");
+  run_test_params_arr[183].line_num = 1888;
+  run_test_params_arr[184].func = testNotGreaterOrEqualCHAR;
+  run_test_params_arr[184].name = UNITY_TOKENIZE("testNotGreaterOrEqualCHAR");
+  run_test_params_arr[184].line_num = 1910;
+  run_test_params_arr[185].func = testGreaterOrEqualINT16;
+  run_test_params_arr[185].name = UNITY_TOKENIZE("testGreaterOrEqualINT16");
+  run_test_params_arr[185].line_num = 1917;
+  run_test_params_arr[186].func = testNotGreaterOrEqualINT16;
+  run_test_params_arr[186].name = UNITY_TOKENIZE("testNotGreaterOrEqualINT16");
+  run_test_params_arr[186].line_num = 1939;
+  run_test_params_arr[187].func = testGreaterOrEqualINT32;
+  run_test_params_arr[187].name = UNITY_TOKENIZE("testGreaterOrEqualINT32");
+  run_test_params_arr[187].line_num = 1946;
+  run_test_params_arr[188].func = testNotGreaterOrEqualINT32;
+  run_test_params_arr[188].name = UNITY_TOKENIZE("testNotGreaterOrEqualINT32");
+  run_test_params_arr[188].line_num = 1968;
+  run_test_params_arr[189].func = testGreaterOrEqualUINT;
+  run_test_params_arr[189].name = UNITY_TOKENIZE("testGreaterOrEqualUINT");
+  run_test_params_arr[189].line_num = 1975;
+  run_test_params_arr[190].func = testNotGreaterOrEqualUINT;
+  run_test_params_arr[190].name = UNITY_TOKENIZE("testNotGreaterOrEqualUINT");
+  run_test_params_arr[190].line_num = 1997;
+  run_test_params_arr[191].func = testGreaterOrEqualUINT8;
+  run_test_params_arr[191].name = UNITY_TOKENIZE("testGreaterOrEqualUINT8");
+  run_test_params_arr[191].line_num = 2004;
+  run_test_params_arr[192].func = testNotGreaterOrEqualUINT8;
+  run_test_params_arr[192].name = UNITY_TOKENIZE("testNotGreaterOrEqualUINT8");
+  run_test_params_arr[192].line_num = 2026;
+  run_test_params_arr[193].func = testGreaterOrEqualUINT16;
+  run_test_params_arr[193].name = UNITY_TOKENIZE("testGreaterOrEqualUINT16");
+  run_test_params_arr[193].line_num = 2033;
+  run_test_params_arr[194].func = testNotGreaterOrEqualUINT16;
+  run_test_params_arr[194].name = UNITY_TOKENIZE("testNotGreaterOrEqualUINT16");
+  run_test_params_arr[194].line_num = 2055;
+  run_test_params_arr[195].func = testGreaterOrEqualUINT32;
+  run_test_params_arr[195].name = UNITY_TOKENIZE("testGreaterOrEqualUINT32");
+  run_test_params_arr[195].line_num = 2062;
+  run_test_params_arr[196].func = testNotGreaterOrEqualUINT32;
+  run_test_params_arr[196].name = UNITY_TOKENIZE("testNotGreaterOrEqualUINT32");
+  run_test_params_arr[196].line_num = 2084;
+  run_test_params_arr[197].func = testGreaterOrEqualHEX8;
+  run_test_params_arr[197].name = UNITY_TOKENIZE("testGreaterOrEqualHEX8");
+  run_test_params_arr[197].line_num = 2091;
+  run_test_params_arr[198].func = testNotGreaterOrEqualHEX8;
+  run_test_params_arr[198].name = UNITY_TOKENIZE("testNotGreaterOrEqualHEX8");
+  run_test_params_arr[198].line_num = 2113;
+  run_test_params_arr[199].func = testGreaterOrEqualHEX16;
+  run_test_params_arr[199].name = UNITY_TOKENIZE("testGreaterOrEqualHEX16");
+  run_test_params_arr[199].line_num = 2120;
+  run_test_params_arr[200].func = testNotGreaterOrEqualHEX16;
+  run_test_params_arr[200].name = UNITY_TOKENIZE("testNotGreaterOrEqualHEX16");
+  run_test_params_arr[200].line_num = 2142;
+  run_test_params_arr[201].func = testGreaterOrEqualHEX32;
+  run_test_params_arr[201].name = UNITY_TOKENIZE("testGreaterOrEqualHEX32");
+  run_test_params_arr[201].line_num = 2149;
+  run_test_params_arr[202].func = testNotGreaterOrEqualHEX32;
+  run_test_params_arr[202].name = UNITY_TOKENIZE("testNotGreaterOrEqualHEX32");
+  run_test_params_arr[202].line_num = 2171;
+  run_test_params_arr[203].func = testLessThan;
+  run_test_params_arr[203].name = UNITY_TOKENIZE("testLessThan");
+  run_test_params_arr[203].line_num = 2180;
+  run_test_params_arr[204].func = testNotLessThan;
+  run_test_params_arr[204].name = UNITY_TOKENIZE("testNotLessThan");
+  run_test_params_arr[204].line_num = 2196;
+  run_test_params_arr[205].func = testLessThanINT;
+  run_test_params_arr[205].name = UNITY_TOKENIZE("testLessThanINT");
+  run_test_params_arr[205].line_num = 2203;
+  run_test_params_arr[206].func = testNotLessThanINT;
+  run_test_params_arr[206].name = UNITY_TOKENIZE("testNotLessThanINT");
+  run_test_params_arr[206].line_num = 2219;
+  run_test_params_arr[207].func = testLessThanINT8;
+  run_test_params_arr[207].name = UNITY_TOKENIZE("testLessThanINT8");
+  run_test_params_arr[207].line_num = 2226;
+  run_test_params_arr[208].func = testNotLessThanINT8;
+  run_test_params_arr[208].name = UNITY_TOKENIZE("testNotLessThanINT8");
+  run_test_params_arr[208].line_num = 2242;
+  run_test_params_arr[209].func = testLessThanCHAR;
+  run_test_params_arr[209].name = UNITY_TOKENIZE("testLessThanCHAR");
+  run_test_params_arr[209].line_num = 2249;
+  run_test_params_arr[210].func = testNotLessThanCHAR;
+  run_test_params_arr[210].name = UNITY_TOKENIZE("testNotLessThanCHAR");
+  run_test_params_arr[210].line_num = 2265;
+  run_test_params_arr[211].func = testLessThanINT16;
+  run_test_params_arr[211].name = UNITY_TOKENIZE("testLessThanINT16");
+  run_test_params_arr[211].line_num = 2272;
+  run_test_params_arr[212].func = testNotLessThanINT16;
+  run_test_params_arr[212].name = UNITY_TOKENIZE("testNotLessThanINT16");
+  run_test_params_arr[212].line_num = 2288;
+  run_test_params_arr[213].func = testLessThanINT32;
+  run_test_params_arr[213].name = UNITY_TOKENIZE("testLessThanINT32");
+  run_test_params_arr[213].line_num = 2295;
+  run_test_params_arr[214].func = testNotLessThanINT32;
+  run_test_params_arr[214].name = UNITY_TOKENIZE("testNotLessThanINT32");
+  run_test_params_arr[214].line_num = 2311;
+  run_test_params_arr[215].func = testLessThanUINT;
+  run_test_params_arr[215].name = UNITY_TOKENIZE("testLessThanUINT");
+  run_test_params_arr[215].line_num = 2318;
+  run_test_params_arr[216].func = testNotLessThanUINT;
+  run_test_params_arr[216].name = UNITY_TOKENIZE("testNotLessThanUINT");
+  run_test_params_arr[216].line_num = 2334;
+  run_test_params_arr[217].func = testLessThanUINT8;
+  run_test_params_arr[217].name = UNITY_TOKENIZE("testLessThanUINT8");
+  run_test_params_arr[217].line_num = 2341;
+  run_test_params_arr[218].func = testNotLessThanUINT8;
+  run_test_params_arr[218].name = UNITY_TOKENIZE("testNotLessThanUINT8");
+  run_test_params_arr[218].line_num = 2357;
+  run_test_params_arr[219].func = testLessThanUINT16;
+  run_test_params_arr[219].name = UNITY_TOKENIZE("testLessThanUINT16");
+  run_test_params_arr[219].line_num = 2364;
+  run_test_params_arr[220].func = testNotLessThanUINT16;
+  run_test_params_arr[220].name = UNITY_TOKENIZE("testNotLessThanUINT16");
+  run_test_params_arr[220].line_num = 2380;
+  run_test_params_arr[221].func = testLessThanUINT32;
+  run_test_params_arr[221].name = UNITY_TOKENIZE("testLessThanUINT32");
+  run_test_params_arr[221].line_num = 2387;
+  run_test_params_arr[222].func = testNotLessThanUINT32;
+  run_test_params_arr[222].name = UNITY_TOKENIZE("testNotLessThanUINT32");
+  run_test_params_arr[222].line_num = 2403;
+  run_test_params_arr[223].func = testLessThanHEX8;
+  run_test_params_arr[223].name = UNITY_TOKENIZE("testLessThanHEX8");
+  run_test_params_arr[223].line_num = 2410;
+  run_test_params_arr[224].func = testNotLessThanHEX8;
+  run_test_params_arr[224].name = UNITY_TOKENIZE("testNotLessThanHEX8");
+  run_test_params_arr[224].line_num = 2426;
+  run_test_params_arr[225].func = testLessThanHEX16;
+  run_test_params_arr[225].name = UNITY_TOKENIZE("testLessThanHEX16");
+  run_test_params_arr[225].line_num = 2433;
+  run_test_params_arr[226].func = testNotLessThanHEX16;
+  run_test_params_arr[226].name = UNITY_TOKENIZE("testNotLessThanHEX16");
+  run_test_params_arr[226].line_num = 2449;
+  run_test_params_arr[227].func = testLessThanHEX32;
+  run_test_params_arr[227].name = UNITY_TOKENIZE("testLessThanHEX32");
+  run_test_params_arr[227].line_num = 2456;
+  run_test_params_arr[228].func = testNotLessThanHEX32;
+  run_test_params_arr[228].name = UNITY_TOKENIZE("testNotLessThanHEX32");
+  run_test_params_arr[228].line_num = 2472;
+  run_test_params_arr[229].func = testLessOrEqual;
+  run_test_params_arr[229].name = UNITY_TOKENIZE("testLessOrEqual");
+  run_test_params_arr[229].line_num = 2479;
+  run_test_params_arr[230].func = testNotLessOrEqual;
+  run_test_params_arr[230].name = UNITY_TOKENIZE("testNotLessOrEqual");
+  run_test_params_arr[230].line_num = 2501;
+  run_test_params_arr[231].func = testLessOrEqualINT;
+  run_test_params_arr[231].name = UNITY_TOKENIZE("testLessOrEqualINT");
+  run_test_params_arr[231].line_num = 2508;
+  run_test_params_arr[232].func = testNotLessOrEqualINT;
+  run_test_params_arr[232].name = UNITY_TOKENIZE("testNotLessOrEqualINT");
+  run_test_params_arr[232].line_num = 2530;
+  run_test_params_arr[233].func = testLessOrEqualINT8;
+  run_test_params_arr[233].name = UNITY_TOKENIZE("testLessOrEqualINT8");
+  run_test_params_arr[233].line_num = 2537;
+  run_test_params_arr[234].func = testNotLessOrEqualINT8;
+  run_test_params_arr[234].name = UNITY_TOKENIZE("testNotLessOrEqualINT8");
+  run_test_params_arr[234].line_num = 2559;
+  run_test_params_arr[235].func = testLessOrEqualCHAR;
+  run_test_params_arr[235].name = UNITY_TOKENIZE("testLessOrEqualCHAR");
+  run_test_params_arr[235].line_num = 2566;
+  run_test_params_arr[236].func = testNotLessOrEqualCHAR;
+  run_test_params_arr[236].name = UNITY_TOKENIZE("testNotLessOrEqualCHAR");
+  run_test_params_arr[236].line_num = 2588;
+  run_test_params_arr[237].func = testLessOrEqualINT16;
+  run_test_params_arr[237].name = UNITY_TOKENIZE("testLessOrEqualINT16");
+  run_test_params_arr[237].line_num = 2595;
+  run_test_params_arr[238].func = testNotLessOrEqualINT16;
+  run_test_params_arr[238].name = UNITY_TOKENIZE("testNotLessOrEqualINT16");
+  run_test_params_arr[238].line_num = 2617;
+  run_test_params_arr[239].func = testLessOrEqualINT32;
+  run_test_params_arr[239].name = UNITY_TOKENIZE("testLessOrEqualINT32");
+  run_test_params_arr[239].line_num = 2624;
+  run_test_params_arr[240].func = testNotLessOrEqualINT32;
+  run_test_params_arr[240].name = UNITY_TOKENIZE("testNotLessOrEqualINT32");
+  run_test_params_arr[240].line_num = 2646;
+  run_test_params_arr[241].func = testLessOrEqualUINT;
+  run_test_params_arr[241].name = UNITY_TOKENIZE("testLessOrEqualUINT");
+  run_test_params_arr[241].line_num = 2653;
+  run_test_params_arr[242].func = testNotLessOrEqualUINT;
+  run_test_params_arr[242].name = UNITY_TOKENIZE("testNotLessOrEqualUINT");
+  run_test_params_arr[242].line_num = 2675;
+  run_test_params_arr[243].func = testLessOrEqualUINT8;
+  run_test_params_arr[243].name = UNITY_TOKENIZE("testLessOrEqualUINT8");
+  run_test_params_arr[243].line_num = 2682;
+  run_test_params_arr[244].func = testNotLessOrEqualUINT8;
+  run_test_params_arr[244].name = UNITY_TOKENIZE("testNotLessOrEqualUINT8");
+  run_test_params_arr[244].line_num = 2704;
+  run_test_params_arr[245].func = testLessOrEqualUINT16;
+  run_test_params_arr[245].name = UNITY_TOKENIZE("testLessOrEqualUINT16");
+  run_test_params_arr[245].line_num = 2711;
+  run_test_params_arr[246].func = testNotLessOrEqualUINT16;
+  run_test_params_arr[246].name = UNITY_TOKENIZE("testNotLessOrEqualUINT16");
+  run_test_params_arr[246].line_num = 2733;
+  run_test_params_arr[247].func = testLessOrEqualUINT32;
+  run_test_params_arr[247].name = UNITY_TOKENIZE("testLessOrEqualUINT32");
+  run_test_params_arr[247].line_num = 2740;
+  run_test_params_arr[248].func = testNotLessOrEqualUINT32;
+  run_test_params_arr[248].name = UNITY_TOKENIZE("testNotLessOrEqualUINT32");
+  run_test_params_arr[248].line_num = 2762;
+  run_test_params_arr[249].func = testLessOrEqualHEX8;
+  run_test_params_arr[249].name = UNITY_TOKENIZE("testLessOrEqualHEX8");
+  run_test_params_arr[249].line_num = 2769;
+  run_test_params_arr[250].func = testNotLessOrEqualHEX8;
+  run_test_params_arr[250].name = UNITY_TOKENIZE("testNotLessOrEqualHEX8");
+  run_test_params_arr[250].line_num = 2791;
+  run_test_params_arr[251].func = testLessOrEqualHEX16;
+  run_test_params_arr[251].name = UNITY_TOKENIZE("testLessOrEqualHEX16");
+  run_test_params_arr[251].line_num = 2798;
+  run_test_params_arr[252].func = testNotLessOrEqualHEX16;
+  run_test_params_arr[252].name = UNITY_TOKENIZE("testNotLessOrEqualHEX16");
+  run_test_params_arr[252].line_num = 2820;
+  run_test_params_arr[253].func = testLessOrEqualHEX32;
+  run_test_params_arr[253].name = UNITY_TOKENIZE("testLessOrEqualHEX32");
+  run_test_params_arr[253].line_num = 2827;
+  run_test_params_arr[254].func = testNotLessOrEqualHEX32;
+  run_test_params_arr[254].name = UNITY_TOKENIZE("testNotLessOrEqualHEX32");
+  run_test_params_arr[254].line_num = 2849;
+  run_test_params_arr[255].func = testHexPrintsUpToMaxNumberOfNibbles;
+  run_test_params_arr[255].name = UNITY_TOKENIZE("testHexPrintsUpToMaxNumberOfNibbles");
+  run_test_params_arr[255].line_num = 2856;
+  run_test_params_arr[256].func = testPrintNumbers32;
+  run_test_params_arr[256].name = UNITY_TOKENIZE("testPrintNumbers32");
+  run_test_params_arr[256].line_num = 2872;
+  run_test_params_arr[257].func = testPrintNumbersUnsigned32;
+  run_test_params_arr[257].name = UNITY_TOKENIZE("testPrintNumbersUnsigned32");
+  run_test_params_arr[257].line_num = 2886;
+
+  for (int i = 0; i < 258; i++)
+  {
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
@@ -0,0 +1,34 @@
+#include "unity.h" /* Autogenerated by awk in Makefile */
+void testEqualMemory(void);
+void testNotEqualMemory1(void);
+void testNotEqualMemory2(void);
+void testNotEqualMemory3(void);
+void testNotEqualMemory4(void);
+void testNotEqualMemoryLengthZero(void);
+void testNotEqualMemory(void);
+void testNotNotEqualMemory1(void);
+void testNotNotEqualMemory2(void);
+void testNotNotEqualMemoryLengthZero(void);
+void testEachEqualMemory(void);
+void testNotEachEqualMemory(void);
+void testEachEqualMemoryWithMessage(void);
+void testNotEachEqualMemoryWithMessage(void);
+int main(void)
+{
+    UnityBegin("tests/test_unity_memory.c");
+    RUN_TEST(testEqualMemory, 37);
+    RUN_TEST(testNotEqualMemory1, 49);
+    RUN_TEST(testNotEqualMemory2, 56);
+    RUN_TEST(testNotEqualMemory3, 63);
+    RUN_TEST(testNotEqualMemory4, 70);
+    RUN_TEST(testNotEqualMemoryLengthZero, 77);
+    RUN_TEST(testNotEqualMemory, 84);
+    RUN_TEST(testNotNotEqualMemory1, 92);
+    RUN_TEST(testNotNotEqualMemory2, 99);
+    RUN_TEST(testNotNotEqualMemoryLengthZero, 106);
+    RUN_TEST(testEachEqualMemory, 113);
+    RUN_TEST(testNotEachEqualMemory, 127);
+    RUN_TEST(testEachEqualMemoryWithMessage, 136);
+    RUN_TEST(testNotEachEqualMemoryWithMessage, 143);
+    return UNITY_END();
+}
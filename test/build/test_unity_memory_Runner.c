@@ -0,0 +1,151 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "self_assessment_utils.h"
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testEqualMemory(void);
+extern void testNotEqualMemory1(void);
+extern void testNotEqualMemory2(void);
+extern void testNotEqualMemory3(void);
+extern void testNotEqualMemory4(void);
+extern void testNotEqualMemoryLengthZero(void);
+extern void testNotEqualMemory(void);
+extern void testNotNotEqualMemory1(void);
+extern void testNotNotEqualMemory2(void);
+extern void testNotNotEqualMemoryLengthZero(void);
+extern void testEachEqualMemory(void);
+extern void testNotEachEqualMemory(void);
+extern void testEachEqualMemoryWithMessage(void);
+extern void testNotEachEqualMemoryWithMessage(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("tests/test_unity_memory.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[14];
+
+  run_test_params_arr[0].func = testEqualMemory;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("testEqualMemory");
+  run_test_params_arr[0].line_num = 37;
+  run_test_params_arr[1].func = testNotEqualMemory1;
+  run_test_params_arr[1].name = UNITY_TOKENIZE("testNotEqualMemory1");
+  run_test_params_arr[1].line_num = 49;
+  run_test_params_arr[2].func = testNotEqualMemory2;
+  run_test_params_arr[2].name = UNITY_TOKENIZE("testNotEqualMemory2");
+  run_test_params_arr[2].line_num = 56;
+  run_test_params_arr[3].func = testNotEqualMemory3;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("testNotEqualMemory3");
+  run_test_params_arr[3].line_num = 63;
+  run_test_params_arr[4].func = testNotEqualMemory4;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("testNotEqualMemory4");
+  run_test_params_arr[4].line_num = 70;
+  run_test_params_arr[5].func = testNotEqualMemoryLengthZero;
+  run_test_params_arr[5].name = UNITY_TOKENIZE("testNotEqualMemoryLengthZero");
+  run_test_params_arr[5].line_num = 77;
+  run_test_params_arr[6].func = testNotEqualMemory;
+  run_test_params_arr[6].name = UNITY_TOKENIZE("testNotEqualMemory");
+  run_test_params_arr[6].line_num = 84;
+  run_test_params_arr[7].func = testNotNotEqualMemory1;
+  run_test_params_arr[7].name = UNITY_TOKENIZE("testNotNotEqualMemory1");
+  run_test_params_arr[7].line_num = 92;
+  run_test_params_arr[8].func = testNotNotEqualMemory2;
+  run_test_params_arr[8].name = UNITY_TOKENIZE("testNotNotEqualMemory2");
+  run_test_params_arr[8].line_num = 99;
+  run_test_params_arr[9].func = testNotNotEqualMemoryLengthZero;
+  run_test_params_arr[9].name = UNITY_TOKENIZE("testNotNotEqualMemoryLengthZero");
+  run_test_params_arr[9].line_num = 106;
+  run_test_params_arr[10].func = testEachEqualMemory;
+  run_test_params_arr[10].name = UNITY_TOKENIZE("testEachEqualMemory");
+  run_test_params_arr[10].line_num = 113;
+  run_test_params_arr[11].func = testNotEachEqualMemory;
+  run_test_params_arr[11].name = UNITY_TOKENIZE("testNotEachEqualMemory");
+  run_test_params_arr[11].line_num = 127;
+  run_test_params_arr[12].func = testEachEqualMemoryWithMessage;
+  run_test_params_arr[12].name = UNITY_TOKENIZE("testEachEqualMemoryWithMessage");
+  run_test_params_arr[12].line_num = 136;
+  run_test_params_arr[13].func = testNotEachEqualMemoryWithMessage;
+  run_test_params_arr[13].name = UNITY_TOKENIZE("testNotEachEqualMemoryWithMessage");
+  run_test_params_arr[13].line_num = 143;
+
+  for (int i = 0; i < 14; i++)
+  {
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
@@ -0,0 +1,158 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+  int args_row;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_demoParamFunction(int a, int b, int c);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Setup (stub)=====*/
+void setUp(void) {}
+
+/*=======Teardown (stub)=====*/
+void tearDown(void) {}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======Parameterized Test Wrappers=====*/
+static int runner_args_row;
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    int p1;
+    int p2;
+    int p3;
+} runner_args_table_test_demoParamFunction[] =
+{
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(1, 2, 5)"), 1, 2, 5 },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(10, 7, 20)"), 10, 7, 20 },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(3, 10, 30)"), 3, 10, 30 },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(3, 8, 30)"), 3, 8, 30 },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(3, 6, 30)"), 3, 6, 30 },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(4, 10, 30)"), 4, 10, 30 },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(4, 8, 30)"), 4, 8, 30 },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(4, 6, 30)"), 4, 6, 30 },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(3, 10, 30u)"), 3, 10, 30u },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(3, 10, 20.0f)"), 3, 10, 20.0f },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(3, 8, 30u)"), 3, 8, 30u },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(3, 8, 20.0f)"), 3, 8, 20.0f },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(3, 2, 30u)"), 3, 2, 30u },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(3, 2, 20.0f)"), 3, 2, 20.0f },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(3, 1, 30u)"), 3, 1, 30u },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(3, 1, 20.0f)"), 3, 1, 20.0f },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(4, 10, 30u)"), 4, 10, 30u },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(4, 10, 20.0f)"), 4, 10, 20.0f },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(4, 8, 30u)"), 4, 8, 30u },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(4, 8, 20.0f)"), 4, 8, 20.0f },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(4, 2, 30u)"), 4, 2, 30u },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(4, 2, 20.0f)"), 4, 2, 20.0f },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(4, 1, 30u)"), 4, 1, 30u },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(4, 1, 20.0f)"), 4, 1, 20.0f },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(7, 10, 30u)"), 7, 10, 30u },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(7, 10, 20.0f)"), 7, 10, 20.0f },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(7, 8, 30u)"), 7, 8, 30u },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(7, 8, 20.0f)"), 7, 8, 20.0f },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(7, 2, 30u)"), 7, 2, 30u },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(7, 2, 20.0f)"), 7, 2, 20.0f },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(7, 1, 30u)"), 7, 1, 30u },
+    { UNITY_TOKENIZED_NAME("test_demoParamFunction(7, 1, 20.0f)"), 7, 1, 20.0f },
+};
+static void runner_args_test_demoParamFunction(void)
+{
+    test_demoParamFunction(runner_args_table_test_demoParamFunction[runner_args_row].p1, runner_args_table_test_demoParamFunction[runner_args_row].p2, runner_args_table_test_demoParamFunction[runner_args_row].p3);
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("tests/test_unity_parameterizedDemo.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[32];
+
+  for (int r = 0; r < 32; r++)
+  {
+    run_test_params_arr[0 + r].func = runner_args_test_demoParamFunction;
+    run_test_params_arr[0 + r].name = runner_args_table_test_demoParamFunction[r].name;
+    run_test_params_arr[0 + r].line_num = 25;
+    run_test_params_arr[0 + r].args_row = r;
+  }
+
+  for (int i = 0; i < 32; i++)
+  {
+    runner_args_row = run_test_params_arr[i].args_row;
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
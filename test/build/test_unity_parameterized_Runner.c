@@ -0,0 +1,1143 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "types_for_test.h"
+#include <setjmp.h>
+#include <stdio.h>
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+  int args_row;
+  int runs_cases;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_TheseShouldAllPass(int Num);
+extern void test_TheseShouldAllFail(int Num);
+extern void test_TheseAreEveryOther(int Num);
+extern void test_NormalPassesStillWork(void);
+extern void test_NormalFailsStillWork(void);
+extern void test_StringsArePreserved(unsigned index, const char * str);
+extern void test_CharsArePreserved(unsigned index, char c);
+extern void test_SingleRange(unsigned value);
+extern void test_TwoRanges(unsigned first, unsigned second);
+extern void test_SingleExclusiveRange(unsigned value);
+extern void test_BothInclusiveAndExclusiveRange(unsigned first, unsigned second);
+extern void test_SpaceInTestCase(unsigned index, unsigned bigger);
+extern void test_SingleMatix(unsigned value);
+extern void test_TwoMatrices(unsigned first, signed second);
+extern void test_StringsAndNumbersMatrices(const char* str, float number);
+extern void test_EnumCharAndArrayMatrices(test_enum_t e, float n, char c);
+extern void test_PairwiseMatrix(unsigned a, unsigned b, unsigned c, unsigned d);
+extern void test_PairwiseMatrixCoversEveryPairWithFewerCases(void);
+extern void test_ValuesFromSource(unsigned int square);
+extern void test_ValuesFromSourceArePointers(const char* word);
+extern void test_ValuesFromSourceRanEveryValue(void);
+extern int squaresUpTo100(unsigned int index, unsigned int* value);
+extern int someWords(unsigned int index, const char** value);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======Parameterized Test Wrappers=====*/
+static int runner_args_row;
+static void runner_args1_test_TheseShouldAllPass(void)
+{
+    test_TheseShouldAllPass(0);
+}
+static void runner_args2_test_TheseShouldAllPass(void)
+{
+    test_TheseShouldAllPass(44);
+}
+static void runner_args3_test_TheseShouldAllPass(void)
+{
+    test_TheseShouldAllPass((90)+9);
+}
+static void runner_args1_test_TheseShouldAllFail(void)
+{
+    test_TheseShouldAllFail(3);
+}
+static void runner_args2_test_TheseShouldAllFail(void)
+{
+    test_TheseShouldAllFail(77);
+}
+static void runner_args3_test_TheseShouldAllFail(void)
+{
+    test_TheseShouldAllFail((99) + 1 - (1));
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    int p1;
+} runner_args_table_test_TheseAreEveryOther[] =
+{
+    { UNITY_TOKENIZED_NAME("test_TheseAreEveryOther(1)"), 1 },
+    { UNITY_TOKENIZED_NAME("test_TheseAreEveryOther(44)"), 44 },
+    { UNITY_TOKENIZED_NAME("test_TheseAreEveryOther(99)"), 99 },
+    { UNITY_TOKENIZED_NAME("test_TheseAreEveryOther(98)"), 98 },
+};
+static void runner_args_test_TheseAreEveryOther(void)
+{
+    test_TheseAreEveryOther(runner_args_table_test_TheseAreEveryOther[runner_args_row].p1);
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    unsigned p1;
+    const char * p2;
+} runner_args_table_test_StringsArePreserved[] =
+{
+    { UNITY_TOKENIZED_NAME("test_StringsArePreserved(0, \"abc\")"), 0, "abc" },
+    { UNITY_TOKENIZED_NAME("test_StringsArePreserved(1, \"{\")"), 1, "{" },
+    { UNITY_TOKENIZED_NAME("test_StringsArePreserved(2, \"}\")"), 2, "}" },
+    { UNITY_TOKENIZED_NAME("test_StringsArePreserved(3, \";\")"), 3, ";" },
+    { UNITY_TOKENIZED_NAME("test_StringsArePreserved(4, \"\\\"quoted\\\"\")"), 4, "\"quoted\"" },
+};
+static void runner_args_test_StringsArePreserved(void)
+{
+    test_StringsArePreserved(runner_args_table_test_StringsArePreserved[runner_args_row].p1, runner_args_table_test_StringsArePreserved[runner_args_row].p2);
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    unsigned p1;
+    char p2;
+} runner_args_table_test_CharsArePreserved[] =
+{
+    { UNITY_TOKENIZED_NAME("test_CharsArePreserved(0, 'x')"), 0, 'x' },
+    { UNITY_TOKENIZED_NAME("test_CharsArePreserved(1, '{')"), 1, '{' },
+    { UNITY_TOKENIZED_NAME("test_CharsArePreserved(2, '}')"), 2, '}' },
+    { UNITY_TOKENIZED_NAME("test_CharsArePreserved(3, ';')"), 3, ';' },
+    { UNITY_TOKENIZED_NAME("test_CharsArePreserved(4, '\\'')"), 4, '\'' },
+    { UNITY_TOKENIZED_NAME("test_CharsArePreserved(5, '\"')"), 5, '"' },
+};
+static void runner_args_test_CharsArePreserved(void)
+{
+    test_CharsArePreserved(runner_args_table_test_CharsArePreserved[runner_args_row].p1, runner_args_table_test_CharsArePreserved[runner_args_row].p2);
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    unsigned p1;
+} runner_args_table_test_SingleRange[] =
+{
+    { UNITY_TOKENIZED_NAME("test_SingleRange(0)"), 0 },
+    { UNITY_TOKENIZED_NAME("test_SingleRange(2)"), 2 },
+    { UNITY_TOKENIZED_NAME("test_SingleRange(4)"), 4 },
+    { UNITY_TOKENIZED_NAME("test_SingleRange(6)"), 6 },
+    { UNITY_TOKENIZED_NAME("test_SingleRange(8)"), 8 },
+    { UNITY_TOKENIZED_NAME("test_SingleRange(10)"), 10 },
+};
+static void runner_args_test_SingleRange(void)
+{
+    test_SingleRange(runner_args_table_test_SingleRange[runner_args_row].p1);
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    unsigned p1;
+    unsigned p2;
+} runner_args_table_test_TwoRanges[] =
+{
+    { UNITY_TOKENIZED_NAME("test_TwoRanges(1, 2)"), 1, 2 },
+    { UNITY_TOKENIZED_NAME("test_TwoRanges(1, 1)"), 1, 1 },
+    { UNITY_TOKENIZED_NAME("test_TwoRanges(2, 2)"), 2, 2 },
+    { UNITY_TOKENIZED_NAME("test_TwoRanges(2, 1)"), 2, 1 },
+};
+static void runner_args_test_TwoRanges(void)
+{
+    test_TwoRanges(runner_args_table_test_TwoRanges[runner_args_row].p1, runner_args_table_test_TwoRanges[runner_args_row].p2);
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    unsigned p1;
+} runner_args_table_test_SingleExclusiveRange[] =
+{
+    { UNITY_TOKENIZED_NAME("test_SingleExclusiveRange(0)"), 0 },
+    { UNITY_TOKENIZED_NAME("test_SingleExclusiveRange(2)"), 2 },
+    { UNITY_TOKENIZED_NAME("test_SingleExclusiveRange(4)"), 4 },
+    { UNITY_TOKENIZED_NAME("test_SingleExclusiveRange(6)"), 6 },
+    { UNITY_TOKENIZED_NAME("test_SingleExclusiveRange(8)"), 8 },
+};
+static void runner_args_test_SingleExclusiveRange(void)
+{
+    test_SingleExclusiveRange(runner_args_table_test_SingleExclusiveRange[runner_args_row].p1);
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    unsigned p1;
+    unsigned p2;
+} runner_args_table_test_BothInclusiveAndExclusiveRange[] =
+{
+    { UNITY_TOKENIZED_NAME("test_BothInclusiveAndExclusiveRange(2, 1)"), 2, 1 },
+    { UNITY_TOKENIZED_NAME("test_BothInclusiveAndExclusiveRange(3, 1)"), 3, 1 },
+    { UNITY_TOKENIZED_NAME("test_BothInclusiveAndExclusiveRange(4, 1)"), 4, 1 },
+};
+static void runner_args_test_BothInclusiveAndExclusiveRange(void)
+{
+    test_BothInclusiveAndExclusiveRange(runner_args_table_test_BothInclusiveAndExclusiveRange[runner_args_row].p1, runner_args_table_test_BothInclusiveAndExclusiveRange[runner_args_row].p2);
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    unsigned p1;
+    unsigned p2;
+} runner_args_table_test_SpaceInTestCase[] =
+{
+    { UNITY_TOKENIZED_NAME("test_SpaceInTestCase(0,\n\n          1)"), 0, 1 },
+    { UNITY_TOKENIZED_NAME("test_SpaceInTestCase(1,\n\n          2)"), 1, 2 },
+    { UNITY_TOKENIZED_NAME("test_SpaceInTestCase(2, 6)"), 2, 6 },
+    { UNITY_TOKENIZED_NAME("test_SpaceInTestCase(3, 6)"), 3, 6 },
+    { UNITY_TOKENIZED_NAME("test_SpaceInTestCase(4, 6)"), 4, 6 },
+    { UNITY_TOKENIZED_NAME("test_SpaceInTestCase(5, 6)"), 5, 6 },
+    { UNITY_TOKENIZED_NAME("test_SpaceInTestCase(6 , 7)"), 6, 7 },
+    { UNITY_TOKENIZED_NAME("test_SpaceInTestCase(7, 11)"), 7, 11 },
+    { UNITY_TOKENIZED_NAME("test_SpaceInTestCase(8, 11)"), 8, 11 },
+    { UNITY_TOKENIZED_NAME("test_SpaceInTestCase(9, 11)"), 9, 11 },
+    { UNITY_TOKENIZED_NAME("test_SpaceInTestCase(10, 11)"), 10, 11 },
+};
+static void runner_args_test_SpaceInTestCase(void)
+{
+    test_SpaceInTestCase(runner_args_table_test_SpaceInTestCase[runner_args_row].p1, runner_args_table_test_SpaceInTestCase[runner_args_row].p2);
+}
+static void runner_args1_test_SingleMatix(void)
+{
+    test_SingleMatix(1);
+}
+static void runner_args2_test_SingleMatix(void)
+{
+    test_SingleMatix(5);
+}
+static void runner_args3_test_SingleMatix(void)
+{
+    test_SingleMatix((2*2)+1);
+}
+static void runner_args4_test_SingleMatix(void)
+{
+    test_SingleMatix(4);
+}
+static void runner_args1_test_TwoMatrices(void)
+{
+    test_TwoMatrices(2, -2);
+}
+static void runner_args2_test_TwoMatrices(void)
+{
+    test_TwoMatrices(2, 3);
+}
+static void runner_args3_test_TwoMatrices(void)
+{
+    test_TwoMatrices(5l, -2);
+}
+static void runner_args4_test_TwoMatrices(void)
+{
+    test_TwoMatrices(5l, 3);
+}
+static void runner_args5_test_TwoMatrices(void)
+{
+    test_TwoMatrices(4u+3, -2);
+}
+static void runner_args6_test_TwoMatrices(void)
+{
+    test_TwoMatrices(4u+3, 3);
+}
+static void runner_args7_test_TwoMatrices(void)
+{
+    test_TwoMatrices(4ul, -2);
+}
+static void runner_args8_test_TwoMatrices(void)
+{
+    test_TwoMatrices(4ul, 3);
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    const char* p1;
+    float p2;
+} runner_args_table_test_StringsAndNumbersMatrices[] =
+{
+    { UNITY_TOKENIZED_NAME("test_StringsAndNumbersMatrices(\"String1\", -5)"), "String1", -5 },
+    { UNITY_TOKENIZED_NAME("test_StringsAndNumbersMatrices(\"String1\", 12.5f)"), "String1", 12.5f },
+    { UNITY_TOKENIZED_NAME("test_StringsAndNumbersMatrices(\"String,2\", -5)"), "String,2", -5 },
+    { UNITY_TOKENIZED_NAME("test_StringsAndNumbersMatrices(\"String,2\", 12.5f)"), "String,2", 12.5f },
+    { UNITY_TOKENIZED_NAME("test_StringsAndNumbersMatrices(\"Stri\" \"ng3\", -5)"), "Stri" "ng3", -5 },
+    { UNITY_TOKENIZED_NAME("test_StringsAndNumbersMatrices(\"Stri\" \"ng3\", 12.5f)"), "Stri" "ng3", 12.5f },
+    { UNITY_TOKENIZED_NAME("test_StringsAndNumbersMatrices(\"String[4]\", -5)"), "String[4]", -5 },
+    { UNITY_TOKENIZED_NAME("test_StringsAndNumbersMatrices(\"String[4]\", 12.5f)"), "String[4]", 12.5f },
+    { UNITY_TOKENIZED_NAME("test_StringsAndNumbersMatrices(\"String\\\"5\\\"\", -5)"), "String\"5\"", -5 },
+    { UNITY_TOKENIZED_NAME("test_StringsAndNumbersMatrices(\"String\\\"5\\\"\", 12.5f)"), "String\"5\"", 12.5f },
+};
+static void runner_args_test_StringsAndNumbersMatrices(void)
+{
+    test_StringsAndNumbersMatrices(runner_args_table_test_StringsAndNumbersMatrices[runner_args_row].p1, runner_args_table_test_StringsAndNumbersMatrices[runner_args_row].p2);
+}
+static void runner_args1_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, test_arr[0], 'a');
+}
+static void runner_args2_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, test_arr[0], 'f');
+}
+static void runner_args3_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, test_arr[0], '[');
+}
+static void runner_args4_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, test_arr[0], ']');
+}
+static void runner_args5_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, test_arr[0], '\'');
+}
+static void runner_args6_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, test_arr[0], '"');
+}
+static void runner_args7_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, 7.8f, 'a');
+}
+static void runner_args8_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, 7.8f, 'f');
+}
+static void runner_args9_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, 7.8f, '[');
+}
+static void runner_args10_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, 7.8f, ']');
+}
+static void runner_args11_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, 7.8f, '\'');
+}
+static void runner_args12_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, 7.8f, '"');
+}
+static void runner_args13_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, test_arr[2], 'a');
+}
+static void runner_args14_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, test_arr[2], 'f');
+}
+static void runner_args15_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, test_arr[2], '[');
+}
+static void runner_args16_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, test_arr[2], ']');
+}
+static void runner_args17_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, test_arr[2], '\'');
+}
+static void runner_args18_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_A, test_arr[2], '"');
+}
+static void runner_args19_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, test_arr[0], 'a');
+}
+static void runner_args20_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, test_arr[0], 'f');
+}
+static void runner_args21_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, test_arr[0], '[');
+}
+static void runner_args22_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, test_arr[0], ']');
+}
+static void runner_args23_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, test_arr[0], '\'');
+}
+static void runner_args24_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, test_arr[0], '"');
+}
+static void runner_args25_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, 7.8f, 'a');
+}
+static void runner_args26_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, 7.8f, 'f');
+}
+static void runner_args27_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, 7.8f, '[');
+}
+static void runner_args28_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, 7.8f, ']');
+}
+static void runner_args29_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, 7.8f, '\'');
+}
+static void runner_args30_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, 7.8f, '"');
+}
+static void runner_args31_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, test_arr[2], 'a');
+}
+static void runner_args32_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, test_arr[2], 'f');
+}
+static void runner_args33_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, test_arr[2], '[');
+}
+static void runner_args34_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, test_arr[2], ']');
+}
+static void runner_args35_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, test_arr[2], '\'');
+}
+static void runner_args36_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_4, test_arr[2], '"');
+}
+static void runner_args37_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, test_arr[0], 'a');
+}
+static void runner_args38_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, test_arr[0], 'f');
+}
+static void runner_args39_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, test_arr[0], '[');
+}
+static void runner_args40_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, test_arr[0], ']');
+}
+static void runner_args41_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, test_arr[0], '\'');
+}
+static void runner_args42_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, test_arr[0], '"');
+}
+static void runner_args43_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, 7.8f, 'a');
+}
+static void runner_args44_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, 7.8f, 'f');
+}
+static void runner_args45_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, 7.8f, '[');
+}
+static void runner_args46_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, 7.8f, ']');
+}
+static void runner_args47_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, 7.8f, '\'');
+}
+static void runner_args48_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, 7.8f, '"');
+}
+static void runner_args49_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, test_arr[2], 'a');
+}
+static void runner_args50_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, test_arr[2], 'f');
+}
+static void runner_args51_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, test_arr[2], '[');
+}
+static void runner_args52_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, test_arr[2], ']');
+}
+static void runner_args53_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, test_arr[2], '\'');
+}
+static void runner_args54_test_EnumCharAndArrayMatrices(void)
+{
+    test_EnumCharAndArrayMatrices(ENUM_C, test_arr[2], '"');
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    unsigned p1;
+    unsigned p2;
+    unsigned p3;
+    unsigned p4;
+} runner_args_table_test_PairwiseMatrix[] =
+{
+    { UNITY_TOKENIZED_NAME("test_PairwiseMatrix(0, 0, 0, 0)"), 0, 0, 0, 0 },
+    { UNITY_TOKENIZED_NAME("test_PairwiseMatrix(0, 1, 1, 1)"), 0, 1, 1, 1 },
+    { UNITY_TOKENIZED_NAME("test_PairwiseMatrix(0, 2, 2, 2)"), 0, 2, 2, 2 },
+    { UNITY_TOKENIZED_NAME("test_PairwiseMatrix(1, 0, 1, 2)"), 1, 0, 1, 2 },
+    { UNITY_TOKENIZED_NAME("test_PairwiseMatrix(1, 1, 0, 0)"), 1, 1, 0, 0 },
+    { UNITY_TOKENIZED_NAME("test_PairwiseMatrix(1, 2, 0, 1)"), 1, 2, 0, 1 },
+    { UNITY_TOKENIZED_NAME("test_PairwiseMatrix(2, 0, 2, 1)"), 2, 0, 2, 1 },
+    { UNITY_TOKENIZED_NAME("test_PairwiseMatrix(2, 1, 0, 2)"), 2, 1, 0, 2 },
+    { UNITY_TOKENIZED_NAME("test_PairwiseMatrix(2, 2, 1, 0)"), 2, 2, 1, 0 },
+    { UNITY_TOKENIZED_NAME("test_PairwiseMatrix(1, 1, 2, 0)"), 1, 1, 2, 0 },
+};
+static void runner_args_test_PairwiseMatrix(void)
+{
+    test_PairwiseMatrix(runner_args_table_test_PairwiseMatrix[runner_args_row].p1, runner_args_table_test_PairwiseMatrix[runner_args_row].p2, runner_args_table_test_PairwiseMatrix[runner_args_row].p3, runner_args_table_test_PairwiseMatrix[runner_args_row].p4);
+}
+
+/*=======Runtime Value Sources=====*/
+static char runner_value_name[UNITY_VALUES_NAME_SIZE];
+static unsigned int runner_value_name_len;
+static void runner_value_name_add(const char* text)
+{
+    while ((*text != 0) && (runner_value_name_len < sizeof(runner_value_name) - 1))
+    {
+        runner_value_name[runner_value_name_len++] = *text++;
+    }
+    runner_value_name[runner_value_name_len] = 0;
+}
+static void runner_value_name_add_uint(UNITY_UINT number)
+{
+    char digits[24];
+    int i = (int)sizeof(digits) - 1;
+    digits[i] = 0;
+    do
+    {
+        digits[--i] = (char)('0' + (int)(number % 10));
+        number /= 10;
+    } while (number != 0);
+    runner_value_name_add(&digits[i]);
+}
+static unsigned int runner_value_test_ValuesFromSource;
+static void runner_value_case_test_ValuesFromSource(void)
+{
+    test_ValuesFromSource(runner_value_test_ValuesFromSource);
+}
+static void runner_values_test_ValuesFromSource(void)
+{
+    unsigned int index;
+    for (index = 0; squaresUpTo100(index, &runner_value_test_ValuesFromSource); index++)
+    {
+        runner_value_name_len = 0;
+        runner_value_name_add("test_ValuesFromSource[");
+        runner_value_name_add_uint((UNITY_UINT)index);
+        runner_value_name_add("](");
+        runner_value_name_add_uint((UNITY_UINT)runner_value_test_ValuesFromSource);
+        runner_value_name_add(")");
+        run_test(runner_value_case_test_ValuesFromSource, runner_value_name, 356);
+    }
+}
+static const char* runner_value_test_ValuesFromSourceArePointers;
+static void runner_value_case_test_ValuesFromSourceArePointers(void)
+{
+    test_ValuesFromSourceArePointers(runner_value_test_ValuesFromSourceArePointers);
+}
+static void runner_values_test_ValuesFromSourceArePointers(void)
+{
+    unsigned int index;
+    for (index = 0; someWords(index, &runner_value_test_ValuesFromSourceArePointers); index++)
+    {
+        runner_value_name_len = 0;
+        runner_value_name_add("test_ValuesFromSourceArePointers[");
+        runner_value_name_add_uint((UNITY_UINT)index);
+        runner_value_name_add("](");
+        if (runner_value_test_ValuesFromSourceArePointers == NULL)
+        {
+            runner_value_name_add("NULL)");
+        }
+        else
+        {
+            runner_value_name_add("\"");
+            runner_value_name_add(runner_value_test_ValuesFromSourceArePointers);
+            runner_value_name_add("\")");
+        }
+        run_test(runner_value_case_test_ValuesFromSourceArePointers, runner_value_name, 372);
+    }
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  suiteSetUp();
+  UnityBegin(UNITY_TOKENIZE("tests/test_unity_parameterized.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[142];
+
+  run_test_params_arr[0].func = runner_args1_test_TheseShouldAllPass;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("test_TheseShouldAllPass(0)");
+  run_test_params_arr[0].line_num = 79;
+  run_test_params_arr[0].args_row = 0;
+  run_test_params_arr[0].runs_cases = 0;
+  run_test_params_arr[1].func = runner_args2_test_TheseShouldAllPass;
+  run_test_params_arr[1].name = UNITY_TOKENIZE("test_TheseShouldAllPass(44)");
+  run_test_params_arr[1].line_num = 79;
+  run_test_params_arr[1].args_row = 0;
+  run_test_params_arr[1].runs_cases = 0;
+  run_test_params_arr[2].func = runner_args3_test_TheseShouldAllPass;
+  run_test_params_arr[2].name = UNITY_TOKENIZE("test_TheseShouldAllPass((90)+9)");
+  run_test_params_arr[2].line_num = 79;
+  run_test_params_arr[2].args_row = 0;
+  run_test_params_arr[2].runs_cases = 0;
+  run_test_params_arr[3].func = runner_args1_test_TheseShouldAllFail;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("test_TheseShouldAllFail(3)");
+  run_test_params_arr[3].line_num = 87;
+  run_test_params_arr[3].args_row = 0;
+  run_test_params_arr[3].runs_cases = 0;
+  run_test_params_arr[4].func = runner_args2_test_TheseShouldAllFail;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("test_TheseShouldAllFail(77)");
+  run_test_params_arr[4].line_num = 87;
+  run_test_params_arr[4].args_row = 0;
+  run_test_params_arr[4].runs_cases = 0;
+  run_test_params_arr[5].func = runner_args3_test_TheseShouldAllFail;
+  run_test_params_arr[5].name = UNITY_TOKENIZE("test_TheseShouldAllFail((99) + 1 - (1))");
+  run_test_params_arr[5].line_num = 87;
+  run_test_params_arr[5].args_row = 0;
+  run_test_params_arr[5].runs_cases = 0;
+  for (int r = 0; r < 4; r++)
+  {
+    run_test_params_arr[6 + r].func = runner_args_test_TheseAreEveryOther;
+    run_test_params_arr[6 + r].name = runner_args_table_test_TheseAreEveryOther[r].name;
+    run_test_params_arr[6 + r].line_num = 98;
+    run_test_params_arr[6 + r].args_row = r;
+    run_test_params_arr[6 + r].runs_cases = 0;
+  }
+  run_test_params_arr[10].func = test_NormalPassesStillWork;
+  run_test_params_arr[10].name = UNITY_TOKENIZE("test_NormalPassesStillWork");
+  run_test_params_arr[10].line_num = 112;
+  run_test_params_arr[10].args_row = 0;
+  run_test_params_arr[10].runs_cases = 0;
+  run_test_params_arr[11].func = test_NormalFailsStillWork;
+  run_test_params_arr[11].name = UNITY_TOKENIZE("test_NormalFailsStillWork");
+  run_test_params_arr[11].line_num = 117;
+  run_test_params_arr[11].args_row = 0;
+  run_test_params_arr[11].runs_cases = 0;
+  for (int r = 0; r < 5; r++)
+  {
+    run_test_params_arr[12 + r].func = runner_args_test_StringsArePreserved;
+    run_test_params_arr[12 + r].name = runner_args_table_test_StringsArePreserved[r].name;
+    run_test_params_arr[12 + r].line_num = 129;
+    run_test_params_arr[12 + r].args_row = r;
+    run_test_params_arr[12 + r].runs_cases = 0;
+  }
+  for (int r = 0; r < 6; r++)
+  {
+    run_test_params_arr[17 + r].func = runner_args_test_CharsArePreserved;
+    run_test_params_arr[17 + r].name = runner_args_table_test_CharsArePreserved[r].name;
+    run_test_params_arr[17 + r].line_num = 154;
+    run_test_params_arr[17 + r].args_row = r;
+    run_test_params_arr[17 + r].runs_cases = 0;
+  }
+  for (int r = 0; r < 6; r++)
+  {
+    run_test_params_arr[23 + r].func = runner_args_test_SingleRange;
+    run_test_params_arr[23 + r].name = runner_args_table_test_SingleRange[r].name;
+    run_test_params_arr[23 + r].line_num = 175;
+    run_test_params_arr[23 + r].args_row = r;
+    run_test_params_arr[23 + r].runs_cases = 0;
+  }
+  for (int r = 0; r < 4; r++)
+  {
+    run_test_params_arr[29 + r].func = runner_args_test_TwoRanges;
+    run_test_params_arr[29 + r].name = runner_args_table_test_TwoRanges[r].name;
+    run_test_params_arr[29 + r].line_num = 182;
+    run_test_params_arr[29 + r].args_row = r;
+    run_test_params_arr[29 + r].runs_cases = 0;
+  }
+  for (int r = 0; r < 5; r++)
+  {
+    run_test_params_arr[33 + r].func = runner_args_test_SingleExclusiveRange;
+    run_test_params_arr[33 + r].name = runner_args_table_test_SingleExclusiveRange[r].name;
+    run_test_params_arr[33 + r].line_num = 188;
+    run_test_params_arr[33 + r].args_row = r;
+    run_test_params_arr[33 + r].runs_cases = 0;
+  }
+  for (int r = 0; r < 3; r++)
+  {
+    run_test_params_arr[38 + r].func = runner_args_test_BothInclusiveAndExclusiveRange;
+    run_test_params_arr[38 + r].name = runner_args_table_test_BothInclusiveAndExclusiveRange[r].name;
+    run_test_params_arr[38 + r].line_num = 195;
+    run_test_params_arr[38 + r].args_row = r;
+    run_test_params_arr[38 + r].runs_cases = 0;
+  }
+  for (int r = 0; r < 11; r++)
+  {
+    run_test_params_arr[41 + r].func = runner_args_test_SpaceInTestCase;
+    run_test_params_arr[41 + r].name = runner_args_table_test_SpaceInTestCase[r].name;
+    run_test_params_arr[41 + r].line_num = 222;
+    run_test_params_arr[41 + r].args_row = r;
+    run_test_params_arr[41 + r].runs_cases = 0;
+  }
+  run_test_params_arr[52].func = runner_args1_test_SingleMatix;
+  run_test_params_arr[52].name = UNITY_TOKENIZE("test_SingleMatix(1)");
+  run_test_params_arr[52].line_num = 231;
+  run_test_params_arr[52].args_row = 0;
+  run_test_params_arr[52].runs_cases = 0;
+  run_test_params_arr[53].func = runner_args2_test_SingleMatix;
+  run_test_params_arr[53].name = UNITY_TOKENIZE("test_SingleMatix(5)");
+  run_test_params_arr[53].line_num = 231;
+  run_test_params_arr[53].args_row = 0;
+  run_test_params_arr[53].runs_cases = 0;
+  run_test_params_arr[54].func = runner_args3_test_SingleMatix;
+  run_test_params_arr[54].name = UNITY_TOKENIZE("test_SingleMatix((2*2)+1)");
+  run_test_params_arr[54].line_num = 231;
+  run_test_params_arr[54].args_row = 0;
+  run_test_params_arr[54].runs_cases = 0;
+  run_test_params_arr[55].func = runner_args4_test_SingleMatix;
+  run_test_params_arr[55].name = UNITY_TOKENIZE("test_SingleMatix(4)");
+  run_test_params_arr[55].line_num = 231;
+  run_test_params_arr[55].args_row = 0;
+  run_test_params_arr[55].runs_cases = 0;
+  run_test_params_arr[56].func = runner_args1_test_TwoMatrices;
+  run_test_params_arr[56].name = UNITY_TOKENIZE("test_TwoMatrices(2, -2)");
+  run_test_params_arr[56].line_num = 237;
+  run_test_params_arr[56].args_row = 0;
+  run_test_params_arr[56].runs_cases = 0;
+  run_test_params_arr[57].func = runner_args2_test_TwoMatrices;
+  run_test_params_arr[57].name = UNITY_TOKENIZE("test_TwoMatrices(2, 3)");
+  run_test_params_arr[57].line_num = 237;
+  run_test_params_arr[57].args_row = 0;
+  run_test_params_arr[57].runs_cases = 0;
+  run_test_params_arr[58].func = runner_args3_test_TwoMatrices;
+  run_test_params_arr[58].name = UNITY_TOKENIZE("test_TwoMatrices(5l, -2)");
+  run_test_params_arr[58].line_num = 237;
+  run_test_params_arr[58].args_row = 0;
+  run_test_params_arr[58].runs_cases = 0;
+  run_test_params_arr[59].func = runner_args4_test_TwoMatrices;
+  run_test_params_arr[59].name = UNITY_TOKENIZE("test_TwoMatrices(5l, 3)");
+  run_test_params_arr[59].line_num = 237;
+  run_test_params_arr[59].args_row = 0;
+  run_test_params_arr[59].runs_cases = 0;
+  run_test_params_arr[60].func = runner_args5_test_TwoMatrices;
+  run_test_params_arr[60].name = UNITY_TOKENIZE("test_TwoMatrices(4u+3, -2)");
+  run_test_params_arr[60].line_num = 237;
+  run_test_params_arr[60].args_row = 0;
+  run_test_params_arr[60].runs_cases = 0;
+  run_test_params_arr[61].func = runner_args6_test_TwoMatrices;
+  run_test_params_arr[61].name = UNITY_TOKENIZE("test_TwoMatrices(4u+3, 3)");
+  run_test_params_arr[61].line_num = 237;
+  run_test_params_arr[61].args_row = 0;
+  run_test_params_arr[61].runs_cases = 0;
+  run_test_params_arr[62].func = runner_args7_test_TwoMatrices;
+  run_test_params_arr[62].name = UNITY_TOKENIZE("test_TwoMatrices(4ul, -2)");
+  run_test_params_arr[62].line_num = 237;
+  run_test_params_arr[62].args_row = 0;
+  run_test_params_arr[62].runs_cases = 0;
+  run_test_params_arr[63].func = runner_args8_test_TwoMatrices;
+  run_test_params_arr[63].name = UNITY_TOKENIZE("test_TwoMatrices(4ul, 3)");
+  run_test_params_arr[63].line_num = 237;
+  run_test_params_arr[63].args_row = 0;
+  run_test_params_arr[63].runs_cases = 0;
+  for (int r = 0; r < 10; r++)
+  {
+    run_test_params_arr[64 + r].func = runner_args_test_StringsAndNumbersMatrices;
+    run_test_params_arr[64 + r].name = runner_args_table_test_StringsAndNumbersMatrices[r].name;
+    run_test_params_arr[64 + r].line_num = 252;
+    run_test_params_arr[64 + r].args_row = r;
+    run_test_params_arr[64 + r].runs_cases = 0;
+  }
+  run_test_params_arr[74].func = runner_args1_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[74].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, test_arr[0], 'a')");
+  run_test_params_arr[74].line_num = 278;
+  run_test_params_arr[74].args_row = 0;
+  run_test_params_arr[74].runs_cases = 0;
+  run_test_params_arr[75].func = runner_args2_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[75].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, test_arr[0], 'f')");
+  run_test_params_arr[75].line_num = 278;
+  run_test_params_arr[75].args_row = 0;
+  run_test_params_arr[75].runs_cases = 0;
+  run_test_params_arr[76].func = runner_args3_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[76].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, test_arr[0], '[')");
+  run_test_params_arr[76].line_num = 278;
+  run_test_params_arr[76].args_row = 0;
+  run_test_params_arr[76].runs_cases = 0;
+  run_test_params_arr[77].func = runner_args4_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[77].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, test_arr[0], ']')");
+  run_test_params_arr[77].line_num = 278;
+  run_test_params_arr[77].args_row = 0;
+  run_test_params_arr[77].runs_cases = 0;
+  run_test_params_arr[78].func = runner_args5_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[78].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, test_arr[0], '\\'')");
+  run_test_params_arr[78].line_num = 278;
+  run_test_params_arr[78].args_row = 0;
+  run_test_params_arr[78].runs_cases = 0;
+  run_test_params_arr[79].func = runner_args6_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[79].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, test_arr[0], '\"')");
+  run_test_params_arr[79].line_num = 278;
+  run_test_params_arr[79].args_row = 0;
+  run_test_params_arr[79].runs_cases = 0;
+  run_test_params_arr[80].func = runner_args7_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[80].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, 7.8f, 'a')");
+  run_test_params_arr[80].line_num = 278;
+  run_test_params_arr[80].args_row = 0;
+  run_test_params_arr[80].runs_cases = 0;
+  run_test_params_arr[81].func = runner_args8_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[81].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, 7.8f, 'f')");
+  run_test_params_arr[81].line_num = 278;
+  run_test_params_arr[81].args_row = 0;
+  run_test_params_arr[81].runs_cases = 0;
+  run_test_params_arr[82].func = runner_args9_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[82].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, 7.8f, '[')");
+  run_test_params_arr[82].line_num = 278;
+  run_test_params_arr[82].args_row = 0;
+  run_test_params_arr[82].runs_cases = 0;
+  run_test_params_arr[83].func = runner_args10_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[83].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, 7.8f, ']')");
+  run_test_params_arr[83].line_num = 278;
+  run_test_params_arr[83].args_row = 0;
+  run_test_params_arr[83].runs_cases = 0;
+  run_test_params_arr[84].func = runner_args11_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[84].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, 7.8f, '\\'')");
+  run_test_params_arr[84].line_num = 278;
+  run_test_params_arr[84].args_row = 0;
+  run_test_params_arr[84].runs_cases = 0;
+  run_test_params_arr[85].func = runner_args12_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[85].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, 7.8f, '\"')");
+  run_test_params_arr[85].line_num = 278;
+  run_test_params_arr[85].args_row = 0;
+  run_test_params_arr[85].runs_cases = 0;
+  run_test_params_arr[86].func = runner_args13_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[86].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, test_arr[2], 'a')");
+  run_test_params_arr[86].line_num = 278;
+  run_test_params_arr[86].args_row = 0;
+  run_test_params_arr[86].runs_cases = 0;
+  run_test_params_arr[87].func = runner_args14_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[87].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, test_arr[2], 'f')");
+  run_test_params_arr[87].line_num = 278;
+  run_test_params_arr[87].args_row = 0;
+  run_test_params_arr[87].runs_cases = 0;
+  run_test_params_arr[88].func = runner_args15_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[88].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, test_arr[2], '[')");
+  run_test_params_arr[88].line_num = 278;
+  run_test_params_arr[88].args_row = 0;
+  run_test_params_arr[88].runs_cases = 0;
+  run_test_params_arr[89].func = runner_args16_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[89].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, test_arr[2], ']')");
+  run_test_params_arr[89].line_num = 278;
+  run_test_params_arr[89].args_row = 0;
+  run_test_params_arr[89].runs_cases = 0;
+  run_test_params_arr[90].func = runner_args17_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[90].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, test_arr[2], '\\'')");
+  run_test_params_arr[90].line_num = 278;
+  run_test_params_arr[90].args_row = 0;
+  run_test_params_arr[90].runs_cases = 0;
+  run_test_params_arr[91].func = runner_args18_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[91].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_A, test_arr[2], '\"')");
+  run_test_params_arr[91].line_num = 278;
+  run_test_params_arr[91].args_row = 0;
+  run_test_params_arr[91].runs_cases = 0;
+  run_test_params_arr[92].func = runner_args19_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[92].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, test_arr[0], 'a')");
+  run_test_params_arr[92].line_num = 278;
+  run_test_params_arr[92].args_row = 0;
+  run_test_params_arr[92].runs_cases = 0;
+  run_test_params_arr[93].func = runner_args20_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[93].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, test_arr[0], 'f')");
+  run_test_params_arr[93].line_num = 278;
+  run_test_params_arr[93].args_row = 0;
+  run_test_params_arr[93].runs_cases = 0;
+  run_test_params_arr[94].func = runner_args21_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[94].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, test_arr[0], '[')");
+  run_test_params_arr[94].line_num = 278;
+  run_test_params_arr[94].args_row = 0;
+  run_test_params_arr[94].runs_cases = 0;
+  run_test_params_arr[95].func = runner_args22_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[95].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, test_arr[0], ']')");
+  run_test_params_arr[95].line_num = 278;
+  run_test_params_arr[95].args_row = 0;
+  run_test_params_arr[95].runs_cases = 0;
+  run_test_params_arr[96].func = runner_args23_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[96].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, test_arr[0], '\\'')");
+  run_test_params_arr[96].line_num = 278;
+  run_test_params_arr[96].args_row = 0;
+  run_test_params_arr[96].runs_cases = 0;
+  run_test_params_arr[97].func = runner_args24_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[97].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, test_arr[0], '\"')");
+  run_test_params_arr[97].line_num = 278;
+  run_test_params_arr[97].args_row = 0;
+  run_test_params_arr[97].runs_cases = 0;
+  run_test_params_arr[98].func = runner_args25_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[98].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, 7.8f, 'a')");
+  run_test_params_arr[98].line_num = 278;
+  run_test_params_arr[98].args_row = 0;
+  run_test_params_arr[98].runs_cases = 0;
+  run_test_params_arr[99].func = runner_args26_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[99].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, 7.8f, 'f')");
+  run_test_params_arr[99].line_num = 278;
+  run_test_params_arr[99].args_row = 0;
+  run_test_params_arr[99].runs_cases = 0;
+  run_test_params_arr[100].func = runner_args27_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[100].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, 7.8f, '[')");
+  run_test_params_arr[100].line_num = 278;
+  run_test_params_arr[100].args_row = 0;
+  run_test_params_arr[100].runs_cases = 0;
+  run_test_params_arr[101].func = runner_args28_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[101].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, 7.8f, ']')");
+  run_test_params_arr[101].line_num = 278;
+  run_test_params_arr[101].args_row = 0;
+  run_test_params_arr[101].runs_cases = 0;
+  run_test_params_arr[102].func = runner_args29_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[102].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, 7.8f, '\\'')");
+  run_test_params_arr[102].line_num = 278;
+  run_test_params_arr[102].args_row = 0;
+  run_test_params_arr[102].runs_cases = 0;
+  run_test_params_arr[103].func = runner_args30_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[103].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, 7.8f, '\"')");
+  run_test_params_arr[103].line_num = 278;
+  run_test_params_arr[103].args_row = 0;
+  run_test_params_arr[103].runs_cases = 0;
+  run_test_params_arr[104].func = runner_args31_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[104].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, test_arr[2], 'a')");
+  run_test_params_arr[104].line_num = 278;
+  run_test_params_arr[104].args_row = 0;
+  run_test_params_arr[104].runs_cases = 0;
+  run_test_params_arr[105].func = runner_args32_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[105].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, test_arr[2], 'f')");
+  run_test_params_arr[105].line_num = 278;
+  run_test_params_arr[105].args_row = 0;
+  run_test_params_arr[105].runs_cases = 0;
+  run_test_params_arr[106].func = runner_args33_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[106].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, test_arr[2], '[')");
+  run_test_params_arr[106].line_num = 278;
+  run_test_params_arr[106].args_row = 0;
+  run_test_params_arr[106].runs_cases = 0;
+  run_test_params_arr[107].func = runner_args34_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[107].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, test_arr[2], ']')");
+  run_test_params_arr[107].line_num = 278;
+  run_test_params_arr[107].args_row = 0;
+  run_test_params_arr[107].runs_cases = 0;
+  run_test_params_arr[108].func = runner_args35_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[108].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, test_arr[2], '\\'')");
+  run_test_params_arr[108].line_num = 278;
+  run_test_params_arr[108].args_row = 0;
+  run_test_params_arr[108].runs_cases = 0;
+  run_test_params_arr[109].func = runner_args36_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[109].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_4, test_arr[2], '\"')");
+  run_test_params_arr[109].line_num = 278;
+  run_test_params_arr[109].args_row = 0;
+  run_test_params_arr[109].runs_cases = 0;
+  run_test_params_arr[110].func = runner_args37_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[110].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, test_arr[0], 'a')");
+  run_test_params_arr[110].line_num = 278;
+  run_test_params_arr[110].args_row = 0;
+  run_test_params_arr[110].runs_cases = 0;
+  run_test_params_arr[111].func = runner_args38_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[111].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, test_arr[0], 'f')");
+  run_test_params_arr[111].line_num = 278;
+  run_test_params_arr[111].args_row = 0;
+  run_test_params_arr[111].runs_cases = 0;
+  run_test_params_arr[112].func = runner_args39_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[112].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, test_arr[0], '[')");
+  run_test_params_arr[112].line_num = 278;
+  run_test_params_arr[112].args_row = 0;
+  run_test_params_arr[112].runs_cases = 0;
+  run_test_params_arr[113].func = runner_args40_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[113].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, test_arr[0], ']')");
+  run_test_params_arr[113].line_num = 278;
+  run_test_params_arr[113].args_row = 0;
+  run_test_params_arr[113].runs_cases = 0;
+  run_test_params_arr[114].func = runner_args41_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[114].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, test_arr[0], '\\'')");
+  run_test_params_arr[114].line_num = 278;
+  run_test_params_arr[114].args_row = 0;
+  run_test_params_arr[114].runs_cases = 0;
+  run_test_params_arr[115].func = runner_args42_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[115].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, test_arr[0], '\"')");
+  run_test_params_arr[115].line_num = 278;
+  run_test_params_arr[115].args_row = 0;
+  run_test_params_arr[115].runs_cases = 0;
+  run_test_params_arr[116].func = runner_args43_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[116].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, 7.8f, 'a')");
+  run_test_params_arr[116].line_num = 278;
+  run_test_params_arr[116].args_row = 0;
+  run_test_params_arr[116].runs_cases = 0;
+  run_test_params_arr[117].func = runner_args44_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[117].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, 7.8f, 'f')");
+  run_test_params_arr[117].line_num = 278;
+  run_test_params_arr[117].args_row = 0;
+  run_test_params_arr[117].runs_cases = 0;
+  run_test_params_arr[118].func = runner_args45_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[118].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, 7.8f, '[')");
+  run_test_params_arr[118].line_num = 278;
+  run_test_params_arr[118].args_row = 0;
+  run_test_params_arr[118].runs_cases = 0;
+  run_test_params_arr[119].func = runner_args46_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[119].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, 7.8f, ']')");
+  run_test_params_arr[119].line_num = 278;
+  run_test_params_arr[119].args_row = 0;
+  run_test_params_arr[119].runs_cases = 0;
+  run_test_params_arr[120].func = runner_args47_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[120].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, 7.8f, '\\'')");
+  run_test_params_arr[120].line_num = 278;
+  run_test_params_arr[120].args_row = 0;
+  run_test_params_arr[120].runs_cases = 0;
+  run_test_params_arr[121].func = runner_args48_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[121].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, 7.8f, '\"')");
+  run_test_params_arr[121].line_num = 278;
+  run_test_params_arr[121].args_row = 0;
+  run_test_params_arr[121].runs_cases = 0;
+  run_test_params_arr[122].func = runner_args49_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[122].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, test_arr[2], 'a')");
+  run_test_params_arr[122].line_num = 278;
+  run_test_params_arr[122].args_row = 0;
+  run_test_params_arr[122].runs_cases = 0;
+  run_test_params_arr[123].func = runner_args50_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[123].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, test_arr[2], 'f')");
+  run_test_params_arr[123].line_num = 278;
+  run_test_params_arr[123].args_row = 0;
+  run_test_params_arr[123].runs_cases = 0;
+  run_test_params_arr[124].func = runner_args51_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[124].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, test_arr[2], '[')");
+  run_test_params_arr[124].line_num = 278;
+  run_test_params_arr[124].args_row = 0;
+  run_test_params_arr[124].runs_cases = 0;
+  run_test_params_arr[125].func = runner_args52_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[125].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, test_arr[2], ']')");
+  run_test_params_arr[125].line_num = 278;
+  run_test_params_arr[125].args_row = 0;
+  run_test_params_arr[125].runs_cases = 0;
+  run_test_params_arr[126].func = runner_args53_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[126].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, test_arr[2], '\\'')");
+  run_test_params_arr[126].line_num = 278;
+  run_test_params_arr[126].args_row = 0;
+  run_test_params_arr[126].runs_cases = 0;
+  run_test_params_arr[127].func = runner_args54_test_EnumCharAndArrayMatrices;
+  run_test_params_arr[127].name = UNITY_TOKENIZE("test_EnumCharAndArrayMatrices(ENUM_C, test_arr[2], '\"')");
+  run_test_params_arr[127].line_num = 278;
+  run_test_params_arr[127].args_row = 0;
+  run_test_params_arr[127].runs_cases = 0;
+  for (int r = 0; r < 10; r++)
+  {
+    run_test_params_arr[128 + r].func = runner_args_test_PairwiseMatrix;
+    run_test_params_arr[128 + r].name = runner_args_table_test_PairwiseMatrix[r].name;
+    run_test_params_arr[128 + r].line_num = 315;
+    run_test_params_arr[128 + r].args_row = r;
+    run_test_params_arr[128 + r].runs_cases = 0;
+  }
+  run_test_params_arr[138].func = test_PairwiseMatrixCoversEveryPairWithFewerCases;
+  run_test_params_arr[138].name = UNITY_TOKENIZE("test_PairwiseMatrixCoversEveryPairWithFewerCases");
+  run_test_params_arr[138].line_num = 326;
+  run_test_params_arr[138].args_row = 0;
+  run_test_params_arr[138].runs_cases = 0;
+  run_test_params_arr[139].func = runner_values_test_ValuesFromSource;
+  run_test_params_arr[139].name = UNITY_TOKENIZE("test_ValuesFromSource");
+  run_test_params_arr[139].line_num = 356;
+  run_test_params_arr[139].args_row = 0;
+  run_test_params_arr[139].runs_cases = 1;
+  run_test_params_arr[140].func = runner_values_test_ValuesFromSourceArePointers;
+  run_test_params_arr[140].name = UNITY_TOKENIZE("test_ValuesFromSourceArePointers");
+  run_test_params_arr[140].line_num = 372;
+  run_test_params_arr[140].args_row = 0;
+  run_test_params_arr[140].runs_cases = 1;
+  run_test_params_arr[141].func = test_ValuesFromSourceRanEveryValue;
+  run_test_params_arr[141].name = UNITY_TOKENIZE("test_ValuesFromSourceRanEveryValue");
+  run_test_params_arr[141].line_num = 380;
+  run_test_params_arr[141].args_row = 0;
+  run_test_params_arr[141].runs_cases = 0;
+
+  for (int i = 0; i < 142; i++)
+  {
+    runner_args_row = run_test_params_arr[i].args_row;
+    if (run_test_params_arr[i].runs_cases)
+    {
+      run_test_params_arr[i].func();
+      continue;
+    }
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
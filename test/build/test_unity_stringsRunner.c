@@ -0,0 +1,90 @@
+#include "unity.h" /* Autogenerated by awk in Makefile */
+void testEqualStrings(void);
+void testEqualStringsLen(void);
+void testEqualStringsWithCarriageReturnsAndLineFeeds(void);
+void testNotEqualString1(void);
+void testNotEqualStringLen1(void);
+void testNotEqualString2(void);
+void testNotEqualStringLen2(void);
+void testNotEqualString3(void);
+void testNotEqualStringLen3(void);
+void testNotEqualString4(void);
+void testNotEqualStringLen4(void);
+void testNotEqualString5(void);
+void testNotEqualString_ExpectedStringIsNull(void);
+void testNotEqualStringLen_ExpectedStringIsNull(void);
+void testNotEqualString_ActualStringIsNull(void);
+void testNotEqualStringLen_ActualStringIsNull(void);
+void testNotEqualString_ExpectedStringIsLonger(void);
+void testNotEqualString_ActualStringIsLonger(void);
+void testNotEqualStrings(void);
+void testNotNotEqualString1(void);
+void testNotNotEqualString2(void);
+void testNotEqualStringsLen(void);
+void testNotNotEqualStringLen1(void);
+void testNotNotEqualStringLen2(void);
+void testNotNotEqualStringLen3(void);
+void testNotNotEqualStringLenZero(void);
+void testEqualStringArrays(void);
+void testNotEqualStringArray1(void);
+void testNotEqualStringArray2(void);
+void testNotEqualStringArray3(void);
+void testNotEqualStringArray4(void);
+void testNotEqualStringArray5(void);
+void testNotEqualStringArray6(void);
+void testEqualStringArrayIfBothNulls(void);
+void testNotEqualStringArrayLengthZero(void);
+void testEqualStringEachEqual(void);
+void testNotEqualStringEachEqual1(void);
+void testNotEqualStringEachEqual2(void);
+void testNotEqualStringEachEqual3(void);
+void testNotEqualStringEachEqual4(void);
+void testNotEqualStringEachEqual5(void);
+void testCstringsEscapeSequence(void);
+int main(void)
+{
+    UnityBegin("tests/test_unity_strings.c");
+    RUN_TEST(testEqualStrings, 37);
+    RUN_TEST(testEqualStringsLen, 48);
+    RUN_TEST(testEqualStringsWithCarriageReturnsAndLineFeeds, 58);
+    RUN_TEST(testNotEqualString1, 69);
+    RUN_TEST(testNotEqualStringLen1, 76);
+    RUN_TEST(testNotEqualString2, 83);
+    RUN_TEST(testNotEqualStringLen2, 90);
+    RUN_TEST(testNotEqualString3, 97);
+    RUN_TEST(testNotEqualStringLen3, 104);
+    RUN_TEST(testNotEqualString4, 111);
+    RUN_TEST(testNotEqualStringLen4, 118);
+    RUN_TEST(testNotEqualString5, 125);
+    RUN_TEST(testNotEqualString_ExpectedStringIsNull, 134);
+    RUN_TEST(testNotEqualStringLen_ExpectedStringIsNull, 141);
+    RUN_TEST(testNotEqualString_ActualStringIsNull, 148);
+    RUN_TEST(testNotEqualStringLen_ActualStringIsNull, 155);
+    RUN_TEST(testNotEqualString_ExpectedStringIsLonger, 162);
+    RUN_TEST(testNotEqualString_ActualStringIsLonger, 169);
+    RUN_TEST(testNotEqualStrings, 176);
+    RUN_TEST(testNotNotEqualString1, 188);
+    RUN_TEST(testNotNotEqualString2, 195);
+    RUN_TEST(testNotEqualStringsLen, 202);
+    RUN_TEST(testNotNotEqualStringLen1, 212);
+    RUN_TEST(testNotNotEqualStringLen2, 219);
+    RUN_TEST(testNotNotEqualStringLen3, 226);
+    RUN_TEST(testNotNotEqualStringLenZero, 233);
+    RUN_TEST(testEqualStringArrays, 240);
+    RUN_TEST(testNotEqualStringArray1, 251);
+    RUN_TEST(testNotEqualStringArray2, 261);
+    RUN_TEST(testNotEqualStringArray3, 271);
+    RUN_TEST(testNotEqualStringArray4, 281);
+    RUN_TEST(testNotEqualStringArray5, 291);
+    RUN_TEST(testNotEqualStringArray6, 301);
+    RUN_TEST(testEqualStringArrayIfBothNulls, 311);
+    RUN_TEST(testNotEqualStringArrayLengthZero, 319);
+    RUN_TEST(testEqualStringEachEqual, 329);
+    RUN_TEST(testNotEqualStringEachEqual1, 341);
+    RUN_TEST(testNotEqualStringEachEqual2, 350);
+    RUN_TEST(testNotEqualStringEachEqual3, 359);
+    RUN_TEST(testNotEqualStringEachEqual4, 368);
+    RUN_TEST(testNotEqualStringEachEqual5, 377);
+    RUN_TEST(testCstringsEscapeSequence, 384);
+    return UNITY_END();
+}
@@ -0,0 +1,263 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "self_assessment_utils.h"
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testEqualStrings(void);
+extern void testEqualStringsLen(void);
+extern void testEqualStringsWithCarriageReturnsAndLineFeeds(void);
+extern void testNotEqualString1(void);
+extern void testNotEqualStringLen1(void);
+extern void testNotEqualString2(void);
+extern void testNotEqualStringLen2(void);
+extern void testNotEqualString3(void);
+extern void testNotEqualStringLen3(void);
+extern void testNotEqualString4(void);
+extern void testNotEqualStringLen4(void);
+extern void testNotEqualString5(void);
+extern void testNotEqualString_ExpectedStringIsNull(void);
+extern void testNotEqualStringLen_ExpectedStringIsNull(void);
+extern void testNotEqualString_ActualStringIsNull(void);
+extern void testNotEqualStringLen_ActualStringIsNull(void);
+extern void testNotEqualString_ExpectedStringIsLonger(void);
+extern void testNotEqualString_ActualStringIsLonger(void);
+extern void testNotEqualStrings(void);
+extern void testNotNotEqualString1(void);
+extern void testNotNotEqualString2(void);
+extern void testNotEqualStringsLen(void);
+extern void testNotNotEqualStringLen1(void);
+extern void testNotNotEqualStringLen2(void);
+extern void testNotNotEqualStringLen3(void);
+extern void testNotNotEqualStringLenZero(void);
+extern void testEqualStringArrays(void);
+extern void testNotEqualStringArray1(void);
+extern void testNotEqualStringArray2(void);
+extern void testNotEqualStringArray3(void);
+extern void testNotEqualStringArray4(void);
+extern void testNotEqualStringArray5(void);
+extern void testNotEqualStringArray6(void);
+extern void testEqualStringArrayIfBothNulls(void);
+extern void testNotEqualStringArrayLengthZero(void);
+extern void testEqualStringEachEqual(void);
+extern void testNotEqualStringEachEqual1(void);
+extern void testNotEqualStringEachEqual2(void);
+extern void testNotEqualStringEachEqual3(void);
+extern void testNotEqualStringEachEqual4(void);
+extern void testNotEqualStringEachEqual5(void);
+extern void testCstringsEscapeSequence(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("tests/test_unity_strings.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[42];
+
+  run_test_params_arr[0].func = testEqualStrings;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("testEqualStrings");
+  run_test_params_arr[0].line_num = 37;
+  run_test_params_arr[1].func = testEqualStringsLen;
+  run_test_params_arr[1].name = UNITY_TOKENIZE("testEqualStringsLen");
+  run_test_params_arr[1].line_num = 48;
+  run_test_params_arr[2].func = testEqualStringsWithCarriageReturnsAndLineFeeds;
+  run_test_params_arr[2].name = UNITY_TOKENIZE("testEqualStringsWithCarriageReturnsAndLineFeeds");
+  run_test_params_arr[2].line_num = 58;
+  run_test_params_arr[3].func = testNotEqualString1;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("testNotEqualString1");
+  run_test_params_arr[3].line_num = 69;
+  run_test_params_arr[4].func = testNotEqualStringLen1;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("testNotEqualStringLen1");
+  run_test_params_arr[4].line_num = 76;
+  run_test_params_arr[5].func = testNotEqualString2;
+  run_test_params_arr[5].name = UNITY_TOKENIZE("testNotEqualString2");
+  run_test_params_arr[5].line_num = 83;
+  run_test_params_arr[6].func = testNotEqualStringLen2;
+  run_test_params_arr[6].name = UNITY_TOKENIZE("testNotEqualStringLen2");
+  run_test_params_arr[6].line_num = 90;
+  run_test_params_arr[7].func = testNotEqualString3;
+  run_test_params_arr[7].name = UNITY_TOKENIZE("testNotEqualString3");
+  run_test_params_arr[7].line_num = 97;
+  run_test_params_arr[8].func = testNotEqualStringLen3;
+  run_test_params_arr[8].name = UNITY_TOKENIZE("testNotEqualStringLen3");
+  run_test_params_arr[8].line_num = 104;
+  run_test_params_arr[9].func = testNotEqualString4;
+  run_test_params_arr[9].name = UNITY_TOKENIZE("testNotEqualString4");
+  run_test_params_arr[9].line_num = 111;
+  run_test_params_arr[10].func = testNotEqualStringLen4;
+  run_test_params_arr[10].name = UNITY_TOKENIZE("testNotEqualStringLen4");
+  run_test_params_arr[10].line_num = 118;
+  run_test_params_arr[11].func = testNotEqualString5;
+  run_test_params_arr[11].name = UNITY_TOKENIZE("testNotEqualString5");
+  run_test_params_arr[11].line_num = 125;
+  run_test_params_arr[12].func = testNotEqualString_ExpectedStringIsNull;
+  run_test_params_arr[12].name = UNITY_TOKENIZE("testNotEqualString_ExpectedStringIsNull");
+  run_test_params_arr[12].line_num = 134;
+  run_test_params_arr[13].func = testNotEqualStringLen_ExpectedStringIsNull;
+  run_test_params_arr[13].name = UNITY_TOKENIZE("testNotEqualStringLen_ExpectedStringIsNull");
+  run_test_params_arr[13].line_num = 141;
+  run_test_params_arr[14].func = testNotEqualString_ActualStringIsNull;
+  run_test_params_arr[14].name = UNITY_TOKENIZE("testNotEqualString_ActualStringIsNull");
+  run_test_params_arr[14].line_num = 148;
+  run_test_params_arr[15].func = testNotEqualStringLen_ActualStringIsNull;
+  run_test_params_arr[15].name = UNITY_TOKENIZE("testNotEqualStringLen_ActualStringIsNull");
+  run_test_params_arr[15].line_num = 155;
+  run_test_params_arr[16].func = testNotEqualString_ExpectedStringIsLonger;
+  run_test_params_arr[16].name = UNITY_TOKENIZE("testNotEqualString_ExpectedStringIsLonger");
+  run_test_params_arr[16].line_num = 162;
+  run_test_params_arr[17].func = testNotEqualString_ActualStringIsLonger;
+  run_test_params_arr[17].name = UNITY_TOKENIZE("testNotEqualString_ActualStringIsLonger");
+  run_test_params_arr[17].line_num = 169;
+  run_test_params_arr[18].func = testNotEqualStrings;
+  run_test_params_arr[18].name = UNITY_TOKENIZE("testNotEqualStrings");
+  run_test_params_arr[18].line_num = 176;
+  run_test_params_arr[19].func = testNotNotEqualString1;
+  run_test_params_arr[19].name = UNITY_TOKENIZE("testNotNotEqualString1");
+  run_test_params_arr[19].line_num = 188;
+  run_test_params_arr[20].func = testNotNotEqualString2;
+  run_test_params_arr[20].name = UNITY_TOKENIZE("testNotNotEqualString2");
+  run_test_params_arr[20].line_num = 195;
+  run_test_params_arr[21].func = testNotEqualStringsLen;
+  run_test_params_arr[21].name = UNITY_TOKENIZE("testNotEqualStringsLen");
+  run_test_params_arr[21].line_num = 202;
+  run_test_params_arr[22].func = testNotNotEqualStringLen1;
+  run_test_params_arr[22].name = UNITY_TOKENIZE("testNotNotEqualStringLen1");
+  run_test_params_arr[22].line_num = 212;
+  run_test_params_arr[23].func = testNotNotEqualStringLen2;
+  run_test_params_arr[23].name = UNITY_TOKENIZE("testNotNotEqualStringLen2");
+  run_test_params_arr[23].line_num = 219;
+  run_test_params_arr[24].func = testNotNotEqualStringLen3;
+  run_test_params_arr[24].name = UNITY_TOKENIZE("testNotNotEqualStringLen3");
+  run_test_params_arr[24].line_num = 226;
+  run_test_params_arr[25].func = testNotNotEqualStringLenZero;
+  run_test_params_arr[25].name = UNITY_TOKENIZE("testNotNotEqualStringLenZero");
+  run_test_params_arr[25].line_num = 233;
+  run_test_params_arr[26].func = testEqualStringArrays;
+  run_test_params_arr[26].name = UNITY_TOKENIZE("testEqualStringArrays");
+  run_test_params_arr[26].line_num = 240;
+  run_test_params_arr[27].func = testNotEqualStringArray1;
+  run_test_params_arr[27].name = UNITY_TOKENIZE("testNotEqualStringArray1");
+  run_test_params_arr[27].line_num = 251;
+  run_test_params_arr[28].func = testNotEqualStringArray2;
+  run_test_params_arr[28].name = UNITY_TOKENIZE("testNotEqualStringArray2");
+  run_test_params_arr[28].line_num = 261;
+  run_test_params_arr[29].func = testNotEqualStringArray3;
+  run_test_params_arr[29].name = UNITY_TOKENIZE("testNotEqualStringArray3");
+  run_test_params_arr[29].line_num = 271;
+  run_test_params_arr[30].func = testNotEqualStringArray4;
+  run_test_params_arr[30].name = UNITY_TOKENIZE("testNotEqualStringArray4");
+  run_test_params_arr[30].line_num = 281;
+  run_test_params_arr[31].func = testNotEqualStringArray5;
+  run_test_params_arr[31].name = UNITY_TOKENIZE("testNotEqualStringArray5");
+  run_test_params_arr[31].line_num = 291;
+  run_test_params_arr[32].func = testNotEqualStringArray6;
+  run_test_params_arr[32].name = UNITY_TOKENIZE("testNotEqualStringArray6");
+  run_test_params_arr[32].line_num = 301;
+  run_test_params_arr[33].func = testEqualStringArrayIfBothNulls;
+  run_test_params_arr[33].name = UNITY_TOKENIZE("testEqualStringArrayIfBothNulls");
+  run_test_params_arr[33].line_num = 311;
+  run_test_params_arr[34].func = testNotEqualStringArrayLengthZero;
+  run_test_params_arr[34].name = UNITY_TOKENIZE("testNotEqualStringArrayLengthZero");
+  run_test_params_arr[34].line_num = 319;
+  run_test_params_arr[35].func = testEqualStringEachEqual;
+  run_test_params_arr[35].name = UNITY_TOKENIZE("testEqualStringEachEqual");
+  run_test_params_arr[35].line_num = 329;
+  run_test_params_arr[36].func = testNotEqualStringEachEqual1;
+  run_test_params_arr[36].name = UNITY_TOKENIZE("testNotEqualStringEachEqual1");
+  run_test_params_arr[36].line_num = 341;
+  run_test_params_arr[37].func = testNotEqualStringEachEqual2;
+  run_test_params_arr[37].name = UNITY_TOKENIZE("testNotEqualStringEachEqual2");
+  run_test_params_arr[37].line_num = 350;
+  run_test_params_arr[38].func = testNotEqualStringEachEqual3;
+  run_test_params_arr[38].name = UNITY_TOKENIZE("testNotEqualStringEachEqual3");
+  run_test_params_arr[38].line_num = 359;
+  run_test_params_arr[39].func = testNotEqualStringEachEqual4;
+  run_test_params_arr[39].name = UNITY_TOKENIZE("testNotEqualStringEachEqual4");
+  run_test_params_arr[39].line_num = 368;
+  run_test_params_arr[40].func = testNotEqualStringEachEqual5;
+  run_test_params_arr[40].name = UNITY_TOKENIZE("testNotEqualStringEachEqual5");
+  run_test_params_arr[40].line_num = 377;
+  run_test_params_arr[41].func = testCstringsEscapeSequence;
+  run_test_params_arr[41].name = UNITY_TOKENIZE("testCstringsEscapeSequence");
+  run_test_params_arr[41].line_num = 384;
+
+  for (int i = 0; i < 42; i++)
+  {
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
@@ -0,0 +1,233 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "Defs.h"
+#include "CException.h"
+#include <stdio.h>
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+  int args_row;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void paratest_ShouldHandleParameterizedTests(int Num);
+extern void paratest_ShouldHandleParameterizedTests2(int Num);
+extern void paratest_ShouldHandleNonParameterizedTestsWhenParameterizationValid(void);
+extern void paratest_ShouldHandleParameterizedTestsThatFail(int Num);
+extern void paratest_WorksWithFunctionPointers(int function(int));
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======Parameterized Test Wrappers=====*/
+static int runner_args_row;
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    int p1;
+} runner_args_table_paratest_ShouldHandleParameterizedTests[] =
+{
+    { UNITY_TOKENIZED_NAME("paratest_ShouldHandleParameterizedTests(25)"), 25 },
+    { UNITY_TOKENIZED_NAME("paratest_ShouldHandleParameterizedTests(125)"), 125 },
+    { UNITY_TOKENIZED_NAME("paratest_ShouldHandleParameterizedTests(5)"), 5 },
+};
+static void runner_args_paratest_ShouldHandleParameterizedTests(void)
+{
+    paratest_ShouldHandleParameterizedTests(runner_args_table_paratest_ShouldHandleParameterizedTests[runner_args_row].p1);
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    int p1;
+} runner_args_table_paratest_ShouldHandleParameterizedTests2[] =
+{
+    { UNITY_TOKENIZED_NAME("paratest_ShouldHandleParameterizedTests2(7)"), 7 },
+};
+static void runner_args_paratest_ShouldHandleParameterizedTests2(void)
+{
+    paratest_ShouldHandleParameterizedTests2(runner_args_table_paratest_ShouldHandleParameterizedTests2[runner_args_row].p1);
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    int p1;
+} runner_args_table_paratest_ShouldHandleParameterizedTestsThatFail[] =
+{
+    { UNITY_TOKENIZED_NAME("paratest_ShouldHandleParameterizedTestsThatFail(17)"), 17 },
+};
+static void runner_args_paratest_ShouldHandleParameterizedTestsThatFail(void)
+{
+    paratest_ShouldHandleParameterizedTestsThatFail(runner_args_table_paratest_ShouldHandleParameterizedTestsThatFail[runner_args_row].p1);
+}
+static void runner_args1_paratest_WorksWithFunctionPointers(void)
+{
+    paratest_WorksWithFunctionPointers(isArgumentOne);
+}
+
+/*=======List Parameterized Test Names=====*/
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+static void runner_list_case_name(const char* name)
+{
+#ifdef UNITY_OUTPUT_TOKENIZED
+  UnityPrint(name);
+#else
+  char ch[2] = { 0, 0 };
+  for (; *name != 0; name++)
+  {
+    if ((*name != '"') && (*name != '\n'))
+    {
+      ch[0] = *name;
+      UnityPrint(ch);
+    }
+  }
+#endif
+}
+#endif
+
+/*=======MAIN=====*/
+ int main(int argc, char** argv)
+{
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+  int parse_status = UnityParseOptions(argc, argv);
+  if (parse_status != 0)
+  {
+    if (parse_status < 0)
+    {
+      UnityPrint("testdata/testRunnerGenerator.");
+      UNITY_PRINT_EOL();
+      for (int r = 0; r < 3; r++)
+      {
+        UnityPrint("  ");
+        runner_list_case_name(runner_args_table_paratest_ShouldHandleParameterizedTests[r].name);
+        UNITY_PRINT_EOL();
+      }
+      for (int r = 0; r < 1; r++)
+      {
+        UnityPrint("  ");
+        runner_list_case_name(runner_args_table_paratest_ShouldHandleParameterizedTests2[r].name);
+        UNITY_PRINT_EOL();
+      }
+      UnityPrint("  paratest_ShouldHandleNonParameterizedTestsWhenParameterizationValid");
+      UNITY_PRINT_EOL();
+      for (int r = 0; r < 1; r++)
+      {
+        UnityPrint("  ");
+        runner_list_case_name(runner_args_table_paratest_ShouldHandleParameterizedTestsThatFail[r].name);
+        UNITY_PRINT_EOL();
+      }
+      UnityPrint("  paratest_WorksWithFunctionPointers(isArgumentOne)");
+      UNITY_PRINT_EOL();
+      return 0;
+    }
+    return parse_status;
+  }
+#endif
+  UnityBegin(UNITY_TOKENIZE("testdata/testRunnerGenerator.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[7];
+
+  for (int r = 0; r < 3; r++)
+  {
+    run_test_params_arr[0 + r].func = runner_args_paratest_ShouldHandleParameterizedTests;
+    run_test_params_arr[0 + r].name = runner_args_table_paratest_ShouldHandleParameterizedTests[r].name;
+    run_test_params_arr[0 + r].line_num = 152;
+    run_test_params_arr[0 + r].args_row = r;
+  }
+  for (int r = 0; r < 1; r++)
+  {
+    run_test_params_arr[3 + r].func = runner_args_paratest_ShouldHandleParameterizedTests2;
+    run_test_params_arr[3 + r].name = runner_args_table_paratest_ShouldHandleParameterizedTests2[r].name;
+    run_test_params_arr[3 + r].line_num = 158;
+    run_test_params_arr[3 + r].args_row = r;
+  }
+  run_test_params_arr[4].func = paratest_ShouldHandleNonParameterizedTestsWhenParameterizationValid;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("paratest_ShouldHandleNonParameterizedTestsWhenParameterizationValid");
+  run_test_params_arr[4].line_num = 163;
+  run_test_params_arr[4].args_row = 0;
+  for (int r = 0; r < 1; r++)
+  {
+    run_test_params_arr[5 + r].func = runner_args_paratest_ShouldHandleParameterizedTestsThatFail;
+    run_test_params_arr[5 + r].name = runner_args_table_paratest_ShouldHandleParameterizedTestsThatFail[r].name;
+    run_test_params_arr[5 + r].line_num = 169;
+    run_test_params_arr[5 + r].args_row = r;
+  }
+  run_test_params_arr[6].func = runner_args1_paratest_WorksWithFunctionPointers;
+  run_test_params_arr[6].name = UNITY_TOKENIZE("paratest_WorksWithFunctionPointers(isArgumentOne)");
+  run_test_params_arr[6].line_num = 180;
+  run_test_params_arr[6].args_row = 0;
+
+  for (int i = 0; i < 7; i++)
+  {
+    runner_args_row = run_test_params_arr[i].args_row;
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
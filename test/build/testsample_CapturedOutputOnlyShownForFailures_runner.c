@@ -0,0 +1,112 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "Defs.h"
+#include <stdio.h>
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_ThisTestPrintsAndPasses(void);
+extern void test_ThisTestPrintsAndFails(void);
+extern void test_ThisTestPrintsTooMuchAndFails(void);
+extern void test_ThisTestPrintsAndIsIgnored(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("testdata/testRunnerGeneratorOutput.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[4];
+
+  run_test_params_arr[0].func = test_ThisTestPrintsAndPasses;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("test_ThisTestPrintsAndPasses");
+  run_test_params_arr[0].line_num = 27;
+  run_test_params_arr[1].func = test_ThisTestPrintsAndFails;
+  run_test_params_arr[1].name = UNITY_TOKENIZE("test_ThisTestPrintsAndFails");
+  run_test_params_arr[1].line_num = 38;
+  run_test_params_arr[2].func = test_ThisTestPrintsTooMuchAndFails;
+  run_test_params_arr[2].name = UNITY_TOKENIZE("test_ThisTestPrintsTooMuchAndFails");
+  run_test_params_arr[2].line_num = 46;
+  run_test_params_arr[3].func = test_ThisTestPrintsAndIsIgnored;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("test_ThisTestPrintsAndIsIgnored");
+  run_test_params_arr[3].line_num = 57;
+
+  for (int i = 0; i < 4; i++)
+  {
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
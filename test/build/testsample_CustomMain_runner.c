@@ -0,0 +1,148 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include "Defs.h"
+#include "CException.h"
+#include <stdio.h>
+#include "mockMock.h"
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_ThisTestAlwaysPasses(void);
+extern void test_ThisTestAlwaysFails(void);
+extern void test_ThisTestAlwaysIgnored(void);
+extern void spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan(void);
+extern void spec_ThisTestPassesWhenNormalSetupRan(void);
+extern void spec_ThisTestPassesWhenNormalTeardownRan(void);
+extern void test_NotBeConfusedByLongComplicatedStrings(void);
+extern void test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings(void);
+extern void test_StillNotBeConfusedByLongComplicatedStrings(void);
+extern void should_RunTestsStartingWithShouldByDefault(void);
+extern void test_ShouldCallMockInitAndVerifyFunctionsForEachTest(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  mockMock_Init();
+}
+static void CMock_Verify(void)
+{
+  mockMock_Verify();
+}
+static void CMock_Destroy(void)
+{
+  mockMock_Destroy();
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+ int custom_main(void);
+int custom_main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("testdata/testRunnerGeneratorWithMocks.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[11];
+
+  run_test_params_arr[0].func = test_ThisTestAlwaysPasses;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("test_ThisTestAlwaysPasses");
+  run_test_params_arr[0].line_num = 66;
+  run_test_params_arr[1].func = test_ThisTestAlwaysFails;
+  run_test_params_arr[1].name = UNITY_TOKENIZE("test_ThisTestAlwaysFails");
+  run_test_params_arr[1].line_num = 71;
+  run_test_params_arr[2].func = test_ThisTestAlwaysIgnored;
+  run_test_params_arr[2].name = UNITY_TOKENIZE("test_ThisTestAlwaysIgnored");
+  run_test_params_arr[2].line_num = 76;
+  run_test_params_arr[3].func = spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan");
+  run_test_params_arr[3].line_num = 91;
+  run_test_params_arr[4].func = spec_ThisTestPassesWhenNormalSetupRan;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("spec_ThisTestPassesWhenNormalSetupRan");
+  run_test_params_arr[4].line_num = 96;
+  run_test_params_arr[5].func = spec_ThisTestPassesWhenNormalTeardownRan;
+  run_test_params_arr[5].name = UNITY_TOKENIZE("spec_ThisTestPassesWhenNormalTeardownRan");
+  run_test_params_arr[5].line_num = 101;
+  run_test_params_arr[6].func = test_NotBeConfusedByLongComplicatedStrings;
+  run_test_params_arr[6].name = UNITY_TOKENIZE("test_NotBeConfusedByLongComplicatedStrings");
+  run_test_params_arr[6].line_num = 123;
+  run_test_params_arr[7].func = test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings;
+  run_test_params_arr[7].name = UNITY_TOKENIZE("test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings");
+  run_test_params_arr[7].line_num = 130;
+  run_test_params_arr[8].func = test_StillNotBeConfusedByLongComplicatedStrings;
+  run_test_params_arr[8].name = UNITY_TOKENIZE("test_StillNotBeConfusedByLongComplicatedStrings");
+  run_test_params_arr[8].line_num = 135;
+  run_test_params_arr[9].func = should_RunTestsStartingWithShouldByDefault;
+  run_test_params_arr[9].name = UNITY_TOKENIZE("should_RunTestsStartingWithShouldByDefault");
+  run_test_params_arr[9].line_num = 142;
+  run_test_params_arr[10].func = test_ShouldCallMockInitAndVerifyFunctionsForEachTest;
+  run_test_params_arr[10].name = UNITY_TOKENIZE("test_ShouldCallMockInitAndVerifyFunctionsForEachTest");
+  run_test_params_arr[10].line_num = 193;
+
+  for (int i = 0; i < 11; i++)
+  {
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  CMock_Guts_MemFreeFinal();
+  return UNITY_END();
+}
@@ -0,0 +1,151 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include <stdio.h>
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+  int runs_cases;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_OnlyFuzzTarget(const unsigned char* data, size_t size);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======Fuzz Tests=====*/
+#ifndef UNITY_INCLUDE_FUZZ
+#error "TEST_FUZZ tests need Unity built with UNITY_INCLUDE_FUZZ"
+#endif
+#ifndef UNITY_FUZZ_ENTRY
+static void runner_fuzz_test_OnlyFuzzTarget(void)
+{
+    UnityFuzzReplay(test_OnlyFuzzTarget, "test_OnlyFuzzTarget", 25, run_test);
+}
+#endif
+
+/*=======libFuzzer Entry Point=====*/
+#ifdef UNITY_FUZZ_ENTRY
+#ifndef UNITY_FUZZ_TARGET
+#define UNITY_FUZZ_TARGET test_OnlyFuzzTarget
+#endif
+#ifdef __cplusplus
+extern "C"
+#endif
+int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size);
+int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size)
+{
+  static const struct
+  {
+    UnityFuzzFunction func;
+    const char* name;
+    UNITY_LINE_TYPE line_num;
+  } targets[] =
+  {
+    { test_OnlyFuzzTarget, "test_OnlyFuzzTarget", 25 },
+  };
+  static int began = 0;
+  unsigned int t = 0;
+  (void)run_test; /* only the corpus replay runs tests one by one */
+  if (!began)
+  {
+    UnityBegin(UNITY_TOKENIZE("testdata/testRunnerGeneratorFuzzEntry.c"));
+    began = 1;
+  }
+  UnityFuzzOneInput(UNITY_FUZZ_TARGET, targets[t].name, targets[t].line_num, data, size);
+  return 0;
+}
+#else
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("testdata/testRunnerGeneratorFuzzEntry.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[1];
+
+  run_test_params_arr[0].func = runner_fuzz_test_OnlyFuzzTarget;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("test_OnlyFuzzTarget");
+  run_test_params_arr[0].line_num = 25;
+  run_test_params_arr[0].runs_cases = 1;
+
+  for (int i = 0; i < 1; i++)
+  {
+    if (run_test_params_arr[i].runs_cases)
+    {
+      run_test_params_arr[i].func();
+      continue;
+    }
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
+#endif /* UNITY_FUZZ_ENTRY */
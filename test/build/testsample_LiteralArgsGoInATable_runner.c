@@ -0,0 +1,176 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "Defs.h"
+#include <stdio.h>
+#include <string.h>
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+  int args_row;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_LiteralsGoInATable(int number, const char* text);
+extern void test_ArraysGetWrappers(int number, const char text[]);
+extern void test_NonLiteralsGetWrappers(int number);
+extern void test_FunctionPointersGetWrappers(int (*op)(int));
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======Parameterized Test Wrappers=====*/
+static int runner_args_row;
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    int p1;
+    const char* p2;
+} runner_args_table_test_LiteralsGoInATable[] =
+{
+    { UNITY_TOKENIZED_NAME("test_LiteralsGoInATable(1, \"one\")"), 1, "one" },
+    { UNITY_TOKENIZED_NAME("test_LiteralsGoInATable(2, \"say \\\"hi\\\"\")"), 2, "say \"hi\"" },
+    { UNITY_TOKENIZED_NAME("test_LiteralsGoInATable(3, \"C:\\\\temp\")"), 3, "C:\\temp" },
+};
+static void runner_args_test_LiteralsGoInATable(void)
+{
+    test_LiteralsGoInATable(runner_args_table_test_LiteralsGoInATable[runner_args_row].p1, runner_args_table_test_LiteralsGoInATable[runner_args_row].p2);
+}
+static void runner_args1_test_ArraysGetWrappers(void)
+{
+    test_ArraysGetWrappers(1, "one");
+}
+static void runner_args2_test_ArraysGetWrappers(void)
+{
+    test_ArraysGetWrappers(2, "say \"hi\"");
+}
+static void runner_args3_test_ArraysGetWrappers(void)
+{
+    test_ArraysGetWrappers(3, "C:\\temp");
+}
+static void runner_args1_test_NonLiteralsGetWrappers(void)
+{
+    test_NonLiteralsGetWrappers(ARGUMENT_TWO);
+}
+static void runner_args2_test_NonLiteralsGetWrappers(void)
+{
+    test_NonLiteralsGetWrappers(twice(2));
+}
+static void runner_args1_test_FunctionPointersGetWrappers(void)
+{
+    test_FunctionPointersGetWrappers(NULL);
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("testdata/testRunnerGeneratorArgs.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[9];
+
+  for (int r = 0; r < 3; r++)
+  {
+    run_test_params_arr[0 + r].func = runner_args_test_LiteralsGoInATable;
+    run_test_params_arr[0 + r].name = runner_args_table_test_LiteralsGoInATable[r].name;
+    run_test_params_arr[0 + r].line_num = 36;
+    run_test_params_arr[0 + r].args_row = r;
+  }
+  run_test_params_arr[3].func = runner_args1_test_ArraysGetWrappers;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("test_ArraysGetWrappers(1, \"one\")");
+  run_test_params_arr[3].line_num = 46;
+  run_test_params_arr[3].args_row = 0;
+  run_test_params_arr[4].func = runner_args2_test_ArraysGetWrappers;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("test_ArraysGetWrappers(2, \"say \\\"hi\\\"\")");
+  run_test_params_arr[4].line_num = 46;
+  run_test_params_arr[4].args_row = 0;
+  run_test_params_arr[5].func = runner_args3_test_ArraysGetWrappers;
+  run_test_params_arr[5].name = UNITY_TOKENIZE("test_ArraysGetWrappers(3, \"C:\\\\temp\")");
+  run_test_params_arr[5].line_num = 46;
+  run_test_params_arr[5].args_row = 0;
+  run_test_params_arr[6].func = runner_args1_test_NonLiteralsGetWrappers;
+  run_test_params_arr[6].name = UNITY_TOKENIZE("test_NonLiteralsGetWrappers(ARGUMENT_TWO)");
+  run_test_params_arr[6].line_num = 55;
+  run_test_params_arr[6].args_row = 0;
+  run_test_params_arr[7].func = runner_args2_test_NonLiteralsGetWrappers;
+  run_test_params_arr[7].name = UNITY_TOKENIZE("test_NonLiteralsGetWrappers(twice(2))");
+  run_test_params_arr[7].line_num = 55;
+  run_test_params_arr[7].args_row = 0;
+  run_test_params_arr[8].func = runner_args1_test_FunctionPointersGetWrappers;
+  run_test_params_arr[8].name = UNITY_TOKENIZE("test_FunctionPointersGetWrappers(NULL)");
+  run_test_params_arr[8].line_num = 62;
+  run_test_params_arr[8].args_row = 0;
+
+  for (int i = 0; i < 9; i++)
+  {
+    runner_args_row = run_test_params_arr[i].args_row;
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
@@ -0,0 +1,175 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include "Defs.h"
+#include "CException.h"
+#include <stdio.h>
+#include "mockMock.h"
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+  int args_row;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void paratest_ShouldHandleParameterizedTests(int Num);
+extern void paratest_ShouldHandleParameterizedTests2(int Num);
+extern void paratest_ShouldHandleNonParameterizedTestsWhenParameterizationValid(void);
+extern void paratest_ShouldHandleParameterizedTestsThatFail(int Num);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  mockMock_Init();
+}
+static void CMock_Verify(void)
+{
+  mockMock_Verify();
+}
+static void CMock_Destroy(void)
+{
+  mockMock_Destroy();
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======Parameterized Test Wrappers=====*/
+static int runner_args_row;
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    int p1;
+} runner_args_table_paratest_ShouldHandleParameterizedTests[] =
+{
+    { UNITY_TOKENIZED_NAME("paratest_ShouldHandleParameterizedTests(25)"), 25 },
+    { UNITY_TOKENIZED_NAME("paratest_ShouldHandleParameterizedTests(125)"), 125 },
+    { UNITY_TOKENIZED_NAME("paratest_ShouldHandleParameterizedTests(5)"), 5 },
+};
+static void runner_args_paratest_ShouldHandleParameterizedTests(void)
+{
+    paratest_ShouldHandleParameterizedTests(runner_args_table_paratest_ShouldHandleParameterizedTests[runner_args_row].p1);
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    int p1;
+} runner_args_table_paratest_ShouldHandleParameterizedTests2[] =
+{
+    { UNITY_TOKENIZED_NAME("paratest_ShouldHandleParameterizedTests2(7)"), 7 },
+};
+static void runner_args_paratest_ShouldHandleParameterizedTests2(void)
+{
+    paratest_ShouldHandleParameterizedTests2(runner_args_table_paratest_ShouldHandleParameterizedTests2[runner_args_row].p1);
+}
+static const struct
+{
+    UNITY_TOKENIZED_NAME_T name;
+    int p1;
+} runner_args_table_paratest_ShouldHandleParameterizedTestsThatFail[] =
+{
+    { UNITY_TOKENIZED_NAME("paratest_ShouldHandleParameterizedTestsThatFail(17)"), 17 },
+};
+static void runner_args_paratest_ShouldHandleParameterizedTestsThatFail(void)
+{
+    paratest_ShouldHandleParameterizedTestsThatFail(runner_args_table_paratest_ShouldHandleParameterizedTestsThatFail[runner_args_row].p1);
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("testdata/testRunnerGeneratorWithMocks.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[6];
+
+  for (int r = 0; r < 3; r++)
+  {
+    run_test_params_arr[0 + r].func = runner_args_paratest_ShouldHandleParameterizedTests;
+    run_test_params_arr[0 + r].name = runner_args_table_paratest_ShouldHandleParameterizedTests[r].name;
+    run_test_params_arr[0 + r].line_num = 150;
+    run_test_params_arr[0 + r].args_row = r;
+  }
+  for (int r = 0; r < 1; r++)
+  {
+    run_test_params_arr[3 + r].func = runner_args_paratest_ShouldHandleParameterizedTests2;
+    run_test_params_arr[3 + r].name = runner_args_table_paratest_ShouldHandleParameterizedTests2[r].name;
+    run_test_params_arr[3 + r].line_num = 156;
+    run_test_params_arr[3 + r].args_row = r;
+  }
+  run_test_params_arr[4].func = paratest_ShouldHandleNonParameterizedTestsWhenParameterizationValid;
+  run_test_params_arr[4].name = UNITY_TOKENIZE("paratest_ShouldHandleNonParameterizedTestsWhenParameterizationValid");
+  run_test_params_arr[4].line_num = 161;
+  run_test_params_arr[4].args_row = 0;
+  for (int r = 0; r < 1; r++)
+  {
+    run_test_params_arr[5 + r].func = runner_args_paratest_ShouldHandleParameterizedTestsThatFail;
+    run_test_params_arr[5 + r].name = runner_args_table_paratest_ShouldHandleParameterizedTestsThatFail[r].name;
+    run_test_params_arr[5 + r].line_num = 167;
+    run_test_params_arr[5 + r].args_row = r;
+  }
+
+  for (int i = 0; i < 6; i++)
+  {
+    runner_args_row = run_test_params_arr[i].args_row;
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  CMock_Guts_MemFreeFinal();
+  return UNITY_END();
+}
@@ -0,0 +1,218 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "Defs.h"
+#include <stdio.h>
+
+/*=======Structure Used By Test Runner=====*/
+struct UnityRunTestParameters
+{
+  UnityTestFunction func;
+  const char* name;
+  UNITY_LINE_TYPE line_num;
+  int runs_cases;
+};
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_ThisTestFailsForPositiveOffsets(int offset);
+extern void test_ThisTestGetsStructs(area_t area);
+extern void test_ThisTestNeverRuns(unsigned long value);
+extern void test_EachValueHadItsOwnSetUp(void);
+extern int offsets(unsigned int index, int* value);
+extern int areas(unsigned int index, area_t* value);
+extern int nothing(unsigned int index, unsigned long* value);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = (UNITY_UINT) line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UnityReportTestBegin();
+    UNITY_CLR_DETAILS();
+    UNITY_CAPTURE_OUTPUT_START();
+    UNITY_EXEC_TIME_START();
+    UNITY_PERF_COUNTERS_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_BODY);
+        func();
+    }
+    UNITY_EXEC_TIME_PHASE(UNITY_EXEC_PHASE_TEARDOWN);
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_PERF_COUNTERS_STOP();
+    UNITY_EXEC_TIME_STOP();
+    UNITY_CAPTURE_OUTPUT_STOP();
+    UnityConcludeTest();
+}
+
+/*=======Parameterized Test Wrappers=====*/
+
+/*=======Runtime Value Sources=====*/
+static char runner_value_name[UNITY_VALUES_NAME_SIZE];
+static unsigned int runner_value_name_len;
+static void runner_value_name_add(const char* text)
+{
+    while ((*text != 0) && (runner_value_name_len < sizeof(runner_value_name) - 1))
+    {
+        runner_value_name[runner_value_name_len++] = *text++;
+    }
+    runner_value_name[runner_value_name_len] = 0;
+}
+static void runner_value_name_add_uint(UNITY_UINT number)
+{
+    char digits[24];
+    int i = (int)sizeof(digits) - 1;
+    digits[i] = 0;
+    do
+    {
+        digits[--i] = (char)('0' + (int)(number % 10));
+        number /= 10;
+    } while (number != 0);
+    runner_value_name_add(&digits[i]);
+}
+static void runner_value_name_add_int(UNITY_INT number)
+{
+    if (number < 0)
+    {
+        runner_value_name_add("-");
+        runner_value_name_add_uint((UNITY_UINT)0 - (UNITY_UINT)number);
+    }
+    else
+    {
+        runner_value_name_add_uint((UNITY_UINT)number);
+    }
+}
+static int runner_value_test_ThisTestFailsForPositiveOffsets;
+static void runner_value_case_test_ThisTestFailsForPositiveOffsets(void)
+{
+    test_ThisTestFailsForPositiveOffsets(runner_value_test_ThisTestFailsForPositiveOffsets);
+}
+static void runner_values_test_ThisTestFailsForPositiveOffsets(void)
+{
+    unsigned int index;
+    for (index = 0; offsets(index, &runner_value_test_ThisTestFailsForPositiveOffsets); index++)
+    {
+        runner_value_name_len = 0;
+        runner_value_name_add("test_ThisTestFailsForPositiveOffsets[");
+        runner_value_name_add_uint((UNITY_UINT)index);
+        runner_value_name_add("](");
+        runner_value_name_add_int((UNITY_INT)runner_value_test_ThisTestFailsForPositiveOffsets);
+        runner_value_name_add(")");
+        run_test(runner_value_case_test_ThisTestFailsForPositiveOffsets, runner_value_name, 54);
+    }
+}
+static area_t runner_value_test_ThisTestGetsStructs;
+static void runner_value_case_test_ThisTestGetsStructs(void)
+{
+    test_ThisTestGetsStructs(runner_value_test_ThisTestGetsStructs);
+}
+static void runner_values_test_ThisTestGetsStructs(void)
+{
+    unsigned int index;
+    for (index = 0; areas(index, &runner_value_test_ThisTestGetsStructs); index++)
+    {
+        runner_value_name_len = 0;
+        runner_value_name_add("test_ThisTestGetsStructs[");
+        runner_value_name_add_uint((UNITY_UINT)index);
+        runner_value_name_add("]");
+        run_test(runner_value_case_test_ThisTestGetsStructs, runner_value_name, 60);
+    }
+}
+static unsigned long runner_value_test_ThisTestNeverRuns;
+static void runner_value_case_test_ThisTestNeverRuns(void)
+{
+    test_ThisTestNeverRuns(runner_value_test_ThisTestNeverRuns);
+}
+static void runner_values_test_ThisTestNeverRuns(void)
+{
+    unsigned int index;
+    for (index = 0; nothing(index, &runner_value_test_ThisTestNeverRuns); index++)
+    {
+        runner_value_name_len = 0;
+        runner_value_name_add("test_ThisTestNeverRuns[");
+        runner_value_name_add_uint((UNITY_UINT)index);
+        runner_value_name_add("](");
+        runner_value_name_add_uint((UNITY_UINT)runner_value_test_ThisTestNeverRuns);
+        runner_value_name_add(")");
+        run_test(runner_value_case_test_ThisTestNeverRuns, runner_value_name, 66);
+    }
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin(UNITY_TOKENIZE("testdata/testRunnerGeneratorValues.c"));
+
+  struct UnityRunTestParameters run_test_params_arr[4];
+
+  run_test_params_arr[0].func = runner_values_test_ThisTestFailsForPositiveOffsets;
+  run_test_params_arr[0].name = UNITY_TOKENIZE("test_ThisTestFailsForPositiveOffsets");
+  run_test_params_arr[0].line_num = 54;
+  run_test_params_arr[0].runs_cases = 1;
+  run_test_params_arr[1].func = runner_values_test_ThisTestGetsStructs;
+  run_test_params_arr[1].name = UNITY_TOKENIZE("test_ThisTestGetsStructs");
+  run_test_params_arr[1].line_num = 60;
+  run_test_params_arr[1].runs_cases = 1;
+  run_test_params_arr[2].func = runner_values_test_ThisTestNeverRuns;
+  run_test_params_arr[2].name = UNITY_TOKENIZE("test_ThisTestNeverRuns");
+  run_test_params_arr[2].line_num = 66;
+  run_test_params_arr[2].runs_cases = 1;
+  run_test_params_arr[3].func = test_EachValueHadItsOwnSetUp;
+  run_test_params_arr[3].name = UNITY_TOKENIZE("test_EachValueHadItsOwnSetUp");
+  run_test_params_arr[3].line_num = 72;
+  run_test_params_arr[3].runs_cases = 0;
+
+  for (int i = 0; i < 4; i++)
+  {
+    if (run_test_params_arr[i].runs_cases)
+    {
+      run_test_params_arr[i].func();
+      continue;
+    }
+    run_test(run_test_params_arr[i].func, run_test_params_arr[i].name, run_test_params_arr[i].line_num);
+  }
+
+  return UNITY_END();
+}
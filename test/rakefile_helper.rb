@@ -165,7 +165,7 @@ module RakefileHelpers
     execute(cmd_str)
   end
 
-  def runtest(bin_name, ok_to_fail = false, extra_args = nil)
+  def runtest(bin_name, ok_to_fail = false, extra_args = nil, raw = false)
     bin_name = File.join('build', File.basename(bin_name))
     extra_args = extra_args.nil? ? "" : " " + extra_args
     if $cfg[:tools][:test_fixture]
@@ -173,7 +173,7 @@ module RakefileHelpers
     else
       cmd_str = bin_name + extra_args
     end
-    execute(cmd_str, ok_to_fail)
+    execute(cmd_str, ok_to_fail, raw)
   end
 
   def run_astyle(style_what)
@@ -188,9 +188,11 @@ module RakefileHelpers
     report "Styling C:PASS"
   end
 
-  def execute(command_string, ok_to_fail = false)
+  # A raw output is returned exactly as the command wrote it, for output that isn't text
+  def execute(command_string, ok_to_fail = false, raw = false)
     report command_string if $verbose
-    output = `#{command_string}`.chomp
+    output = `#{command_string}`
+    output = output.chomp unless raw
     report(output) if ($verbose && !output.nil? && !output.empty?) || (!$?.nil? && !$?.exitstatus.zero? && !ok_to_fail)
     raise "Command failed. (Returned #{$?.exitstatus})" if !$?.nil? && !$?.exitstatus.zero? && !ok_to_fail
     output
@@ -409,8 +411,10 @@ module RakefileHelpers
       "make -s coverage",        # test with coverage
       "cd #{File.join("..","extras","fixture",'test')} && make -s default noStdlibMalloc",
       "cd #{File.join("..","extras","fixture",'test')} && make -s C89",
-      "cd #{File.join("..","extras","memory",'test')} && make -s default noStdlibMalloc",
+      "cd #{File.join("..","extras","memory",'test')} && make -s default noStdlibMalloc arena guardPages threadSafe quarantine",
       "cd #{File.join("..","extras","memory",'test')} && make -s C89",
+      "cd #{File.join("..","extras","async_output",'test')} && make -s default dropPolicy",
+      "cd #{File.join("..","extras","property",'test')} && make -s default workers",
     ].each do |cmd|
       report "Testing '#{cmd}'"
       combined_output += "Testing '#{cmd}'\n\n#{execute(cmd, false)}\n"
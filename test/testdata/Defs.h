@@ -13,4 +13,13 @@
 extern int CounterSuiteSetup;
 extern int isArgumentOne(int i);
 
+#define ARGUMENT_TWO 2
+extern int twice(int i);
+
+typedef struct
+{
+    int width;
+    int height;
+} area_t;
+
 #endif
@@ -198,6 +198,29 @@ int main(void)
 }
 #endif
 
+#ifdef USE_GROUPED_MAIN
+/* Each RUN_TEST here names its test from a different function's stack */
+static void run_first_group(void)
+{
+    RUN_TEST(test_ThisTestAlwaysPasses);
+}
+
+static void run_second_group(void)
+{
+    RUN_TEST(spec_ThisTestPassesWhenNormalSetupRan);
+}
+
+int custom_main(void);
+
+int main(void)
+{
+    UNITY_BEGIN();
+    run_first_group();
+    run_second_group();
+    return UNITY_END();
+}
+#endif
+
 void suitetest_ThisTestPassesWhenCustomSuiteSetupAndTeardownRan(void)
 {
     TEST_ASSERT_EQUAL_MESSAGE(1, CounterSuiteSetup, "Suite Setup Should Have Run");
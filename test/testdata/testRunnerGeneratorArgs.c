@@ -0,0 +1,66 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+/* This Test File Is Used To Verify Which Parameterized Tests Get An Argument Table */
+
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "Defs.h"
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+int twice(int i)
+{
+    return 2 * i;
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/* Only literals, in plain parameters: these are rows of a table */
+TEST_CASE(1, "one")
+TEST_CASE(2, "say \"hi\"")
+TEST_CASE(3, "C:\\temp")
+void test_LiteralsGoInATable(int number, const char* text)
+{
+    TEST_ASSERT_TRUE(number > 0);
+    TEST_ASSERT_NULL(strpbrk(text, "\"\\"));
+}
+
+/* The same cases, but an array parameter can't be a member of the table */
+TEST_CASE(1, "one")
+TEST_CASE(2, "say \"hi\"")
+TEST_CASE(3, "C:\\temp")
+void test_ArraysGetWrappers(int number, const char text[])
+{
+    TEST_ASSERT_TRUE(number > 0);
+    TEST_ASSERT_NULL(strpbrk(text, "\"\\"));
+}
+
+/* Arguments that aren't literals have to be compiled where they are used */
+TEST_CASE(ARGUMENT_TWO)
+TEST_CASE(twice(2))
+void test_NonLiteralsGetWrappers(int number)
+{
+    TEST_ASSERT_EQUAL_INT(0, number % 2);
+}
+
+/* A literal argument, but a parameter that isn't a plain declaration */
+TEST_CASE(NULL)
+void test_FunctionPointersGetWrappers(int (*op)(int))
+{
+    TEST_ASSERT_NULL(op);
+    TEST_ASSERT_EQUAL_INT(4, twice(2));
+}
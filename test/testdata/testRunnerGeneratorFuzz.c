@@ -0,0 +1,44 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+/* This Test File Is Used To Verify Fuzz Tests Replaying Their Corpus */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "unity.h"
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+TEST_FUZZ(test_ParsesEveryInput, data, size)
+{
+    if (size > 0)
+    {
+        TEST_ASSERT_NOT_EQUAL_CHAR('X', data[0]);
+    }
+}
+
+TEST_FUZZ(test_CrashesOnBang, data, size)
+{
+    if ((size > 0) && (data[0] == '!'))
+    {
+        abort();
+    }
+}
+
+void test_PlainTestStillRuns(void)
+{
+}
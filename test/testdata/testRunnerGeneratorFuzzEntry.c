@@ -0,0 +1,46 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+/* This Test File Is Used To Verify The Fuzzer Entry Point Of A File With One Fuzz Test */
+
+#include <stdio.h>
+#include "unity.h"
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+TEST_FUZZ(test_OnlyFuzzTarget, data, size)
+{
+    if (size > 0)
+    {
+        TEST_ASSERT_NOT_EQUAL_CHAR('X', data[0]);
+    }
+}
+
+#ifdef UNITY_FUZZ_ENTRY
+/* Stands in for the fuzzer, which would call the entry point with inputs of its own */
+int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size);
+
+int main(void)
+{
+    static const unsigned char input[] = "hello";
+
+    (void)LLVMFuzzerTestOneInput(input, sizeof(input) - 1);
+    (void)LLVMFuzzerTestOneInput(input, 0);
+    printf("Both inputs were run\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,61 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+/* This Test File Is Used To Verify What Becomes Of Output Written By The Tests Themselves */
+
+#include <stdio.h>
+#include "unity.h"
+#include "Defs.h"
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+void setUp(void)
+{
+    printf("setUp talks too\n");
+}
+
+void tearDown(void)
+{
+}
+
+void test_ThisTestPrintsAndPasses(void)
+{
+    int i;
+    for (i = 0; i < 100; i++)
+    {
+        printf("noise from a passing test %d\n", i);
+        fprintf(stderr, "more noise on stderr %d\n", i);
+    }
+    TEST_ASSERT_EQUAL(100, i);
+}
+
+void test_ThisTestPrintsAndFails(void)
+{
+    printf("written to stdout");
+    printf(" before failing\n");
+    fprintf(stderr, "written to stderr\n");
+    TEST_FAIL_MESSAGE("This Test Should Fail");
+}
+
+void test_ThisTestPrintsTooMuchAndFails(void)
+{
+    int i;
+    for (i = 0; i < 200; i++)
+    {
+        printf("line %03d of a long story\n", i);
+    }
+    printf("the end");
+    TEST_FAIL_MESSAGE("This Test Should Fail Too");
+}
+
+void test_ThisTestPrintsAndIsIgnored(void)
+{
+    printf("noise from an ignored test\n");
+    TEST_IGNORE_MESSAGE("This Test Should Be Ignored");
+}
@@ -0,0 +1,32 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+/* This Test File Is Used To Verify The Performance Counters Printed After A Test */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "unity.h"
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_SleepsOnce(void)
+{
+    /* Giving up the processor is a context switch, which only the kernel sees */
+    const struct timespec nap = { 0, 1000000L };
+    TEST_ASSERT_EQUAL_INT(0, nanosleep(&nap, NULL));
+}
@@ -0,0 +1,36 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+/* This Test File Is Used To Verify Allocation Sweeps Are Found With Their Line Numbers */
+
+#include <stdio.h>
+#include "unity.h"
+
+/* Sweeping needs unity_memory.c, which these tests don't link, so each one runs as a plain test */
+#define TEST_ALLOC_SWEEP(name) void name(void); void name(void)
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+TEST_ALLOC_SWEEP(test_SweepIsFound)
+{
+    TEST_ASSERT_TRUE(1);
+}
+
+TEST_ALLOC_SWEEP( test_SpacedSweepIsFound )
+{
+    TEST_ASSERT_TRUE(1);
+}
@@ -0,0 +1,50 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+/* This Test File Is Used To Verify The Report Of How Long Tests And Their Phases Took */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "unity.h"
+
+/* How long test_Slow takes */
+#define SLOW_MS 20
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+static void spin(long ms)
+{
+    struct timespec start;
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+    } while (((now.tv_sec - start.tv_sec) * 1000L) + ((now.tv_nsec - start.tv_nsec) / 1000000L) < ms);
+}
+
+void setUp(void)
+{
+    spin(2);
+}
+
+void tearDown(void)
+{
+}
+
+void test_Quick(void)
+{
+}
+
+void test_Slow(void)
+{
+    spin(SLOW_MS);
+}
@@ -0,0 +1,75 @@
+/* =========================================================================
+    Unity - A Test Framework for C
+    ThrowTheSwitch.org
+    Copyright (c) 2007-26 Mike Karlesky, Mark VanderVoord, & Greg Williams
+    SPDX-License-Identifier: MIT
+========================================================================= */
+
+/* This Test File Is Used To Verify Tests Whose Values Come From A Source At Runtime */
+
+#include <stdio.h>
+#include "unity.h"
+#include "Defs.h"
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+int CounterSetup = 0;
+
+void setUp(void)
+{
+    CounterSetup++;
+}
+
+void tearDown(void)
+{
+}
+
+int offsets(unsigned int index, int* value)
+{
+    if (index >= 4)
+        return 0;
+    *value = (int)index * 2 - 3;
+    return 1;
+}
+
+int areas(unsigned int index, area_t* value)
+{
+    if (index >= 2)
+        return 0;
+    value->width = (int)index + 1;
+    value->height = 10;
+    return 1;
+}
+
+int nothing(unsigned int index, unsigned long* value)
+{
+    (void)index;
+    (void)value;
+    return 0;
+}
+
+TEST_VALUES_FROM(offsets)
+void test_ThisTestFailsForPositiveOffsets(int offset)
+{
+    TEST_ASSERT_LESS_THAN(0, offset);
+}
+
+TEST_VALUES_FROM(areas)
+void test_ThisTestGetsStructs(area_t area)
+{
+    TEST_ASSERT_EQUAL_INT(10 * area.width, area.width * area.height);
+}
+
+TEST_VALUES_FROM(nothing)
+void test_ThisTestNeverRuns(unsigned long value)
+{
+    TEST_FAIL_MESSAGE("There were no values");
+    (void)value;
+}
+
+void test_EachValueHadItsOwnSetUp(void)
+{
+    TEST_ASSERT_EQUAL_INT(7, CounterSetup);
+}
@@ -6,12 +6,41 @@
 # =========================================================================
 
 require '../auto/generate_test_runner.rb'
+require '../auto/decode_binary_output.rb'
 
 $generate_test_runner_tests = 0
 $generate_test_runner_failures = 0
 
 OUT_FILE  = 'build/testsample_'
 
+# A :postprocess hook turns what the test printed into the text that is checked against
+# :expected, for tests whose output isn't text to begin with
+def decode_binary(tokens = nil)
+  lambda { |output| UnityBinaryDecoder.new(tokens).decode(output.b) }
+end
+
+# Tokenized output is decoded with the strings of the sources it was built from (and any,
+# like __FILE__ names, that aren't literals in them)
+def decode_tokenized(sources, strings = [])
+  lambda do |output|
+    tokens = UnityTokenDatabase.new
+    strings.each { |str| tokens.add(str.b) }
+    sources.each { |file| tokens.add_source(File.binread(file)) }
+    decode_binary(tokens).call(output)
+  end
+end
+
+# The JUnit and JSON reports a test wrote are checked in place of what it printed: how many
+# test cases each of them lists, then the first part of them that matches each pattern
+def read_reports(xml, json, patterns)
+  lambda do |_output|
+    junit = File.read(xml)
+    lines = File.read(json)
+    ([ junit.scan('<testcase ').size, lines.scan('"event":"test_end"').size ] +
+     patterns.map { |pattern| (junit + lines)[pattern] }).join("\n")
+  end
+end
+
 RUNNER_TESTS = [
   { :name => 'DefaultsThroughOptions',
     :testfile => 'testdata/testRunnerGenerator.c',
@@ -32,6 +61,550 @@ RUNNER_TESTS = [
     }
   },
 
+  { :name => 'PerfCountersStillReportResults',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_PERF_COUNTERS'],
+    :options => nil, #defaults
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'PerfCountersSeeTheKernelWorkOfATest',
+    :testfile => 'testdata/testRunnerGeneratorPerf.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_PERF_COUNTERS'],
+    :options => nil, #defaults
+    :expected => {
+      :to_pass => [ 'test_SleepsOnce' ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "test_SleepsOnce:PASS (\\[([a-z-]+=[0-9]+ )*task-clock=[1-9][0-9]* page-faults=[0-9]+ context-switches=[1-9][0-9]*\\]|\\[perf counters unavailable\\])$",
+                 "^-+$",
+                 "^1 Tests 0 Failures 0 Ignored",
+                 "^OK$",
+               ],
+    }
+  },
+
+  { :name => 'ExecTimeStillReportsResults',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_EXEC_TIME', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-t 3",
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'CapturedOutputOnlyShownForFailures',
+    :testfile => 'testdata/testRunnerGeneratorOutput.c',
+    :testdefines => ['TEST', 'UNITY_CAPTURE_TEST_OUTPUT', 'UNITY_CAPTURE_TEST_OUTPUT_SIZE=128'],
+    :expected => {
+      :to_pass => [ 'test_ThisTestPrintsAndPasses' ],
+      :to_fail => [ 'test_ThisTestPrintsAndFails', 'test_ThisTestPrintsTooMuchAndFails' ],
+      :to_ignore => [ 'test_ThisTestPrintsAndIsIgnored' ],
+      :text => [ "test_ThisTestPrintsAndPasses:PASS$",
+                 "test_ThisTestPrintsAndFails:FAIL:This Test Should Fail$",
+                 "^  \\| written to stderr$",
+                 "^  \\| setUp talks too$",
+                 "^  \\| written to stdout before failing$",
+                 "test_ThisTestPrintsTooMuchAndFails:FAIL:This Test Should Fail Too$",
+                 "^  \\| \\(4916 bytes of output before this were dropped\\)$",
+                 "^  \\| line 196 of a long story$",
+                 "^  \\| line 197 of a long story$",
+                 "^  \\| line 198 of a long story$",
+                 "^  \\| line 199 of a long story$",
+                 "^  \\| the end$",
+                 "test_ThisTestPrintsAndIsIgnored:IGNORE",
+                 "^-+$",
+                 "4 Tests 2 Failures 1 Ignored",
+                 "^FAIL$",
+               ],
+    }
+  },
+
+  { :name => 'ValuesFromSourceAtRuntime',
+    :testfile => 'testdata/testRunnerGeneratorValues.c',
+    :testdefines => ['TEST', 'UNITY_SUPPORT_TEST_CASES'],
+    :options => {
+      :use_param_tests => true,
+    },
+    :features => [ :parameterized ],
+    :expected => {
+      :to_pass => [ 'test_ThisTestFailsForPositiveOffsets\[0\]\(-3\)',
+                    'test_ThisTestFailsForPositiveOffsets\[1\]\(-1\)',
+                    'test_ThisTestGetsStructs\[0\]',
+                    'test_ThisTestGetsStructs\[1\]',
+                    'test_EachValueHadItsOwnSetUp',
+                  ],
+      :to_fail => [ 'test_ThisTestFailsForPositiveOffsets\[2\]\(1\)',
+                    'test_ThisTestFailsForPositiveOffsets\[3\]\(3\)',
+                  ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ValuesFromSourceDecodeFromBinary',
+    :testfile => 'testdata/testRunnerGeneratorValues.c',
+    :testdefines => ['TEST', 'UNITY_SUPPORT_TEST_CASES', 'UNITY_OUTPUT_BINARY', 'UNITY_INCLUDE_EXEC_TIME'],
+    :options => {
+      :use_param_tests => true,
+    },
+    :postprocess => decode_binary,
+    :features => [ :parameterized ],
+    :expected => {
+      :to_pass => [ 'test_ThisTestFailsForPositiveOffsets\[0\]\(-3\)',
+                    'test_ThisTestFailsForPositiveOffsets\[1\]\(-1\)',
+                    'test_ThisTestGetsStructs\[0\]',
+                    'test_ThisTestGetsStructs\[1\]',
+                    'test_EachValueHadItsOwnSetUp',
+                  ],
+      :to_fail => [ 'test_ThisTestFailsForPositiveOffsets\[2\]\(1\)',
+                    'test_ThisTestFailsForPositiveOffsets\[3\]\(3\)',
+                  ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ValuesFromSourceKeepTheirNamesInSlowestList',
+    :testfile => 'testdata/testRunnerGeneratorValues.c',
+    :testdefines => ['TEST', 'UNITY_SUPPORT_TEST_CASES', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_EXEC_TIME'],
+    :options => {
+      :use_param_tests => true,
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-t 10 | grep -o ' line 54 test_ThisTestFailsForPositiveOffsets\\[[0-3]\\]([-0-9]*) ' | sort -u | wc -l",
+    :features => [ :parameterized ],
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "^ *4$" ],
+    }
+  },
+
+  { :name => 'ValuesFromSourceAreListedOnce',
+    :testfile => 'testdata/testRunnerGeneratorValues.c',
+    :testdefines => ['TEST', 'UNITY_SUPPORT_TEST_CASES', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :use_param_tests => true,
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-l",
+    :features => [ :parameterized ],
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "testRunnerGeneratorValues",
+                 "^  test_ThisTestFailsForPositiveOffsets\\[\\.\\.\\.\\]$",
+                 "^  test_ThisTestGetsStructs\\[\\.\\.\\.\\]$",
+                 "^  test_ThisTestNeverRuns\\[\\.\\.\\.\\]$",
+                 "^  test_EachValueHadItsOwnSetUp$",
+               ],
+    }
+  },
+
+  { :name => 'LiteralArgsGoInATable',
+    :testfile => 'testdata/testRunnerGeneratorArgs.c',
+    :testdefines => ['TEST', 'UNITY_SUPPORT_TEST_CASES'],
+    :options => {
+      :use_param_tests => true,
+    },
+    :features => [ :parameterized ],
+    :runner_has => [ 'runner_args_table_test_LiteralsGoInATable\[\]',
+                     'runner_args1_test_ArraysGetWrappers',
+                     'runner_args2_test_NonLiteralsGetWrappers',
+                     'runner_args1_test_FunctionPointersGetWrappers',
+                   ],
+    :runner_lacks => [ 'runner_args1_test_LiteralsGoInATable',
+                       'runner_args_table_test_ArraysGetWrappers',
+                       'runner_args_table_test_NonLiteralsGetWrappers',
+                       'runner_args_table_test_FunctionPointersGetWrappers',
+                     ],
+    :expected => {
+      :to_pass => [ Regexp.escape('test_LiteralsGoInATable(1, "one")'),
+                    Regexp.escape('test_ArraysGetWrappers(1, "one")'),
+                    Regexp.escape('test_NonLiteralsGetWrappers(ARGUMENT_TWO)'),
+                    Regexp.escape('test_NonLiteralsGetWrappers(twice(2))'),
+                    Regexp.escape('test_FunctionPointersGetWrappers(NULL)'),
+                  ],
+      :to_fail => [ Regexp.escape('test_LiteralsGoInATable(2, "say \"hi\"")'),
+                    Regexp.escape('test_LiteralsGoInATable(3, "C:\\\\temp")'),
+                    Regexp.escape('test_ArraysGetWrappers(2, "say \"hi\"")'),
+                    Regexp.escape('test_ArraysGetWrappers(3, "C:\\\\temp")'),
+                  ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsTableCasesAreListedLikeWrappers',
+    :testfile => 'testdata/testRunnerGeneratorArgs.c',
+    :testdefines => ['TEST', 'UNITY_SUPPORT_TEST_CASES', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :use_param_tests => true,
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-l",
+    :features => [ :parameterized ],
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "testRunnerGeneratorArgs",
+                 "^" + Regexp.escape('  test_LiteralsGoInATable(1, one)') + "$",
+                 "^" + Regexp.escape('  test_LiteralsGoInATable(2, say \hi\)') + "$",
+                 "^" + Regexp.escape('  test_LiteralsGoInATable(3, C:\\\\temp)') + "$",
+                 "^" + Regexp.escape('  test_ArraysGetWrappers(1, one)') + "$",
+                 "^" + Regexp.escape('  test_ArraysGetWrappers(2, say \hi\)') + "$",
+                 "^" + Regexp.escape('  test_ArraysGetWrappers(3, C:\\\\temp)') + "$",
+                 "^" + Regexp.escape('  test_NonLiteralsGetWrappers(ARGUMENT_TWO)') + "$",
+                 "^" + Regexp.escape('  test_NonLiteralsGetWrappers(twice(2))') + "$",
+                 "^" + Regexp.escape('  test_FunctionPointersGetWrappers(NULL)') + "$",
+               ],
+    }
+  },
+
+  { :name => 'AllocSweepsKeepTheirLineNumbers',
+    :testfile => 'testdata/testRunnerGeneratorSweep.c',
+    :testdefines => ['TEST'],
+    :expected => {
+      :to_pass => [ 'testRunnerGeneratorSweep.c:28:test_SweepIsFound',
+                    'testRunnerGeneratorSweep.c:33:test_SpacedSweepIsFound',
+                  ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'FuzzTestsReplayTheirCorpus',
+    :testfile => 'testdata/testRunnerGeneratorFuzz.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_FUZZ', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--corpus testdata/fuzz",
+    :expected => {
+      :to_pass => [ 'test_ParsesEveryInput\[empty\]',
+                    'test_ParsesEveryInput\[hello\]',
+                    'test_PlainTestStillRuns',
+                  ],
+      :to_fail => [ 'test_ParsesEveryInput\[x_ray\]' ],
+      :to_ignore => [ 'test_CrashesOnBang' ],
+    }
+  },
+
+  { :name => 'FuzzInputsKeepTheirNamesInSlowestList',
+    :testfile => 'testdata/testRunnerGeneratorFuzz.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_FUZZ', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_EXEC_TIME'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--corpus testdata/fuzz -t 10 | grep -o ' line [0-9]* test_ParsesEveryInput\\[[a-z_]*\\] ' | sort -u | wc -l",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "^ *3$" ],
+    }
+  },
+
+  { :name => 'FuzzCorpusReplaysInJobs',
+    :testfile => 'testdata/testRunnerGeneratorFuzz.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_FUZZ', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--corpus testdata/fuzz --jobs 2",
+    :expected => {
+      :to_pass => [ 'test_ParsesEveryInput\[empty\]',
+                    'test_ParsesEveryInput\[hello\]',
+                    'test_PlainTestStillRuns',
+                  ],
+      :to_fail => [ 'test_ParsesEveryInput\[x_ray\]' ],
+      :to_ignore => [ 'test_CrashesOnBang' ],
+    }
+  },
+
+  { :name => 'FuzzJobsSendResultsToFileReporters',
+    :testfile => 'testdata/testRunnerGeneratorFuzz.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_FUZZ', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_FILE_REPORTERS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--corpus testdata/fuzz --jobs 2 --report-junit build/fuzz.xml --report-json=build/fuzz.jsonl",
+    :postprocess => read_reports('build/fuzz.xml', 'build/fuzz.jsonl',
+                                 [ /name="test_ParsesEveryInput\[x_ray\]" file="testdata\/testRunnerGeneratorFuzz.c" line="26"/,
+                                   /"event":"assert_fail","file":"testdata\/testRunnerGeneratorFuzz.c","test":"test_ParsesEveryInput\[x_ray\]","line":30/ ]),
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "^5$",
+                 "^5$",
+                 "^name=\"test_ParsesEveryInput\\[x_ray\\]\"",
+                 "^\"event\":\"assert_fail\"",
+               ],
+    }
+  },
+
+  { :name => 'FuzzInputThatCrashesAJobFails',
+    :testfile => 'testdata/testRunnerGeneratorFuzz.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_FUZZ', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--corpus testdata/fuzz_crash --jobs 2",
+    :expected => {
+      :to_pass => [ 'test_CrashesOnBang\[fine\]',
+                    'test_PlainTestStillRuns',
+                  ],
+      :to_fail => [ 'test_CrashesOnBang\[bang\]' ],
+      :to_ignore => [ 'test_ParsesEveryInput' ],
+    }
+  },
+
+  { :name => 'FuzzJobsGoOnAfterACrash',
+    :testfile => 'testdata/testRunnerGeneratorFuzz.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_FUZZ', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--corpus testdata/fuzz_crash_queue --jobs 2",
+    :expected => {
+      :to_pass => [ 'test_CrashesOnBang\[b_fine\]',
+                    'test_CrashesOnBang\[d_fine\]',
+                    'test_CrashesOnBang\[e_fine\]',
+                    'test_CrashesOnBang\[f_fine\]',
+                    'test_PlainTestStillRuns',
+                  ],
+      :to_fail => [ 'test_CrashesOnBang\[a_bang\]',
+                    'test_CrashesOnBang\[c_bang\]',
+                  ],
+      :to_ignore => [ 'test_ParsesEveryInput' ],
+    }
+  },
+
+  { :name => 'FuzzEntryWithOneTargetBuildsWithWarnings',
+    :testfile => 'testdata/testRunnerGeneratorFuzzEntry.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_FUZZ', 'UNITY_FUZZ_ENTRY'],
+    :options => nil,
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "^Both inputs were run$" ],
+    }
+  },
+
+  { :name => 'ExecTimeReportsEveryPhase',
+    :testfile => 'testdata/testRunnerGeneratorTime.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_EXEC_TIME', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-v -t 2",
+    :expected => {
+      :to_pass => [ 'test_Quick', 'test_Slow' ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "test_Quick:PASS \\([0-9]+\\.[0-9]{6} ms\\) \\(setUp [2-9]\\.[0-9]{6} ms, body [0-9]+\\.[0-9]{6} ms, tearDown [0-9]+\\.[0-9]{6} ms\\)$",
+                 "test_Slow:PASS \\([0-9]+\\.[0-9]{6} ms\\) \\(setUp [2-9]\\.[0-9]{6} ms, body [2-9][0-9]\\.[0-9]{6} ms, tearDown [0-9]+\\.[0-9]{6} ms\\)$",
+                 "^Total time [0-9]+\\.[0-9]{6} ms \\(setUp [4-9]\\.[0-9]{6} ms, body [2-9][0-9]\\.[0-9]{6} ms, tearDown [0-9]+\\.[0-9]{6} ms\\), fixture overhead [0-9]+\\.[0-9]%$",
+                 "^Slowest tests$",
+                 "^  testdata/testRunnerGeneratorTime\\.c line [0-9]+ test_Slow [2-9][0-9]\\.[0-9]{6} ms \\(setUp ",
+                 "^  testdata/testRunnerGeneratorTime\\.c line [0-9]+ test_Quick [0-9]\\.[0-9]{6} ms \\(setUp ",
+                 "^-+$",
+                 "^2 Tests 0 Failures 0 Ignored",
+                 "^OK$",
+               ],
+    }
+  },
+
+  { :name => 'FuzzTestsAreListedOnce',
+    :testfile => 'testdata/testRunnerGeneratorFuzz.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_FUZZ', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-l",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "testRunnerGeneratorFuzz",
+                 "^  test_ParsesEveryInput\\[\\.\\.\\.\\]$",
+                 "^  test_CrashesOnBang\\[\\.\\.\\.\\]$",
+                 "^  test_PlainTestStillRuns$",
+               ],
+    }
+  },
+
+  { :name => 'VerbositySilentSkipsPasses',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-s",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+      :text => [ "test_ThisTestAlwaysFails:FAIL",
+                 "test_ThisTestAlwaysIgnored:IGNORE",
+                 "^-+$",
+                 "10 Tests 1 Failures 1 Ignored",
+                 "^FAIL$",
+               ],
+    }
+  },
+
+  { :name => 'VerbosityQuietPrintsDots',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-q",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+      :text => [ "^\\.$",
+                 "^testdata/testRunnerGenerator.c:\\d+:test_ThisTestAlwaysFails:FAIL",
+                 "^testdata/testRunnerGenerator.c:\\d+:test_ThisTestAlwaysIgnored:IGNORE",
+                 "^\\.{7}$",
+                 "^-+$",
+                 "10 Tests 1 Failures 1 Ignored",
+                 "^FAIL$",
+               ],
+    }
+  },
+
+  { :name => 'VerbosityVerboseAddsPhaseTimes',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_INCLUDE_EXEC_TIME', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-v | grep -c 'PASS (.*) (setUp .*, body .*, tearDown .*)$'",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "^8$" ],
+    }
+  },
+
+  { :name => 'BinaryOutputDecodesToText',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_OUTPUT_BINARY', 'UNITY_INCLUDE_EXEC_TIME'],
+    :options => nil, #defaults
+    :postprocess => decode_binary,
+    :expected => {
+      :to_pass => [ 'testRunnerGenerator.c:\\d+:test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                  ],
+      :to_fail => [ 'testRunnerGenerator.c:\\d+:test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'TokenizedOutputDecodesToText',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_OUTPUT_TOKENIZED'],
+    :options => nil, #defaults
+    :postprocess => decode_tokenized([ 'testdata/testRunnerGenerator.c',
+                                       OUT_FILE + 'TokenizedOutputDecodesToText_runner.c',
+                                       '../src/unity.c' ]),
+    :expected => {
+      :to_pass => [ 'testRunnerGenerator.c:\\d+:test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                  ],
+      :to_fail => [ 'testRunnerGenerator.c:\\d+:test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'TokenizedNamesFromSeveralFunctions',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_OUTPUT_TOKENIZED', 'USE_GROUPED_MAIN'],
+    :options => {
+      :main_name => "custom_main",
+    },
+    :postprocess => decode_tokenized([ 'testdata/testRunnerGenerator.c', '../src/unity.c' ],
+                                     [ 'testdata/testRunnerGenerator.c' ]),
+    :expected => {
+      :to_pass => [ 'testRunnerGenerator.c:\\d+:test_ThisTestAlwaysPasses',
+                    'testRunnerGenerator.c:\\d+:spec_ThisTestPassesWhenNormalSetupRan',
+                  ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'FileReportersWriteJUnitAndJson',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_FILE_REPORTERS', 'UNITY_INCLUDE_EXEC_TIME'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--report-junit build/report.xml --report-json=build/report.jsonl",
+    :postprocess => read_reports('build/report.xml', 'build/report.jsonl',
+                                 [ /tests="\d+" failures="\d+" skipped="\d+"/,
+                                   /<failure .*<\/failure>/,
+                                   /<skipped .*\/>/,
+                                   /"test":"test_ThisTestAlwaysFails",.*"message":"[^"]*"/ ]),
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [
+        '^10$',
+        '^10$',
+        '^tests="10" failures="1" skipped="1"$',
+        '^<failure message="This Test Should Fail" type="ASSERT">testdata/testRunnerGenerator.c:72</failure>$',
+        '^<skipped message="This Test Should Be Ignored"/>$',
+        '^"test":"test_ThisTestAlwaysFails","line":72,"message":"This Test Should Fail"$',
+      ],
+    }
+  },
+
   { :name => 'DefaultsThroughCommandLine',
     :testfile => 'testdata/testRunnerGenerator.c',
     :testdefines => ['TEST'],
@@ -1219,9 +1792,12 @@ RUNNER_TESTS = [
         "-f NAME   Filter to run only tests whose name includes NAME",
         "-n NAME   Run only the test named NAME",
         "-h        show this Help menu",
-        "-q        Quiet/decrease verbosity",
-        "-v        increase Verbosity",
+        "-q        Quiet: a dot for each passing test",
+        "-s        Silent: only failures and ignores are printed",
+        "-t NUM    report the NUM slowest Tests when timing",
+        "-v        Verbose: phase times and details on PASS lines",
         "-x NAME   eXclude tests whose name includes NAME",
+        "--seed NUM  seed for tests that draw random inputs",
       ],
     }
   },
@@ -1243,15 +1819,18 @@ RUNNER_TESTS = [
         "-f NAME   Filter to run only tests whose name includes NAME",
         "-n NAME   Run only the test named NAME",
         "-h        show this Help menu",
-        "-q        Quiet/decrease verbosity",
-        "-v        increase Verbosity",
+        "-q        Quiet: a dot for each passing test",
+        "-s        Silent: only failures and ignores are printed",
+        "-t NUM    report the NUM slowest Tests when timing",
+        "-v        Verbose: phase times and details on PASS lines",
         "-x NAME   eXclude tests whose name includes NAME",
+        "--seed NUM  seed for tests that draw random inputs",
       ],
     }
   },
 ]
 
-def runner_test(test, runner, expected, test_defines, cmdline_args, features)
+def runner_test(test, runner, expected, test_defines, cmdline_args, features, postprocess)
   # Drop Out if we're skipping this type of test
   if $cfg[:skip_tests] && features
     if $cfg[:skip_tests].include?(:parameterized) && features.include?(:parameterized)
@@ -1272,7 +1851,8 @@ def runner_test(test, runner, expected, test_defines, cmdline_args, features)
   link_it(test_base, obj_list)
 
   # Execute unit test and generate results file
-  output = runtest(test_base, true, cmdline_args)
+  output = runtest(test_base, true, cmdline_args, !postprocess.nil?)
+  output = postprocess.call(output) if postprocess
 
   #compare to the expected pass/fail
   allgood = expected[:to_pass].inject(true)      {|s,v| s && verify_match(/#{v}:PASS/,   output) }
@@ -1303,6 +1883,15 @@ def verify_match(expression, output)
   end
 end
 
+def verify_no_match(expression, output)
+  if (expression =~ output)
+    report "  FAIL: Unexpected Match For /#{expression.to_s}/"
+    return false
+  else
+    return true
+  end
+end
+
 def verify_number(expected, expression, output)
   exp = expected.length
   act = output.scan(expression).length
@@ -1335,8 +1924,13 @@ RUNNER_TESTS.each do |testset|
       UnityTestRunnerGenerator.new(testset[:options]).run(testset[:testfile], runner_name)
     end
 
+    #check which code the script generated, where that matters
+    runner_text = File.read(runner_name)
+    allgood = (testset[:runner_has] || []).inject(true) {|s,v| s && verify_match(/#{v}/, runner_text) }
+    allgood = (testset[:runner_lacks] || []).inject(allgood) {|s,v| s && verify_no_match(/#{v}/, runner_text) }
+
     #test the script against the specified test file and check results
-    if (runner_test(testset[:testfile], runner_name, testset[:expected], testset[:testdefines], testset[:cmdline_args], testset[:features]))
+    if (allgood && runner_test(testset[:testfile], runner_name, testset[:expected], testset[:testdefines], testset[:cmdline_args], testset[:features], testset[:postprocess]))
       report "#{testset_name}:PASS"
     else
       report "#{testset_name}:FAIL"
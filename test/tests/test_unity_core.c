@@ -70,6 +70,12 @@ struct {
 #ifdef UNITY_INCLUDE_EXEC_TIME
     UNITY_TIME_TYPE CurrentTestStartTime;
     UNITY_TIME_TYPE CurrentTestStopTime;
+#ifdef UNITY_EXEC_TIME_BUILTIN
+    UNITY_TIME_TYPE CurrentPhaseStartTime;
+    UNITY_TIME_TYPE CurrentTestPhaseTime[UNITY_EXEC_PHASE_COUNT];
+    UNITY_TIME_TYPE TotalPhaseTime[UNITY_EXEC_PHASE_COUNT];
+    UNITY_COUNTER_TYPE CurrentTestPhase;
+#endif
 #endif
 #ifndef UNITY_EXCLUDE_SETJMP_H
     jmp_buf AbortFrame;
@@ -368,3 +374,118 @@ void testThatDetailsCanBeHandleSingleDetailClearingTwoDetails(void)
     VERIFY_FAILS_END
 #endif
 }
+
+/* ===================== REPORTERS ================== */
+
+static UNITY_FAILURE_T ReportedFailure;
+static UNITY_TEST_RESULT_T ReportedResult;
+static int ReportedFailures;
+
+static void SpyAssertFail(const UNITY_FAILURE_T* failure)
+{
+    ReportedFailure = *failure;
+    ReportedFailures++;
+}
+
+static void SpyTestEnd(const UNITY_TEST_RESULT_T* result)
+{
+    ReportedResult = *result;
+}
+
+static const struct UNITY_REPORTER_T SpyReporter = { NULL, NULL, NULL, SpyAssertFail, SpyTestEnd, NULL };
+
+void testReporterGetsFailedValuesAndMessage(void)
+{
+    ReportedFailures = 0;
+    TEST_ASSERT_EQUAL(0, UnityAddReporter(&SpyReporter));
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT_MESSAGE(5, 6, "Spied");
+    VERIFY_FAILS_END
+    UnityRemoveReporter(&SpyReporter);
+
+    TEST_ASSERT_EQUAL(1, ReportedFailures);
+    TEST_ASSERT_EQUAL_STRING(Unity.CurrentTestName, ReportedFailure.TestName);
+    TEST_ASSERT_EQUAL_STRING("Spied", ReportedFailure.Message);
+    TEST_ASSERT_EQUAL(UNITY_FAILURE_HAS_VALUES, ReportedFailure.Flags);
+    TEST_ASSERT_EQUAL(5, ReportedFailure.Expected);
+    TEST_ASSERT_EQUAL(6, ReportedFailure.Actual);
+    TEST_ASSERT_EQUAL(UNITY_DISPLAY_STYLE_INT, ReportedFailure.Style);
+}
+
+void testReporterGetsFailedArrayIndex(void)
+{
+    int expected[] = { 1, 2, 3 };
+    int actual[] = { 1, 2, 4 };
+
+    ReportedFailures = 0;
+    UnityAddReporter(&SpyReporter);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, actual, 3);
+    VERIFY_FAILS_END
+    UnityRemoveReporter(&SpyReporter);
+
+    TEST_ASSERT_EQUAL(1, ReportedFailures);
+    TEST_ASSERT_NULL(ReportedFailure.Message);
+    TEST_ASSERT_EQUAL(UNITY_FAILURE_HAS_VALUES | UNITY_FAILURE_HAS_INDEX, ReportedFailure.Flags);
+    TEST_ASSERT_EQUAL(2, ReportedFailure.Index);
+    TEST_ASSERT_EQUAL(3, ReportedFailure.Expected);
+    TEST_ASSERT_EQUAL(4, ReportedFailure.Actual);
+}
+
+void testReporterGetsPlainFailureWithoutValues(void)
+{
+    ReportedFailures = 0;
+    UnityAddReporter(&SpyReporter);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_STRING("MEH", "GUH");
+    VERIFY_FAILS_END
+    UnityRemoveReporter(&SpyReporter);
+
+    TEST_ASSERT_EQUAL(1, ReportedFailures);
+    TEST_ASSERT_EQUAL(0, ReportedFailure.Flags);
+}
+
+void testReporterGetsIgnoredTestEnd(void)
+{
+    UnityAddReporter(&SpyReporter);
+
+    EXPECT_ABORT_BEGIN
+    TEST_IGNORE_MESSAGE("Not today");
+    VERIFY_IGNORES_END
+    Unity.CurrentTestIgnored = 1;
+    UnityReportTestEnd();
+    Unity.CurrentTestIgnored = 0;
+    UnityRemoveReporter(&SpyReporter);
+
+    TEST_ASSERT_EQUAL(UNITY_RESULT_IGNORE, ReportedResult.Result);
+    TEST_ASSERT_EQUAL_STRING("Not today", ReportedResult.Message);
+    TEST_ASSERT_EQUAL_STRING(Unity.CurrentTestName, ReportedResult.TestName);
+}
+
+void testReportersAreLimitedAndCanBeRemoved(void)
+{
+    static const struct UNITY_REPORTER_T others[UNITY_MAX_REPORTERS];
+    int i;
+    int added = 0;
+
+    for (i = 0; i < UNITY_MAX_REPORTERS; i++)
+    {
+        if (UnityAddReporter(&others[i]) == 0)
+        {
+            added++;
+        }
+    }
+    for (i = 0; i < UNITY_MAX_REPORTERS; i++)
+    {
+        UnityRemoveReporter(&others[i]);
+    }
+
+    /* The built-in reporter takes one place */
+    TEST_ASSERT_EQUAL(UNITY_MAX_REPORTERS - 1, added);
+    TEST_ASSERT_EQUAL(1, UnityAddReporter(NULL));
+    TEST_ASSERT_EQUAL(0, UnityAddReporter(&SpyReporter));
+    UnityRemoveReporter(&SpyReporter);
+}
@@ -307,3 +307,78 @@ void test_EnumCharAndArrayMatrices(test_enum_t e, float n, char c)
     }
   }
 }
+
+static unsigned PairwiseCases;
+static unsigned PairwiseSeen[6][3][3];
+
+TEST_MATRIX_PAIRWISE([0, 1, 2], [0, 1, 2], [0, 1, 2], [0, 1, 2])
+void test_PairwiseMatrix(unsigned a, unsigned b, unsigned c, unsigned d)
+{
+  PairwiseSeen[0][a][b]++;
+  PairwiseSeen[1][a][c]++;
+  PairwiseSeen[2][a][d]++;
+  PairwiseSeen[3][b][c]++;
+  PairwiseSeen[4][b][d]++;
+  PairwiseSeen[5][c][d]++;
+  PairwiseCases++;
+}
+
+void test_PairwiseMatrixCoversEveryPairWithFewerCases(void)
+{
+  unsigned pair, x, y;
+
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT(9, PairwiseCases);
+  TEST_ASSERT_LESS_THAN_UINT(81, PairwiseCases);
+  for (pair = 0; pair < 6; pair++)
+  {
+    for (x = 0; x < 3; x++)
+    {
+      for (y = 0; y < 3; y++)
+      {
+        TEST_ASSERT_NOT_EQUAL_UINT(0, PairwiseSeen[pair][x][y]);
+      }
+    }
+  }
+}
+
+static unsigned ValuesFromSquaresSeen;
+static unsigned ValuesFromWordsSeen;
+
+int squaresUpTo100(unsigned int index, unsigned int* value)
+{
+  if (index > 10)
+    return 0;
+  *value = index * index;
+  return 1;
+}
+
+TEST_VALUES_FROM(squaresUpTo100)
+void test_ValuesFromSource(unsigned int square)
+{
+  TEST_ASSERT_EQUAL_UINT(ValuesFromSquaresSeen * ValuesFromSquaresSeen, square);
+  ValuesFromSquaresSeen++;
+}
+
+int someWords(unsigned int index, const char** value)
+{
+  static const char* words[] = { "alpha", "beta", "gamma" };
+  if (index >= sizeof(words) / sizeof(words[0]))
+    return 0;
+  *value = words[index];
+  return 1;
+}
+
+TEST_VALUES_FROM(someWords)
+void test_ValuesFromSourceArePointers(const char* word)
+{
+  static const char firstLetters[] = "abg";
+  TEST_ASSERT_NOT_NULL(word);
+  TEST_ASSERT_EQUAL_CHAR(firstLetters[ValuesFromWordsSeen], word[0]);
+  ValuesFromWordsSeen++;
+}
+
+void test_ValuesFromSourceRanEveryValue(void)
+{
+  TEST_ASSERT_EQUAL_UINT(11, ValuesFromSquaresSeen);
+  TEST_ASSERT_EQUAL_UINT(3, ValuesFromWordsSeen);
+}